@@ -0,0 +1,90 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares the heap (allocator::Dynamic) with the static pool
+// (allocator::Static) for a message queue as used by the dispatcher:
+// messages are appended at the end and removed from the front, the queue
+// holds between 8 and 24 entries.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/doubly_linked_list.hpp>
+
+#include <chrono>
+
+static constexpr uint32_t Operations = 1000000;
+static constexpr std::size_t PoolSize = 32;
+
+struct Message
+{
+	uint16_t identifier;
+	uint8_t payload[12];
+};
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Operations;
+}
+
+template< typename List >
+static void
+queue(List& list)
+{
+	Message message = {};
+	for (uint8_t i = 0; i < 8; ++i) {
+		list.append(message);
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		// let the queue grow and shrink between 8 and 24 entries
+		if ((i / 16) % 2 == 0) {
+			message.identifier = i;
+			list.append(message);
+		}
+		else {
+			list.removeFront();
+		}
+	}
+	while (!list.isEmpty()) {
+		list.removeFront();
+	}
+}
+
+int
+main()
+{
+	typedef xpcc::allocator::Static<Message, PoolSize> Pool;
+
+	xpcc::LinkedList<Message> dynamicList;
+	xpcc::LinkedList<Message, Pool> staticList;
+	xpcc::DoublyLinkedList<Message> dynamicDoublyList;
+	xpcc::DoublyLinkedList<Message, Pool> staticDoublyList;
+
+	float dynamicTime = measure([&]() { queue(dynamicList); });
+	float staticTime = measure([&]() { queue(staticList); });
+	float dynamicDoublyTime = measure([&]() { queue(dynamicDoublyList); });
+	float staticDoublyTime = measure([&]() { queue(staticDoublyList); });
+
+	XPCC_LOG_INFO << "LinkedList, Dynamic       : " << dynamicTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "LinkedList, Static        : " << staticTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "DoublyLinkedList, Dynamic : " << dynamicDoublyTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "DoublyLinkedList, Static  : " << staticDoublyTime << " ns" << xpcc::endl;
+
+	const auto& pool = staticList.getAllocator();
+	XPCC_LOG_INFO << "pool peak   : " << pool.getPeak() << " of " << pool.getCapacity() << xpcc::endl;
+	XPCC_LOG_INFO << "pool failed : " << pool.getFailed() << xpcc::endl;
+	return 0;
+}
@@ -0,0 +1,233 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Speed and size of a sensor readout implemented with the switch based
+// resumable functions and with C++20 coroutines (xpcc::Coroutine).
+//
+// The readout pings the sensor and reads three registers, every bus
+// transfer is nested one level deeper and takes a few polls of a simulated
+// I2C master to complete. The step is one call of the readout (RF_CALL
+// semantic for the resumable functions, resume() for the coroutines).
+//
+// Needs C++20, which is selected with `cxxstd` in the project.cfg.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/processing/resumable.hpp>
+#include <xpcc/processing/resumable/coroutine.hpp>
+
+#include <chrono>
+
+static constexpr uint32_t Readouts = 200000;
+
+/// Simulated I2C master, a transfer completes after some polls
+struct Bus
+{
+	uint8_t remaining = 0;
+	uint8_t registers[4] = { 0x60, 10, 20, 30 };
+
+	inline void
+	start()
+	{
+		remaining = 3;
+	}
+
+	inline bool
+	isBusy()
+	{
+		if (remaining == 0) {
+			return false;
+		}
+		remaining--;
+		return true;
+	}
+};
+
+static Bus bus;
+
+class ResumableSensor : public xpcc::NestedResumable<3>
+{
+public:
+	xpcc::ResumableResult<uint8_t>
+	transfer(uint8_t reg)
+	{
+		RF_BEGIN();
+		bus.start();
+		RF_WAIT_WHILE(bus.isBusy());
+		RF_END_RETURN(bus.registers[reg]);
+	}
+
+	xpcc::ResumableResult<bool>
+	ping()
+	{
+		RF_BEGIN();
+		id = RF_CALL(transfer(0));
+		RF_END_RETURN(id == 0x60);
+	}
+
+	xpcc::ResumableResult<uint16_t>
+	readout()
+	{
+		RF_BEGIN();
+		sum = 0;
+		if (!RF_CALL(ping())) {
+			RF_RETURN(0);
+		}
+		for (index = 1; index < 4; index++) {
+			sum += RF_CALL(transfer(index));
+		}
+		RF_END_RETURN(sum);
+	}
+
+private:
+	// member variables, locals are lost across a yield
+	uint16_t sum;
+	uint8_t index;
+	uint8_t id;
+};
+
+template< typename Frames >
+class CoroutineSensor
+{
+public:
+	xpcc::Coroutine<uint8_t, Frames>
+	transfer(uint8_t reg)
+	{
+		bus.start();
+		co_await xpcc::co::waitUntil([]() { return !bus.isBusy(); });
+		co_return bus.registers[reg];
+	}
+
+	xpcc::Coroutine<bool, Frames>
+	ping()
+	{
+		co_return (co_await transfer(0) == 0x60);
+	}
+
+	xpcc::Coroutine<uint16_t, Frames>
+	readout()
+	{
+		uint16_t sum = 0;
+		if (!co_await ping()) {
+			co_return 0;
+		}
+		for (uint8_t index = 1; index < 4; index++) {
+			sum += co_await transfer(index);
+		}
+		co_return sum;
+	}
+};
+
+/// Coroutine readout, which calls the unchanged resumable driver
+class MixedSensor
+{
+public:
+	xpcc::Coroutine<uint16_t>
+	readout()
+	{
+		uint16_t sum = 0;
+		if (!XPCC_CO_CALL(driver.ping())) {
+			co_return 0;
+		}
+		for (uint8_t index = 1; index < 4; index++) {
+			sum += XPCC_CO_CALL(driver.transfer(index));
+		}
+		co_return sum;
+	}
+
+	ResumableSensor driver;
+};
+
+typedef xpcc::co::StaticFrames<16, 64> Pool;
+
+static uint32_t steps;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	steps = 0;
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / steps;
+}
+
+template< typename Step >
+static uint32_t
+runReadouts(Step step)
+{
+	uint32_t checksum = 0;
+	for (uint32_t i = 0; i < Readouts; ++i)
+	{
+		xpcc::ResumableResult<uint16_t> result(xpcc::rf::Running);
+		do {
+			result = step(i);
+			steps++;
+		}
+		while (result.getState() > xpcc::rf::NestingError);
+		checksum += result.getResult();
+	}
+	return checksum;
+}
+
+int
+main()
+{
+	uint32_t checksum = 0;
+
+	ResumableSensor resumable;
+	const float resumableTime = measure([&]() {
+		checksum += runReadouts([&](uint32_t) { return resumable.readout(); });
+	});
+
+	// a new coroutine for every readout, resumed until it has finished
+	CoroutineSensor<xpcc::co::HeapFrames> heap;
+	xpcc::Coroutine<uint16_t> heapReadout;
+	const float heapTime = measure([&]() {
+		checksum += runReadouts([&](uint32_t) {
+			if (!heapReadout.isValid() || heapReadout.isFinished()) {
+				heapReadout = heap.readout();
+			}
+			return heapReadout.resume();
+		});
+	});
+
+	CoroutineSensor<Pool> pool;
+	xpcc::Coroutine<uint16_t, Pool> poolReadout;
+	const float poolTime = measure([&]() {
+		checksum += runReadouts([&](uint32_t) {
+			if (!poolReadout.isValid() || poolReadout.isFinished()) {
+				poolReadout = pool.readout();
+			}
+			return poolReadout.resume();
+		});
+	});
+
+	MixedSensor mixed;
+	xpcc::co::ResumableAdapter<uint16_t> adapter;
+	const float mixedTime = measure([&]() {
+		checksum += runReadouts([&](uint32_t) {
+			return adapter.run([&]() { return mixed.readout(); });
+		});
+	});
+
+	XPCC_LOG_INFO << "time per step of a readout (checksum " << checksum << ")" << xpcc::endl;
+	XPCC_LOG_INFO << "  NestedResumable:            " << resumableTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "  Coroutine, HeapFrames:      " << heapTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "  Coroutine, StaticFrames:    " << poolTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "  Coroutine calling RF_CALL:  " << mixedTime << " ns" << xpcc::endl;
+
+	XPCC_LOG_INFO << "memory" << xpcc::endl;
+	XPCC_LOG_INFO << "  sizeof(ResumableSensor):    " << sizeof(ResumableSensor) << xpcc::endl;
+	XPCC_LOG_INFO << "  sizeof(Coroutine):          " << sizeof(heapReadout) << xpcc::endl;
+	XPCC_LOG_INFO << "  sizeof(ResumableAdapter):   " << sizeof(adapter) << xpcc::endl;
+	XPCC_LOG_INFO << "  frames of a readout (peak): " << Pool::getPeak() << " bytes" << xpcc::endl;
+	return 0;
+}
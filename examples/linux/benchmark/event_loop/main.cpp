@@ -0,0 +1,151 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Cost of one pass of the main loop depending on the number of idle
+// protothreads. Every protothread waits for its own flag, which is set for
+// one of them every 100 passes (like a rare interrupt). One more protothread
+// is busy and runs on every pass.
+//
+// The super-loop runs every protothread, which re-checks its condition. The
+// xpcc::pt::EventLoop only runs the busy protothread and the signaled one.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/processing/protothread.hpp>
+
+#include <chrono>
+#include <vector>
+
+static constexpr uint32_t Passes = 100000;
+
+class Sensor : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+{
+public:
+	Sensor() :
+		flag(false), samples(0)
+	{
+	}
+
+	bool
+	run()
+	{
+		PT_BEGIN();
+		while (true)
+		{
+			PT_WAIT_EVENT_UNTIL(event, flag);
+			flag = false;
+			samples++;
+		}
+		PT_END();
+	}
+
+	inline void
+	trigger()
+	{
+		flag = true;
+		event.signal();
+	}
+
+	xpcc::pt::Event event;
+	bool flag;
+	uint32_t samples;
+};
+
+class Controller : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+{
+public:
+	Controller() :
+		updates(0)
+	{
+	}
+
+	bool
+	run()
+	{
+		PT_BEGIN();
+		while (true)
+		{
+			updates++;
+			PT_YIELD();
+		}
+		PT_END();
+	}
+
+	uint32_t updates;
+};
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Passes;
+}
+
+static void
+runSuperLoop(std::vector<Sensor>& sensors, Controller& controller)
+{
+	for (uint32_t pass = 0; pass < Passes; ++pass)
+	{
+		if (pass % 100 == 0) {
+			sensors[(pass / 100) % sensors.size()].trigger();
+		}
+
+		for (Sensor& sensor : sensors) {
+			sensor.run();
+		}
+		controller.run();
+	}
+}
+
+static void
+runEventLoop(std::vector<Sensor>& sensors, Controller& controller)
+{
+	xpcc::pt::EventLoop loop;
+	for (Sensor& sensor : sensors) {
+		loop.add(sensor);
+	}
+	loop.add(controller);
+
+	for (uint32_t pass = 0; pass < Passes; ++pass)
+	{
+		if (pass % 100 == 0) {
+			sensors[(pass / 100) % sensors.size()].trigger();
+		}
+		loop.update();
+	}
+
+	for (Sensor& sensor : sensors) {
+		loop.remove(sensor);
+	}
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << "time per pass of the main loop" << xpcc::endl;
+
+	static const uint16_t counts[] = { 10, 50, 100, 500, 1000 };
+	for (uint16_t count : counts)
+	{
+		std::vector<Sensor> sensors(count);
+		Controller controller;
+		const float superLoop = measure([&]() { runSuperLoop(sensors, controller); });
+
+		std::vector<Sensor> sensors2(count);
+		Controller controller2;
+		const float eventLoop = measure([&]() { runEventLoop(sensors2, controller2); });
+
+		XPCC_LOG_INFO << count << " idle protothreads: super-loop " << superLoop
+					  << " ns, EventLoop " << eventLoop << " ns" << xpcc::endl;
+	}
+	return 0;
+}
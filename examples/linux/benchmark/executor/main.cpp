@@ -0,0 +1,213 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// 200 robot components, each doing a short update step repeatedly. Compares
+// one std::thread per component (like one rtos::Thread each) with the
+// xpcc::rtos::Executor on 1 to N worker threads, where N is the number of
+// cores (at least 4).
+//
+// The second part passes items from producer to consumer threads through
+// xpcc::rtos::Queue and through a std::deque protected by a mutex.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/processing/rtos.hpp>
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+static constexpr uint32_t Components = 200;
+static constexpr uint32_t Steps = 2000;
+
+// a few hundred nanoseconds of work, e.g. a controller update
+static inline uint32_t
+update(uint32_t state)
+{
+	for (uint32_t i = 0; i < 100; ++i) {
+		state = state * 1664525 + 1013904223;
+	}
+	return state;
+}
+
+class Component : public xpcc::rtos::Executor::Task
+{
+public:
+	Component() :
+		state(0), steps(0)
+	{
+	}
+
+	virtual bool
+	run()
+	{
+		state = update(state);
+		return (++steps < Steps);
+	}
+
+	uint32_t state;
+	uint32_t steps;
+};
+
+static Component components[Components];
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	for (Component& component : components)
+	{
+		component.state = 0;
+		component.steps = 0;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / (Components * Steps);
+}
+
+// ----------------------------------------------------------------------------
+static void
+runThreads()
+{
+	std::vector<std::thread> threads;
+	for (Component& component : components)
+	{
+		threads.emplace_back([&component]()
+		{
+			while (component.run()) {
+				// give the other components a chance, like a
+				// cooperative rtos::Thread
+				std::this_thread::yield();
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+static uint64_t steals;
+
+static void
+runExecutor(std::size_t workers)
+{
+	xpcc::rtos::Executor executor(workers);
+	for (Component& component : components) {
+		executor.submit(component);
+	}
+	executor.wait();
+	steals = executor.getStealCount();
+}
+
+// ----------------------------------------------------------------------------
+static constexpr uint32_t Items = 200000;
+static constexpr uint32_t Producers = 2;
+static constexpr uint32_t Consumers = 2;
+
+class LockedQueue
+{
+public:
+	LockedQueue(std::size_t length) :
+		length(length)
+	{
+	}
+
+	void
+	append(uint32_t item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		changed.wait(lock, [this]() { return (items.size() < length); });
+		items.push_back(item);
+		changed.notify_all();
+	}
+
+	void
+	get(uint32_t& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		changed.wait(lock, [this]() { return !items.empty(); });
+		item = items.front();
+		items.pop_front();
+		changed.notify_all();
+	}
+
+private:
+	std::size_t length;
+	std::deque<uint32_t> items;
+	std::mutex mutex;
+	std::condition_variable changed;
+};
+
+template< typename Queue >
+static float
+measureQueue(Queue& queue)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (uint32_t p = 0; p < Producers; ++p)
+	{
+		threads.emplace_back([&queue]()
+		{
+			for (uint32_t i = 0; i < Items / Producers; ++i) {
+				queue.append(i);
+			}
+		});
+	}
+	for (uint32_t c = 0; c < Consumers; ++c)
+	{
+		threads.emplace_back([&queue]()
+		{
+			uint32_t item;
+			for (uint32_t i = 0; i < Items / Consumers; ++i) {
+				queue.get(item);
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Items;
+}
+
+// ----------------------------------------------------------------------------
+int
+main()
+{
+	const std::size_t cores = std::thread::hardware_concurrency();
+	XPCC_LOG_INFO << Components << " components, " << Steps << " steps each, "
+				  << cores << " cores, time per step" << xpcc::endl;
+
+	XPCC_LOG_INFO << "std::thread per component : " << measure(runThreads) << " ns" << xpcc::endl;
+	for (std::size_t workers = 1; workers <= std::max<std::size_t>(cores, 4); workers *= 2)
+	{
+		XPCC_LOG_INFO << "Executor, " << workers << " workers        : "
+					  << measure([workers]() { runExecutor(workers); }) << " ns, "
+					  << steals << " steals" << xpcc::endl;
+	}
+
+	XPCC_LOG_INFO << Producers << " producers, " << Consumers << " consumers, "
+				  << Items << " items, time per item" << xpcc::endl;
+	{
+		xpcc::rtos::Queue<uint32_t> queue(64);
+		XPCC_LOG_INFO << "rtos::Queue               : " << measureQueue(queue) << " ns" << xpcc::endl;
+	}
+	{
+		LockedQueue queue(64);
+		XPCC_LOG_INFO << "std::deque with mutex     : " << measureQueue(queue) << " ns" << xpcc::endl;
+	}
+	return 0;
+}
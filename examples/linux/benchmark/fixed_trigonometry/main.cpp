@@ -0,0 +1,172 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares the table and CORDIC based functions of FixedAngle with the
+// libm functions and the odometry update of Location2D with both.
+//
+// A PC has a fast FPU, so the speedup shown here is much smaller than on
+// controllers without one (AVR, Cortex-M0), where every libm call is
+// emulated in software. The error columns are valid for all targets.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/math/geometry.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+static constexpr std::size_t Count = 4096;
+static constexpr uint32_t Repetitions = 500;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < Repetitions; ++i) {
+		function();
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / (Repetitions * Count);
+}
+
+int
+main()
+{
+	static xpcc::FixedAngle angles[Count];
+	static float radians[Count];
+	static int16_t x[Count];
+	static int16_t y[Count];
+
+	std::srand(42);
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		angles[i] = xpcc::FixedAngle(static_cast<uint16_t>(std::rand()));
+		radians[i] = angles[i].toRadian();
+		x[i] = std::rand() % 20000 - 10000;
+		y[i] = std::rand() % 20000 - 10000;
+	}
+
+	volatile int32_t sink = 0;
+
+	// sine and cosine
+	float libmSinCos = measure([&]() {
+		float sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += std::sin(radians[i]) + std::cos(radians[i]);
+		}
+		sink = sum;
+	});
+	float fixedSinCos = measure([&]() {
+		int32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i)
+		{
+			int16_t s, c;
+			angles[i].sinCos(&s, &c);
+			sum += s + c;
+		}
+		sink = sum;
+	});
+
+	// angle of a vector
+	float libmAtan2 = measure([&]() {
+		float sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += std::atan2(float(y[i]), float(x[i]));
+		}
+		sink = sum;
+	});
+	float fixedAtan2 = measure([&]() {
+		int32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += xpcc::FixedAngle::atan2(y[i], x[i]).getRaw();
+		}
+		sink = sum;
+	});
+
+	// length of a vector
+	float libmHypot = measure([&]() {
+		float sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += std::sqrt(float(x[i]) * x[i] + float(y[i]) * y[i]);
+		}
+		sink = sum;
+	});
+	float fixedHypot = measure([&]() {
+		uint32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += xpcc::FixedAngle::hypot(x[i], y[i]);
+		}
+		sink = sum;
+	});
+
+	// odometry update
+	float libmMove = measure([&]() {
+		xpcc::Location2D<int16_t> location;
+		for (std::size_t i = 0; i < Count; ++i) {
+			location.move(x[i] & 0x0f, radians[i] * 0.01f);
+		}
+		sink = location.getX();
+	});
+	float fixedMove = measure([&]() {
+		xpcc::Location2D<int16_t> location;
+		for (std::size_t i = 0; i < Count; ++i) {
+			location.move(x[i] & 0x0f, xpcc::FixedAngle(angles[i].getSigned() / 100));
+		}
+		sink = location.getX();
+	});
+	(void) sink;
+
+	// maximum errors over all angles and a grid of vectors
+	double sineError = 0;
+	for (uint32_t raw = 0; raw < 65536; ++raw)
+	{
+		double error = std::fabs(xpcc::FixedAngle(raw).sin() -
+				32768.0 * std::sin(raw * (M_PI / 32768.0)));
+		if (error > sineError) {
+			sineError = error;
+		}
+	}
+
+	double atan2Error = 0;
+	double hypotError = 0;
+	for (int32_t vy = -1000; vy <= 1000; vy += 3)
+	{
+		for (int32_t vx = -1000; vx <= 1000; vx += 7)
+		{
+			double error = std::fabs(xpcc::FixedAngle::atan2(vy, vx).getSigned() -
+					std::atan2(vy, vx) * (32768.0 / M_PI));
+			if (error > 32768) {
+				error = 65536 - error;
+			}
+			if (error > atan2Error) {
+				atan2Error = error;
+			}
+
+			error = std::fabs(xpcc::FixedAngle::hypot(vx, vy) - std::hypot(vx, vy));
+			if (error > hypotError) {
+				hypotError = error;
+			}
+		}
+	}
+
+	XPCC_LOG_INFO << "sin + cos : libm " << libmSinCos << " ns, fixed "
+			<< fixedSinCos << " ns, max. error " << float(sineError)
+			<< " LSB (Q15)" << xpcc::endl;
+	XPCC_LOG_INFO << "atan2     : libm " << libmAtan2 << " ns, fixed "
+			<< fixedAtan2 << " ns, max. error " << float(atan2Error)
+			<< " LSB (2 Pi / 65536)" << xpcc::endl;
+	XPCC_LOG_INFO << "hypot     : libm " << libmHypot << " ns, fixed "
+			<< fixedHypot << " ns, max. error " << float(hypotError)
+			<< xpcc::endl;
+	XPCC_LOG_INFO << "odometry  : libm " << libmMove << " ns, fixed "
+			<< fixedMove << " ns per update" << xpcc::endl;
+	return 0;
+}
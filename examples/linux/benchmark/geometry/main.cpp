@@ -0,0 +1,124 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares the structure-of-arrays batch kernels of PointArray2D and
+// LineSegmentArray2D against looping over the single object methods of
+// Polygon2D, for float and int16_t coordinates.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/math/geometry.hpp>
+#include <xpcc/math/geometry/point_array_2d.hpp>
+#include <xpcc/math/geometry/line_segment_array_2d.hpp>
+
+#include <chrono>
+#include <cstdlib>
+
+static constexpr std::size_t Count = 4096;
+static constexpr uint32_t Repetitions = 200;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < Repetitions; ++i) {
+		function();
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / (Repetitions * Count);
+}
+
+template< typename T >
+static void
+run(const char* name)
+{
+	// field border with a few obstacles
+	xpcc::Polygon2D<T> field {
+		xpcc::Vector<T, 2>(-1500, -1000), xpcc::Vector<T, 2>(1500, -1000),
+		xpcc::Vector<T, 2>(1600, 0), xpcc::Vector<T, 2>(1500, 1000),
+		xpcc::Vector<T, 2>(-1500, 1000), xpcc::Vector<T, 2>(-1600, 0) };
+
+	static xpcc::LineSegmentArray2D<T, Count> segments;
+	static xpcc::PointArray2D<T, Count> points;
+	static xpcc::LineSegment2D<T> segmentList[Count];
+	static bool result[Count];
+
+	segments.removeAll();
+	points.removeAll();
+	std::srand(42);
+	for (std::size_t i = 0; i < Count; ++i)
+	{
+		xpcc::Vector<T, 2> start(std::rand() % 3600 - 1800, std::rand() % 2400 - 1200);
+		xpcc::Vector<T, 2> end(start.x + std::rand() % 400 - 200, start.y + std::rand() % 400 - 200);
+		segmentList[i] = xpcc::LineSegment2D<T>(start, end);
+		segments.append(segmentList[i]);
+		points.append(start);
+	}
+
+	volatile std::size_t sink = 0;
+
+	float scalarSegments = measure([&]() {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			count += field.intersects(segmentList[i]);
+		}
+		sink = count;
+	});
+	float batchSegments = measure([&]() {
+		sink = segments.intersects(field, result);
+	});
+
+	float scalarInside = measure([&]() {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			count += field.isInside(points[i]);
+		}
+		sink = count;
+	});
+	float batchInside = measure([&]() {
+		sink = points.isInside(field, result);
+	});
+
+	xpcc::Vector<T, 2> query(100, 200);
+	float scalarClosest = measure([&]() {
+		T best = 0;
+		std::size_t bestIndex = 0;
+		for (std::size_t i = 0; i < Count - 1; ++i)
+		{
+			xpcc::LineSegment2D<T> line(points[i], points[i + 1]);
+			T d = line.getDistanceTo(query);
+			if (i == 0 || d < best) {
+				best = d;
+				bestIndex = i;
+			}
+		}
+		sink = xpcc::LineSegment2D<T>(points[bestIndex], points[bestIndex + 1]).getClosestPointTo(query).x;
+	});
+	float batchClosest = measure([&]() {
+		sink = points.getClosestPolylinePointTo(query).x;
+	});
+	(void) sink;
+
+	XPCC_LOG_INFO << name << xpcc::endl;
+	XPCC_LOG_INFO << "  segments vs. polygon : scalar " << scalarSegments
+			<< " ns, batch " << batchSegments << " ns per segment" << xpcc::endl;
+	XPCC_LOG_INFO << "  points in polygon    : scalar " << scalarInside
+			<< " ns, batch " << batchInside << " ns per point" << xpcc::endl;
+	XPCC_LOG_INFO << "  closest on polyline  : scalar " << scalarClosest
+			<< " ns, batch " << batchClosest << " ns per vertex" << xpcc::endl;
+}
+
+int
+main()
+{
+	run<float>("float");
+	run<int16_t>("int16_t");
+	return 0;
+}
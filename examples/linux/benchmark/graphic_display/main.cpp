@@ -0,0 +1,199 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Fill and text throughput of a hosted 320x240 frame buffer, once drawn
+// pixel by pixel (the default implementation of the span primitives) and
+// once with the fast paths of the displays.
+//
+// The monochrome display is a xpcc::BufferedGraphicDisplay, the color display
+// a RGB565 frame buffer in memory, like the one of the STM32F469 Discovery.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/ui/display/buffered_graphic_display.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+static constexpr uint32_t Passes = 1000;
+
+static constexpr uint16_t Width = 320;
+static constexpr uint16_t Height = 240;
+
+class Monochrome : public xpcc::BufferedGraphicDisplay<Width, Height>
+{
+public:
+	Monochrome()
+	{
+		this->clear();
+	}
+
+	virtual void
+	update()
+	{
+	}
+};
+
+/// Uses the pixel by pixel default implementations of GraphicDisplay
+class MonochromePerPixel : public Monochrome
+{
+protected:
+	virtual void
+	fillSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		GraphicDisplay::fillSpan(x0, x1, y);
+	}
+
+	virtual void
+	clearSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		GraphicDisplay::clearSpan(x0, x1, y);
+	}
+
+	virtual void
+	fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+	{
+		GraphicDisplay::fillArea(x0, y0, x1, y1);
+	}
+};
+
+template< bool Spans >
+class Color : public xpcc::GraphicDisplay
+{
+public:
+	Color()
+	{
+		this->clear();
+	}
+
+	virtual uint16_t
+	getWidth() const
+	{
+		return Width;
+	}
+
+	virtual uint16_t
+	getHeight() const
+	{
+		return Height;
+	}
+
+	virtual void
+	clear()
+	{
+		std::fill(buffer, buffer + Width * Height, this->backgroundColor.getValue());
+	}
+
+	virtual void
+	update()
+	{
+	}
+
+protected:
+	virtual void
+	fillSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		if (Spans) {
+			std::fill(&buffer[y * Width + x0], &buffer[y * Width + x1 + 1],
+					this->foregroundColor.getValue());
+		}
+		else {
+			GraphicDisplay::fillSpan(x0, x1, y);
+		}
+	}
+
+	virtual void
+	clearSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		if (Spans) {
+			std::fill(&buffer[y * Width + x0], &buffer[y * Width + x1 + 1],
+					this->backgroundColor.getValue());
+		}
+		else {
+			GraphicDisplay::clearSpan(x0, x1, y);
+		}
+	}
+
+	virtual void
+	setPixel(int16_t x, int16_t y)
+	{
+		if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+			buffer[y * Width + x] = this->foregroundColor.getValue();
+		}
+	}
+
+	virtual void
+	clearPixel(int16_t x, int16_t y)
+	{
+		if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+			buffer[y * Width + x] = this->backgroundColor.getValue();
+		}
+	}
+
+	virtual bool
+	getPixel(int16_t x, int16_t y)
+	{
+		return (buffer[y * Width + x] != this->backgroundColor.getValue());
+	}
+
+	uint16_t buffer[Width * Height];
+};
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t pass = 0; pass < Passes; ++pass) {
+		function(pass);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::micro>(end - start).count() / Passes;
+}
+
+template< typename Display >
+static void
+run(const char* name)
+{
+	static Display display;
+
+	const float screen = measure([](uint32_t) {
+		display.fillRectangle(xpcc::glcd::Point(0, 0), Width, Height);
+	});
+
+	const float rectangles = measure([](uint32_t pass) {
+		for (uint16_t i = 0; i < 100; ++i) {
+			display.fillRectangle(xpcc::glcd::Point((pass + i * 7) % Width, (i * 13) % Height), 20, 20);
+		}
+	});
+
+	// rows not aligned to the pages of the monochrome display
+	const float text = measure([](uint32_t pass) {
+		display.clear();
+		for (int16_t y = 3; y < Height; y += 10) {
+			display.setCursor(pass % 4, y);
+			display << "The quick brown fox jumps over the lazy dog";
+		}
+	});
+
+	XPCC_LOG_INFO << name << ": screen " << screen << " us, 100 rectangles "
+				  << rectangles << " us, text screen " << text << " us" << xpcc::endl;
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << "time per operation on a " << Width << "x" << Height << " frame buffer" << xpcc::endl;
+
+	run< MonochromePerPixel >("monochrome per pixel");
+	run< Monochrome >("monochrome spans   ");
+	run< Color<false> >("RGB565 per pixel   ");
+	run< Color<true> >("RGB565 spans       ");
+	return 0;
+}
@@ -0,0 +1,224 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares xpcc::HashMap and xpcc::BoundedHashMap with std::unordered_map
+// and std::map for a routing table: 16 bit addresses mapped to a 32 bit
+// value. The table is filled, searched for existing and missing addresses
+// and emptied again. All times are per operation.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/container/hash_map.hpp>
+
+#include <chrono>
+#include <map>
+#include <unordered_map>
+
+static constexpr uint32_t Entries = 256;
+static constexpr uint32_t Rounds = 4000;
+static constexpr uint32_t Operations = Entries * Rounds;
+
+typedef xpcc::HashMap<uint16_t, uint32_t> Hash;
+typedef xpcc::BoundedHashMap<uint16_t, uint32_t, 512> Bounded;
+typedef std::unordered_map<uint16_t, uint32_t> Unordered;
+typedef std::map<uint16_t, uint32_t> Ordered;
+
+// prevents that the compiler removes the loops
+static volatile uint32_t sink;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Operations;
+}
+
+// addresses of the devices, spread over the whole range
+static inline uint16_t
+getAddress(uint32_t i)
+{
+	return static_cast<uint16_t>(i * 251 + 17);
+}
+
+// ----------------------------------------------------------------------------
+template< typename Map >
+static inline void
+add(Map& map, uint16_t key, uint32_t value)
+{
+	map.insert(key, value);
+}
+
+template< typename Map >
+static inline const uint32_t*
+lookup(const Map& map, uint16_t key)
+{
+	return map.get(key);
+}
+
+template< typename Map >
+static inline void
+erase(Map& map, uint16_t key)
+{
+	map.remove(key);
+}
+
+// std::unordered_map and std::map
+template< typename Map >
+static inline void
+addStd(Map& map, uint16_t key, uint32_t value)
+{
+	map.emplace(key, value);
+}
+
+template< typename Map >
+static inline const uint32_t*
+lookupStd(const Map& map, uint16_t key)
+{
+	auto it = map.find(key);
+	return (it == map.end()) ? nullptr : &it->second;
+}
+
+static inline void
+add(Unordered& map, uint16_t key, uint32_t value)
+{
+	addStd(map, key, value);
+}
+
+static inline const uint32_t*
+lookup(const Unordered& map, uint16_t key)
+{
+	return lookupStd(map, key);
+}
+
+static inline void
+erase(Unordered& map, uint16_t key)
+{
+	map.erase(key);
+}
+
+static inline void
+add(Ordered& map, uint16_t key, uint32_t value)
+{
+	addStd(map, key, value);
+}
+
+static inline const uint32_t*
+lookup(const Ordered& map, uint16_t key)
+{
+	return lookupStd(map, key);
+}
+
+static inline void
+erase(Ordered& map, uint16_t key)
+{
+	map.erase(key);
+}
+
+// ----------------------------------------------------------------------------
+template< typename Map >
+static void
+fill()
+{
+	uint32_t sum = 0;
+	for (uint32_t r = 0; r < Rounds; ++r)
+	{
+		Map map;
+		for (uint32_t i = 0; i < Entries; ++i) {
+			add(map, getAddress(i), i);
+		}
+		sum += *lookup(map, getAddress(r % Entries));
+	}
+	sink = sum;
+}
+
+template< typename Map >
+static void
+hit()
+{
+	Map map;
+	for (uint32_t i = 0; i < Entries; ++i) {
+		add(map, getAddress(i), i);
+	}
+
+	uint32_t sum = 0;
+	for (uint32_t r = 0; r < Rounds; ++r)
+	{
+		for (uint32_t i = 0; i < Entries; ++i) {
+			sum += *lookup(map, getAddress((i * 7 + r) % Entries));
+		}
+	}
+	sink = sum;
+}
+
+template< typename Map >
+static void
+miss()
+{
+	Map map;
+	for (uint32_t i = 0; i < Entries; ++i) {
+		add(map, getAddress(i), i);
+	}
+
+	uint32_t count = 0;
+	for (uint32_t r = 0; r < Rounds; ++r)
+	{
+		for (uint32_t i = 0; i < Entries; ++i) {
+			count += (lookup(map, getAddress(i + Entries + r)) == nullptr);
+		}
+	}
+	sink = count;
+}
+
+template< typename Map >
+static void
+remove()
+{
+	Map map;
+	for (uint32_t r = 0; r < Rounds; ++r)
+	{
+		for (uint32_t i = 0; i < Entries; ++i) {
+			add(map, getAddress(i), i);
+		}
+		for (uint32_t i = 0; i < Entries; ++i) {
+			erase(map, getAddress(i));
+		}
+	}
+	sink = (lookup(map, getAddress(0)) == nullptr);
+}
+
+template< typename Map >
+static void
+report(const char* name)
+{
+	float timeFill = measure(fill<Map>);
+	float timeHit = measure(hit<Map>);
+	float timeMiss = measure(miss<Map>);
+	float timeRemove = measure(remove<Map>);
+
+	XPCC_LOG_INFO << name << xpcc::endl;
+	XPCC_LOG_INFO << "    fill          : " << timeFill << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "    hit           : " << timeHit << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "    miss          : " << timeMiss << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "    insert+remove : " << timeRemove << " ns" << xpcc::endl;
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << Entries << " entries, uint16_t -> uint32_t" << xpcc::endl;
+
+	report<Hash>("xpcc::HashMap");
+	report<Bounded>("xpcc::BoundedHashMap");
+	report<Unordered>("std::unordered_map");
+	report<Ordered>("std::map");
+	return 0;
+}
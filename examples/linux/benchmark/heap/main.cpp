@@ -0,0 +1,190 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Deadline management for 512 timeouts. Compares xpcc::BoundedHeap and
+// xpcc::Heap with a linear search for the earliest deadline (as done when
+// iterating over a list of timeouts), std::priority_queue and std::multiset.
+//
+// expire: the earliest timeout expires and is restarted with a new period
+// restart: a random timeout is restarted (decrease/increase-key), not
+//          supported by std::priority_queue
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/container/heap.hpp>
+
+#include <chrono>
+#include <queue>
+#include <set>
+#include <vector>
+#include <functional>
+
+static constexpr uint32_t Timeouts = 512;
+static constexpr uint32_t Operations = 1000000;
+
+typedef xpcc::BoundedHeap<uint32_t, Timeouts> Bounded;
+typedef xpcc::Heap<uint32_t> Growing;
+
+// prevents that the compiler removes the loops
+static volatile uint32_t sink;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Operations;
+}
+
+static inline uint32_t
+getPeriod(uint32_t i)
+{
+	return 10 + (i * 7919) % 1000;
+}
+
+// ----------------------------------------------------------------------------
+template< typename Heap >
+static void
+expireHeap()
+{
+	Heap heap;
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		heap.push(getPeriod(i));
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		const uint32_t now = heap.getTop();
+		heap.update(heap.getTopHandle(), now + getPeriod(i));
+	}
+	sink = heap.getTop();
+}
+
+template< typename Heap >
+static void
+restartHeap()
+{
+	Heap heap;
+	typename Heap::Handle handles[Timeouts];
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		handles[i] = heap.push(getPeriod(i));
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i) {
+		heap.update(handles[(i * 31) % Timeouts], i + getPeriod(i));
+	}
+	sink = heap.getTop();
+}
+
+// ----------------------------------------------------------------------------
+static void
+expireScan()
+{
+	uint32_t deadlines[Timeouts];
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		deadlines[i] = getPeriod(i);
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		uint32_t earliest = 0;
+		for (uint32_t k = 1; k < Timeouts; ++k) {
+			if (deadlines[k] < deadlines[earliest]) {
+				earliest = k;
+			}
+		}
+		deadlines[earliest] += getPeriod(i);
+	}
+	sink = deadlines[0];
+}
+
+static void
+restartScan()
+{
+	uint32_t deadlines[Timeouts];
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		deadlines[i] = getPeriod(i);
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i) {
+		deadlines[(i * 31) % Timeouts] = i + getPeriod(i);
+	}
+	sink = deadlines[0];
+}
+
+// ----------------------------------------------------------------------------
+static void
+expirePriorityQueue()
+{
+	std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t> > queue;
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		queue.push(getPeriod(i));
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		const uint32_t now = queue.top();
+		queue.pop();
+		queue.push(now + getPeriod(i));
+	}
+	sink = queue.top();
+}
+
+static void
+expireSet()
+{
+	std::multiset<uint32_t> set;
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		set.insert(getPeriod(i));
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		const uint32_t now = *set.begin();
+		set.erase(set.begin());
+		set.insert(now + getPeriod(i));
+	}
+	sink = *set.begin();
+}
+
+static void
+restartSet()
+{
+	std::multiset<uint32_t> set;
+	std::multiset<uint32_t>::iterator handles[Timeouts];
+	for (uint32_t i = 0; i < Timeouts; ++i) {
+		handles[i] = set.insert(getPeriod(i));
+	}
+
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		const uint32_t index = (i * 31) % Timeouts;
+		set.erase(handles[index]);
+		handles[index] = set.insert(i + getPeriod(i));
+	}
+	sink = *set.begin();
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << Timeouts << " timeouts" << xpcc::endl;
+	XPCC_LOG_INFO << "expire, BoundedHeap         : " << measure(expireHeap<Bounded>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "expire, Heap                : " << measure(expireHeap<Growing>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "expire, linear search       : " << measure(expireScan) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "expire, std::priority_queue : " << measure(expirePriorityQueue) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "expire, std::multiset       : " << measure(expireSet) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "restart, BoundedHeap        : " << measure(restartHeap<Bounded>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "restart, Heap               : " << measure(restartHeap<Growing>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "restart, linear search      : " << measure(restartScan) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "restart, std::multiset      : " << measure(restartSet) << " ns" << xpcc::endl;
+	return 0;
+}
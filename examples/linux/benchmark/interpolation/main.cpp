@@ -0,0 +1,117 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares the lookup of Linear (linear search), IndexedLinear (bucket
+// index) and Uniform (direct index calculation) for a sensor
+// linearization curve with 64 supporting points and 12 bit ADC values.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/math/interpolation.hpp>
+
+#include <chrono>
+#include <cstdlib>
+
+static constexpr std::size_t Count = 4096;
+static constexpr uint32_t Repetitions = 500;
+static constexpr uint8_t Points = 64;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < Repetitions; ++i) {
+		function();
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / (Repetitions * Count);
+}
+
+// IR distance sensor, distance in mm over the ADC value
+constexpr float
+distance(float adc)
+{
+	return 2.5e5f / (adc + 100.f);
+}
+
+typedef xpcc::interpolation::Table<uint16_t, Points + 1> DistanceTable;
+
+FLASH_STORAGE(DistanceTable distanceTable) =
+		xpcc::interpolation::generateTable<uint16_t, Points + 1>(distance, 0.f, 64.f);
+
+int
+main()
+{
+	typedef xpcc::Pair<uint16_t, uint16_t> Point;
+
+	static Point points[Points + 1];
+	for (uint8_t i = 0; i <= Points; ++i) {
+		points[i].first = i * 64;
+		points[i].second = distanceTable.values[i];
+	}
+
+	xpcc::interpolation::Linear<Point> linear(points, Points + 1);
+	xpcc::interpolation::IndexedLinear<Point, 32> indexed(points, Points + 1);
+	xpcc::interpolation::Uniform<uint16_t, uint16_t, xpcc::accessor::Flash>
+			uniform(xpcc::accessor::asFlash(distanceTable.values), Points + 1, 0, 64);
+
+	static uint16_t input[Count];
+	static uint16_t output[Count];
+	std::srand(42);
+	for (std::size_t i = 0; i < Count; ++i) {
+		input[i] = std::rand() % 4096;
+	}
+
+	volatile uint32_t sink = 0;
+
+	float linearTime = measure([&]() {
+		uint32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += linear.interpolate(input[i]);
+		}
+		sink = sum;
+	});
+	float indexedTime = measure([&]() {
+		uint32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += indexed.interpolate(input[i]);
+		}
+		sink = sum;
+	});
+	float uniformTime = measure([&]() {
+		uint32_t sum = 0;
+		for (std::size_t i = 0; i < Count; ++i) {
+			sum += uniform.interpolate(input[i]);
+		}
+		sink = sum;
+	});
+	float batchTime = measure([&]() {
+		uniform.interpolate(input, output, Count);
+		sink = output[Count - 1];
+	});
+	(void) sink;
+
+	// all three have to give the same results
+	uint32_t mismatches = 0;
+	for (uint16_t adc = 0; adc < 4096; ++adc)
+	{
+		uint16_t expected = linear.interpolate(adc);
+		if (indexed.interpolate(adc) != expected || uniform.interpolate(adc) != expected) {
+			++mismatches;
+		}
+	}
+
+	XPCC_LOG_INFO << "Linear        : " << linearTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "IndexedLinear : " << indexedTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "Uniform       : " << uniformTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "Uniform batch : " << batchTime << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "mismatches    : " << mismatches << xpcc::endl;
+	return 0;
+}
@@ -0,0 +1,158 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares xpcc::filter::Kalman against a straightforward implementation
+// with full matrices, temporaries and an explicit inversion of the
+// innovation covariance. The model is a planar IMU/odometry fusion with
+// six states (x, y, heading, velocity, yaw rate, gyro bias) and three
+// measurements (odometry velocity, odometry yaw rate, gyro).
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/math/filter/kalman.hpp>
+
+#include <chrono>
+
+static constexpr uint8_t States = 6;
+static constexpr uint8_t Measurements = 3;
+static constexpr uint32_t Iterations = 200000;
+
+typedef xpcc::filter::Kalman<float, States> Filter;
+typedef xpcc::Matrix<float, States, States> StateMatrix;
+typedef xpcc::Matrix<float, States, 1> StateVector;
+typedef xpcc::Matrix<float, Measurements, States> ObservationMatrix;
+typedef xpcc::Matrix<float, Measurements, 1> MeasurementVector;
+
+static const float dt = 0.001f;
+
+static const float transitionData[States * States] = {
+	1, 0, 0, dt, 0,  0,
+	0, 1, 0, 0,  0,  0,
+	0, 0, 1, 0,  dt, 0,
+	0, 0, 0, 1,  0,  0,
+	0, 0, 0, 0,  1,  0,
+	0, 0, 0, 0,  0,  1,
+};
+
+static const float observationData[Measurements * States] = {
+	0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 1, 0,
+	0, 0, 0, 0, 1, 1,
+};
+
+static const float varianceData[Measurements] = { 0.01f, 0.02f, 0.001f };
+
+/// Textbook implementation with full matrices
+class NaiveKalman
+{
+public:
+	NaiveKalman() :
+		x(StateVector::zeroMatrix()),
+		p(StateMatrix::identityMatrix())
+	{
+	}
+
+	void
+	predict(const StateMatrix& f, const StateMatrix& q)
+	{
+		x = f * x;
+		p = f * p * f.asTransposed() + q;
+	}
+
+	void
+	update(const ObservationMatrix& h, const MeasurementVector& z,
+			const xpcc::Matrix<float, Measurements, Measurements>& r)
+	{
+		xpcc::Matrix<float, Measurements, Measurements> s = h * p * h.asTransposed() + r;
+		xpcc::Matrix<float, Measurements, Measurements> sInverse =
+				xpcc::Matrix<float, Measurements, Measurements>::identityMatrix();
+		xpcc::LUDecomposition::solve(s, &sInverse);
+
+		xpcc::Matrix<float, States, Measurements> k = p * h.asTransposed() * sInverse;
+		x += k * (z - h * x);
+
+		StateMatrix a = StateMatrix::identityMatrix() - k * h;
+		p = a * p * a.asTransposed() + k * r * k.asTransposed();
+	}
+
+	StateVector x;
+	StateMatrix p;
+};
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < Iterations; ++i) {
+		function(i);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Iterations;
+}
+
+static MeasurementVector
+measurement(uint32_t i)
+{
+	MeasurementVector z;
+	z[0][0] = 1.0f + 0.01f * (i % 7);
+	z[1][0] = 0.2f - 0.01f * (i % 5);
+	z[2][0] = 0.21f + 0.001f * (i % 3);
+	return z;
+}
+
+int
+main()
+{
+	const StateMatrix f(transitionData);
+	const ObservationMatrix h(observationData);
+	const MeasurementVector variance(varianceData);
+
+	xpcc::Matrix<float, Measurements, Measurements> r =
+			xpcc::Matrix<float, Measurements, Measurements>::zeroMatrix();
+	xpcc::SymmetricMatrix<float, Measurements> rSymmetric =
+			xpcc::SymmetricMatrix<float, Measurements>::zeroMatrix();
+	for (uint8_t i = 0; i < Measurements; ++i) {
+		r[i][i] = varianceData[i];
+		rSymmetric(i, i) = varianceData[i];
+	}
+	const Filter::Covariance q = Filter::Covariance::diagonalMatrix(1e-6f);
+	const StateMatrix qFull = q.asMatrix();
+
+	NaiveKalman naive;
+	float naiveTime = measure([&](uint32_t i) {
+		naive.predict(f, qFull);
+		naive.update(h, measurement(i), r);
+	});
+
+	Filter correlated(StateVector::zeroMatrix(), Filter::Covariance::identityMatrix());
+	float correlatedTime = measure([&](uint32_t i) {
+		correlated.predict(f, q);
+		correlated.updateCorrelated(h, measurement(i), rSymmetric);
+	});
+
+	Filter sequential(StateVector::zeroMatrix(), Filter::Covariance::identityMatrix());
+	float sequentialTime = measure([&](uint32_t i) {
+		sequential.predict(f, q);
+		sequential.update(h, measurement(i), variance);
+	});
+
+	XPCC_LOG_INFO << "Kalman filter, " << States << " states, "
+			<< Measurements << " measurements" << xpcc::endl;
+	XPCC_LOG_INFO << "covariance storage: naive " << sizeof(StateMatrix)
+			<< " bytes, symmetric " << sizeof(Filter::Covariance) << " bytes" << xpcc::endl;
+	XPCC_LOG_INFO << "naive full matrix     : " << naiveTime << " ns/step" << xpcc::endl;
+	XPCC_LOG_INFO << "symmetric, correlated : " << correlatedTime << " ns/step" << xpcc::endl;
+	XPCC_LOG_INFO << "symmetric, sequential : " << sequentialTime << " ns/step" << xpcc::endl;
+	XPCC_LOG_INFO << "velocity estimates    : " << naive.x[3][0] << " "
+			<< correlated.getState()[3][0] << " "
+			<< sequential.getState()[3][0] << xpcc::endl;
+
+	return 0;
+}
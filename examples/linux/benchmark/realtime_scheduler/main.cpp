@@ -0,0 +1,188 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Simulation of 100 periodic tasks on a simulated microsecond clock, which is
+// advanced by the execution time of each job. Compares the dispatch overhead
+// of xpcc::RealtimeScheduler (EDF and fixed priority) with the list based
+// xpcc::Scheduler, and reports the simulated worst-case latency (release
+// until start) of the tasks.
+//
+// xpcc::Scheduler visits every task once per tick, RealtimeScheduler only
+// the released jobs (O(log n) each). With short periods (1ms to 100ms, about
+// 55 jobs per ms) the simple list wins, with longer periods (10ms to 1s) the
+// heaps do.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/processing/scheduler/scheduler.hpp>
+#include <xpcc/processing/scheduler/realtime_scheduler.hpp>
+
+#include <chrono>
+
+static constexpr uint32_t Tasks = 100;
+static constexpr uint32_t Milliseconds = 100000;
+
+// simulated microsecond clock
+struct SimulatedClock
+{
+	template< typename TimestampType >
+	static TimestampType
+	now()
+	{
+		return TimestampType(time);
+	}
+
+	static uint32_t time;
+};
+
+uint32_t SimulatedClock::time = 0;
+
+typedef xpcc::RealtimeScheduler<Tasks, SimulatedClock> Realtime;
+
+// in milliseconds
+static const uint16_t shortPeriods[] = { 1, 2, 5, 10, 20, 50, 100 };
+static const uint16_t longPeriods[] = { 10, 20, 50, 100, 200, 500, 1000 };
+static const uint16_t* periods = shortPeriods;
+
+static inline uint32_t
+getPeriod(uint32_t i)
+{
+	return periods[(i * 7919) % 7];
+}
+
+static inline uint32_t
+getExecutionTime(uint32_t i)
+{
+	// in microseconds, about 30% utilization in total
+	return 2 + (i * 31) % (6 * getPeriod(i));
+}
+
+// ----------------------------------------------------------------------------
+class SimulatedTask : public Realtime::Task, public xpcc::Scheduler::Task
+{
+public:
+	SimulatedTask() :
+		executionTime(0), executions(0)
+	{
+	}
+
+	virtual void
+	run()
+	{
+		SimulatedClock::time += executionTime;
+		executions++;
+	}
+
+	uint32_t executionTime;
+	uint32_t executions;
+};
+
+static SimulatedTask tasks[Tasks];
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	SimulatedClock::time = 0;
+	for (uint32_t i = 0; i < Tasks; ++i) {
+		tasks[i].executionTime = getExecutionTime(i);
+		tasks[i].executions = 0;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Milliseconds;
+}
+
+// ----------------------------------------------------------------------------
+static uint32_t maximumLatency;
+static uint32_t overruns;
+
+template< Realtime::Policy policy >
+static void
+runRealtime()
+{
+	static Realtime scheduler(policy);
+	Realtime::Handle handles[Tasks];
+	for (uint32_t i = 0; i < Tasks; ++i)
+	{
+		// rate monotonic priorities for the fixed priority policy
+		handles[i] = scheduler.addTask(tasks[i], getPeriod(i) * 1000, 255 - (getPeriod(i) >> 2));
+	}
+
+	for (uint32_t ms = 0; ms < Milliseconds; ++ms)
+	{
+		if (SimulatedClock::time < ms * 1000) {
+			SimulatedClock::time = ms * 1000;
+		}
+		scheduler.schedule();
+	}
+
+	maximumLatency = 0;
+	overruns = 0;
+	for (uint32_t i = 0; i < Tasks; ++i)
+	{
+		const Realtime::Statistics& statistics = scheduler.getStatistics(handles[i]);
+		if (statistics.maximumLatency > maximumLatency) {
+			maximumLatency = statistics.maximumLatency;
+		}
+		overruns += statistics.overruns;
+		scheduler.removeTask(handles[i]);
+	}
+}
+
+static void
+runScheduler()
+{
+	// allocates a list item per task, which is never freed
+	static xpcc::Scheduler scheduler;
+	static bool initialized = false;
+	if (!initialized)
+	{
+		for (uint32_t i = 0; i < Tasks; ++i) {
+			scheduler.scheduleTask(tasks[i], getPeriod(i), 255 - (getPeriod(i) >> 2));
+		}
+		initialized = true;
+	}
+
+	for (uint32_t ms = 0; ms < Milliseconds; ++ms)
+	{
+		if (SimulatedClock::time < ms * 1000) {
+			SimulatedClock::time = ms * 1000;
+		}
+		scheduler.schedule();
+	}
+}
+
+static void
+compare()
+{
+	XPCC_LOG_INFO << "Scheduler                       : " << measure(runScheduler) << " ns" << xpcc::endl;
+
+	XPCC_LOG_INFO << "RealtimeScheduler, EDF          : " << measure(runRealtime<Realtime::Policy::EarliestDeadlineFirst>) << " ns";
+	XPCC_LOG_INFO << ", max. latency " << maximumLatency << " us, " << overruns << " overruns" << xpcc::endl;
+
+	XPCC_LOG_INFO << "RealtimeScheduler, fixed prio.  : " << measure(runRealtime<Realtime::Policy::FixedPriority>) << " ns";
+	XPCC_LOG_INFO << ", max. latency " << maximumLatency << " us, " << overruns << " overruns" << xpcc::endl;
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << Tasks << " tasks, " << Milliseconds << " simulated ms, time per ms" << xpcc::endl;
+
+	XPCC_LOG_INFO << "periods 1ms to 100ms:" << xpcc::endl;
+	compare();
+
+	periods = longPeriods;
+	XPCC_LOG_INFO << "periods 10ms to 1s:" << xpcc::endl;
+	compare();
+	return 0;
+}
@@ -0,0 +1,463 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Rendering throughput of shapes, of all fonts of xpcc and of a view of the
+// GUI on a headless 320x240 RGB565 display, which draws into memory only.
+//
+// Every scene is drawn once on a display which counts the written pixels,
+// then repeated for at least 200 ms on a cleared display. Clearing is not
+// part of the time. The throughput is reported in written pixels per
+// second, for fonts also in nanoseconds per glyph.
+//
+// Text is drawn directly from the font tables, with a glyph cache
+// (`operator <<` with a xpcc::glcd::TextCache) and as cached lines
+// (drawText()).
+//
+// The GUI view is drawn completely and after a change of a single number,
+// where only the damaged part of the widget is redrawn.
+//
+// The hash of the last frame of every scene is printed as well, it must only
+// change if the drawing code is changed on purpose. Pass a directory to
+// write the frames as PPM images into it:
+//
+//     ./build/rendering.elf /tmp/frames
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/ui/display/font.hpp>
+#include <xpcc/ui/display/image.hpp>
+#include <xpcc/ui/gui.hpp>
+
+#include <xpcc/architecture/platform/driver/graphics/hosted/headless_display.hpp>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+static constexpr uint16_t Width = 320;
+static constexpr uint16_t Height = 240;
+
+typedef xpcc::HeadlessDisplay<Width, Height> Display;
+
+/// Counts the pixels written by the drawing primitives
+class CountingDisplay : public Display
+{
+public:
+	uint32_t pixels = 0;
+
+protected:
+	virtual void
+	fillSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		pixels += x1 - x0 + 1;
+		Display::fillSpan(x0, x1, y);
+	}
+
+	virtual void
+	clearSpan(int16_t x0, int16_t x1, int16_t y)
+	{
+		pixels += x1 - x0 + 1;
+		Display::clearSpan(x0, x1, y);
+	}
+
+	virtual void
+	fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+	{
+		pixels += uint32_t(x1 - x0 + 1) * (y1 - y0 + 1);
+		Display::fillArea(x0, y0, x1, y1);
+	}
+
+	virtual void
+	setPixel(int16_t x, int16_t y)
+	{
+		pixels++;
+		Display::setPixel(x, y);
+	}
+
+	virtual void
+	clearPixel(int16_t x, int16_t y)
+	{
+		pixels++;
+		Display::clearPixel(x, y);
+	}
+};
+
+static Display display;
+static CountingDisplay counter;
+
+static xpcc::glcd::StaticTextCache<65536, 255> cache;
+
+static const char* directory = nullptr;
+
+/// Microseconds per call of the function, repeated for at least 200 ms
+template< typename Function >
+static float
+measure(Function function)
+{
+	uint32_t passes = 0;
+	auto start = std::chrono::steady_clock::now();
+	auto end = start;
+	do {
+		for (uint32_t ii = 0; ii < 10; ++ii, ++passes) {
+			function(display);
+		}
+		end = std::chrono::steady_clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(200));
+
+	return std::chrono::duration<float, std::micro>(end - start).count() / passes;
+}
+
+static void
+report(const char* name, float time, uint32_t pixels, uint32_t glyphs = 0)
+{
+	char hash[17];
+	snprintf(hash, sizeof(hash), "%016llx", (unsigned long long) display.getHash());
+
+	XPCC_LOG_INFO << name << ": " << time << " us, "
+				  << uint32_t(pixels / time) << " Mpixel/s";
+	if (glyphs) {
+		XPCC_LOG_INFO << ", " << uint32_t(time * 1000 / glyphs) << " ns/glyph";
+	}
+	XPCC_LOG_INFO << ", hash " << hash << xpcc::endl;
+
+	if (directory)
+	{
+		char filename[256];
+		snprintf(filename, sizeof(filename), "%s/%s.ppm", directory, name);
+		for (char* c = filename + strlen(directory) + 1; *c; ++c) {
+			if (*c == ' ') *c = '_';
+		}
+		if (not display.writePpm(filename)) {
+			XPCC_LOG_ERROR << "could not write " << filename << xpcc::endl;
+		}
+	}
+}
+
+/// Counts the pixels of one pass, then measures the scene
+template< typename Scene >
+static void
+run(const char* name, Scene scene)
+{
+	counter.clear();
+	counter.pixels = 0;
+	scene(counter);
+	const uint32_t pixels = counter.pixels;
+
+	display.clear();
+	const float time = measure(scene);
+	report(name, time, pixels);
+}
+
+// ----------------------------------------------------------------------------
+static void
+shapes()
+{
+	run("screen", [](xpcc::GraphicDisplay& display) {
+		display.fillRectangle(xpcc::glcd::Point(0, 0), Width, Height);
+	});
+
+	run("100 rectangles 20x20", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 100; ++i) {
+			display.fillRectangle(xpcc::glcd::Point((i * 37) % Width, (i * 13) % Height), 20, 20);
+		}
+	});
+
+	run("100 rectangle outlines", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 100; ++i) {
+			display.drawRectangle(xpcc::glcd::Point((i * 37) % Width, (i * 13) % Height), 40, 30);
+		}
+	});
+
+	run("100 lines", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 100; ++i) {
+			display.drawLine(xpcc::glcd::Point(0, (i * 13) % Height),
+							 xpcc::glcd::Point(Width - 1, (i * 29) % Height));
+		}
+	});
+
+	run("50 circles r30", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 50; ++i) {
+			display.drawCircle(xpcc::glcd::Point((i * 37) % Width, (i * 13) % Height), 30);
+		}
+	});
+
+	run("50 filled circles r20", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 50; ++i) {
+			display.fillCircle(xpcc::glcd::Point((i * 37) % Width, (i * 13) % Height), 20);
+		}
+	});
+
+	run("50 rounded rectangles", [](xpcc::GraphicDisplay& display) {
+		for (uint16_t i = 0; i < 50; ++i) {
+			display.drawRoundedRectangle(xpcc::glcd::Point((i * 37) % Width, (i * 13) % Height), 60, 40, 8);
+		}
+	});
+}
+
+// ----------------------------------------------------------------------------
+struct Image
+{
+	const char* name;
+	const uint8_t* data;
+	uint8_t width;
+	uint8_t height;
+};
+
+/// Screen tiled with the image
+static void
+images()
+{
+	const Image images[] = {
+		{ "logo_xpcc_90x64", bitmap::logo_xpcc_90x64, 90, 64 },
+		{ "logo_rca_90x64", bitmap::logo_rca_90x64, 90, 64 },
+		{ "logo_eurobot_90x64", bitmap::logo_eurobot_90x64, 90, 64 },
+		{ "skull_64x64", bitmap::skull_64x64, 64, 64 },
+		{ "home_16x16", bitmap::home_16x16, 16, 16 },
+	};
+
+	for (const Image& image : images)
+	{
+		run(image.name, [&image](xpcc::GraphicDisplay& display) {
+			for (int16_t y = 0; y < Height; y += image.height) {
+				for (int16_t x = 0; x < Width; x += image.width) {
+					display.drawImage(xpcc::glcd::Point(x, y),
+							xpcc::accessor::asFlash(image.data));
+				}
+			}
+		});
+	}
+}
+
+// ----------------------------------------------------------------------------
+struct Font
+{
+	const char* name;
+	const uint8_t* data;
+	const char* text;
+};
+
+static const char Sentence[] = "The quick brown fox jumps over the lazy dog 0123456789";
+static const char Digits[] = "0123456789";
+
+enum class
+Text
+{
+	Direct,
+	Glyphs,
+	Lines,
+};
+
+static void
+font(const Font& font, Text mode)
+{
+	// as many characters of the text as fit into a line
+	char line[sizeof(Sentence)];
+	display.setFont(font.data);
+	size_t length = strlen(font.text);
+	do {
+		strncpy(line, font.text, length);
+		line[length] = '\0';
+	}
+	while (display.getStringWidth(line) > Width and --length);
+
+	// glyphs which are not part of the font are skipped
+	const uint8_t first = font.data[6];
+	const uint8_t count = font.data[7];
+	uint32_t glyphs = 0;
+	for (const char* c = line; *c; ++c) {
+		if (uint8_t(*c) >= first and uint8_t(*c) < first + count) {
+			glyphs++;
+		}
+	}
+	const uint16_t step = display.getFontHeight() + font.data[4];
+	glyphs *= (Height + step - 1) / step;
+
+	auto scene = [&line, &font, step, mode](xpcc::GraphicDisplay& display) {
+		display.setFont(font.data);
+		for (int16_t y = 0; y < Height; y += step) {
+			if (mode == Text::Lines) {
+				display.drawText(xpcc::glcd::Point(0, y), line);
+			}
+			else {
+				display.setCursor(0, y);
+				display << line;
+			}
+		}
+	};
+
+	counter.clear();
+	counter.pixels = 0;
+	scene(counter);
+	const uint32_t pixels = counter.pixels;
+
+	// the cache is filled during the first pass
+	cache.clear();
+	display.setTextCache((mode == Text::Direct) ? nullptr : &cache);
+	display.clear();
+	const float time = measure(scene);
+
+	char name[64];
+	snprintf(name, sizeof(name), "%s%s", font.name,
+			(mode == Text::Direct) ? "" : (mode == Text::Glyphs) ? " glyphs" : " lines");
+	report(name, time, pixels, glyphs);
+	display.setTextCache(nullptr);
+}
+
+static void
+fonts()
+{
+	const Font fonts[] = {
+		{ "AllCaps3x5", xpcc::font::AllCaps3x5, Sentence },
+		{ "ArcadeClassic", xpcc::font::ArcadeClassic, Sentence },
+		{ "Assertion", xpcc::font::Assertion, Sentence },
+		{ "FixedWidth5x8", xpcc::font::FixedWidth5x8, Sentence },
+		{ "Matrix8x8", xpcc::font::Matrix8x8, Digits },
+		{ "Numbers14x32", xpcc::font::Numbers14x32, Digits },
+		{ "Numbers40x57", xpcc::font::Numbers40x57, Digits },
+		{ "Numbers46x64", xpcc::font::Numbers46x64, Digits },
+		{ "ScriptoNarrow", xpcc::font::ScriptoNarrow, Sentence },
+		{ "Ubuntu_36", xpcc::font::Ubuntu_36, Sentence },
+	};
+
+	for (const Font& f : fonts)
+	{
+		font(f, Text::Direct);
+		font(f, Text::Glyphs);
+		font(f, Text::Lines);
+	}
+
+	display.setFont(xpcc::font::FixedWidth5x8);
+	counter.setFont(xpcc::font::FixedWidth5x8);
+}
+
+// ----------------------------------------------------------------------------
+class Settings : public xpcc::gui::View
+{
+public:
+	Settings(xpcc::gui::GuiViewStack* stack) :
+		View(stack, 1, xpcc::gui::Dimension(Width, Height)),
+		tabs(xpcc::gui::Dimension(Width, Height), 0.2),
+		back("Back", tabs.buttonDimension),
+		apply("Apply", tabs.buttonDimension),
+		next("Next", tabs.buttonDimension),
+		name("Name", xpcc::glcd::Color::white()),
+		value(42, 1, xpcc::gui::Dimension(200, 30)),
+		enabled(true, xpcc::gui::Dimension(30, 30)),
+		color(xpcc::glcd::Color::emeraldGreen(), xpcc::gui::Dimension(60, 30))
+	{
+		tabs.packTabLeft(&back);
+		tabs.packTabMiddle(&apply);
+		tabs.packTabRight(&next);
+
+		this->pack(&tabs, xpcc::glcd::Point(0, 0));
+		this->pack(&name, xpcc::glcd::Point(20, 20));
+		this->pack(&value, xpcc::glcd::Point(60, 60));
+		this->pack(&enabled, xpcc::glcd::Point(60, 110));
+		this->pack(&color, xpcc::glcd::Point(120, 110));
+	}
+
+	bool
+	hasChanged()
+	{
+		return true;
+	}
+
+	/// Changes the number, like a click on one of the arrows
+	void
+	step(bool up)
+	{
+		if (up) {
+			value.increase();
+		}
+		else {
+			value.decrease();
+		}
+	}
+
+private:
+	xpcc::gui::TabPanel tabs;
+	xpcc::gui::ButtonWidget back;
+	xpcc::gui::ButtonWidget apply;
+	xpcc::gui::ButtonWidget next;
+	xpcc::gui::Label name;
+	xpcc::gui::NumberRocker<int16_t> value;
+	xpcc::gui::CheckboxWidget enabled;
+	xpcc::gui::FilledAreaButton color;
+};
+
+static void
+gui()
+{
+	static xpcc::gui::inputQueue input;
+	static xpcc::gui::GuiViewStack counterStack(&counter, &input);
+	static xpcc::gui::GuiViewStack displayStack(&display, &input);
+
+	// the stacks delete their views
+	Settings* counterView = new Settings(&counterStack);
+	Settings* displayView = new Settings(&displayStack);
+	counterStack.push(counterView);
+	displayStack.push(displayView);
+
+	// all widgets
+	counter.pixels = 0;
+	counterView->markDirty();
+	counterView->draw();
+	const uint32_t pixels = counter.pixels;
+
+	auto redraw = [displayView](xpcc::GraphicDisplay&) {
+		displayView->markDirty();
+		displayView->draw();
+	};
+	report("gui view", measure(redraw), pixels);
+
+	cache.clear();
+	display.setTextCache(&cache);
+	report("gui view cached", measure(redraw), pixels);
+	display.setTextCache(nullptr);
+
+	// only the inside of the number box is redrawn
+	counter.pixels = 0;
+	counterView->resetRedrawCounters();
+	counterView->step(true);
+	counterView->draw();
+	counterView->step(false);
+	counterView->draw();
+	const uint32_t numberPixels = counter.pixels;
+
+	auto number = [displayView](xpcc::GraphicDisplay&) {
+		displayView->step(true);
+		displayView->draw();
+		displayView->step(false);
+		displayView->draw();
+	};
+	report("gui number", measure(number), numberPixels);
+	XPCC_LOG_INFO << "gui number: " << counterView->getRenderCount()
+				  << " widgets rendered, " << counterView->getRedrawnPixels()
+				  << " pixels redrawn" << xpcc::endl;
+}
+
+// ----------------------------------------------------------------------------
+int
+main(int argc, char* argv[])
+{
+	if (argc > 1) {
+		directory = argv[1];
+	}
+
+	XPCC_LOG_INFO << "rendering on a headless " << Width << "x" << Height
+				  << " RGB565 display" << xpcc::endl;
+
+	shapes();
+	images();
+	fonts();
+	gui();
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares xpcc::DynamicArray with xpcc::SmallArray for the typical use
+// in the geometry classes: small polygons with 3 to 8 vertices which are
+// built, copied and destroyed again. The last case grows the arrays to
+// 100 elements to show the cost of the relocation.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/container/dynamic_array.hpp>
+#include <xpcc/container/small_array.hpp>
+#include <xpcc/math/geometry/vector2.hpp>
+
+#include <chrono>
+
+static constexpr uint32_t Operations = 1000000;
+
+typedef xpcc::DynamicArray<xpcc::Vector2i> Dynamic;
+typedef xpcc::SmallArray<xpcc::Vector2i, 8> Small;
+
+// prevents that the compiler removes the loops
+static volatile int32_t sink;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Operations;
+}
+
+template< typename Array >
+static void
+build()
+{
+	int32_t sum = 0;
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		Array polygon(4);
+		const int16_t vertices = 3 + (i % 6);
+		for (int16_t k = 0; k < vertices; ++k) {
+			polygon.append(xpcc::Vector2i(k, i));
+		}
+		sum += polygon[vertices - 1].x;
+	}
+	sink = sum;
+}
+
+template< typename Array >
+static void
+copy()
+{
+	Array polygon;
+	for (int16_t k = 0; k < 6; ++k) {
+		polygon.append(xpcc::Vector2i(k, 2 * k));
+	}
+
+	int32_t sum = 0;
+	for (uint32_t i = 0; i < Operations; ++i)
+	{
+		polygon[0].x = i;
+		Array other(polygon);
+		sum += other.getSize();
+	}
+	sink = sum;
+}
+
+template< typename Array >
+static void
+grow()
+{
+	int32_t sum = 0;
+	for (uint32_t i = 0; i < Operations / 100; ++i)
+	{
+		Array array;
+		for (int16_t k = 0; k < 100; ++k) {
+			array.append(xpcc::Vector2i(k, i));
+		}
+		sum += array[99].y;
+	}
+	sink = sum;
+}
+
+int
+main()
+{
+	float dynamicBuild = measure(build<Dynamic>);
+	float smallBuild = measure(build<Small>);
+	float dynamicCopy = measure(copy<Dynamic>);
+	float smallCopy = measure(copy<Small>);
+	float dynamicGrow = measure(grow<Dynamic>);
+	float smallGrow = measure(grow<Small>);
+
+	XPCC_LOG_INFO << "build 3-8 vertices, DynamicArray : " << dynamicBuild << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "build 3-8 vertices, SmallArray   : " << smallBuild << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "copy 6 vertices, DynamicArray    : " << dynamicCopy << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "copy 6 vertices, SmallArray      : " << smallCopy << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "grow to 100, DynamicArray        : " << dynamicGrow << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "grow to 100, SmallArray          : " << smallGrow << " ns" << xpcc::endl;
+	return 0;
+}
@@ -0,0 +1,241 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Collision queries of a path planner against 1k, 10k and 100k obstacles
+// (circles, line segments and triangles): a brute force loop over all
+// shapes compared with SpatialGrid2D and AabbTree2D (incrementally
+// inserted and built at once). The density of the obstacles is the same
+// for all sizes. The grid handles at most 65534 shapes.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/math/geometry/spatial_grid_2d.hpp>
+#include <xpcc/math/geometry/aabb_tree_2d.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+typedef xpcc::Shape2D<float> Shape;
+
+static constexpr uint32_t Queries = 2000;
+
+/// Edge length of the area containing one obstacle on average
+static constexpr float Spacing = 100;
+
+static volatile float sink;
+
+static float
+random(float min, float max)
+{
+	return min + (max - min) * (std::rand() / float(RAND_MAX));
+}
+
+template< typename Function >
+static float
+measure(uint32_t count, Function function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < count; ++i) {
+		function(i);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::micro>(end - start).count() / count;
+}
+
+/// Random obstacles and query parameters
+struct Scene
+{
+	Scene(std::size_t count) :
+		count(count), size(std::sqrt(float(count)) * Spacing),
+		circles(count / 3), segments(count / 3), polygons(count - 2 * (count / 3)),
+		shapes(count)
+	{
+		std::srand(42);
+		for (std::size_t i = 0; i < count / 3; ++i)
+		{
+			circles.append(xpcc::Circle2D<float>(randomPoint(), random(5, 30)));
+			xpcc::Vector2f start = randomPoint();
+			segments.append(xpcc::LineSegment2D<float>(start,
+					start + xpcc::Vector2f(random(-60, 60), random(-60, 60))));
+		}
+		for (std::size_t i = 2 * (count / 3); i < count; ++i)
+		{
+			xpcc::Vector2f center = randomPoint();
+			polygons.append(xpcc::Polygon2D<float> {
+					center + xpcc::Vector2f(random(-40, -5), random(-40, -5)),
+					center + xpcc::Vector2f(random(5, 40), random(-40, -5)),
+					center + xpcc::Vector2f(random(-20, 20), random(5, 40)) });
+		}
+
+		for (std::size_t i = 0; i < circles.getSize(); ++i) { shapes.append(circles[i]); }
+		for (std::size_t i = 0; i < segments.getSize(); ++i) { shapes.append(segments[i]); }
+		for (std::size_t i = 0; i < polygons.getSize(); ++i) { shapes.append(polygons[i]); }
+
+		for (uint32_t i = 0; i < Queries; ++i)
+		{
+			points[i] = randomPoint();
+			directions[i] = xpcc::Vector2f(random(-300, 300), random(-300, 300));
+		}
+	}
+
+	xpcc::Vector2f
+	randomPoint()
+	{
+		return xpcc::Vector2f(random(50, size - 50), random(50, size - 50));
+	}
+
+	const std::size_t count;
+	const float size;
+
+	xpcc::DynamicArray< xpcc::Circle2D<float> > circles;
+	xpcc::DynamicArray< xpcc::LineSegment2D<float> > segments;
+	xpcc::DynamicArray< xpcc::Polygon2D<float> > polygons;
+	xpcc::DynamicArray< Shape > shapes;
+
+	xpcc::Vector2f points[Queries];
+	xpcc::Vector2f directions[Queries];
+};
+
+/// Radius, raycast and nearest queries on one index
+template< typename Index >
+static void
+benchmark(const char* name, const Index& index, const Scene& scene,
+		uint32_t queries)
+{
+	typename Index::Handle result[64];
+	float radius = measure(queries, [&](uint32_t i) {
+		sink = index.query(scene.points[i], 50.f, result, 64);
+	});
+
+	typename Index::Hit hit;
+	float raycast = measure(queries, [&](uint32_t i) {
+		sink = index.raycast(xpcc::Ray2D<float>(scene.points[i], scene.directions[i]), 1.f, &hit);
+	});
+
+	float nearest = measure(queries, [&](uint32_t i) {
+		sink = index.getNearest(scene.points[i], 1e6f, &hit);
+	});
+
+	XPCC_LOG_INFO << "  " << name << ": radius " << radius << " us, raycast " << raycast
+			<< " us, nearest " << nearest << " us" << xpcc::endl;
+}
+
+/// Reference implementation which tests all shapes
+struct BruteForce
+{
+	typedef std::size_t Handle;
+	struct Hit { Handle handle; float distance; };
+
+	BruteForce(const Scene& scene) :
+		scene(scene)
+	{
+	}
+
+	std::size_t
+	query(const xpcc::Vector2f& center, float radius, Handle* result, std::size_t max) const
+	{
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < scene.count && found < max; ++i) {
+			if (scene.shapes[i].getDistanceTo(center) <= radius) {
+				result[found++] = i;
+			}
+		}
+		return found;
+	}
+
+	bool
+	raycast(const xpcc::Ray2D<float>& ray, float maxLength, Hit* hit) const
+	{
+		bool found = false;
+		for (std::size_t i = 0; i < scene.count; ++i)
+		{
+			float t;
+			if (scene.shapes[i].intersects(ray.getStartPoint(),
+					ray.getDirectionVector(), maxLength, &t)) {
+				maxLength = t;
+				hit->handle = i;
+				found = true;
+			}
+		}
+		hit->distance = maxLength;
+		return found;
+	}
+
+	bool
+	getNearest(const xpcc::Vector2f& point, float maxDistance, Hit* hit) const
+	{
+		bool found = false;
+		for (std::size_t i = 0; i < scene.count; ++i)
+		{
+			float distance = scene.shapes[i].getDistanceTo(point);
+			if (distance <= maxDistance) {
+				maxDistance = distance;
+				hit->handle = i;
+				found = true;
+			}
+		}
+		hit->distance = maxDistance;
+		return found;
+	}
+
+	const Scene& scene;
+};
+
+template< uint8_t Cells, uint16_t Capacity >
+static void
+run(std::size_t count)
+{
+	Scene scene(count);
+	XPCC_LOG_INFO << count << " obstacles" << xpcc::endl;
+
+	// brute force is slow, use less queries
+	benchmark("brute force   ", BruteForce(scene), scene, (count > 10000) ? 20 : 200);
+
+	if (Capacity >= count)
+	{
+		typedef xpcc::SpatialGrid2D<float, Cells, Cells, Capacity> Grid;
+		static Grid grid(xpcc::Vector2f(0, 0), scene.size / Cells);
+		grid.removeAll();
+		float insert = measure(1, [&](uint32_t) {
+			for (std::size_t i = 0; i < count; ++i) {
+				grid.insert(scene.shapes[i]);
+			}
+		});
+		XPCC_LOG_INFO << "  grid insert   : " << insert / count << " us per shape" << xpcc::endl;
+		benchmark("grid          ", grid, scene, Queries);
+	}
+
+	xpcc::AabbTree2D<float> tree;
+	float insert = measure(1, [&](uint32_t) {
+		for (std::size_t i = 0; i < count; ++i) {
+			tree.insert(scene.shapes[i]);
+		}
+	});
+	XPCC_LOG_INFO << "  tree insert   : " << insert / count << " us per shape, height "
+			<< tree.getHeight() << xpcc::endl;
+	benchmark("tree          ", tree, scene, Queries);
+
+	float build = measure(1, [&](uint32_t) {
+		tree.build(&scene.shapes[0], count, nullptr);
+	});
+	XPCC_LOG_INFO << "  tree build    : " << build / count << " us per shape, height "
+			<< tree.getHeight() << xpcc::endl;
+	benchmark("tree (built)  ", tree, scene, Queries);
+}
+
+int
+main()
+{
+	run<32, 1000>(1000);
+	run<100, 10000>(10000);
+	run<1, 1>(100000);
+
+	return 0;
+}
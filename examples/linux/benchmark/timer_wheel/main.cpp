@@ -0,0 +1,129 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// 2000 periodic timers with periods between 10ms and 1s, polled once per
+// millisecond. Compares polling every xpcc::PeriodicTimer in the main loop
+// with a single xpcc::TimerWheel::update() call per loop.
+//
+// The time is simulated, so the result is the cost of one loop iteration.
+
+#include <xpcc/architecture.hpp>
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/processing/timer.hpp>
+
+#include <chrono>
+#include <vector>
+
+static constexpr uint32_t Timers = 2000;
+static constexpr uint32_t Loops = 100000;
+
+// simulated millisecond clock
+struct SimulatedClock
+{
+	template< typename TimestampType >
+	static TimestampType
+	now()
+	{
+		return TimestampType(time);
+	}
+
+	static uint32_t time;
+};
+
+uint32_t SimulatedClock::time = 0;
+
+// prevents that the compiler removes the loops
+static volatile uint32_t sink;
+
+template< typename Function >
+static float
+measure(Function function)
+{
+	SimulatedClock::time = 0;
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<float, std::nano>(end - start).count() / Loops;
+}
+
+static inline uint32_t
+getPeriod(uint32_t i)
+{
+	return 10 + (i * 7919) % 990;
+}
+
+static void
+count(void* context)
+{
+	(*static_cast<uint32_t*>(context))++;
+}
+
+// ----------------------------------------------------------------------------
+template< typename TimestampType >
+static void
+pollPeriodicTimers()
+{
+	typedef xpcc::GenericPeriodicTimer<SimulatedClock, TimestampType> Timer;
+
+	std::vector<Timer> timers;
+	timers.reserve(Timers);
+	for (uint32_t i = 0; i < Timers; ++i) {
+		timers.emplace_back(getPeriod(i));
+	}
+
+	uint32_t expired = 0;
+	for (uint32_t loop = 0; loop < Loops; ++loop)
+	{
+		SimulatedClock::time++;
+		for (uint32_t i = 0; i < Timers; ++i) {
+			if (timers[i].execute()) {
+				expired++;
+			}
+		}
+	}
+	sink = expired;
+}
+
+template< typename TimestampType >
+static void
+updateTimerWheel()
+{
+	typedef xpcc::GenericTimerWheel<SimulatedClock, TimestampType> Wheel;
+
+	uint32_t expired = 0;
+	static Wheel wheel;
+	static typename Wheel::Timer timers[Timers];
+	for (uint32_t i = 0; i < Timers; ++i) {
+		timers[i] = typename Wheel::Timer(&count, &expired);
+		wheel.startPeriodic(timers[i], getPeriod(i));
+	}
+
+	for (uint32_t loop = 0; loop < Loops; ++loop)
+	{
+		SimulatedClock::time++;
+		wheel.update();
+	}
+	sink = expired;
+
+	for (uint32_t i = 0; i < Timers; ++i) {
+		timers[i].stop();
+	}
+}
+
+int
+main()
+{
+	XPCC_LOG_INFO << Timers << " timers, time per loop" << xpcc::endl;
+	XPCC_LOG_INFO << "PeriodicTimer, ShortTimestamp  : " << measure(pollPeriodicTimers<xpcc::ShortTimestamp>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "PeriodicTimer, Timestamp       : " << measure(pollPeriodicTimers<xpcc::Timestamp>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "TimerWheel, ShortTimestamp     : " << measure(updateTimerWheel<xpcc::ShortTimestamp>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "TimerWheel, Timestamp          : " << measure(updateTimerWheel<xpcc::Timestamp>) << " ns" << xpcc::endl;
+	XPCC_LOG_INFO << "TimerWheel, LongTimestamp      : " << measure(updateTimerWheel<xpcc::LongTimestamp>) << " ns" << xpcc::endl;
+	return 0;
+}
@@ -0,0 +1,94 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+// Compares the same containers placed in the core-coupled RAM (CCM), the
+// internal SRAM and the external SDRAM with allocator::Traits:
+// - a message queue (LinkedList) as used by the dispatcher
+// - a sum over a large buffer (DynamicArray)
+
+#include <xpcc/architecture/platform.hpp>
+#include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/dynamic_array.hpp>
+
+static constexpr uint32_t Operations = 10000;
+static constexpr uint16_t BufferSize = 16 * 1024;
+
+struct Message
+{
+	uint16_t identifier;
+	uint8_t payload[12];
+};
+
+template< typename Function >
+static uint32_t
+measure(Function function)
+{
+	// the cycle counter is enabled by the startup code
+	const uint32_t start = DWT->CYCCNT;
+	function();
+	return DWT->CYCCNT - start;
+}
+
+template< uint16_t traits >
+static void
+run(const char* name)
+{
+	xpcc::LinkedList<Message, xpcc::allocator::Traits<Message, traits> > queue;
+	xpcc::DynamicArray<uint32_t, xpcc::allocator::Traits<uint32_t, traits> > buffer(BufferSize);
+	for (uint16_t i = 0; i < BufferSize; ++i) {
+		buffer.append(i);
+	}
+
+	const uint32_t queueCycles = measure([&]() {
+		Message message = {};
+		for (uint32_t i = 0; i < Operations; ++i)
+		{
+			// let the queue grow and shrink between 0 and 16 entries
+			if ((i / 16) % 2 == 0) {
+				message.identifier = i;
+				queue.append(message);
+			}
+			else {
+				queue.removeFront();
+			}
+		}
+	});
+
+	volatile uint32_t sink;
+	const uint32_t bufferCycles = measure([&]() {
+		uint32_t sum = 0;
+		for (uint16_t i = 0; i < BufferSize; ++i) {
+			sum += buffer[i];
+		}
+		sink = sum;
+	});
+	(void) sink;
+
+	XPCC_LOG_INFO << name << ": queue " << (queueCycles / Operations)
+			<< " cycles/operation, buffer " << (bufferCycles / BufferSize)
+			<< " cycles/element" << xpcc::endl;
+}
+
+int
+main()
+{
+	Board::initialize();
+	Board::LedGreen::set();
+
+	run< xpcc::MemoryFastData.value >("CCM  ");
+	run< xpcc::MemoryDMA.value >("SRAM ");
+	run< xpcc::MemoryExternal.value >("SDRAM");
+
+	while (1)
+	{
+		Board::LedGreen::toggle();
+		xpcc::delayMilliseconds(500);
+	}
+	return 0;
+}
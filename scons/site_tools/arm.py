@@ -171,7 +171,7 @@ def generate(env, **kw):
 	env['CXXFLAGS'] = [
 #		"-fverbose-asm",
 #		"-save-temps",		# save preprocessed files
-		"-std=c++14",
+		"-std=" + env.get('XPCC_CXX_STANDARD', "c++14"),
 		"-fconstexpr-depth=10000", # enable deep recursion
 		"-fno-exceptions",
 		"-fno-rtti",
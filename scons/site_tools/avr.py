@@ -153,7 +153,7 @@ def generate(env, **kw):
 	
 	# C++ flags
 	env['CXXFLAGS'] = [
-		"-std=c++14",
+		"-std=" + env.get('XPCC_CXX_STANDARD', "c++14"),
 		"-fno-exceptions", 
 		"-fno-rtti",
 		"-fno-threadsafe-statics",
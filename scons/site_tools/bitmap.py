@@ -28,10 +28,14 @@
 
 import string
 import os
+import sys
 import re
 import math
 from SCons.Script import *
 
+sys.path.append(os.path.join(os.path.dirname(__file__), "../../tools/bitmap"))
+import run_length
+
 # -----------------------------------------------------------------------------
 template_source = """
 #include <xpcc/architecture/driver/accessor.hpp>
@@ -40,7 +44,7 @@ namespace bitmap
 {
 	FLASH_STORAGE(uint8_t ${name}[]) =
 	{
-		${width}, ${height},
+		${header}
 		${array}
 	};
 }
@@ -62,6 +66,7 @@ namespace bitmap
 	 *
 	 * - Width  : ${width}
 	 * - Height : ${height}
+	 * - Size   : ${size}
 	 *
 	 * \\ingroup	image
 	 */
@@ -110,12 +115,25 @@ def bitmap_action(target, source, env):
 			if input[index] == "1":
 				data[y // 8][x] |= 1 << (y % 8)
 
-	array = []
-	for y in range(rows):
-		line = []
-		for x in range(width):
-			line.append("0x%02x," % data[y][x])
-		array.append(" ".join(line))
+	if env.get('BITMAP_ENCODING', 'raw') == 'rle':
+		# a width of zero marks the run-length encoded images
+		pixels = run_length.from_pages(sum(data, []), width, height)
+		encoded = run_length.encode(pixels)
+		header = "0, %i, %i," % (width, height)
+		size = "%i bytes, run-length encoded (%i bytes raw)" % \
+				(3 + len(encoded), 2 + rows * width)
+		array = []
+		for i in range(0, len(encoded), 16):
+			array.append(" ".join(["0x%02x," % byte for byte in encoded[i:i + 16]]))
+	else:
+		header = "%i, %i," % (width, height)
+		size = "%i bytes" % (2 + rows * width)
+		array = []
+		for y in range(rows):
+			line = []
+			for x in range(width):
+				line.append("0x%02x," % data[y][x])
+			array.append(" ".join(line))
 
 	basename = os.path.splitext(os.path.basename(str(target[0])))[0]
 	substitutions = {
@@ -123,6 +141,8 @@ def bitmap_action(target, source, env):
 		'filename': str(source[0]),
 		'width': width,
 		'height': height,
+		'header': header,
+		'size': size,
 		'array': "\n\t\t".join(array),
 		'include_guard': "BITMAP__" + basename.upper().replace(" ", "_") + "_HPP"
 	}
@@ -134,6 +154,8 @@ def bitmap_action(target, source, env):
 	open(target[1].path, 'w').write(output)
 
 def bitmap_string(target, source, env):
+	if env.get('BITMAP_ENCODING', 'raw') == 'rle':
+		return "Create Bitmap: '%s' (run-length encoded)" % (str(target[0]))
 	return "Create Bitmap: '%s'" % (str(target[0]))
 
 def bitmap_emitter(target, source, env):
@@ -146,7 +168,8 @@ def generate(env, **kw):
 	env.Append(
 		BUILDERS = {
 			'Bitmap': env.Builder(
-				action = env.Action(bitmap_action, bitmap_string),
+				action = env.Action(bitmap_action, bitmap_string,
+						varlist = ['BITMAP_ENCODING']),
 				suffix = '.cpp',
 				src_suffix = '.pbm',
 				emitter = bitmap_emitter,
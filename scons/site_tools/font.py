@@ -37,9 +37,12 @@ def font_action(target, source, env):
 	infile  = str(source[0])
 	outfile = os.path.splitext(str(target[0]))[0]
 
-	os.system('python3 "%s" "%s" "%s"' % (command, infile, outfile))
+	options = "--rle " if (env.get('FONT_ENCODING', 'raw') == 'rle') else ""
+	os.system('python3 "%s" %s"%s" "%s"' % (command, options, infile, outfile))
 
 def font_string(target, source, env):
+	if env.get('FONT_ENCODING', 'raw') == 'rle':
+		return "Create Font: '%s' (run-length encoded)" % (str(source[0]))
 	return "Create Font: '%s'" % (str(source[0]))
 
 def font_emitter(target, source, env):
@@ -53,7 +56,8 @@ def generate(env, **kw):
 	env.Append(
 		BUILDERS = {
 			'Font': env.Builder(
-				action = env.Action(font_action, font_string),
+				action = env.Action(font_action, font_string,
+						varlist = ['FONT_ENCODING']),
 				suffix = '.cpp',
 				src_suffix = '.font',
 				emitter = font_emitter,
@@ -387,6 +387,8 @@ def generate(env, **kw):
 		optimization = ARGUMENTS.get('optimization', optimization)
 
 		env['XPCC_ADDITIONAL_CCFLAGS'] = parser.get('build', 'ccflags', '').split()
+		# C++ standard, e.g. c++20 for the coroutines
+		env['XPCC_CXX_STANDARD'] = parser.get('build', 'cxxstd', 'c++14')
 
 		# load parameters if available
 		if parser.has_section('parameters'):
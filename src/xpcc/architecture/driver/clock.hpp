@@ -11,6 +11,7 @@
 #define	XPCC_CLOCK_HPP
 
 #include <xpcc/architecture/utils.hpp>
+#include <xpcc/architecture/driver/atomic/lock.hpp>
 #include <xpcc/processing/timer/timestamp.hpp>
 
 namespace xpcc
@@ -73,6 +74,36 @@ protected:
 	static Type time;
 };
 
+/**
+ * The 64 bit time is extended from the 32 bit time by counting its
+ * overflows. now() has to be called at least once every 49 days for
+ * the LongTimestamp to be correct.
+ *
+ * The overflow counter is updated with interrupts disabled, so that
+ * interrupts can call now() as well. On hosted targets the lock does not
+ * protect against concurrent threads.
+ *
+ * @warning	With `XPCC__CLOCK_TESTMODE` every step of the time backwards
+ * 			is counted as an overflow.
+ */
+template<>
+inline LongTimestamp
+Clock::now<LongTimestamp>()
+{
+	static uint32_t overflows = 0;
+	static uint32_t last = 0;
+
+	atomic::Lock lock;
+
+	const uint32_t current = now<Timestamp>().getTime();
+	if (current < last) {
+		overflows++;
+	}
+	last = current;
+
+	return LongTimestamp((uint64_t(overflows) << 32) | current);
+}
+
 }	// namespace xpcc
 
 #endif	// XPCC_CLOCK_HPP
@@ -14,65 +14,104 @@
 //
 
 #include "stm32f469_discovery.hpp"
+#include <xpcc/ui/display/buffered_color_display.hpp>
 
 extern void
 board_initialize_display(uint8_t);
 
-// Basic implementation of display running on memory mapped buffer
-class DsiDisplay : public xpcc::GraphicDisplay
+// Fills, copies and blends areas of the frame buffer in the background
+struct Dma2d
 {
-public:
-	DsiDisplay() : buffer(new (xpcc::MemoryExternal) uint16_t[800*480])
+	template< typename Pixel >
+	static bool
+	fill(Pixel* destination, uint16_t stride, uint16_t width, uint16_t height, Pixel pixel)
 	{
-		Board::setDisplayBuffer((void *) buffer);
+		wait();
+		DMA2D->CR = DMA2D_CR_MODE;	// register to memory
+		DMA2D->OPFCCR = format<Pixel>();
+		DMA2D->OCOLR = pixel;
+		DMA2D->OMAR = uint32_t(destination);
+		DMA2D->OOR = stride - width;
+		DMA2D->NLR = (uint32_t(width) << 16) | height;
+		DMA2D->CR |= DMA2D_CR_START;
+		return true;
 	}
 
-	uint16_t
-	getWidth() const override
-	{ return 800; }
-
-	uint16_t
-	getHeight() const override
-	{ return 480; }
-
-	void
-	clear() override
+	template< typename Pixel >
+	static bool
+	copy(Pixel* destination, uint16_t destinationStride,
+			const Pixel* source, uint16_t sourceStride,
+			uint16_t width, uint16_t height)
 	{
-		for (int ii = 0; ii < 800*480; ii++)
-		{
-			buffer[ii] = this->backgroundColor.getValue();
-		}
+		wait();
+		DMA2D->CR = 0;	// memory to memory
+		DMA2D->FGPFCCR = format<Pixel>();
+		DMA2D->FGMAR = uint32_t(source);
+		DMA2D->FGOR = sourceStride - width;
+		DMA2D->OPFCCR = format<Pixel>();
+		DMA2D->OMAR = uint32_t(destination);
+		DMA2D->OOR = destinationStride - width;
+		DMA2D->NLR = (uint32_t(width) << 16) | height;
+		DMA2D->CR |= DMA2D_CR_START;
+		return true;
 	}
 
-	void
-	update() override
+	template< typename Pixel >
+	static bool
+	blend(Pixel* destination, uint16_t destinationStride,
+			const uint32_t* source, uint16_t sourceStride,
+			uint16_t width, uint16_t height, uint8_t alpha)
 	{
-		// FIXME: avoid tearing by using double buffering!
+		wait();
+		DMA2D->CR = DMA2D_CR_MODE_1;	// memory to memory with blending
+		// ARGB8888, alpha multiplied with the global alpha
+		DMA2D->FGPFCCR = (uint32_t(alpha) << 24) | DMA2D_FGPFCCR_AM_1;
+		DMA2D->FGMAR = uint32_t(source);
+		DMA2D->FGOR = sourceStride - width;
+		DMA2D->BGPFCCR = format<Pixel>();
+		DMA2D->BGMAR = uint32_t(destination);
+		DMA2D->BGOR = destinationStride - width;
+		DMA2D->OPFCCR = format<Pixel>();
+		DMA2D->OMAR = uint32_t(destination);
+		DMA2D->OOR = destinationStride - width;
+		DMA2D->NLR = (uint32_t(width) << 16) | height;
+		DMA2D->CR |= DMA2D_CR_START;
+		return true;
 	}
 
-	void
-	setPixel(int16_t x, int16_t y) override
+	static inline void
+	wait()
 	{
-		if (x < 0 or 800 <= x or y < 0 or 480 <= y) return;
-		buffer[y * 800 + x] = this->foregroundColor.getValue();
+		while (DMA2D->CR & DMA2D_CR_START) {
+		}
 	}
 
-	void
-	clearPixel(int16_t x, int16_t y) override
+	// Color mode: 0 = ARGB8888, 2 = RGB565
+	template< typename Pixel >
+	static constexpr uint32_t
+	format()
 	{
-		if (x < 0 or 800 <= x or y < 0 or 480 <= y) return;
-		buffer[y * 800 + x] = this->backgroundColor.getValue();
+		return (sizeof(Pixel) == 2) ? 2 : 0;
 	}
+};
 
-	bool
-	getPixel(int16_t x, int16_t y) override
+// Display running on the memory mapped buffer
+class DsiDisplay : public xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, 800, 480, Dma2d>
+{
+public:
+	DsiDisplay() :
+		BufferedColorDisplay(new (xpcc::MemoryExternal) uint16_t[800*480])
 	{
-		if (x < 0 or 800 <= x or y < 0 or 480 <= y) return false;
-		return (buffer[y * 800 + x] != this->backgroundColor.getValue());
+		RCC->AHB1ENR |= RCC_AHB1ENR_DMA2DEN;
+		Board::setDisplayBuffer((void *) this->buffer);
 	}
 
-protected:
-	uint16_t * const buffer;
+	void
+	update() override
+	{
+		this->waitForAccelerator();
+		// FIXME: avoid tearing by using double buffering!
+	}
 };
 
 void
@@ -0,0 +1,246 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/detect.hpp>
+
+#ifdef XPCC__OS_HOSTED
+
+#include <cstdlib>
+#include "heap.hpp"
+
+namespace
+{
+	// Every block starts with a header, the size includes the header and is
+	// a multiple of the alignment.
+	struct alignas(std::max_align_t) Header
+	{
+		std::size_t size;
+		bool used;
+	};
+
+	constexpr std::size_t alignment = alignof(std::max_align_t);
+
+	struct Region
+	{
+		uint16_t traits;
+		uint8_t *start;
+		uint8_t *end;
+
+		std::size_t used;
+		std::size_t peak;
+		std::size_t failed;
+	};
+
+	Region regions[xpcc::hosted::Heap::MaxRegions];
+	uint8_t regionCount = 0;
+
+	inline Header *
+	getHeader(uint8_t *ptr)
+	{
+		return reinterpret_cast<Header *>(ptr);
+	}
+
+	/// Merges all free blocks directly following \p block into it
+	void
+	merge(Region& region, Header *block)
+	{
+		uint8_t *next = reinterpret_cast<uint8_t *>(block) + block->size;
+		while (next < region.end && !getHeader(next)->used)
+		{
+			block->size += getHeader(next)->size;
+			next += getHeader(next)->size;
+		}
+	}
+
+	void *
+	allocateFromRegion(Region& region, std::size_t size)
+	{
+		const std::size_t needed = sizeof(Header) +
+				((size + alignment - 1) / alignment) * alignment;
+
+		for (uint8_t *ptr = region.start; ptr < region.end; ptr += getHeader(ptr)->size)
+		{
+			Header *block = getHeader(ptr);
+			if (block->used) {
+				continue;
+			}
+
+			merge(region, block);
+			if (block->size < needed) {
+				continue;
+			}
+
+			// split the block if the rest is large enough for another one
+			if (block->size - needed >= sizeof(Header) + alignment)
+			{
+				Header *rest = getHeader(ptr + needed);
+				rest->size = block->size - needed;
+				rest->used = false;
+				block->size = needed;
+			}
+			block->used = true;
+
+			region.used += block->size;
+			if (region.used > region.peak) {
+				region.peak = region.used;
+			}
+			return ptr + sizeof(Header);
+		}
+
+		region.failed++;
+		return nullptr;
+	}
+}
+
+// ----------------------------------------------------------------------------
+uint8_t
+xpcc::hosted::Heap::Statistics::getFragmentation() const
+{
+	const std::size_t available = size - used;
+	if (available == 0) {
+		return 0;
+	}
+	return 100 - (largestFree * 100) / available;
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::hosted::Heap::addRegion(MemoryTraits traits, std::size_t size)
+{
+	size = (size / alignment) * alignment;
+	if (regionCount >= MaxRegions || size < sizeof(Header) + alignment) {
+		return false;
+	}
+
+	uint8_t *memory = static_cast<uint8_t *>(std::malloc(size));
+	if (memory == nullptr) {
+		return false;
+	}
+
+	Region& region = regions[regionCount];
+	region.traits = traits.value;
+	region.start = memory;
+	region.end = memory + size;
+	region.used = 0;
+	region.peak = 0;
+	region.failed = 0;
+
+	Header *block = getHeader(memory);
+	block->size = size;
+	block->used = false;
+
+	regionCount++;
+	return true;
+}
+
+void
+xpcc::hosted::Heap::removeRegions()
+{
+	for (uint8_t i = 0; i < regionCount; ++i) {
+		std::free(regions[i].start);
+	}
+	regionCount = 0;
+}
+
+uint8_t
+xpcc::hosted::Heap::getRegionCount()
+{
+	return regionCount;
+}
+
+// ----------------------------------------------------------------------------
+void *
+xpcc::hosted::Heap::allocate(std::size_t size, MemoryTraits memoryTraits)
+{
+	uint16_t traits = memoryTraits.value;
+	while (true)
+	{
+		for (uint8_t i = 0; i < regionCount; ++i)
+		{
+			if ((regions[i].traits & traits) == traits)
+			{
+				void *ptr = allocateFromRegion(regions[i], size);
+				if (ptr) {
+					return ptr;
+				}
+			}
+		}
+
+		// same fallback as malloc_tr() of the Cortex-M targets:
+		// clear the types core coupled and external, but not non-volatile
+		const uint16_t clearMask = uint16_t(MemoryTrait::TypeCoreCoupled) |
+				uint16_t(MemoryTrait::TypeExternal);
+		const uint16_t setMask = uint16_t(MemoryTrait::AccessSBus);
+		if (traits & clearMask) {
+			traits &= ~clearMask;
+		}
+		// then set the S-Bus and try again
+		else if (!(traits & setMask)) {
+			traits |= setMask;
+		}
+		else {
+			return nullptr;
+		}
+	}
+}
+
+bool
+xpcc::hosted::Heap::free(void *ptr)
+{
+	uint8_t *memory = static_cast<uint8_t *>(ptr);
+	for (uint8_t i = 0; i < regionCount; ++i)
+	{
+		Region& region = regions[i];
+		if (region.start < memory && memory < region.end)
+		{
+			Header *block = getHeader(memory - sizeof(Header));
+			block->used = false;
+			region.used -= block->size;
+			merge(region, block);
+			return true;
+		}
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::hosted::Heap::Statistics
+xpcc::hosted::Heap::getStatistics(uint8_t index)
+{
+	Statistics statistics = Statistics();
+	if (index >= regionCount) {
+		return statistics;
+	}
+
+	const Region& region = regions[index];
+	statistics.traits = MemoryTraits(region.traits);
+	statistics.size = region.end - region.start;
+	statistics.used = region.used;
+	statistics.peak = region.peak;
+	statistics.failed = region.failed;
+
+	// adjacent free blocks are not always merged, sum them up
+	std::size_t length = 0;
+	for (uint8_t *ptr = region.start; ptr < region.end; ptr += getHeader(ptr)->size)
+	{
+		if (getHeader(ptr)->used) {
+			length = 0;
+		}
+		else
+		{
+			length += getHeader(ptr)->size;
+			if (length > statistics.largestFree) {
+				statistics.largestFree = length;
+			}
+		}
+	}
+	return statistics;
+}
+
+#endif
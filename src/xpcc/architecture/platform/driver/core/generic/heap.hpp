@@ -0,0 +1,122 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_HOSTED_HEAP_HPP
+#define XPCC_HOSTED_HEAP_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/architecture/interface/memory.hpp>
+
+namespace xpcc
+{
+	namespace hosted
+	{
+		/**
+		 * \brief	Emulation of the multi-region heap of the Cortex-M targets
+		 *
+		 * On the Cortex-M targets every memory region (SRAM, CCM, SDRAM, ...)
+		 * has its own heap tagged with memory traits, `new (traits)` and
+		 * xpcc::allocator::Traits pick the region. On hosted targets all
+		 * memory is equal, so without emulation the traits are ignored.
+		 *
+		 * Adding regions here makes `new (traits)` behave like on the
+		 * target: the memory comes from a region with matching traits,
+		 * with the same fallback rules if the region is exhausted (first
+		 * without the core-coupled and external traits, then with S-Bus
+		 * access). Memory from the regions is released with the normal
+		 * `delete`. Allocations without traits still use the system heap.
+		 *
+		 * Each region keeps statistics, so the memory layout of an
+		 * application can be dimensioned on the PC:
+		 * \code
+		 * // memory of a STM32F429 with external SDRAM
+		 * xpcc::hosted::Heap::addRegion(xpcc::MemoryDMA | xpcc::MemoryTrait::AccessDBus, 112 * 1024);
+		 * xpcc::hosted::Heap::addRegion(xpcc::MemoryFastData, 64 * 1024);
+		 * xpcc::hosted::Heap::addRegion(xpcc::MemoryExternal | xpcc::MemoryTrait::AccessDMA2D,
+		 *         8 * 1024 * 1024);
+		 *
+		 * runApplication();
+		 *
+		 * for (uint8_t i = 0; i < xpcc::hosted::Heap::getRegionCount(); ++i) {
+		 *     auto s = xpcc::hosted::Heap::getStatistics(i);
+		 *     XPCC_LOG_INFO << i << ": peak=" << s.peak << " failed=" << s.failed << xpcc::endl;
+		 * }
+		 * \endcode
+		 *
+		 * The regions are first-fit heaps, not TLSF. The emulation is not
+		 * thread-safe, add the regions before starting other threads.
+		 *
+		 * \ingroup	linux
+		 */
+		class Heap
+		{
+		public:
+			static constexpr uint8_t MaxRegions = 6;
+
+			struct Statistics
+			{
+				MemoryTraits traits;
+				std::size_t size;			///< Size of the region in bytes
+				std::size_t used;			///< Bytes in use including block headers
+				std::size_t peak;			///< Maximum of \c used
+				std::size_t failed;			///< Requests which did not fit into this region
+				std::size_t largestFree;	///< Largest contiguous free block in bytes
+
+				/// 0 if all free memory is one block, close to 100 if it
+				/// is split into many small blocks
+				uint8_t
+				getFragmentation() const;
+			};
+
+		public:
+			/**
+			 * \brief	Add a memory region
+			 *
+			 * Regions are searched in the order in which they are added.
+			 *
+			 * \return	\c false if no more regions are available
+			 */
+			static bool
+			addRegion(MemoryTraits traits, std::size_t size);
+
+			/// Remove all regions, all memory allocated from them is invalid
+			static void
+			removeRegions();
+
+			static uint8_t
+			getRegionCount();
+
+			/**
+			 * \brief	Allocate memory with the given traits
+			 *
+			 * Uses the same rules as `malloc_tr()` on the Cortex-M targets.
+			 *
+			 * \return	Memory aligned for any type, or a null pointer if no
+			 * 			region (including fallbacks) has enough memory left
+			 */
+			static void *
+			allocate(std::size_t size, MemoryTraits traits);
+
+			/**
+			 * \brief	Release memory if it belongs to one of the regions
+			 *
+			 * \return	\c false if \p ptr was not allocated by allocate()
+			 */
+			static bool
+			free(void *ptr);
+
+			static Statistics
+			getStatistics(uint8_t region);
+		};
+	}
+}
+
+#endif // XPCC_HOSTED_HEAP_HPP
@@ -12,18 +12,108 @@
 #ifdef XPCC__OS_HOSTED
 
 #include <xpcc/architecture/interface/memory.hpp>
+#include <xpcc/architecture/interface/assert.hpp>
 #include <stdlib.h>
+#include <new>
+
+#include "heap.hpp"
+
+// The operators are replaced as a set, so that memory from new is always
+// released by the matching delete.
+void *
+operator new(size_t size)
+{
+	void * ptr = malloc(size ? size : 1);
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
 
 void *
-operator new(size_t size, xpcc::MemoryTraits)
+operator new[](size_t size)
 {
 	return ::operator new(size);
 }
 
 void *
-operator new[](size_t size, xpcc::MemoryTraits)
+operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return malloc(size ? size : 1);
+}
+
+void *
+operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return malloc(size ? size : 1);
+}
+
+// Without emulated regions the traits are ignored, otherwise the memory
+// comes from the region with the matching traits. See xpcc::hosted::Heap.
+void *
+operator new(size_t size, xpcc::MemoryTraits traits)
+{
+	if (xpcc::hosted::Heap::getRegionCount() == 0) {
+		return ::operator new(size);
+	}
+	void * ptr = xpcc::hosted::Heap::allocate(size, traits);
+	xpcc_assert(ptr, "core", "heap", "new", size);
+	return ptr;
+}
+
+void *
+operator new[](size_t size, xpcc::MemoryTraits traits)
+{
+	if (xpcc::hosted::Heap::getRegionCount() == 0) {
+		return ::operator new[](size);
+	}
+	void * ptr = xpcc::hosted::Heap::allocate(size, traits);
+	xpcc_assert(ptr, "core", "heap", "new", size);
+	return ptr;
+}
+
+// Everything not allocated from an emulated region is returned with free().
+// Heap::free() only compares the address with the region bounds in that
+// case, which do not change after the regions were added.
+void
+operator delete(void *ptr) noexcept
+{
+	if (ptr == nullptr) {
+		return;
+	}
+	if (xpcc::hosted::Heap::getRegionCount() == 0 || !xpcc::hosted::Heap::free(ptr)) {
+		free(ptr);
+	}
+}
+
+void
+operator delete(void *ptr, const std::nothrow_t&) noexcept
+{
+	::operator delete(ptr);
+}
+
+void
+operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{
+	::operator delete(ptr);
+}
+
+void
+operator delete(void* ptr, size_t) noexcept
+{
+	::operator delete(ptr);
+}
+
+void
+operator delete[](void* ptr) noexcept
+{
+	::operator delete(ptr);
+}
+
+void
+operator delete[](void* ptr, size_t) noexcept
 {
-	return ::operator new[](size);
+	::operator delete(ptr);
 }
 
 #endif
@@ -0,0 +1,103 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_HEADLESS_DISPLAY_HPP
+#define XPCC_HEADLESS_DISPLAY_HPP
+
+#include <xpcc/ui/display/buffered_color_display.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Display without a screen, drawing into memory only
+	 *
+	 * Renders exactly like a color display with a frame buffer, but needs
+	 * neither SDL nor a window, so that drawing code can be tested and
+	 * benchmarked on a build server. The result is compared by its hash or
+	 * written into an image file:
+	 *
+	 * \code
+	 * xpcc::HeadlessDisplay<320, 240> display;
+	 *
+	 * display.clear();
+	 * display.drawCircle(xpcc::glcd::Point(160, 120), 50);
+	 *
+	 * if (display.getHash() != 0x...) {
+	 *     display.writePpm("circle.ppm");
+	 * }
+	 * \endcode
+	 *
+	 * The frame buffer is allocated on the heap.
+	 *
+	 * \tparam	Width	Width of the display
+	 * \tparam	Height	Height of the display
+	 * \tparam	Format	Pixel format of the frame buffer
+	 *
+	 * \ingroup	graphics
+	 */
+	template <uint16_t Width, uint16_t Height, typename Format = glcd::Rgb565>
+	class HeadlessDisplay : public BufferedColorDisplay<Format, Width, Height>
+	{
+	public:
+		HeadlessDisplay();
+
+		virtual
+		~HeadlessDisplay();
+
+		/// Only counts the updates
+		virtual void
+		update()
+		{
+			this->updates++;
+		}
+
+		/// Number of calls to update() since the construction
+		inline uint32_t
+		getUpdateCount() const
+		{
+			return this->updates;
+		}
+
+		/**
+		 * \brief	64 bit FNV-1a hash of the image
+		 *
+		 * Calculated over the red, green and blue byte of every pixel, row
+		 * by row, as they are written by writePpm(). The hash is therefore
+		 * independent of the host and of the pixel format, as long as the
+		 * format does not change the colors (e.g. by blending).
+		 */
+		uint64_t
+		getHash() const;
+
+		/**
+		 * \brief	Write the image in color as binary PPM (`P6`)
+		 *
+		 * \return	\c false if the file could not be written
+		 */
+		bool
+		writePpm(const char* filename) const;
+
+		/**
+		 * \brief	Write the image as binary PBM (`P4`)
+		 *
+		 * Every pixel which differs from the background color is black.
+		 *
+		 * \return	\c false if the file could not be written
+		 */
+		bool
+		writePbm(const char* filename) const;
+
+	private:
+		uint32_t updates;
+	};
+}
+
+#include "headless_display_impl.hpp"
+
+#endif // XPCC_HEADLESS_DISPLAY_HPP
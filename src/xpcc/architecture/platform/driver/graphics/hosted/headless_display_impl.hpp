@@ -0,0 +1,112 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_HEADLESS_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'headless_display.hpp' instead!"
+#endif
+
+#include <stdio.h>
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height, typename Format>
+xpcc::HeadlessDisplay<Width, Height, Format>::HeadlessDisplay() :
+	BufferedColorDisplay<Format, Width, Height>(
+			new typename Format::Pixel[uint32_t(Width) * Height]),
+	updates(0)
+{
+	this->clear();
+}
+
+template <uint16_t Width, uint16_t Height, typename Format>
+xpcc::HeadlessDisplay<Width, Height, Format>::~HeadlessDisplay()
+{
+	delete[] this->buffer;
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height, typename Format>
+uint64_t
+xpcc::HeadlessDisplay<Width, Height, Format>::getHash() const
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (uint32_t ii = 0; ii < uint32_t(Width) * Height; ++ii)
+	{
+		const uint32_t argb = Format::toArgb(this->buffer[ii]);
+		const uint8_t rgb[3] = { uint8_t(argb >> 16), uint8_t(argb >> 8), uint8_t(argb) };
+		for (uint8_t byte : rgb)
+		{
+			hash ^= byte;
+			hash *= 0x100000001b3ull;
+		}
+	}
+	return hash;
+}
+
+template <uint16_t Width, uint16_t Height, typename Format>
+bool
+xpcc::HeadlessDisplay<Width, Height, Format>::writePpm(const char* filename) const
+{
+	FILE* file = fopen(filename, "wb");
+	if (file == NULL) {
+		return false;
+	}
+
+	fprintf(file, "P6\n%u %u\n255\n", Width, Height);
+
+	uint8_t row[Width * 3];
+	const typename Format::Pixel* pixel = this->buffer;
+	bool success = true;
+	for (uint_fast16_t y = 0; y < Height and success; ++y)
+	{
+		for (uint_fast16_t x = 0; x < Width; ++x, ++pixel)
+		{
+			const uint32_t argb = Format::toArgb(*pixel);
+			row[x * 3] = argb >> 16;
+			row[x * 3 + 1] = argb >> 8;
+			row[x * 3 + 2] = argb;
+		}
+		success = (fwrite(row, sizeof(row), 1, file) == 1);
+	}
+
+	return (fclose(file) == 0) and success;
+}
+
+template <uint16_t Width, uint16_t Height, typename Format>
+bool
+xpcc::HeadlessDisplay<Width, Height, Format>::writePbm(const char* filename) const
+{
+	FILE* file = fopen(filename, "wb");
+	if (file == NULL) {
+		return false;
+	}
+
+	fprintf(file, "P4\n%u %u\n", Width, Height);
+
+	const typename Format::Pixel background = Format::fromColor(this->backgroundColor);
+
+	// every row starts with a new byte, the MSB is the leftmost pixel
+	uint8_t row[(Width + 7) / 8];
+	const typename Format::Pixel* pixel = this->buffer;
+	bool success = true;
+	for (uint_fast16_t y = 0; y < Height and success; ++y)
+	{
+		for (uint_fast16_t x = 0; x < sizeof(row); ++x) {
+			row[x] = 0;
+		}
+		for (uint_fast16_t x = 0; x < Width; ++x, ++pixel)
+		{
+			if (*pixel != background) {
+				row[x / 8] |= 0x80 >> (x % 8);
+			}
+		}
+		success = (fwrite(row, sizeof(row), 1, file) == 1);
+	}
+
+	return (fclose(file) == 0) and success;
+}
@@ -1,5 +1,7 @@
 #include "sdl_display.hpp"
 
+#include <algorithm>
+
 xpcc::SDLDisplay::SDLDisplay(int16_t width, int16_t height):
 	width(width), height(height), memory(0), screen(0)
 {
@@ -54,6 +56,18 @@ xpcc::SDLDisplay::getPixel(int16_t x, int16_t y)
 	return 	this->memory[y*this->width+x];
 }
 
+void
+xpcc::SDLDisplay::fillSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	std::fill(this->memory + y*this->width + x0, this->memory + y*this->width + x1 + 1, true);
+}
+
+void
+xpcc::SDLDisplay::clearSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	std::fill(this->memory + y*this->width + x0, this->memory + y*this->width + x1 + 1, false);
+}
+
 void
 xpcc::SDLDisplay::setPixelOnScreen(int16_t x, int16_t y, bool value)
 {
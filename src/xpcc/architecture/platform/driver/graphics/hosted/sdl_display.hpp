@@ -84,6 +84,12 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
  	private:
 
 		void setPixelOnScreen(int16_t x, int16_t y, bool value);
@@ -33,6 +33,8 @@
 
 #include <string>
 #include <queue>
+// boost/asio/awaitable.hpp uses std::exchange without including it (C++20)
+#include <utility>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/thread/mutex.hpp>
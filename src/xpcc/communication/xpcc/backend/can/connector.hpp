@@ -32,8 +32,37 @@
 #define	XPCC__CAN_CONNECTOR_HPP
 
 #include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/intrusive_linked_list.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
 #include "../backend_interface.hpp"
 
+/**
+ * Number of messages the CanConnector can queue for sending. If not zero
+ * the lists use static pools (xpcc::allocator::Static) instead of the
+ * heap, the two receive lists share a pool of twice this size.
+ *
+ * The pools belong to the type, not to the object: all CanConnectors
+ * with the same Driver share them, e.g. two connectors on the same CAN
+ * driver class together can queue only this number of messages.
+ *
+ * \ingroup	backend
+ */
+#ifndef XPCC_CAN_CONNECTOR_POOL_SIZE
+#	define XPCC_CAN_CONNECTOR_POOL_SIZE 0
+#endif
+
+/**
+ * Link the messages of the CanConnector with intrusive lists. The messages
+ * are then constructed directly in their list entries and a completely
+ * received fragmented message is moved to the list of received messages
+ * without a copy.
+ *
+ * \ingroup	backend
+ */
+#ifndef XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+#	define XPCC_CAN_CONNECTOR_INTRUSIVE_LIST 0
+#endif
+
 // Filter
 #define XPCC_CAN_PACKET_DESTINATION(x)		(static_cast<uint32_t>(x) << 16)
 #define XPCC_CAN_PACKET_SOURCE(x)			(static_cast<uint32_t>(x) << 8)
@@ -185,7 +214,11 @@ namespace xpcc
 		retrieveMessage();
 
 	protected:
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+		class SendListItem : public xpcc::IntrusiveLinkedListHook<>
+#else
 		class SendListItem
+#endif
 		{
 		public:
 			SendListItem(const uint32_t & inIdentifier,
@@ -213,7 +246,11 @@ namespace xpcc
 			operator = (const SendListItem& other);
 		};
 
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+		class ReceiveListItem : public xpcc::IntrusiveDoublyLinkedListHook<>
+#else
 		class ReceiveListItem
+#endif
 		{
 		public:
 			ReceiveListItem(uint8_t size, const Header& inHeader,
@@ -242,13 +279,38 @@ namespace xpcc
 			operator = (const ReceiveListItem& other);
 		};
 
-		typedef xpcc::LinkedList< SendListItem > SendList;
-		typedef xpcc::LinkedList< ReceiveListItem > ReceiveList;
+#if XPCC_CAN_CONNECTOR_POOL_SIZE > 0
+		typedef xpcc::allocator::Static< SendListItem, XPCC_CAN_CONNECTOR_POOL_SIZE > SendAllocator;
+		typedef xpcc::allocator::Static< ReceiveListItem, 2 * XPCC_CAN_CONNECTOR_POOL_SIZE > ReceiveAllocator;
+#else
+		typedef xpcc::allocator::Dynamic< SendListItem > SendAllocator;
+		typedef xpcc::allocator::Dynamic< ReceiveListItem > ReceiveAllocator;
+#endif
+
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+		typedef xpcc::IntrusiveLinkedList< SendListItem > SendList;
+		typedef xpcc::IntrusiveDoublyLinkedList< ReceiveListItem > ReceiveList;
+#else
+		typedef xpcc::LinkedList< SendListItem, SendAllocator > SendList;
+		typedef xpcc::LinkedList< ReceiveListItem, ReceiveAllocator > ReceiveList;
+#endif
+
+		/// Removes and frees the first message of the send list
+		void
+		removeSendListFront();
+
+		/// Removes and frees the first message of a receive list
+		void
+		removeFront(ReceiveList& list);
 
 	protected:
 		SendList sendList;
 		ReceiveList pendingMessages;
 		ReceiveList receivedMessages;
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+		SendAllocator sendAllocator;
+		ReceiveAllocator receiveAllocator;
+#endif
 
 		Driver *canDriver;
 	};
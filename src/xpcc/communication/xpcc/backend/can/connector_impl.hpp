@@ -45,6 +45,18 @@ xpcc::CanConnector<Driver>::CanConnector(Driver *driver) :
 template<typename Driver>
 xpcc::CanConnector<Driver>::~CanConnector()
 {
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+	// the lists do not own the messages
+	while (!this->sendList.isEmpty()) {
+		this->removeSendListFront();
+	}
+	while (!this->pendingMessages.isEmpty()) {
+		this->removeFront(this->pendingMessages);
+	}
+	while (!this->receivedMessages.isEmpty()) {
+		this->removeFront(this->receivedMessages);
+	}
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -88,7 +100,14 @@ xpcc::CanConnector<Driver>::sendPacket(const Header &header, SmartPointer payloa
 	if (!successful)
 	{
 		// append the message to the list of waiting messages
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+		SendListItem* item = this->sendAllocator.allocate(1);
+		if (item != nullptr) {
+			this->sendList.append(*new (item) SendListItem(identifier, payload));
+		}
+#else
 		this->sendList.append(SendListItem(identifier, payload));
+#endif
 	}
 }
 
@@ -97,7 +116,7 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::dropPacket()
 {
-	this->receivedMessages.removeFront();
+	this->removeFront(this->receivedMessages);
 }
 
 // ----------------------------------------------------------------------------
@@ -139,7 +158,7 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 	else if (canDriver->getBusState() != Driver::BusState::Connected) {
 		// No connection to the CAN bus, drop all messages which should be send
 		while (!sendList.isEmpty()) {
-			sendList.removeFront();
+			this->removeSendListFront();
 		}
 		return;
 	}
@@ -175,7 +194,7 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 			{
 				// message was the last fragment
 				// => remove it from the list
-				this->sendList.removeFront();
+				this->removeSendListFront();
 				this->messageCounter += 0x10;
 			}
 		}
@@ -185,7 +204,7 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 		if (this->sendMessage(message.identifier, message.payload.getPointer(),
 				messageSize))
 		{
-			this->sendList.removeFront();
+			this->removeSendListFront();
 		}
 	}
 }
@@ -202,7 +221,18 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 
 		if (!isFragment)
 		{
-			this->receivedMessages.append(ReceiveListItem(message.length, header));
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+			ReceiveListItem* item = this->receiveAllocator.allocate(1);
+			if (item == nullptr) {
+				// out of memory, drop the message
+				return false;
+			}
+			this->receivedMessages.append(*new (item) ReceiveListItem(message.length, header));
+#else
+			if (!this->receivedMessages.append(ReceiveListItem(message.length, header))) {
+				return false;
+			}
+#endif
 			std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
 					message.data,
 					message.length);
@@ -261,7 +291,17 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			if (packet == this->pendingMessages.end()) {
 				// message not found => first part of this message,
 				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+				ReceiveListItem* item = this->receiveAllocator.allocate(1);
+				if (item == nullptr) {
+					return false;
+				}
+				this->pendingMessages.prepend(*new (item) ReceiveListItem(messageSize, header, counter));
+#else
+				if (!this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter))) {
+					return false;
+				}
+#endif
 				packet = this->pendingMessages.begin();
 			}
 
@@ -284,8 +324,13 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			// for more messages
 			if (xpcc::bitCount(packet->receivedFragments) == numberOfFragments)
 			{
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+				// moves the message without copying it
+				this->receivedMessages.append(*packet);
+#else
 				this->receivedMessages.append(*packet);
 				this->pendingMessages.remove(packet);
+#endif
 			}
 		}
 
@@ -295,3 +340,34 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 		return false;
 	}
 }
+
+// ----------------------------------------------------------------------------
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::removeSendListFront()
+{
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+	SendListItem* item = &this->sendList.getFront();
+	this->sendList.removeFront();
+
+	item->~SendListItem();
+	this->sendAllocator.deallocate(item);
+#else
+	this->sendList.removeFront();
+#endif
+}
+
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::removeFront(ReceiveList& list)
+{
+#if XPCC_CAN_CONNECTOR_INTRUSIVE_LIST
+	ReceiveListItem* item = &list.getFront();
+	list.removeFront();
+
+	item->~ReceiveListItem();
+	this->receiveAllocator.deallocate(item);
+#else
+	list.removeFront();
+#endif
+}
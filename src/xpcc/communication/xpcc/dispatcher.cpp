@@ -40,6 +40,16 @@ xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
 {
 }
 
+xpcc::Dispatcher::~Dispatcher()
+{
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+	// the list does not own the entries
+	while (!this->entries.isEmpty()) {
+		this->removeEntry(this->entries.begin());
+	}
+#endif
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::update()
@@ -123,7 +133,7 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 			// waiting for ack, no response can be handled
 			if (entry->headerFits(header))
 			{
-				entry = this->entries.remove(entry);
+				entry = this->removeEntry(entry);
 				return;
 			}
 		}
@@ -152,7 +162,7 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 						// cannot happen, since responses with callbacks are
 						// not possible
 					}
-					entry = this->entries.remove(entry);
+					entry = this->removeEntry(entry);
 				}
 				return;
 			}
@@ -182,7 +192,7 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 			return entry;
 		}
 		else {
-			return this->entries.remove(entry);
+			return this->removeEntry(entry);
 		}
 	}
 	else
@@ -207,17 +217,32 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 				{
 					req->callbackResponse(entry->header, entry->payload);
 				}
-				this->entries.remove(req);
+				this->removeEntry(req);
 				break;
 			}
 		}
 		
-		return this->entries.remove(entry);
+		return this->removeEntry(entry);
 	}
 	
 	return entry;
 }
 
+xpcc::Dispatcher::EntryIterator
+xpcc::Dispatcher::removeEntry(EntryIterator entry)
+{
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+	Entry* value = &(*entry);
+	EntryIterator next = this->entries.remove(entry);
+
+	value->~Entry();
+	this->entryAllocator.deallocate(value);
+	return next;
+#else
+	return this->entries.remove(entry);
+#endif
+}
+
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
@@ -232,7 +257,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 				postman->deliverPacket(entry->header, entry->payload);
 				backend->sendPacket(entry->header, entry->payload);
 
-				entry = this->entries.remove(entry);
+				entry = this->removeEntry(entry);
 				continue;
 			}
 			else
@@ -263,7 +288,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 				if (entry->tries >= 2)
 				{
 					// TODO do sth to notify the user
-					entry = this->entries.remove(entry);
+					entry = this->removeEntry(entry);
 					continue;
 				}
 				else
@@ -292,14 +317,28 @@ void
 xpcc::Dispatcher::addMessage(const Header& header,
 		SmartPointer& smartPayload)
 {
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+	Entry* entry = this->entryAllocator.allocate(1);
+	if (entry != nullptr) {
+		this->entries.append(*new (entry) Entry(header, smartPayload));
+	}
+#else
 	this->entries.append(Entry(header, smartPayload));
+#endif
 }
 
 void
 xpcc::Dispatcher::addMessage(const Header& header,
 		SmartPointer& smartPayload, ResponseCallback& responseCallback)
 {
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+	Entry* entry = this->entryAllocator.allocate(1);
+	if (entry != nullptr) {
+		this->entries.append(*new (entry) Entry(header, smartPayload, responseCallback));
+	}
+#else
 	this->entries.append(Entry(header, smartPayload, responseCallback));
+#endif
 }
 
 void
@@ -315,5 +354,12 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	// but now responses are handled in reverse order that's not good
 	// what to do? a separator between responses and requests possible?
 
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+	Entry* entry = this->entryAllocator.allocate(1);
+	if (entry != nullptr) {
+		this->entries.prepend(*new (entry) Entry(header, smartPayload));
+	}
+#else
 	this->entries.prepend(Entry(header, smartPayload));
+#endif
 }
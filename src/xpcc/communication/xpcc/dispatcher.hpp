@@ -33,12 +33,45 @@
 
 #include <xpcc/processing/timer.hpp>
 #include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
 
 #include "backend/backend_interface.hpp"
 #include "postman/postman.hpp"
 
 #include "response_callback.hpp"
 
+/**
+ * Number of messages the dispatcher can hold in a static pool. The default
+ * of zero allocates the list entries on the heap.
+ *
+ * \ingroup	xpcc_comm
+ */
+#ifndef XPCC_DISPATCHER_POOL_SIZE
+#	define XPCC_DISPATCHER_POOL_SIZE 0
+#endif
+
+/**
+ * Link the messages of the dispatcher with an intrusive list. Every message
+ * is then constructed directly in its list entry instead of being copied
+ * into a newly allocated list node, and removing a message is O(1).
+ * The entries are allocated as configured by XPCC_DISPATCHER_POOL_SIZE and
+ * XPCC_DISPATCHER_MEMORY_TRAITS.
+ *
+ * \ingroup	xpcc_comm
+ */
+#ifndef XPCC_DISPATCHER_INTRUSIVE_LIST
+#	define XPCC_DISPATCHER_INTRUSIVE_LIST 0
+#endif
+
+/**
+ * \def	XPCC_DISPATCHER_MEMORY_TRAITS
+ * Memory traits for the heap allocated list entries of the dispatcher, e.g.
+ * \c xpcc::MemoryFastData.value to keep them in the core-coupled memory.
+ * Not defined by default, the entries then use the default heap.
+ *
+ * \ingroup	xpcc_comm
+ */
+
 namespace xpcc
 {
 	/**
@@ -58,6 +91,8 @@ namespace xpcc
 	public:
 		Dispatcher(BackendInterface *backend, Postman* postman);
 
+		~Dispatcher();
+
 		void
 		update();
 
@@ -74,7 +109,11 @@ namespace xpcc
 		 * \brief 	This class holds information about a Message being send.
 		 * 			This is the superclass of all entries.
 		 */
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+		class Entry : public IntrusiveDoublyLinkedListHook<>
+#else
 		class Entry
+#endif
 		{
 		public:
 			enum class Type
@@ -164,16 +203,35 @@ namespace xpcc
 		void
 		sendAcknowledge(const Header& header);
 
-		using EntryList = LinkedList<Entry>;
+#if XPCC_DISPATCHER_POOL_SIZE > 0
+		using EntryAllocator = allocator::Static<Entry, XPCC_DISPATCHER_POOL_SIZE>;
+#elif defined(XPCC_DISPATCHER_MEMORY_TRAITS)
+		using EntryAllocator = allocator::Traits<Entry, XPCC_DISPATCHER_MEMORY_TRAITS>;
+#else
+		using EntryAllocator = allocator::Dynamic<Entry>;
+#endif
+
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+		using EntryList = IntrusiveDoublyLinkedList<Entry>;
+#else
+		using EntryList = LinkedList<Entry, EntryAllocator>;
+#endif
 		using EntryIterator = EntryList::iterator;
 
 		EntryIterator
 		sendMessageToInnerComponent(EntryIterator entry);
 
+		/// Removes the entry from the list and frees it
+		EntryIterator
+		removeEntry(EntryIterator entry);
+
 		BackendInterface * const backend;
 		Postman * const postman;
 
 		EntryList entries;
+#if XPCC_DISPATCHER_INTRUSIVE_LIST
+		EntryAllocator entryAllocator;
+#endif
 
 	private:
 		friend class Communicator;
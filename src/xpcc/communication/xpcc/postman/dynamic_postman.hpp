@@ -15,6 +15,8 @@
 #include "../backend/header.hpp"
 #include "../response_handle.hpp"
 
+#include <xpcc/container/hash_map.hpp>
+
 #include <map>
 #include <functional>
 
@@ -102,14 +104,25 @@ private:
 	/// packetIdentifier -> callback
 	typedef std::multimap<uint8_t, EventListener> EventMap;
 
-	/// packetIdentifier -> callback
-	typedef std::map<uint8_t, ActionHandler > CallbackMap;
-	///< destination -> callbackMap
-	typedef std::map<uint8_t, CallbackMap > ActionMap;
+	/// (destination, packetIdentifier) -> callback, see getActionKey()
+	typedef xpcc::HashMap<uint16_t, ActionHandler> ActionMap;
+	/// destinations with at least one callback
+	typedef xpcc::HashSet<uint8_t> ComponentSet;
+
+	static inline uint16_t
+	getActionKey(uint8_t component, uint8_t action)
+	{
+		return (static_cast<uint16_t>(component) << 8) | action;
+	}
+
+	/// Adds or replaces the handler
+	bool
+	addActionHandler(uint8_t componentId, uint8_t actionId, const ActionHandler& handler);
 
 private:
 	EventMap eventMap;
 	ActionMap actionMap;
+	ComponentSet componentSet;
 };
 
 }	// namespace xpcc
@@ -36,19 +36,16 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const SmartPointer& pa
 	else
 	{
 		// REQUEST
-		ActionMap::const_iterator iterDestination(this->actionMap.find(header.destination));
-		if (iterDestination != this->actionMap.end())
+		const ActionHandler* handler = this->actionMap.get(
+				getActionKey(header.destination, header.packetIdentifier));
+		if (handler != nullptr)
 		{
-			CallbackMap::const_iterator iterCallback(iterDestination->second.find(header.packetIdentifier));
-			if (iterCallback != iterDestination->second.end())
-			{
-				xpcc::ResponseHandle response(header);
-				iterCallback->second(response, payload);
-				return OK;
-			}
-			else {
-				return NO_ACTION;
-			}
+			xpcc::ResponseHandle response(header);
+			(*handler)(response, payload);
+			return OK;
+		}
+		else if (this->isComponentAvailable(header.destination)) {
+			return NO_ACTION;
 		}
 		else {
 			return NO_COMPONENT;
@@ -60,7 +57,25 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const SmartPointer& pa
 bool
 xpcc::DynamicPostman::isComponentAvailable(uint8_t component) const
 {
-	return (this->actionMap.find(component) != this->actionMap.end());
+	return this->componentSet.contains(component);
+}
+
+bool
+xpcc::DynamicPostman::addActionHandler(uint8_t componentId, uint8_t actionId,
+		const ActionHandler& handler)
+{
+	const uint16_t key = getActionKey(componentId, actionId);
+	ActionHandler* existing = this->actionMap.get(key);
+	if (existing != nullptr) {
+		*existing = handler;
+		return true;
+	}
+
+	if (!this->componentSet.contains(componentId) &&
+		!this->componentSet.insert(componentId)) {
+		return false;
+	}
+	return this->actionMap.insert(key, handler);
 }
 
 // ----------------------------------------------------------------------------
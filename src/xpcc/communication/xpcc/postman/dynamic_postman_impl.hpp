@@ -67,14 +67,13 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 {
 	using namespace std::placeholders;
 
-	actionMap[componentId][actionId] = ActionHandler(static_cast<ActionCallbackSimple>(
-			std::bind(
-					memberFunction,
-					componentObject,
-					_1)
-	));
-
-	return true;
+	return addActionHandler(componentId, actionId,
+			ActionHandler(static_cast<ActionCallbackSimple>(
+					std::bind(
+							memberFunction,
+							componentObject,
+							_1)
+			)));
 }
 
 template< class C, typename P >
@@ -87,12 +86,11 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 	using namespace std::placeholders;
 	typedef void (C::*Function)(const ResponseHandle&, const uint8_t&);
 
-	actionMap[componentId][actionId] = ActionHandler(
-			std::bind(
-					reinterpret_cast<Function>(memberFunction),
-					componentObject,
-					_1, _2)
-	);
-
-	return true;
+	return addActionHandler(componentId, actionId,
+			ActionHandler(
+					std::bind(
+							reinterpret_cast<Function>(memberFunction),
+							componentObject,
+							_1, _2)
+			));
 }
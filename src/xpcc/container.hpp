@@ -52,10 +52,25 @@ class independently of the underlying container class used.
 
 Sequence containers:
  - xpcc::DynamicArray
+ - xpcc::SmallArray
  - xpcc::LinkedList
  - xpcc::DoublyLinkedList
  - xpcc::BoundedDeque
 
+Intrusive sequence containers (the links are part of the elements):
+ - xpcc::IntrusiveLinkedList
+ - xpcc::IntrusiveDoublyLinkedList
+
+Associative containers:
+ - xpcc::BoundedHashMap
+ - xpcc::HashMap
+ - xpcc::BoundedHashSet
+ - xpcc::HashSet
+
+Priority queues (with handles to change or remove elements):
+ - xpcc::BoundedHeap
+ - xpcc::Heap
+
 Container adaptors:
  - xpcc::Queue
  - xpcc::Stack
@@ -116,8 +131,14 @@ every one of it, only a subset which is sufficient for the container.
 
 #include "container/linked_list.hpp"
 #include "container/doubly_linked_list.hpp"
+#include "container/intrusive_linked_list.hpp"
+#include "container/intrusive_doubly_linked_list.hpp"
 
 #include "container/dynamic_array.hpp"
+#include "container/small_array.hpp"
+
+#include "container/hash_map.hpp"
+#include "container/heap.hpp"
 
 #include "container/pair.hpp"
 #include "container/smart_pointer.hpp"
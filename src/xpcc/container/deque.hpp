@@ -61,6 +61,26 @@ namespace xpcc
 	 * Up to a size of 254 small index variables with 8-bits are used, after
 	 * this they are switched to 16-bit.
 	 * 
+	 * If \p N is a power of two the indices wrap around by masking instead
+	 * of comparing, which saves a branch in every access.
+	 * 
+	 * Several elements can be added and removed at once with
+	 * append(const T*, Size) and removeFront(Size). getSpans() returns the
+	 * content as (at most) two contiguous blocks of memory, e.g. to hand
+	 * them to a DMA transfer or a \c write() call without copying every
+	 * element on its own:
+	 * 
+	 * \code
+	 * xpcc::BoundedDeque<uint8_t, 64> buffer;
+	 * 
+	 * buffer.append(data, length);
+	 * ...
+	 * xpcc::BoundedDeque<uint8_t, 64>::ConstSpan first, second;
+	 * buffer.getSpans(first, second);
+	 * Uart::write(first.data, first.size);
+	 * buffer.removeFront(first.size);
+	 * \endcode
+	 * 
 	 * \warning	This class don't check if the container is empty before
 	 * 			a pop-operation. You have to do this by yourself!
 	 * 
@@ -79,6 +99,20 @@ namespace xpcc
 		
 		typedef Index Size;
 		
+		/// Contiguous block of elements
+		struct Span
+		{
+			T* data;
+			Size size;
+		};
+		
+		/// Contiguous block of elements
+		struct ConstSpan
+		{
+			const T* data;
+			Size size;
+		};
+		
 	public:
 		BoundedDeque();
 		
@@ -171,6 +205,17 @@ namespace xpcc
 		bool
 		append(const T& value);
 		
+		/**
+		 * \brief	Append \p n items from \p values to the back
+		 * 
+		 * Appends as many items as fit into the deque, at most two
+		 * contiguous blocks are copied.
+		 * 
+		 * \return	number of appended items
+		 */
+		Size
+		append(const T* values, std::size_t n);
+		
 		/**
 		 * \brief	Append an item to the back of the deque overwriting existing items
 		 * 
@@ -199,6 +244,27 @@ namespace xpcc
 		
 		void
 		removeFront();
+		
+		/**
+		 * \brief	Remove up to \p n items from the front
+		 * 
+		 * \return	number of removed items
+		 */
+		Size
+		removeFront(std::size_t n);
+		
+		/**
+		 * \brief	Content of the deque as contiguous blocks
+		 * 
+		 * \p first starts at the front item, \p second contains the items
+		 * which wrapped around to the beginning of the ring buffer and is
+		 * empty otherwise. Appending or removing items invalidates the spans.
+		 */
+		void
+		getSpans(Span& first, Span& second);
+		
+		void
+		getSpans(ConstSpan& first, ConstSpan& second) const;
 	
 	public:
 		/**
@@ -240,6 +306,23 @@ namespace xpcc
 	private:
 		friend class const_iterator;
 		
+		static constexpr bool isPowerOfTwo = ((N & (N - 1)) == 0);
+		
+		/// Index following \p index in the ring buffer
+		static inline Index
+		increment(Index index);
+		
+		/// Index preceding \p index in the ring buffer
+		static inline Index
+		decrement(Index index);
+		
+		/// Maps \p index (< 2N) into the ring buffer
+		static inline Index
+		wrap(std::size_t index);
+		
+		static void
+		copy(T* destination, const T* source, std::size_t n);
+		
 		Index head;
 		Index tail;
 		Size size;
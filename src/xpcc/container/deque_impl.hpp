@@ -130,12 +130,7 @@ template<typename T, std::size_t N>
 const T&
 xpcc::BoundedDeque<T, N>::get(Index n) const
 {
-	if (this->tail + n > N-1) {
-		return this->buffer[this->tail + n - N];
-	}
-	else {
-		return this->buffer[this->tail + n];
-	}
+	return this->buffer[wrap(this->tail + n)];
 }
 
 template<typename T, std::size_t N>
@@ -168,12 +163,7 @@ template<typename T, std::size_t N>
 const T&
 xpcc::BoundedDeque<T, N>::rget(Index n) const
 {
-	if (this->head < n) {
-		return this->buffer[N - (n - this->head)];
-	}
-	else {
-		return this->buffer[this->head - n];
-	}
+	return this->buffer[wrap(this->head + N - n)];
 }
 
 
@@ -187,12 +177,7 @@ xpcc::BoundedDeque<T, N>::append(const T& value)
 		return false;
 	}
 	
-	if (this->head >= (N - 1)) {
-		this->head = 0;
-	}
-	else {
-		this->head++;
-	}
+	this->head = increment(this->head);
 	
 	this->buffer[this->head] = value;
 	this->size++;
@@ -204,40 +189,42 @@ void
 xpcc::BoundedDeque<T, N>::appendOverwrite(const T& value)
 {
 	if (this->isFull()) {
-		if (this->tail >= (N - 1)) {
-			this->tail = 0;
-		}
-		else {
-			this->tail++;
-		}
+		this->tail = increment(this->tail);
 	}
 	else {
 		this->size++;
 	}
 	
-	if (this->head >= (N - 1)) {
-		this->head = 0;
-	}
-	else {
-		this->head++;
-	}
+	this->head = increment(this->head);
 	
 	this->buffer[this->head] = value;
 	return;
 }
 
+template<typename T, std::size_t N>
+typename xpcc::BoundedDeque<T, N>::Size
+xpcc::BoundedDeque<T, N>::append(const T* values, std::size_t n)
+{
+	const Size count = (n < std::size_t(N - this->size)) ? n : (N - this->size);
+	
+	// first free slot up to the end of the buffer, then wrap around
+	const Index index = increment(this->head);
+	const Size first = (count < Size(N - index)) ? count : Size(N - index);
+	copy(this->buffer + index, values, first);
+	copy(this->buffer, values + first, count - first);
+	
+	this->head = wrap(this->head + count);
+	this->size += count;
+	return count;
+}
+
 // ----------------------------------------------------------------------------
 
 template<typename T, std::size_t N>
 void
 xpcc::BoundedDeque<T, N>::removeBack()
 {
-	if (this->head == 0) {
-		this->head = N - 1;
-	}
-	else {
-		this->head--;
-	}
+	this->head = decrement(this->head);
 	this->size--;
 }
 
@@ -251,12 +238,7 @@ xpcc::BoundedDeque<T, N>::prepend(const T& value)
 		return false;
 	}
 	
-	if (this->tail == 0) {
-		this->tail = N - 1;
-	}
-	else {
-		this->tail--;
-	}
+	this->tail = decrement(this->tail);
 	
 	this->buffer[this->tail] = value;
 	this->size++;
@@ -268,23 +250,13 @@ void
 xpcc::BoundedDeque<T, N>::prependOverwrite(const T& value)
 {
 	if (this->isFull()) {
-		if (this->head == 0) {
-			this->head = N - 1;
-		}
-		else {
-			this->head--;
-		}
+		this->head = decrement(this->head);
 	}
 	else {
 		this->size++;
 	}
 	
-	if (this->tail == 0) {
-		this->tail = N - 1;
-	}
-	else {
-		this->tail--;
-	}
+	this->tail = decrement(this->tail);
 	
 	this->buffer[this->tail] = value;
 	return;
@@ -296,14 +268,94 @@ template<typename T, std::size_t N>
 void
 xpcc::BoundedDeque<T, N>::removeFront()
 {
-	if (this->tail >= (N - 1)) {
-		this->tail = 0;
+	this->tail = increment(this->tail);
+	
+	this->size--;
+}
+
+template<typename T, std::size_t N>
+typename xpcc::BoundedDeque<T, N>::Size
+xpcc::BoundedDeque<T, N>::removeFront(std::size_t n)
+{
+	const Size count = (n < this->size) ? n : this->size;
+	
+	this->tail = wrap(this->tail + count);
+	this->size -= count;
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+void
+xpcc::BoundedDeque<T, N>::getSpans(Span& first, Span& second)
+{
+	ConstSpan constFirst, constSecond;
+	static_cast<const BoundedDeque*>(this)->getSpans(constFirst, constSecond);
+	
+	first.data = const_cast<T*>(constFirst.data);
+	first.size = constFirst.size;
+	second.data = const_cast<T*>(constSecond.data);
+	second.size = constSecond.size;
+}
+
+template<typename T, std::size_t N>
+void
+xpcc::BoundedDeque<T, N>::getSpans(ConstSpan& first, ConstSpan& second) const
+{
+	const Size untilEnd = N - this->tail;
+	
+	first.data = this->buffer + this->tail;
+	first.size = (this->size < untilEnd) ? this->size : untilEnd;
+	second.data = this->buffer;
+	second.size = this->size - first.size;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+typename xpcc::BoundedDeque<T, N>::Index
+xpcc::BoundedDeque<T, N>::increment(Index index)
+{
+	if (isPowerOfTwo) {
+		return (index + 1) & (N - 1);
 	}
 	else {
-		this->tail++;
+		return (index >= (N - 1)) ? 0 : (index + 1);
+	}
+}
+
+template<typename T, std::size_t N>
+typename xpcc::BoundedDeque<T, N>::Index
+xpcc::BoundedDeque<T, N>::decrement(Index index)
+{
+	if (isPowerOfTwo) {
+		return (index - 1) & (N - 1);
+	}
+	else {
+		return (index == 0) ? (N - 1) : (index - 1);
+	}
+}
+
+template<typename T, std::size_t N>
+typename xpcc::BoundedDeque<T, N>::Index
+xpcc::BoundedDeque<T, N>::wrap(std::size_t index)
+{
+	if (isPowerOfTwo) {
+		return index & (N - 1);
+	}
+	else {
+		return (index >= N) ? (index - N) : index;
+	}
+}
+
+template<typename T, std::size_t N>
+void
+xpcc::BoundedDeque<T, N>::copy(T* destination, const T* source, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		destination[i] = source[i];
 	}
-	
-	this->size--;
 }
 
 // ----------------------------------------------------------------------------
@@ -347,10 +399,7 @@ xpcc::BoundedDeque<T, N>::const_iterator::operator ++ ()
 		this->index = N;
 	}
 	else {
-		this->index++;
-		if (this->index >= N) {
-			this->index = 0;
-		}
+		this->index = increment(this->index);
 	}
 	return *this;
 }
@@ -364,12 +413,7 @@ xpcc::BoundedDeque<T, N>::const_iterator::operator -- ()
 	}
 	else {
 		this->count--;
-		if (this->index == 0)	{
-			this->index = N - 1;
-		}
-		else {
-			this->index--;
-		}
+		this->index = decrement(this->index);
 	}
 	return *this;
 }
@@ -65,12 +65,12 @@ namespace xpcc
 		std::size_t
 		getSize() const;
 
-		/// Insert in front
+		/// Insert in front, returns false if no memory is available
 		bool
 		prepend(const T& value);
 
-		/// Insert at the end of the list
-		void
+		/// Insert at the end of the list, returns false if no memory is available
+		bool
 		append(const T& value);
 		
 		/// Remove the first entry
@@ -113,6 +113,13 @@ namespace xpcc
 		Node *back;
 		
 	public:
+		/// Allocator of the nodes, e.g. to read the statistics of a pool
+		inline const NodeAllocator&
+		getAllocator() const
+		{
+			return this->nodeAllocator;
+		}
+		
 		/**
 		 * \brief	Forward iterator
 		 * 
@@ -77,6 +77,10 @@ namespace xpcc
 		 *
 		 * Construct a dynamic array of given capacity. The array will still
 		 * be empty.
+		 *
+		 * If the memory cannot be allocated, the capacity is zero. The same
+		 * applies to all other constructors, which then create an empty
+		 * dynamic array.
 		 */
 		DynamicArray(SizeType n, const Allocator& allocator = Allocator());
 
@@ -149,6 +153,12 @@ namespace xpcc
 			return this->capacity;
 		}
 
+		inline const Allocator&
+		getAllocator() const
+		{
+			return this->allocator;
+		}
+
 		/**
 		 * \brief	Request a change in capacity
 		 *
@@ -160,9 +170,12 @@ namespace xpcc
 		 * although notice that the parameter n informs of a minimum, so the
 		 * resulting capacity may be any capacity equal or larger than this.
 		 *
+		 * \return	\c false if the allocator has no memory left, the
+		 * 			dynamic array is unchanged in this case.
+		 *
 		 * \see	getCapacity()
 		 */
-		void
+		bool
 		reserve(SizeType n);
 		
 		/**
@@ -225,8 +238,11 @@ namespace xpcc
 		 * dynamic array size was equal to the dynamic array capacity before
 		 * the call. Reallocations invalidate all previously obtained
 		 * iterators, references and pointers.
+		 *
+		 * \return	\c false if the allocator has no memory left, the
+		 * 			dynamic array is unchanged in this case.
 		 */
-		void
+		bool
 		append(const T& value);
 
 		/**
@@ -393,9 +409,10 @@ namespace xpcc
 	private:
 		/*
 		 * Allocate a new buffer of size n and copy the elements from the
-		 * old buffer to the new buffer.
+		 * old buffer to the new buffer. Keeps the old buffer if the
+		 * allocation fails.
 		 */
-		void
+		bool
 		relocate(SizeType n);
 		
 		Allocator allocator;
@@ -45,6 +45,9 @@ xpcc::DynamicArray<T, Allocator>::DynamicArray(SizeType n, const Allocator& allo
 	allocator(alloc), size(0), capacity(n)
 {
 	this->values = this->allocator.allocate(n);
+	if (this->values == 0) {
+		this->capacity = 0;
+	}
 }
 
 template <typename T, typename Allocator>
@@ -52,7 +55,12 @@ xpcc::DynamicArray<T, Allocator>::DynamicArray(SizeType n, const T& value, const
 	allocator(alloc), size(n), capacity(n)
 {
 	this->values = this->allocator.allocate(n);
-	for (SizeType i = 0; i < n; ++i) {
+	if (this->values == 0) {
+		// out of memory, the array stays empty
+		this->size = 0;
+		this->capacity = 0;
+	}
+	for (SizeType i = 0; i < this->size; ++i) {
 		allocator.construct(&this->values[i], value);
 	}
 }
@@ -62,6 +70,11 @@ xpcc::DynamicArray<T, Allocator>::DynamicArray(std::initializer_list<T> init, co
 	allocator(alloc), size(init.size()), capacity(init.size())
 {
 	this->values = this->allocator.allocate(init.size());
+	if (this->values == 0) {
+		this->size = 0;
+		this->capacity = 0;
+		return;
+	}
 	std::size_t ii = 0;
 	for (auto value : init) {
 		allocator.construct(&this->values[ii], value);
@@ -75,6 +88,10 @@ xpcc::DynamicArray<T, Allocator>::DynamicArray(const DynamicArray& other) :
 	size(other.size), capacity(other.capacity)
 {
 	this->values = allocator.allocate(other.capacity);
+	if (this->values == 0) {
+		this->size = 0;
+		this->capacity = 0;
+	}
 	for (SizeType i = 0; i < this->size; ++i) {
 		this->allocator.construct(&this->values[i], other.values[i]);
 	}
@@ -93,15 +110,27 @@ template <typename T, typename Allocator>
 xpcc::DynamicArray<T, Allocator>&
 xpcc::DynamicArray<T, Allocator>::operator = (const DynamicArray& other)
 {
+	if (this == &other) {
+		return *this;
+	}
+
+	// allocate the new buffer first, so that the array stays unchanged
+	// when the allocation fails
+	Allocator newAllocator(other.allocator);
+	T* newValues = newAllocator.allocate(other.capacity);
+	if (newValues == 0 && other.capacity != 0) {
+		return *this;
+	}
+
 	for (SizeType i = 0; i < this->size; ++i) {
 		this->allocator.destroy(&this->values[i]);
 	}
 	this->allocator.deallocate(this->values);
 	
-	this->allocator = other.allocator;
+	this->allocator = newAllocator;
 	this->size = other.size;
 	this->capacity = other.capacity;
-	this->values = this->allocator.allocate(this->capacity);
+	this->values = newValues;
 
 	for (SizeType i = 0; i < this->size; ++i) {
 		this->allocator.construct(&this->values[i], other.values[i]);
@@ -111,16 +140,16 @@ xpcc::DynamicArray<T, Allocator>::operator = (const DynamicArray& other)
 
 // ----------------------------------------------------------------------------
 template <typename T, typename Allocator>
-void
+bool
 xpcc::DynamicArray<T, Allocator>::reserve(SizeType n)
 {
 	if (n <= (this->capacity - this->size)) {
 		// capacity is already big enough, nothing to do.
-		return;
+		return true;
 	}
 
 	// allocate new memory
-	this->relocate(this->size + n);
+	return this->relocate(this->size + n);
 }
 
 // ----------------------------------------------------------------------------
@@ -151,7 +180,7 @@ xpcc::DynamicArray<T, Allocator>::removeAll()
 
 // ----------------------------------------------------------------------------
 template <typename T, typename Allocator>
-void
+bool
 xpcc::DynamicArray<T, Allocator>::append(const T& value)
 {
 	if (this->capacity == this->size)
@@ -161,11 +190,15 @@ xpcc::DynamicArray<T, Allocator>::append(const T& value)
 		if (n == 0) {
 			n = 1;
 		}
-		this->relocate(n);
+		if (!this->relocate(n)) {
+			return false;
+		}
 	}
 	
 	this->allocator.construct(&this->values[this->size], value);
 	++this->size;
+	
+	return true;
 }
 
 // ----------------------------------------------------------------------------
@@ -181,12 +214,16 @@ xpcc::DynamicArray<T, Allocator>::removeBack()
 
 // ----------------------------------------------------------------------------
 template <typename T, typename Allocator>
-void
+bool
 xpcc::DynamicArray<T, Allocator>::relocate(SizeType n)
 {
+	T* newBuffer = allocator.allocate(n);
+	if (newBuffer == 0) {
+		// keep the old buffer
+		return false;
+	}
 	this->capacity = n;
 	
-	T* newBuffer = allocator.allocate(n);
 	for (SizeType i = 0; i < this->size; ++i) {
 		this->allocator.construct(&newBuffer[i], this->values[i]);
 		this->allocator.destroy(&this->values[i]);
@@ -194,6 +231,8 @@ xpcc::DynamicArray<T, Allocator>::relocate(SizeType n)
 	this->allocator.deallocate(this->values);
 	
 	this->values = newBuffer;
+	
+	return true;
 }
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,735 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__HASH_MAP_HPP
+#define XPCC__HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <stdint.h>
+
+#include <xpcc/utils/allocator.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+#include "pair.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Hash function used by HashMap
+	 *
+	 * The default works for all integer types, enums and pointers.
+	 * The result does not need to be well distributed, HashMap mixes the
+	 * bits itself (Fibonacci hashing). Specialize this class for other key
+	 * types.
+	 *
+	 * \ingroup	container
+	 */
+	template <typename Key>
+	struct Hash
+	{
+		inline uint32_t
+		operator () (const Key& key) const
+		{
+			return static_cast<uint32_t>(key);
+		}
+	};
+
+	template <typename T>
+	struct Hash<T*>
+	{
+		inline uint32_t
+		operator () (const T* key) const
+		{
+			return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(key));
+		}
+	};
+
+	template <>
+	struct Hash<uint64_t>
+	{
+		inline uint32_t
+		operator () (uint64_t key) const
+		{
+			return static_cast<uint32_t>(key ^ (key >> 32));
+		}
+	};
+
+	template <>
+	struct Hash<int64_t>
+	{
+		inline uint32_t
+		operator () (int64_t key) const
+		{
+			return Hash<uint64_t>()(static_cast<uint64_t>(key));
+		}
+	};
+
+	/// Hashes the content of the string (FNV-1a), not the pointer
+	template <>
+	struct Hash<const char*>
+	{
+		inline uint32_t
+		operator () (const char* key) const
+		{
+			uint32_t hash = 2166136261UL;
+			while (*key != '\0') {
+				hash = (hash ^ static_cast<uint8_t>(*key++)) * 16777619UL;
+			}
+			return hash;
+		}
+	};
+
+	/**
+	 * \brief	Key comparison used by HashMap
+	 *
+	 * Uses \c operator==, strings are compared by their content.
+	 *
+	 * \ingroup	container
+	 */
+	template <typename Key>
+	struct EqualTo
+	{
+		inline bool
+		operator () (const Key& a, const Key& b) const
+		{
+			return (a == b);
+		}
+	};
+
+	template <>
+	struct EqualTo<const char*>
+	{
+		inline bool
+		operator () (const char* a, const char* b) const
+		{
+			return (std::strcmp(a, b) == 0);
+		}
+	};
+
+	/// \internal
+	namespace detail
+	{
+		/// Entry of a hash map, the key and the value
+		template <typename Key, typename T>
+		struct HashEntry
+		{
+			typedef Pair<Key, T> Type;
+			typedef T Value;
+
+			static inline const Key&
+			getKey(const Type& entry)
+			{
+				return entry.first;
+			}
+
+			static inline Type
+			create(const Key& key, const T& value)
+			{
+				Type entry = { key, value };
+				return entry;
+			}
+		};
+
+		/// Placeholder for the value of a hash set
+		struct NoValue
+		{
+		};
+
+		/// Entry of a hash set, only the key
+		template <typename Key>
+		struct HashEntry<Key, void>
+		{
+			typedef Key Type;
+			typedef NoValue Value;
+
+			static inline const Key&
+			getKey(const Type& entry)
+			{
+				return entry;
+			}
+
+			static inline Type
+			create(const Key& key, const NoValue&)
+			{
+				return key;
+			}
+		};
+
+		/**
+		 * Common part of HashMap and BoundedHashMap: Robin Hood hashing
+		 * with linear probing and backward shift deletion on a power of
+		 * two number of buckets.
+		 *
+		 * Every bucket stores the distance to the bucket selected by the
+		 * hash of its key (plus one, zero marks an empty bucket) next to
+		 * the entry, so a lookup reads one contiguous block of memory and
+		 * can stop as soon as it finds an entry closer to its home bucket
+		 * than the searched key would be.
+		 *
+		 * If \p T is \c void the buckets store only the keys (set mode)
+		 * and the functions returning values are not available.
+		 *
+		 * \tparam	Distance	Type of the stored distance, must be able to
+		 * 						hold the number of buckets
+		 */
+		template <typename Key, typename T, typename Hash, typename Equal,
+				  typename Distance>
+		class HashTable
+		{
+		public:
+			typedef std::size_t SizeType;
+			typedef typename HashEntry<Key, T>::Type Entry;
+			typedef typename HashEntry<Key, T>::Value Value;
+
+			struct Bucket
+			{
+				Distance distance;
+				alignas(Entry) uint8_t storage[sizeof(Entry)];
+
+				inline Entry&
+				getEntry()
+				{
+					return *reinterpret_cast<Entry*>(this->storage);
+				}
+
+				inline const Entry&
+				getEntry() const
+				{
+					return *reinterpret_cast<const Entry*>(this->storage);
+				}
+			};
+
+		public:
+			inline bool
+			isEmpty() const
+			{
+				return (this->size == 0);
+			}
+
+			inline SizeType
+			getSize() const
+			{
+				return this->size;
+			}
+
+			/// Number of buckets
+			inline SizeType
+			getCapacity() const
+			{
+				return this->capacity;
+			}
+
+			/**
+			 * \brief	Value stored for \p key
+			 *
+			 * The key can be of any type \c K supported by \c Hash and
+			 * \c Equal, e.g. a string view to find a string without
+			 * creating a copy of it.
+			 *
+			 * \return	\c nullptr if \p key is not part of the map
+			 */
+			template <typename K>
+			T*
+			get(const K& key);
+
+			template <typename K>
+			const T*
+			get(const K& key) const;
+
+			template <typename K>
+			inline bool
+			contains(const K& key) const
+			{
+				return (this->findBucket(key) != 0);
+			}
+
+			/**
+			 * \brief	Remove \p key
+			 *
+			 * \return	\c false if \p key is not part of the map
+			 */
+			template <typename K>
+			bool
+			remove(const K& key);
+
+			/// Remove all entries, but keep the capacity
+			void
+			removeAll();
+
+		public:
+			class const_iterator;
+
+			/**
+			 * \brief	Forward iterator over all entries
+			 *
+			 * The order is undefined. The key of an entry must not be
+			 * modified. Inserting or removing entries invalidates all
+			 * iterators.
+			 */
+			class iterator
+			{
+				friend class HashTable;
+				friend class const_iterator;
+
+			public:
+				iterator() :
+					bucket(0), end(0)
+				{
+				}
+
+				inline iterator&
+				operator ++ ()
+				{
+					++this->bucket;
+					this->skipEmpty();
+					return *this;
+				}
+
+				inline bool
+				operator == (const iterator& other) const
+				{
+					return (this->bucket == other.bucket);
+				}
+
+				inline bool
+				operator != (const iterator& other) const
+				{
+					return (this->bucket != other.bucket);
+				}
+
+				inline Entry&
+				operator * ()
+				{
+					return this->bucket->getEntry();
+				}
+
+				inline Entry*
+				operator -> ()
+				{
+					return &this->bucket->getEntry();
+				}
+
+			private:
+				iterator(Bucket* bucket, Bucket* end) :
+					bucket(bucket), end(end)
+				{
+					this->skipEmpty();
+				}
+
+				inline void
+				skipEmpty()
+				{
+					while (this->bucket != this->end && this->bucket->distance == 0) {
+						++this->bucket;
+					}
+				}
+
+				Bucket* bucket;
+				Bucket* end;
+			};
+
+			class const_iterator
+			{
+				friend class HashTable;
+
+			public:
+				const_iterator() :
+					bucket(0), end(0)
+				{
+				}
+
+				const_iterator(const iterator& other) :
+					bucket(other.bucket), end(other.end)
+				{
+				}
+
+				inline const_iterator&
+				operator ++ ()
+				{
+					++this->bucket;
+					this->skipEmpty();
+					return *this;
+				}
+
+				inline bool
+				operator == (const const_iterator& other) const
+				{
+					return (this->bucket == other.bucket);
+				}
+
+				inline bool
+				operator != (const const_iterator& other) const
+				{
+					return (this->bucket != other.bucket);
+				}
+
+				inline const Entry&
+				operator * () const
+				{
+					return this->bucket->getEntry();
+				}
+
+				inline const Entry*
+				operator -> () const
+				{
+					return &this->bucket->getEntry();
+				}
+
+			private:
+				const_iterator(const Bucket* bucket, const Bucket* end) :
+					bucket(bucket), end(end)
+				{
+					this->skipEmpty();
+				}
+
+				inline void
+				skipEmpty()
+				{
+					while (this->bucket != this->end && this->bucket->distance == 0) {
+						++this->bucket;
+					}
+				}
+
+				const Bucket* bucket;
+				const Bucket* end;
+			};
+
+			inline iterator
+			begin()
+			{
+				return iterator(this->buckets, this->buckets + this->capacity);
+			}
+
+			inline const_iterator
+			begin() const
+			{
+				return const_iterator(this->buckets, this->buckets + this->capacity);
+			}
+
+			inline iterator
+			end()
+			{
+				return iterator(this->buckets + this->capacity, this->buckets + this->capacity);
+			}
+
+			inline const_iterator
+			end() const
+			{
+				return const_iterator(this->buckets + this->capacity, this->buckets + this->capacity);
+			}
+
+			/// Returns end() if \p key is not part of the map
+			template <typename K>
+			iterator
+			find(const K& key);
+
+			template <typename K>
+			const_iterator
+			find(const K& key) const;
+
+		protected:
+			HashTable(const Hash& hasher, const Equal& equal);
+
+			/// Use the \p buckets, \p capacity needs to be a power of two
+			void
+			setBuckets(Bucket* buckets, SizeType capacity);
+
+			template <typename K>
+			const Bucket*
+			findBucket(const K& key) const;
+
+			/**
+			 * Moves \p entry into the table, \p entry must not be part of
+			 * it and a bucket must be free. Leaves \p entry in a moved
+			 * from state.
+			 */
+			void
+			place(Entry& entry);
+
+			/// Moves all entries into the new (empty) \p buckets
+			void
+			rehash(Bucket* buckets, SizeType capacity);
+
+			inline SizeType
+			getIndex(uint32_t hash) const
+			{
+				// Fibonacci hashing, takes the upper bits of the product
+				return static_cast<uint32_t>(hash * 2654435769UL) >> this->shift;
+			}
+
+			Bucket* buckets;
+			SizeType capacity;
+			SizeType size;
+			uint8_t shift;
+
+			Hash hasher;
+			Equal equal;
+
+		private:
+			HashTable(const HashTable& other);
+
+			HashTable&
+			operator = (const HashTable& other);
+		};
+	}
+
+	/**
+	 * \brief	Hash map with a fixed number of entries
+	 *
+	 * Open addressing hash map using Robin Hood hashing. The entries are
+	 * stored inside of the object, no memory is allocated. All \p N buckets
+	 * can be used, but lookups get slower if the map is nearly full.
+	 *
+	 * \code
+	 * // routing table: destination address -> interface
+	 * xpcc::BoundedHashMap<uint8_t, Interface*, 32> routes;
+	 *
+	 * routes.insert(0x12, &can1);
+	 * Interface** interface = routes.get(destination);
+	 * if (interface != nullptr) {
+	 *     (*interface)->send(packet);
+	 * }
+	 * \endcode
+	 *
+	 * The lookup functions are templates to allow searching with a
+	 * different type than \p Key without creating a temporary key, as long
+	 * as \p Hash and \p Equal support this type and calculate the same
+	 * hash for equal keys.
+	 *
+	 * \tparam	Key		Type of the keys
+	 * \tparam	T		Type of the values
+	 * \tparam	N		Number of buckets, needs to be a power of two
+	 * \tparam	Hash	Hash function, see xpcc::Hash
+	 * \tparam	Equal	Key comparison, see xpcc::EqualTo
+	 *
+	 * \see		HashMap
+	 * \ingroup	container
+	 */
+	template <typename Key, typename T, std::size_t N,
+			  typename Hash = ::xpcc::Hash<Key>,
+			  typename Equal = ::xpcc::EqualTo<Key> >
+	class BoundedHashMap :
+			public detail::HashTable<Key, T, Hash, Equal,
+					typename xpcc::tmp::Select< (N >= 255), uint16_t, uint8_t >::Result>
+	{
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+		static_assert(N <= 32768, "N is too large");
+
+		typedef detail::HashTable<Key, T, Hash, Equal,
+				typename xpcc::tmp::Select< (N >= 255), uint16_t, uint8_t >::Result> Table;
+
+	public:
+		BoundedHashMap(const Hash& hasher = Hash(), const Equal& equal = Equal());
+
+		~BoundedHashMap();
+
+		inline bool
+		isFull() const
+		{
+			return (this->size == N);
+		}
+
+		/**
+		 * \brief	Insert \p value for \p key
+		 *
+		 * \return	\c false if \p key is already part of the map (the
+		 * 			stored value is not changed) or the map is full.
+		 */
+		bool
+		insert(const Key& key, const typename Table::Value& value);
+
+	private:
+		typename Table::Bucket storage[N];
+	};
+
+	/**
+	 * \brief	Hash map which grows if needed
+	 *
+	 * Open addressing hash map using Robin Hood hashing. The buckets are
+	 * stored in one block of memory from \p Allocator. The number of
+	 * buckets is doubled when more than 7/8 of them are used. Growing
+	 * needs the old and the new block at the same time, use reserve() to
+	 * avoid this.
+	 *
+	 * \code
+	 * xpcc::HashMap<const char*, uint16_t> parameters;
+	 * parameters.insert("speed", 100);
+	 *
+	 * uint16_t* speed = parameters.get("speed");
+	 * \endcode
+	 *
+	 * \tparam	Key			Type of the keys
+	 * \tparam	T			Type of the values
+	 * \tparam	Hash		Hash function, see xpcc::Hash
+	 * \tparam	Equal		Key comparison, see xpcc::EqualTo
+	 * \tparam	Allocator	Allocator for the buckets. See classes from the
+	 * 						xpcc::allocator namespace.
+	 *
+	 * \see		BoundedHashMap
+	 * \ingroup	container
+	 */
+	template <typename Key, typename T,
+			  typename Hash = ::xpcc::Hash<Key>,
+			  typename Equal = ::xpcc::EqualTo<Key>,
+			  typename Allocator = allocator::Dynamic<T> >
+	class HashMap :
+			public detail::HashTable<Key, T, Hash, Equal, std::size_t>
+	{
+		typedef detail::HashTable<Key, T, Hash, Equal, std::size_t> Table;
+		typedef typename Table::Bucket Bucket;
+
+		typedef typename Allocator::template rebind< Bucket >::other BucketAllocator;
+
+	public:
+		typedef typename Table::SizeType SizeType;
+
+		/// Does not allocate memory until the first entry is inserted
+		HashMap(const Allocator& allocator = Allocator(),
+				const Hash& hasher = Hash(), const Equal& equal = Equal());
+
+		/// Allocates enough buckets to hold \p n entries without growing
+		HashMap(SizeType n, const Allocator& allocator = Allocator(),
+				const Hash& hasher = Hash(), const Equal& equal = Equal());
+
+		~HashMap();
+
+		/**
+		 * \brief	Insert \p value for \p key
+		 *
+		 * \return	\c false if \p key is already part of the map (the
+		 * 			stored value is not changed) or the allocator has no
+		 * 			memory left.
+		 */
+		bool
+		insert(const Key& key, const typename Table::Value& value);
+
+		/**
+		 * \brief	Make room for \p n entries in total
+		 *
+		 * \return	\c false if the allocator has no memory left
+		 */
+		bool
+		reserve(SizeType n);
+
+		/// Remove all entries and free the memory
+		void
+		clear();
+
+		inline const BucketAllocator&
+		getAllocator() const
+		{
+			return this->allocator;
+		}
+
+	private:
+		/// Number of buckets for \p n entries
+		static SizeType
+		getBucketCount(SizeType n);
+
+		bool
+		resize(SizeType capacity);
+
+		BucketAllocator allocator;
+	};
+
+	/**
+	 * \brief	Hash set with a fixed number of entries
+	 *
+	 * BoundedHashMap without values, the buckets store only the keys.
+	 * Iterators return the keys.
+	 *
+	 * \see		BoundedHashMap
+	 * \ingroup	container
+	 */
+	template <typename Key, std::size_t N,
+			  typename Hash = ::xpcc::Hash<Key>,
+			  typename Equal = ::xpcc::EqualTo<Key> >
+	class BoundedHashSet :
+			public BoundedHashMap<Key, void, N, Hash, Equal>
+	{
+	public:
+		BoundedHashSet(const Hash& hasher = Hash(), const Equal& equal = Equal()) :
+			BoundedHashMap<Key, void, N, Hash, Equal>(hasher, equal)
+		{
+		}
+
+		/**
+		 * \brief	Insert \p key
+		 *
+		 * \return	\c false if \p key is already part of the set or the set
+		 * 			is full.
+		 */
+		inline bool
+		insert(const Key& key)
+		{
+			return BoundedHashMap<Key, void, N, Hash, Equal>::insert(key, detail::NoValue());
+		}
+	};
+
+	/**
+	 * \brief	Hash set which grows if needed
+	 *
+	 * HashMap without values, the buckets store only the keys.
+	 * Iterators return the keys.
+	 *
+	 * \code
+	 * xpcc::HashSet<uint8_t> components;
+	 * components.insert(0x12);
+	 *
+	 * if (components.contains(destination)) {
+	 *     ...
+	 * }
+	 * \endcode
+	 *
+	 * \see		HashMap
+	 * \ingroup	container
+	 */
+	template <typename Key,
+			  typename Hash = ::xpcc::Hash<Key>,
+			  typename Equal = ::xpcc::EqualTo<Key>,
+			  typename Allocator = allocator::Dynamic<Key> >
+	class HashSet :
+			public HashMap<Key, void, Hash, Equal, Allocator>
+	{
+	public:
+		typedef typename HashMap<Key, void, Hash, Equal, Allocator>::SizeType SizeType;
+
+		/// Does not allocate memory until the first key is inserted
+		HashSet(const Allocator& allocator = Allocator(),
+				const Hash& hasher = Hash(), const Equal& equal = Equal()) :
+			HashMap<Key, void, Hash, Equal, Allocator>(allocator, hasher, equal)
+		{
+		}
+
+		/// Allocates enough buckets to hold \p n keys without growing
+		HashSet(SizeType n, const Allocator& allocator = Allocator(),
+				const Hash& hasher = Hash(), const Equal& equal = Equal()) :
+			HashMap<Key, void, Hash, Equal, Allocator>(n, allocator, hasher, equal)
+		{
+		}
+
+		/**
+		 * \brief	Insert \p key
+		 *
+		 * \return	\c false if \p key is already part of the set or the
+		 * 			allocator has no memory left.
+		 */
+		inline bool
+		insert(const Key& key)
+		{
+			return HashMap<Key, void, Hash, Equal, Allocator>::insert(key, detail::NoValue());
+		}
+	};
+}
+
+#include "hash_map_impl.hpp"
+
+#endif	// XPCC__HASH_MAP_HPP
@@ -0,0 +1,347 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__HASH_MAP_HPP
+	#error	"Don't include this file directly, use 'hash_map.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::HashTable(
+		const Hash& hasher, const Equal& equal) :
+	buckets(0), capacity(0), size(0), shift(0),
+	hasher(hasher), equal(equal)
+{
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+void
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::setBuckets(
+		Bucket* buckets, SizeType capacity)
+{
+	this->buckets = buckets;
+	this->capacity = capacity;
+	this->size = 0;
+
+	this->shift = 32;
+	for (SizeType i = capacity; i > 1; i >>= 1) {
+		this->shift--;
+	}
+
+	for (SizeType i = 0; i < capacity; ++i) {
+		buckets[i].distance = 0;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+const typename xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::Bucket*
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::findBucket(const K& key) const
+{
+	if (this->size == 0) {
+		// also covers a HashMap without buckets
+		return 0;
+	}
+
+	const SizeType mask = this->capacity - 1;
+	SizeType index = this->getIndex(this->hasher(key));
+	for (SizeType distance = 1; ; ++distance)
+	{
+		const Bucket& bucket = this->buckets[index];
+		if (bucket.distance < distance) {
+			// empty bucket or an entry closer to its home bucket, the key
+			// would have replaced this entry during the insertion.
+			return 0;
+		}
+		if (bucket.distance == distance && this->equal(HashEntry<Key, T>::getKey(bucket.getEntry()), key)) {
+			return &bucket;
+		}
+		index = (index + 1) & mask;
+	}
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+T*
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::get(const K& key)
+{
+	Bucket* bucket = const_cast<Bucket*>(this->findBucket(key));
+	if (bucket == 0) {
+		return 0;
+	}
+	return &bucket->getEntry().second;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+const T*
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::get(const K& key) const
+{
+	const Bucket* bucket = this->findBucket(key);
+	if (bucket == 0) {
+		return 0;
+	}
+	return &bucket->getEntry().second;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+typename xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::iterator
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::find(const K& key)
+{
+	Bucket* bucket = const_cast<Bucket*>(this->findBucket(key));
+	if (bucket == 0) {
+		return this->end();
+	}
+	return iterator(bucket, this->buckets + this->capacity);
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+typename xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::const_iterator
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::find(const K& key) const
+{
+	const Bucket* bucket = this->findBucket(key);
+	if (bucket == 0) {
+		return this->end();
+	}
+	return const_iterator(bucket, this->buckets + this->capacity);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+void
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::place(Entry& entry)
+{
+	const SizeType mask = this->capacity - 1;
+	SizeType index = this->getIndex(this->hasher(HashEntry<Key, T>::getKey(entry)));
+	Distance distance = 1;
+	while (true)
+	{
+		Bucket& bucket = this->buckets[index];
+		if (bucket.distance == 0)
+		{
+			new (bucket.storage) Entry(static_cast<Entry&&>(entry));
+			bucket.distance = distance;
+			this->size++;
+			return;
+		}
+
+		if (bucket.distance < distance)
+		{
+			// take from the rich: the stored entry is closer to its home
+			// bucket, continue with it instead.
+			Entry temp(static_cast<Entry&&>(bucket.getEntry()));
+			bucket.getEntry() = static_cast<Entry&&>(entry);
+			entry = static_cast<Entry&&>(temp);
+
+			Distance d = bucket.distance;
+			bucket.distance = distance;
+			distance = d;
+		}
+
+		distance++;
+		index = (index + 1) & mask;
+	}
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+void
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::rehash(
+		Bucket* buckets, SizeType capacity)
+{
+	Bucket* oldBuckets = this->buckets;
+	SizeType oldCapacity = this->capacity;
+
+	this->setBuckets(buckets, capacity);
+	for (SizeType i = 0; i < oldCapacity; ++i)
+	{
+		Bucket& bucket = oldBuckets[i];
+		if (bucket.distance != 0) {
+			this->place(bucket.getEntry());
+			bucket.getEntry().~Entry();
+		}
+	}
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+template <typename K>
+bool
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::remove(const K& key)
+{
+	Bucket* bucket = const_cast<Bucket*>(this->findBucket(key));
+	if (bucket == 0) {
+		return false;
+	}
+	bucket->getEntry().~Entry();
+
+	// backward shift: move the following entries one bucket closer to
+	// their home bucket until an empty bucket or an entry which is already
+	// at its home bucket is found. No tombstones are needed.
+	const SizeType mask = this->capacity - 1;
+	SizeType index = bucket - this->buckets;
+	while (true)
+	{
+		Bucket& next = this->buckets[(index + 1) & mask];
+		if (next.distance <= 1) {
+			break;
+		}
+
+		new (this->buckets[index].storage) Entry(static_cast<Entry&&>(next.getEntry()));
+		next.getEntry().~Entry();
+		this->buckets[index].distance = next.distance - 1;
+
+		index = (index + 1) & mask;
+	}
+	this->buckets[index].distance = 0;
+	this->size--;
+
+	return true;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Distance>
+void
+xpcc::detail::HashTable<Key, T, Hash, Equal, Distance>::removeAll()
+{
+	for (SizeType i = 0; i < this->capacity; ++i)
+	{
+		Bucket& bucket = this->buckets[i];
+		if (bucket.distance != 0) {
+			bucket.getEntry().~Entry();
+			bucket.distance = 0;
+		}
+	}
+	this->size = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Key, typename T, std::size_t N, typename Hash, typename Equal>
+xpcc::BoundedHashMap<Key, T, N, Hash, Equal>::BoundedHashMap(
+		const Hash& hasher, const Equal& equal) :
+	Table(hasher, equal)
+{
+	this->setBuckets(this->storage, N);
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash, typename Equal>
+xpcc::BoundedHashMap<Key, T, N, Hash, Equal>::~BoundedHashMap()
+{
+	this->removeAll();
+}
+
+template <typename Key, typename T, std::size_t N, typename Hash, typename Equal>
+bool
+xpcc::BoundedHashMap<Key, T, N, Hash, Equal>::insert(const Key& key,
+		const typename Table::Value& value)
+{
+	if (this->isFull() || this->contains(key)) {
+		return false;
+	}
+
+	typename Table::Entry entry = detail::HashEntry<Key, T>::create(key, value);
+	this->place(entry);
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::HashMap(
+		const Allocator& allocator, const Hash& hasher, const Equal& equal) :
+	Table(hasher, equal), allocator(allocator)
+{
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::HashMap(SizeType n,
+		const Allocator& allocator, const Hash& hasher, const Equal& equal) :
+	Table(hasher, equal), allocator(allocator)
+{
+	this->reserve(n);
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::~HashMap()
+{
+	this->clear();
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+typename xpcc::HashMap<Key, T, Hash, Equal, Allocator>::SizeType
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::getBucketCount(SizeType n)
+{
+	// at most 7/8 of the buckets are used
+	SizeType capacity = 8;
+	while (n > capacity - capacity / 8) {
+		capacity *= 2;
+	}
+	return capacity;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+bool
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::insert(const Key& key,
+		const typename Table::Value& value)
+{
+	if (this->contains(key)) {
+		return false;
+	}
+
+	if (this->size + 1 > this->capacity - this->capacity / 8)
+	{
+		if (!this->resize(getBucketCount(this->size + 1))) {
+			return false;
+		}
+	}
+
+	typename Table::Entry entry = detail::HashEntry<Key, T>::create(key, value);
+	this->place(entry);
+	return true;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+bool
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::reserve(SizeType n)
+{
+	SizeType capacity = getBucketCount(n);
+	if (capacity <= this->capacity) {
+		return true;
+	}
+	return this->resize(capacity);
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+void
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::clear()
+{
+	this->removeAll();
+	if (this->buckets != 0) {
+		this->allocator.deallocate(this->buckets);
+	}
+	this->buckets = 0;
+	this->capacity = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename Equal, typename Allocator>
+bool
+xpcc::HashMap<Key, T, Hash, Equal, Allocator>::resize(SizeType capacity)
+{
+	Bucket* buckets = this->allocator.allocate(capacity);
+	if (buckets == 0) {
+		// allocator is out of memory
+		return false;
+	}
+
+	Bucket* oldBuckets = this->buckets;
+	this->rehash(buckets, capacity);
+	if (oldBuckets != 0) {
+		this->allocator.deallocate(oldBuckets);
+	}
+	return true;
+}
@@ -0,0 +1,371 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__HEAP_HPP
+#define XPCC__HEAP_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+
+#include <xpcc/utils/allocator.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Default ordering of xpcc::Heap, the smallest element is on top
+	 *
+	 * \ingroup	container
+	 */
+	template <typename T>
+	struct Less
+	{
+		inline bool
+		operator () (const T& a, const T& b) const
+		{
+			return (a < b);
+		}
+	};
+
+	/// \internal
+	namespace detail
+	{
+		/**
+		 * Common part of Heap and BoundedHeap: an indexed 4-ary heap.
+		 *
+		 * The elements stay in their slot, only the slot numbers are moved
+		 * inside the heap. So the slot number is a stable handle to the
+		 * element and every slot knows its position inside the heap, which
+		 * allows changing or removing an arbitrary element in O(log n).
+		 *
+		 * The heap array is a permutation of all slots. The first \c size
+		 * entries form the heap, the remaining entries are the free slots.
+		 */
+		template <typename T, typename Compare, typename Index>
+		class IndexedHeap
+		{
+		public:
+			typedef Index Size;
+			typedef Index Handle;
+
+			/// Returned by push() if no element could be added
+			static constexpr Handle invalidHandle = static_cast<Handle>(-1);
+
+			struct Slot
+			{
+				alignas(T) uint8_t storage[sizeof(T)];
+
+				/// position of the element in this slot inside the heap
+				Index position;
+
+				/// slot of the element at this position of the heap
+				Index heap;
+
+				inline T&
+				getValue()
+				{
+					return *reinterpret_cast<T*>(this->storage);
+				}
+
+				inline const T&
+				getValue() const
+				{
+					return *reinterpret_cast<const T*>(this->storage);
+				}
+			};
+
+		public:
+			inline bool
+			isEmpty() const
+			{
+				return (this->size == 0);
+			}
+
+			inline Size
+			getSize() const
+			{
+				return this->size;
+			}
+
+			inline Size
+			getCapacity() const
+			{
+				return this->capacity;
+			}
+
+			/// First element in the order given by \c Compare, the heap must not be empty
+			inline const T&
+			getTop() const
+			{
+				return this->slots[this->slots[0].heap].getValue();
+			}
+
+			inline Handle
+			getTopHandle() const
+			{
+				return this->slots[0].heap;
+			}
+
+			/// Remove the top element, the heap must not be empty
+			inline void
+			pop()
+			{
+				this->remove(this->slots[0].heap);
+			}
+
+			/// \c true if \p handle belongs to an element of the heap
+			inline bool
+			contains(Handle handle) const
+			{
+				return (handle < this->capacity &&
+						this->slots[handle].position < this->size);
+			}
+
+			/**
+			 * \brief	Element belonging to \p handle
+			 *
+			 * Use update() to change the element.
+			 */
+			inline const T&
+			get(Handle handle) const
+			{
+				return this->slots[handle].getValue();
+			}
+
+			/**
+			 * \brief	Replace the element belonging to \p handle
+			 *
+			 * The element is moved up (decrease-key) or down inside of the
+			 * heap depending on the new value. The handle stays valid.
+			 */
+			void
+			update(Handle handle, const T& value);
+
+			/**
+			 * \brief	Remove the element belonging to \p handle
+			 *
+			 * The handle may be returned again by a following push().
+			 */
+			void
+			remove(Handle handle);
+
+			/// Remove all elements
+			void
+			removeAll();
+
+		protected:
+			IndexedHeap(const Compare& compare);
+
+			/// Use the uninitialized \p slots
+			void
+			setSlots(Slot* slots, Size capacity);
+
+			/// Moves all elements to \p slots, the handles stay the same
+			void
+			moveSlots(Slot* slots, Size capacity);
+
+			/// Adds \p value, there must be a free slot
+			Handle
+			add(const T& value);
+
+			inline bool
+			isHigher(Index a, Index b) const
+			{
+				return this->compare(this->slots[a].getValue(), this->slots[b].getValue());
+			}
+
+			/// Places \p slot at \p position
+			inline void
+			set(std::size_t position, Index slot)
+			{
+				this->slots[position].heap = slot;
+				this->slots[slot].position = position;
+			}
+
+			void
+			siftUp(std::size_t position);
+
+			void
+			siftDown(std::size_t position);
+
+			Slot* slots;
+			Size capacity;
+			Size size;
+
+			Compare compare;
+
+		private:
+			IndexedHeap(const IndexedHeap& other);
+
+			IndexedHeap&
+			operator = (const IndexedHeap& other);
+		};
+	}
+
+	/**
+	 * \brief	Priority queue with a fixed capacity
+	 *
+	 * 4-ary heap, push(), pop(), update() and remove() are O(log n),
+	 * getTop() is O(1). No memory is allocated, the elements are stored
+	 * inside of the object.
+	 *
+	 * push() returns a handle to the element, which can be used to change
+	 * (e.g. decrease-key) or remove the element later on, without having
+	 * to search for it. The handle is valid until the element is removed.
+	 *
+	 * \code
+	 * struct Deadline
+	 * {
+	 *     xpcc::Timestamp time;
+	 *     Task* task;
+	 *
+	 *     bool
+	 *     operator < (const Deadline& other) const
+	 *     {
+	 *         return (time < other.time);
+	 *     }
+	 * };
+	 *
+	 * xpcc::BoundedHeap<Deadline, 32> deadlines;
+	 *
+	 * auto handle = deadlines.push(Deadline { now + 100, &task });
+	 * ...
+	 * deadlines.update(handle, Deadline { now + 20, &task });
+	 * ...
+	 * while (not deadlines.isEmpty() and deadlines.getTop().time <= now) {
+	 *     deadlines.getTop().task->run();
+	 *     deadlines.pop();
+	 * }
+	 * \endcode
+	 *
+	 * \tparam	T		Type of the elements
+	 * \tparam	N		Maximum number of elements
+	 * \tparam	Compare	\c true if the first argument needs to be closer
+	 * 					to the top, see xpcc::Less
+	 *
+	 * \see		Heap
+	 * \ingroup	container
+	 */
+	template <typename T, std::size_t N, typename Compare = ::xpcc::Less<T> >
+	class BoundedHeap :
+			public detail::IndexedHeap<T, Compare,
+					typename xpcc::tmp::Select< (N >= 255), uint16_t, uint8_t >::Result>
+	{
+		static_assert(N > 0, "size = 0 is not allowed");
+		static_assert(N < 65535, "N is too large");
+
+		typedef detail::IndexedHeap<T, Compare,
+				typename xpcc::tmp::Select< (N >= 255), uint16_t, uint8_t >::Result> Base;
+
+	public:
+		typedef typename Base::Handle Handle;
+
+	public:
+		BoundedHeap(const Compare& compare = Compare());
+
+		~BoundedHeap();
+
+		inline bool
+		isFull() const
+		{
+			return (this->size == N);
+		}
+
+		/**
+		 * \brief	Add \p value
+		 *
+		 * \return	Handle for the element or \c invalidHandle if the heap
+		 * 			is full
+		 */
+		Handle
+		push(const T& value);
+
+	private:
+		typename Base::Slot storage[N];
+	};
+
+	/**
+	 * \brief	Priority queue which grows if needed
+	 *
+	 * Same as BoundedHeap, but the elements are stored in one block of
+	 * memory from \p Allocator, which is doubled in size if needed. The
+	 * handles stay valid while growing, references to the elements do
+	 * not.
+	 *
+	 * \tparam	T			Type of the elements
+	 * \tparam	Compare		\c true if the first argument needs to be
+	 * 						closer to the top, see xpcc::Less
+	 * \tparam	Allocator	Allocator for the elements. See classes from
+	 * 						the xpcc::allocator namespace.
+	 *
+	 * \see		BoundedHeap
+	 * \ingroup	container
+	 */
+	template <typename T,
+			  typename Compare = ::xpcc::Less<T>,
+			  typename Allocator = allocator::Dynamic<T> >
+	class Heap :
+			public detail::IndexedHeap<T, Compare, std::size_t>
+	{
+		typedef detail::IndexedHeap<T, Compare, std::size_t> Base;
+		typedef typename Base::Slot Slot;
+
+		typedef typename Allocator::template rebind< Slot >::other SlotAllocator;
+
+	public:
+		typedef typename Base::Size Size;
+		typedef typename Base::Handle Handle;
+
+	public:
+		/// Does not allocate memory until the first element is added
+		Heap(const Allocator& allocator = Allocator(),
+			 const Compare& compare = Compare());
+
+		/// Allocates memory for \p n elements
+		Heap(Size n, const Allocator& allocator = Allocator(),
+			 const Compare& compare = Compare());
+
+		~Heap();
+
+		/**
+		 * \brief	Add \p value
+		 *
+		 * \return	Handle for the element or \c invalidHandle if the
+		 * 			allocator has no memory left
+		 */
+		Handle
+		push(const T& value);
+
+		/**
+		 * \brief	Make room for \p n elements in total
+		 *
+		 * \return	\c false if the allocator has no memory left
+		 */
+		bool
+		reserve(Size n);
+
+		/// Remove all elements and free the memory
+		void
+		clear();
+
+		inline const SlotAllocator&
+		getAllocator() const
+		{
+			return this->allocator;
+		}
+
+	private:
+		SlotAllocator allocator;
+	};
+}
+
+#include "heap_impl.hpp"
+
+#endif	// XPCC__HEAP_HPP
@@ -0,0 +1,277 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__HEAP_HPP
+	#error	"Don't include this file directly, use 'heap.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Index>
+constexpr typename xpcc::detail::IndexedHeap<T, Compare, Index>::Handle
+xpcc::detail::IndexedHeap<T, Compare, Index>::invalidHandle;
+
+template <typename T, typename Compare, typename Index>
+xpcc::detail::IndexedHeap<T, Compare, Index>::IndexedHeap(const Compare& compare) :
+	slots(0), capacity(0), size(0), compare(compare)
+{
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::setSlots(Slot* slots, Size capacity)
+{
+	this->slots = slots;
+	this->capacity = capacity;
+	this->size = 0;
+
+	for (std::size_t i = 0; i < capacity; ++i) {
+		this->set(i, i);
+	}
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::moveSlots(Slot* slots, Size capacity)
+{
+	for (std::size_t i = 0; i < this->capacity; ++i)
+	{
+		Slot& slot = this->slots[i];
+		if (slot.position < this->size) {
+			new (slots[i].storage) T(static_cast<T&&>(slot.getValue()));
+			slot.getValue().~T();
+		}
+		slots[i].position = slot.position;
+		slots[i].heap = slot.heap;
+	}
+
+	// the new slots are free and placed behind the old ones
+	for (std::size_t i = this->capacity; i < capacity; ++i) {
+		slots[i].position = i;
+		slots[i].heap = i;
+	}
+
+	this->slots = slots;
+	this->capacity = capacity;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Index>
+typename xpcc::detail::IndexedHeap<T, Compare, Index>::Handle
+xpcc::detail::IndexedHeap<T, Compare, Index>::add(const T& value)
+{
+	// the first free slot is directly behind the heap
+	const Index slot = this->slots[this->size].heap;
+	new (this->slots[slot].storage) T(value);
+
+	this->size++;
+	this->siftUp(this->size - 1);
+	return slot;
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::update(Handle handle, const T& value)
+{
+	Slot& slot = this->slots[handle];
+	const bool higher = this->compare(value, slot.getValue());
+	slot.getValue() = value;
+
+	if (higher) {
+		this->siftUp(slot.position);
+	}
+	else {
+		this->siftDown(slot.position);
+	}
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::remove(Handle handle)
+{
+	const std::size_t position = this->slots[handle].position;
+	const std::size_t last = this->size - 1;
+
+	// move the last element into the gap, the free slot moves behind the heap
+	if (position != last)
+	{
+		const Index lastSlot = this->slots[last].heap;
+		this->set(position, lastSlot);
+		this->set(last, handle);
+	}
+	this->size--;
+	this->slots[handle].getValue().~T();
+
+	if (position < this->size)
+	{
+		// the moved element may belong above or below its new position
+		if (position > 0 && this->isHigher(this->slots[position].heap,
+				this->slots[(position - 1) / 4].heap)) {
+			this->siftUp(position);
+		}
+		else {
+			this->siftDown(position);
+		}
+	}
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::removeAll()
+{
+	for (std::size_t i = 0; i < this->size; ++i) {
+		this->slots[this->slots[i].heap].getValue().~T();
+	}
+	// the heap stays a permutation of all slots, so the slots are free now
+	this->size = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::siftUp(std::size_t position)
+{
+	const Index slot = this->slots[position].heap;
+	while (position > 0)
+	{
+		const std::size_t parent = (position - 1) / 4;
+		const Index parentSlot = this->slots[parent].heap;
+		if (!this->isHigher(slot, parentSlot)) {
+			break;
+		}
+		this->set(position, parentSlot);
+		position = parent;
+	}
+	this->set(position, slot);
+}
+
+template <typename T, typename Compare, typename Index>
+void
+xpcc::detail::IndexedHeap<T, Compare, Index>::siftDown(std::size_t position)
+{
+	const Index slot = this->slots[position].heap;
+	while (true)
+	{
+		const std::size_t first = 4 * position + 1;
+		if (first >= this->size) {
+			break;
+		}
+
+		// find the highest of the (up to) four children
+		const std::size_t end = (first + 4 < this->size) ? (first + 4) : this->size;
+		std::size_t child = first;
+		for (std::size_t i = first + 1; i < end; ++i)
+		{
+			if (this->isHigher(this->slots[i].heap, this->slots[child].heap)) {
+				child = i;
+			}
+		}
+
+		const Index childSlot = this->slots[child].heap;
+		if (!this->isHigher(childSlot, slot)) {
+			break;
+		}
+		this->set(position, childSlot);
+		position = child;
+	}
+	this->set(position, slot);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N, typename Compare>
+xpcc::BoundedHeap<T, N, Compare>::BoundedHeap(const Compare& compare) :
+	Base(compare)
+{
+	this->setSlots(this->storage, N);
+}
+
+template <typename T, std::size_t N, typename Compare>
+xpcc::BoundedHeap<T, N, Compare>::~BoundedHeap()
+{
+	this->removeAll();
+}
+
+template <typename T, std::size_t N, typename Compare>
+typename xpcc::BoundedHeap<T, N, Compare>::Handle
+xpcc::BoundedHeap<T, N, Compare>::push(const T& value)
+{
+	if (this->isFull()) {
+		return Base::invalidHandle;
+	}
+	return this->add(value);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Allocator>
+xpcc::Heap<T, Compare, Allocator>::Heap(const Allocator& allocator,
+		const Compare& compare) :
+	Base(compare), allocator(allocator)
+{
+}
+
+template <typename T, typename Compare, typename Allocator>
+xpcc::Heap<T, Compare, Allocator>::Heap(Size n, const Allocator& allocator,
+		const Compare& compare) :
+	Base(compare), allocator(allocator)
+{
+	this->reserve(n);
+}
+
+template <typename T, typename Compare, typename Allocator>
+xpcc::Heap<T, Compare, Allocator>::~Heap()
+{
+	this->clear();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename xpcc::Heap<T, Compare, Allocator>::Handle
+xpcc::Heap<T, Compare, Allocator>::push(const T& value)
+{
+	if (this->size == this->capacity)
+	{
+		const Size capacity = (this->capacity == 0) ? 8 : (this->capacity * 2);
+		if (!this->reserve(capacity)) {
+			return Base::invalidHandle;
+		}
+	}
+	return this->add(value);
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool
+xpcc::Heap<T, Compare, Allocator>::reserve(Size n)
+{
+	if (n <= this->capacity) {
+		return true;
+	}
+
+	Slot* slots = this->allocator.allocate(n);
+	if (slots == 0) {
+		// allocator is out of memory
+		return false;
+	}
+
+	Slot* oldSlots = this->slots;
+	this->moveSlots(slots, n);
+	if (oldSlots != 0) {
+		this->allocator.deallocate(oldSlots);
+	}
+	return true;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void
+xpcc::Heap<T, Compare, Allocator>::clear()
+{
+	this->removeAll();
+	if (this->slots != 0) {
+		this->allocator.deallocate(this->slots);
+	}
+	this->slots = 0;
+	this->capacity = 0;
+}
@@ -0,0 +1,415 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+#define XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Hook for elements of an IntrusiveDoublyLinkedList
+	 *
+	 * Elements need to derive publicly from this class. To be part of
+	 * several lists at the same time use a different \p Tag for every
+	 * list.
+	 *
+	 * The element can remove itself from its list in O(1) with unlink(),
+	 * this is also done by the destructor. A copy of an element is not
+	 * part of any list.
+	 *
+	 * \see		IntrusiveDoublyLinkedList
+	 * \ingroup	container
+	 */
+	template <typename Tag = void>
+	class IntrusiveDoublyLinkedListHook
+	{
+	public:
+		IntrusiveDoublyLinkedListHook() :
+			next(0), previous(0)
+		{
+		}
+
+		IntrusiveDoublyLinkedListHook(const IntrusiveDoublyLinkedListHook&) :
+			next(0), previous(0)
+		{
+		}
+
+		~IntrusiveDoublyLinkedListHook()
+		{
+			this->unlink();
+		}
+
+		IntrusiveDoublyLinkedListHook&
+		operator = (const IntrusiveDoublyLinkedListHook&)
+		{
+			// keep the position in the list
+			return *this;
+		}
+
+		/// \c true if the element is part of a list
+		inline bool
+		isLinked() const
+		{
+			return (this->next != 0);
+		}
+
+		/// Remove the element from its list, does nothing if not linked
+		inline void
+		unlink()
+		{
+			if (this->next != 0)
+			{
+				this->next->previous = this->previous;
+				this->previous->next = this->next;
+
+				this->next = 0;
+				this->previous = 0;
+			}
+		}
+
+	private:
+		template <typename T, typename U>
+		friend class IntrusiveDoublyLinkedList;
+
+		IntrusiveDoublyLinkedListHook *next;
+		IntrusiveDoublyLinkedListHook *previous;
+	};
+
+	/**
+	 * \brief	Doubly-linked list with the links stored inside of the elements
+	 *
+	 * Same interface as DoublyLinkedList, but the list does not allocate
+	 * nodes and does not copy the elements. Instead the elements are linked
+	 * through an IntrusiveDoublyLinkedListHook base class. The list does not
+	 * own the elements, removing an element only unlinks it.
+	 *
+	 * The list is circular with a sentinel hook inside of the list object,
+	 * so every element can be unlinked in O(1) without knowing the list,
+	 * see IntrusiveDoublyLinkedListHook::unlink(). Destroying an element
+	 * removes it from its list.
+	 *
+	 * Adding an element which is already part of a list moves it, e.g.
+	 * from a list of pending to a list of finished jobs:
+	 *
+	 * \code
+	 * struct Job : public xpcc::IntrusiveDoublyLinkedListHook<>
+	 * {
+	 *     bool done;
+	 * };
+	 *
+	 * xpcc::IntrusiveDoublyLinkedList<Job> pending;
+	 * xpcc::IntrusiveDoublyLinkedList<Job> finished;
+	 *
+	 * for (auto it = pending.begin(); it != pending.end(); )
+	 * {
+	 *     Job& job = *it;
+	 *     ++it;
+	 *     if (job.done) {
+	 *         finished.append(job);
+	 *     }
+	 * }
+	 * \endcode
+	 *
+	 * Removing an element only invalidates the iterators pointing to it.
+	 *
+	 * \tparam	T		Type of the elements, derived from IntrusiveDoublyLinkedListHook<Tag>
+	 * \tparam	Tag		Selects the hook if \p T has more than one
+	 *
+	 * \see		IntrusiveLinkedList
+	 * \ingroup	container
+	 */
+	template <typename T, typename Tag = void>
+	class IntrusiveDoublyLinkedList
+	{
+	public:
+		typedef std::size_t Size;
+		typedef IntrusiveDoublyLinkedListHook<Tag> Hook;
+
+	public:
+		IntrusiveDoublyLinkedList();
+
+		/// Unlinks all elements
+		~IntrusiveDoublyLinkedList();
+
+		/// check if there are any elements in the list
+		inline bool
+		isEmpty() const
+		{
+			return (this->root.next == &this->root);
+		}
+
+		/**
+		 * \brief	Get number of elements
+		 *
+		 * \warning	This method is slow because it has to iterate through
+		 * 			all elements.
+		 */
+		std::size_t
+		getSize() const;
+
+		/// Insert in front, moves \p value if it is part of another list
+		inline void
+		prepend(T& value)
+		{
+			this->link(value, this->root.next);
+		}
+
+		/// Insert at the end of the list, moves \p value if it is part of another list
+		inline void
+		append(T& value)
+		{
+			this->link(value, &this->root);
+		}
+
+		/// Remove the first element
+		inline void
+		removeFront()
+		{
+			this->root.next->unlink();
+		}
+
+		/// Remove the last element
+		inline void
+		removeBack()
+		{
+			this->root.previous->unlink();
+		}
+
+		inline const T&
+		getFront() const
+		{
+			return static_cast<const T&>(*this->root.next);
+		}
+
+		inline T&
+		getFront()
+		{
+			return static_cast<T&>(*this->root.next);
+		}
+
+		inline const T&
+		getBack() const
+		{
+			return static_cast<const T&>(*this->root.previous);
+		}
+
+		inline T&
+		getBack()
+		{
+			return static_cast<T&>(*this->root.previous);
+		}
+
+		/// Unlink all elements
+		void
+		removeAll();
+
+		/// Move all elements of \p other to the end of this list in O(1)
+		void
+		splice(IntrusiveDoublyLinkedList& other);
+
+	public:
+		class const_iterator;
+
+		/**
+		 * \brief	Bidirectional iterator
+		 */
+		class iterator
+		{
+			friend class IntrusiveDoublyLinkedList;
+			friend class const_iterator;
+
+		public:
+			iterator() :
+				node(0)
+			{
+			}
+
+			inline iterator&
+			operator ++ ()
+			{
+				this->node = this->node->next;
+				return *this;
+			}
+
+			inline iterator&
+			operator -- ()
+			{
+				this->node = this->node->previous;
+				return *this;
+			}
+
+			inline bool
+			operator == (const iterator& other) const
+			{
+				return (this->node == other.node);
+			}
+
+			inline bool
+			operator != (const iterator& other) const
+			{
+				return (this->node != other.node);
+			}
+
+			inline T&
+			operator * ()
+			{
+				return static_cast<T&>(*this->node);
+			}
+
+			inline T*
+			operator -> ()
+			{
+				return static_cast<T*>(this->node);
+			}
+
+		private:
+			iterator(Hook* node) :
+				node(node)
+			{
+			}
+
+			Hook* node;
+		};
+
+		/**
+		 * \brief	Bidirectional const iterator
+		 */
+		class const_iterator
+		{
+			friend class IntrusiveDoublyLinkedList;
+
+		public:
+			const_iterator() :
+				node(0)
+			{
+			}
+
+			/// Converts a normal iterator to a const iterator
+			const_iterator(const iterator& other) :
+				node(other.node)
+			{
+			}
+
+			inline const_iterator&
+			operator ++ ()
+			{
+				this->node = this->node->next;
+				return *this;
+			}
+
+			inline const_iterator&
+			operator -- ()
+			{
+				this->node = this->node->previous;
+				return *this;
+			}
+
+			inline bool
+			operator == (const const_iterator& other) const
+			{
+				return (this->node == other.node);
+			}
+
+			inline bool
+			operator != (const const_iterator& other) const
+			{
+				return (this->node != other.node);
+			}
+
+			inline const T&
+			operator * () const
+			{
+				return static_cast<const T&>(*this->node);
+			}
+
+			inline const T*
+			operator -> () const
+			{
+				return static_cast<const T*>(this->node);
+			}
+
+		private:
+			const_iterator(const Hook* node) :
+				node(node)
+			{
+			}
+
+			const Hook* node;
+		};
+
+		inline iterator
+		begin()
+		{
+			return iterator(this->root.next);
+		}
+
+		inline const_iterator
+		begin() const
+		{
+			return const_iterator(this->root.next);
+		}
+
+		inline iterator
+		end()
+		{
+			return iterator(&this->root);
+		}
+
+		inline const_iterator
+		end() const
+		{
+			return const_iterator(&this->root);
+		}
+
+		/**
+		 * \brief	Insert \p value before \p position
+		 *
+		 * Moves \p value if it is part of another list.
+		 *
+		 * \return	Iterator to the inserted element
+		 */
+		iterator
+		insert(const iterator& position, T& value);
+
+		/**
+		 * \brief	Unlink the element at \p position
+		 *
+		 * \return	Iterator to the element following the removed one
+		 */
+		iterator
+		remove(const iterator& position);
+
+		/// Unlink \p value, which needs to be part of this list
+		inline void
+		remove(T& value)
+		{
+			static_cast<Hook&>(value).unlink();
+		}
+
+	private:
+		IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList& other);
+
+		IntrusiveDoublyLinkedList&
+		operator = (const IntrusiveDoublyLinkedList& other);
+
+		/// Links \p value in front of \p position
+		void
+		link(T& value, Hook* position);
+
+		/// Sentinel, next is the first and previous the last element
+		Hook root;
+	};
+}
+
+#include "intrusive_doubly_linked_list_impl.hpp"
+
+#endif	// XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
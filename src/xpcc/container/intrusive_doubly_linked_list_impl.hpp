@@ -0,0 +1,103 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+	#error	"Don't include this file directly, use 'intrusive_doubly_linked_list.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::IntrusiveDoublyLinkedList()
+{
+	this->root.next = &this->root;
+	this->root.previous = &this->root;
+}
+
+template <typename T, typename Tag>
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::~IntrusiveDoublyLinkedList()
+{
+	// the elements must not point to the sentinel afterwards
+	this->removeAll();
+}
+
+template <typename T, typename Tag>
+std::size_t
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::getSize() const
+{
+	std::size_t count = 0;
+	for (const Hook* node = this->root.next; node != &this->root; node = node->next) {
+		count++;
+	}
+	return count;
+}
+
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::removeAll()
+{
+	while (!this->isEmpty()) {
+		this->removeFront();
+	}
+}
+
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::splice(IntrusiveDoublyLinkedList& other)
+{
+	if (other.isEmpty() || &other == this) {
+		return;
+	}
+
+	Hook* first = other.root.next;
+	Hook* last = other.root.previous;
+
+	first->previous = this->root.previous;
+	this->root.previous->next = first;
+	last->next = &this->root;
+	this->root.previous = last;
+
+	other.root.next = &other.root;
+	other.root.previous = &other.root;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename xpcc::IntrusiveDoublyLinkedList<T, Tag>::iterator
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::insert(const iterator& position, T& value)
+{
+	this->link(value, position.node);
+	return iterator(&value);
+}
+
+template <typename T, typename Tag>
+typename xpcc::IntrusiveDoublyLinkedList<T, Tag>::iterator
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::remove(const iterator& position)
+{
+	Hook* next = position.node->next;
+	position.node->unlink();
+	return iterator(next);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Tag>::link(T& value, Hook* position)
+{
+	Hook* node = &value;
+	if (node == position) {
+		// already at the right place
+		return;
+	}
+	node->unlink();
+
+	node->next = position;
+	node->previous = position->previous;
+	position->previous->next = node;
+	position->previous = node;
+}
@@ -0,0 +1,339 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__INTRUSIVE_LINKED_LIST_HPP
+#define XPCC__INTRUSIVE_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Hook for elements of an IntrusiveLinkedList
+	 *
+	 * Elements need to derive publicly from this class. To be part of
+	 * several lists at the same time use a different \p Tag for every
+	 * list.
+	 *
+	 * A copy of an element is not part of any list.
+	 *
+	 * \see		IntrusiveLinkedList
+	 * \ingroup	container
+	 */
+	template <typename Tag = void>
+	class IntrusiveLinkedListHook
+	{
+	public:
+		IntrusiveLinkedListHook() :
+			next(0)
+		{
+		}
+
+		IntrusiveLinkedListHook(const IntrusiveLinkedListHook&) :
+			next(0)
+		{
+		}
+
+		IntrusiveLinkedListHook&
+		operator = (const IntrusiveLinkedListHook&)
+		{
+			// keep the position in the list
+			return *this;
+		}
+
+	private:
+		template <typename T, typename U>
+		friend class IntrusiveLinkedList;
+
+		IntrusiveLinkedListHook *next;
+	};
+
+	/**
+	 * \brief	Singly-linked list with the links stored inside of the elements
+	 *
+	 * Same interface as LinkedList, but the list does not allocate nodes
+	 * and does not copy the elements. Instead the elements are linked
+	 * through an IntrusiveLinkedListHook base class. The list does not own
+	 * the elements, removing an element only unlinks it. The element needs
+	 * to stay alive as long as it is part of the list.
+	 *
+	 * remove() is O(1) as the iterator remembers the previous element.
+	 * It returns an iterator to the next element, so elements can be
+	 * removed while iterating:
+	 *
+	 * \code
+	 * struct Message : public xpcc::IntrusiveLinkedListHook<>
+	 * {
+	 *     uint8_t data[8];
+	 *     bool done;
+	 * };
+	 *
+	 * xpcc::IntrusiveLinkedList<Message> list;
+	 * list.append(message);
+	 *
+	 * for (auto it = list.begin(); it != list.end(); )
+	 * {
+	 *     if (it->done) {
+	 *         it = list.remove(it);
+	 *     } else {
+	 *         ++it;
+	 *     }
+	 * }
+	 * \endcode
+	 *
+	 * Removing an element invalidates all iterators pointing to it or
+	 * to the element following it.
+	 *
+	 * \tparam	T		Type of the elements, derived from IntrusiveLinkedListHook<Tag>
+	 * \tparam	Tag		Selects the hook if \p T has more than one
+	 *
+	 * \see		IntrusiveDoublyLinkedList
+	 * \ingroup	container
+	 */
+	template <typename T, typename Tag = void>
+	class IntrusiveLinkedList
+	{
+	public:
+		typedef std::size_t Size;
+		typedef IntrusiveLinkedListHook<Tag> Hook;
+
+	public:
+		IntrusiveLinkedList();
+
+		/// check if there are any elements in the list
+		inline bool
+		isEmpty() const
+		{
+			return (this->front == 0);
+		}
+
+		/**
+		 * \brief	Get number of elements
+		 *
+		 * \warning	This method is slow because it has to iterate through
+		 * 			all elements.
+		 */
+		std::size_t
+		getSize() const;
+
+		/// Insert in front, \p value must not be part of a list
+		void
+		prepend(T& value);
+
+		/// Insert at the end of the list, \p value must not be part of a list
+		void
+		append(T& value);
+
+		/// Remove the first element
+		void
+		removeFront();
+
+		inline const T&
+		getFront() const
+		{
+			return static_cast<const T&>(*this->front);
+		}
+
+		inline T&
+		getFront()
+		{
+			return static_cast<T&>(*this->front);
+		}
+
+		inline const T&
+		getBack() const
+		{
+			return static_cast<const T&>(*this->back);
+		}
+
+		inline T&
+		getBack()
+		{
+			return static_cast<T&>(*this->back);
+		}
+
+		/// Unlink all elements
+		void
+		removeAll();
+
+	public:
+		class const_iterator;
+
+		/**
+		 * \brief	Forward iterator
+		 */
+		class iterator
+		{
+			friend class IntrusiveLinkedList;
+			friend class const_iterator;
+
+		public:
+			iterator() :
+				previous(0), node(0)
+			{
+			}
+
+			inline iterator&
+			operator ++ ()
+			{
+				this->previous = this->node;
+				this->node = this->node->next;
+				return *this;
+			}
+
+			inline bool
+			operator == (const iterator& other) const
+			{
+				return (this->node == other.node);
+			}
+
+			inline bool
+			operator != (const iterator& other) const
+			{
+				return (this->node != other.node);
+			}
+
+			inline T&
+			operator * ()
+			{
+				return static_cast<T&>(*this->node);
+			}
+
+			inline T*
+			operator -> ()
+			{
+				return static_cast<T*>(this->node);
+			}
+
+		private:
+			iterator(Hook* previous, Hook* node) :
+				previous(previous), node(node)
+			{
+			}
+
+			Hook* previous;
+			Hook* node;
+		};
+
+		/**
+		 * \brief	Forward const iterator
+		 */
+		class const_iterator
+		{
+			friend class IntrusiveLinkedList;
+
+		public:
+			const_iterator() :
+				node(0)
+			{
+			}
+
+			/// Converts a normal iterator to a const iterator
+			const_iterator(const iterator& other) :
+				node(other.node)
+			{
+			}
+
+			inline const_iterator&
+			operator ++ ()
+			{
+				this->node = this->node->next;
+				return *this;
+			}
+
+			inline bool
+			operator == (const const_iterator& other) const
+			{
+				return (this->node == other.node);
+			}
+
+			inline bool
+			operator != (const const_iterator& other) const
+			{
+				return (this->node != other.node);
+			}
+
+			inline const T&
+			operator * () const
+			{
+				return static_cast<const T&>(*this->node);
+			}
+
+			inline const T*
+			operator -> () const
+			{
+				return static_cast<const T*>(this->node);
+			}
+
+		private:
+			const_iterator(const Hook* node) :
+				node(node)
+			{
+			}
+
+			const Hook* node;
+		};
+
+		inline iterator
+		begin()
+		{
+			return iterator(0, this->front);
+		}
+
+		inline const_iterator
+		begin() const
+		{
+			return const_iterator(this->front);
+		}
+
+		inline iterator
+		end()
+		{
+			return iterator(this->back, 0);
+		}
+
+		inline const_iterator
+		end() const
+		{
+			return const_iterator(0);
+		}
+
+		/**
+		 * \brief	Unlink the element at \p position
+		 *
+		 * \return	Iterator to the element following the removed one
+		 */
+		iterator
+		remove(const iterator& position);
+
+		/**
+		 * \brief	Search and unlink \p value
+		 *
+		 * Slow, has to iterate through the list.
+		 *
+		 * \return	\c false if \p value is not part of the list
+		 */
+		bool
+		remove(T& value);
+
+	private:
+		IntrusiveLinkedList(const IntrusiveLinkedList& other);
+
+		IntrusiveLinkedList&
+		operator = (const IntrusiveLinkedList& other);
+
+		Hook *front;
+		Hook *back;
+	};
+}
+
+#include "intrusive_linked_list_impl.hpp"
+
+#endif	// XPCC__INTRUSIVE_LINKED_LIST_HPP
@@ -0,0 +1,125 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__INTRUSIVE_LINKED_LIST_HPP
+	#error	"Don't include this file directly, use 'intrusive_linked_list.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+xpcc::IntrusiveLinkedList<T, Tag>::IntrusiveLinkedList() :
+	front(0), back(0)
+{
+}
+
+template <typename T, typename Tag>
+std::size_t
+xpcc::IntrusiveLinkedList<T, Tag>::getSize() const
+{
+	std::size_t count = 0;
+	for (const Hook* node = this->front; node != 0; node = node->next) {
+		count++;
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveLinkedList<T, Tag>::prepend(T& value)
+{
+	Hook* node = &value;
+
+	node->next = this->front;
+	this->front = node;
+
+	if (this->back == 0) {
+		// first element in the list
+		this->back = node;
+	}
+}
+
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveLinkedList<T, Tag>::append(T& value)
+{
+	Hook* node = &value;
+
+	node->next = 0;
+	if (this->front == 0) {
+		// first element in the list
+		this->front = node;
+	}
+	else {
+		this->back->next = node;
+	}
+	this->back = node;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveLinkedList<T, Tag>::removeFront()
+{
+	Hook* node = this->front;
+	this->front = node->next;
+	node->next = 0;
+
+	if (this->front == 0) {
+		// last element removed
+		this->back = 0;
+	}
+}
+
+template <typename T, typename Tag>
+void
+xpcc::IntrusiveLinkedList<T, Tag>::removeAll()
+{
+	while (this->front != 0) {
+		this->removeFront();
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, typename Tag>
+typename xpcc::IntrusiveLinkedList<T, Tag>::iterator
+xpcc::IntrusiveLinkedList<T, Tag>::remove(const iterator& position)
+{
+	Hook* node = position.node;
+	Hook* next = node->next;
+
+	if (position.previous == 0) {
+		this->front = next;
+	}
+	else {
+		position.previous->next = next;
+	}
+
+	if (node == this->back) {
+		this->back = position.previous;
+	}
+	node->next = 0;
+
+	return iterator(position.previous, next);
+}
+
+template <typename T, typename Tag>
+bool
+xpcc::IntrusiveLinkedList<T, Tag>::remove(T& value)
+{
+	const Hook* node = &value;
+	for (iterator it = this->begin(); it != this->end(); ++it)
+	{
+		if (it.node == node) {
+			this->remove(it);
+			return true;
+		}
+	}
+	return false;
+}
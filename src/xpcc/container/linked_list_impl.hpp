@@ -77,6 +77,10 @@ xpcc::LinkedList<T, Allocator>::prepend(const T& value)
 {
 	// allocate memory for the new node and copy the value into it
 	Node *node = this->nodeAllocator.allocate(1);
+	if (node == 0) {
+		// allocator is out of memory
+		return false;
+	}
 	Allocator::construct(&node->value, value);
 	
 	// hook the node into the list
@@ -97,6 +101,10 @@ xpcc::LinkedList<T, Allocator>::append(const T& value)
 {
 	// allocate memory for the new node and copy the value into it
 	Node *node = this->nodeAllocator.allocate(1);
+	if (node == 0) {
+		// allocator is out of memory
+		return false;
+	}
 	Allocator::construct(&node->value, value);
 	
 	// hook the node into the list
@@ -125,6 +133,10 @@ xpcc::LinkedList<T, Allocator>::insert(const_iterator pos, const T& value)
 
 	// allocate memory for the new node and copy the value into it
 	Node *node = this->nodeAllocator.allocate(1);
+	if (node == 0) {
+		// allocator is out of memory
+		return false;
+	}
 	Allocator::construct(&node->value, value);
 
 	// hook the node into the list
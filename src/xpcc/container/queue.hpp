@@ -116,6 +116,32 @@ namespace xpcc
 		{
 			c.removeFront();
 		}
+		
+		/**
+		 * \brief	Append \p n elements at once
+		 * 
+		 * Only available if the container supports bulk operations.
+		 * 
+		 * \return	number of appended elements
+		 */
+		inline Size
+		push(const T* values, std::size_t n)
+		{
+			return c.append(values, n);
+		}
+		
+		/**
+		 * \brief	Remove up to \p n elements at once
+		 * 
+		 * Only available if the container supports bulk operations.
+		 * 
+		 * \return	number of removed elements
+		 */
+		inline Size
+		pop(std::size_t n)
+		{
+			return c.removeFront(n);
+		}
 
 	protected:
 		Container c;
@@ -132,6 +158,22 @@ namespace xpcc
 			 typename Container = BoundedDeque<T, N> >
 	class BoundedQueue : public Queue<T, Container>
 	{
+	public:
+		/**
+		 * \brief	Content of the queue as contiguous blocks
+		 * 
+		 * Only available if the container provides getSpans(), the type of
+		 * the spans is the one of the container, e.g.
+		 * BoundedDeque::ConstSpan.
+		 * 
+		 * \see	BoundedDeque::getSpans()
+		 */
+		template<typename Span>
+		inline void
+		getSpans(Span& first, Span& second) const
+		{
+			this->c.getSpans(first, second);
+		}
 	};
 
 }
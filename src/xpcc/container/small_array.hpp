@@ -0,0 +1,340 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SMALL_ARRAY_HPP
+#define XPCC__SMALL_ARRAY_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include <cstring>
+#include <initializer_list>
+
+#include <xpcc/utils/allocator.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Dynamic array with storage for a few elements inside of the object
+	 *
+	 * Same interface as DynamicArray, but the first \p InlineN elements are
+	 * stored inside of the object itself. Only if more elements are
+	 * appended the elements are moved to memory from the allocator.
+	 * For the common case of few elements no heap allocation is needed.
+	 *
+	 * Additionally to DynamicArray:
+	 * - move construction and move assignment (steals the allocated
+	 *   memory, only inline elements are moved one by one)
+	 * - configurable growth, see setGrowth()
+	 * - shrinkToFit() to return unused memory
+	 * - trivially copyable types are copied with \c std::memcpy
+	 *
+	 * The iterators are plain pointers.
+	 *
+	 * \code
+	 * xpcc::SmallArray<xpcc::Vector2i, 8> vertices;
+	 * vertices.append(xpcc::Vector2i(0, 0));	// no allocation
+	 * \endcode
+	 *
+	 * \tparam	T			Type of the elements
+	 * \tparam	InlineN		Number of elements stored inside of the object
+	 * \tparam	Allocator	Allocator used if more than \p InlineN elements
+	 * 						are needed
+	 *
+	 * \see		DynamicArray
+	 * \ingroup	container
+	 */
+	template <typename T, std::size_t InlineN,
+			  typename Allocator = allocator::Dynamic<T> >
+	class SmallArray
+	{
+		static_assert(InlineN > 0, "InlineN must be at least one, use DynamicArray otherwise");
+
+	public:
+		typedef std::size_t SizeType;
+
+		typedef T* iterator;
+		typedef const T* const_iterator;
+
+		/// Default growth in percent of the current capacity
+		static constexpr uint8_t defaultGrowth = 50;
+
+	public:
+		/// Constructs an empty array, with the inline capacity
+		SmallArray(const Allocator& allocator = Allocator());
+
+		/// Constructs an empty array with a capacity of at least \p n
+		SmallArray(SizeType n, const Allocator& allocator = Allocator());
+
+		/// Constructs an array with \p n copies of \p value
+		SmallArray(SizeType n, const T& value, const Allocator& allocator = Allocator());
+
+		SmallArray(std::initializer_list<T> init,
+				const Allocator& allocator = Allocator());
+
+		SmallArray(const SmallArray& other);
+
+		/// Takes the memory of \p other, which is empty afterwards
+		SmallArray(SmallArray&& other);
+
+		~SmallArray();
+
+		SmallArray&
+		operator = (const SmallArray& other);
+
+		SmallArray&
+		operator = (SmallArray&& other);
+
+		inline bool
+		isEmpty() const
+		{
+			return (this->size == 0);
+		}
+
+		inline SizeType
+		getSize() const
+		{
+			return this->size;
+		}
+
+		/// Never less than \p InlineN
+		inline SizeType
+		getCapacity() const
+		{
+			return this->capacity;
+		}
+
+		/// \c true as long as the elements are stored inside of the object
+		inline bool
+		isInline() const
+		{
+			return (this->values == getInlineValues());
+		}
+
+		inline const Allocator&
+		getAllocator() const
+		{
+			return this->allocator;
+		}
+
+		/**
+		 * \brief	Set the growth if no space is left
+		 *
+		 * The capacity is increased by \p percent of the current capacity,
+		 * but at least by one element. 50% (the default) is the same
+		 * as DynamicArray, 100% doubles the capacity.
+		 */
+		inline void
+		setGrowth(uint8_t percent)
+		{
+			this->growth = percent;
+		}
+
+		inline uint8_t
+		getGrowth() const
+		{
+			return this->growth;
+		}
+
+		/**
+		 * \brief	Request a change in capacity
+		 *
+		 * Same as DynamicArray::reserve(): the capacity is afterwards
+		 * enough to hold \p n more elements.
+		 *
+		 * \return	\c false if the allocator has no memory left
+		 */
+		bool
+		reserve(SizeType n);
+
+		/**
+		 * \brief	Reduce the capacity to the size
+		 *
+		 * Moves the elements back inside of the object if they fit.
+		 */
+		void
+		shrinkToFit();
+
+		/// Remove all elements and free the allocated memory
+		void
+		clear();
+
+		/// Remove all elements, but keep the capacity
+		void
+		removeAll();
+
+		inline T&
+		operator [](SizeType index)
+		{
+			return this->values[index];
+		}
+
+		inline const T&
+		operator [](SizeType index) const
+		{
+			return this->values[index];
+		}
+
+		/**
+		 * \brief	Add element at the end
+		 *
+		 * \return	\c false if the allocator has no memory left, the
+		 * 			array is unchanged in this case.
+		 */
+		bool
+		append(const T& value);
+
+		bool
+		append(T&& value);
+
+		void
+		removeBack();
+
+		inline const T&
+		getFront() const
+		{
+			return this->values[0];
+		}
+
+		inline T&
+		getFront()
+		{
+			return this->values[0];
+		}
+
+		inline const T&
+		getBack() const
+		{
+			return this->values[this->size - 1];
+		}
+
+		inline T&
+		getBack()
+		{
+			return this->values[this->size - 1];
+		}
+
+	public:
+		inline iterator
+		begin()
+		{
+			return this->values;
+		}
+
+		inline const_iterator
+		begin() const
+		{
+			return this->values;
+		}
+
+		inline iterator
+		end()
+		{
+			return this->values + this->size;
+		}
+
+		inline const_iterator
+		end() const
+		{
+			return this->values + this->size;
+		}
+
+		/// Returns end() if \p value is not found
+		iterator
+		find(const T& value);
+
+		const_iterator
+		find(const T& value) const;
+
+	private:
+		// uninitialized memory for one element
+		struct Storage
+		{
+			alignas(T) uint8_t data[sizeof(T)];
+		};
+
+		// selects the memcpy fast paths, <type_traits> is not available
+		// on all platforms
+		template <bool trivial>
+		struct Trivial
+		{
+		};
+
+		typedef Trivial<__is_trivially_copyable(T)> IsTrivial;
+
+		inline T*
+		getInlineValues()
+		{
+			return reinterpret_cast<T*>(this->storage);
+		}
+
+		inline const T*
+		getInlineValues() const
+		{
+			return reinterpret_cast<const T*>(this->storage);
+		}
+
+		/// Capacity after the next growth
+		SizeType
+		getGrownCapacity() const;
+
+		/**
+		 * Moves the elements to a new buffer of size n, allocated or the
+		 * inline storage if \p n is not more than \p InlineN. Keeps the
+		 * old buffer if the allocation fails.
+		 */
+		bool
+		relocate(SizeType n);
+
+		/// Moves the elements to \p buffer and frees the old buffer
+		void
+		adopt(T* buffer, SizeType n);
+
+		/// Takes elements or memory of \p other, this needs to be empty
+		void
+		take(SmallArray& other);
+
+		/// Destroys the elements and frees the memory, leaves a dangling state
+		void
+		release();
+
+		// copy constructs n elements into uninitialized memory
+		static void
+		copy(T* destination, const T* source, SizeType n, Trivial<true>);
+
+		static void
+		copy(T* destination, const T* source, SizeType n, Trivial<false>);
+
+		// move constructs n elements into uninitialized memory and
+		// destroys the source elements
+		static void
+		move(T* destination, T* source, SizeType n, Trivial<true>);
+
+		static void
+		move(T* destination, T* source, SizeType n, Trivial<false>);
+
+		static void
+		destroy(T* values, SizeType n, Trivial<true>);
+
+		static void
+		destroy(T* values, SizeType n, Trivial<false>);
+
+		Allocator allocator;
+
+		SizeType size;
+		SizeType capacity;
+		T* values;
+		uint8_t growth;
+
+		Storage storage[InlineN];
+	};
+}
+
+#include "small_array_impl.hpp"
+
+#endif	// XPCC__SMALL_ARRAY_HPP
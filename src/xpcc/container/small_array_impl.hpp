@@ -0,0 +1,409 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SMALL_ARRAY_HPP
+	#error	"Don't include this file directly, use 'small_array.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+constexpr uint8_t xpcc::SmallArray<T, InlineN, Allocator>::defaultGrowth;
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(const Allocator& alloc) :
+	allocator(alloc),
+	size(0), capacity(InlineN), values(getInlineValues()),
+	growth(defaultGrowth)
+{
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(SizeType n, const Allocator& alloc) :
+	allocator(alloc),
+	size(0), capacity(InlineN), values(getInlineValues()),
+	growth(defaultGrowth)
+{
+	this->relocate(n);
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(SizeType n, const T& value, const Allocator& alloc) :
+	allocator(alloc),
+	size(0), capacity(InlineN), values(getInlineValues()),
+	growth(defaultGrowth)
+{
+	if (!this->relocate(n)) {
+		// allocator is out of memory
+		n = this->capacity;
+	}
+	for (SizeType i = 0; i < n; ++i) {
+		::new ((void *) &this->values[i]) T(value);
+	}
+	this->size = n;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(std::initializer_list<T> init, const Allocator& alloc) :
+	allocator(alloc),
+	size(0), capacity(InlineN), values(getInlineValues()),
+	growth(defaultGrowth)
+{
+	SizeType n = init.size();
+	if (!this->relocate(n)) {
+		n = this->capacity;
+	}
+	copy(this->values, init.begin(), n, IsTrivial());
+	this->size = n;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(const SmallArray& other) :
+	allocator(other.allocator),
+	size(0), capacity(InlineN), values(getInlineValues()),
+	growth(other.growth)
+{
+	// only as much memory as needed, not the capacity of other
+	SizeType n = other.size;
+	if (!this->relocate(n)) {
+		n = this->capacity;
+	}
+	copy(this->values, other.values, n, IsTrivial());
+	this->size = n;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::SmallArray(SmallArray&& other) :
+	allocator(other.allocator),
+	growth(other.growth)
+{
+	this->take(other);
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>::~SmallArray()
+{
+	this->release();
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>&
+xpcc::SmallArray<T, InlineN, Allocator>::operator = (const SmallArray& other)
+{
+	if (this == &other) {
+		return *this;
+	}
+
+	this->removeAll();
+	if (other.size > this->capacity)
+	{
+		this->clear();
+		this->allocator = other.allocator;
+		this->relocate(other.size);
+	}
+	this->growth = other.growth;
+
+	const SizeType n = (other.size < this->capacity) ? other.size : this->capacity;
+	copy(this->values, other.values, n, IsTrivial());
+	this->size = n;
+
+	return *this;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+xpcc::SmallArray<T, InlineN, Allocator>&
+xpcc::SmallArray<T, InlineN, Allocator>::operator = (SmallArray&& other)
+{
+	if (this == &other) {
+		return *this;
+	}
+
+	this->release();
+	this->allocator = other.allocator;
+	this->growth = other.growth;
+	this->take(other);
+
+	return *this;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+bool
+xpcc::SmallArray<T, InlineN, Allocator>::reserve(SizeType n)
+{
+	if (n <= (this->capacity - this->size)) {
+		// capacity is already big enough, nothing to do.
+		return true;
+	}
+
+	return this->relocate(this->size + n);
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::shrinkToFit()
+{
+	if (this->isInline() || (this->size == this->capacity)) {
+		return;
+	}
+
+	// keeps the old buffer if the allocator has no memory left
+	this->relocate(this->size);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::clear()
+{
+	this->release();
+
+	this->values = getInlineValues();
+	this->size = 0;
+	this->capacity = InlineN;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::removeAll()
+{
+	destroy(this->values, this->size, IsTrivial());
+	this->size = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+bool
+xpcc::SmallArray<T, InlineN, Allocator>::append(const T& value)
+{
+	if (this->capacity == this->size)
+	{
+		const SizeType n = this->getGrownCapacity();
+		T* buffer = this->allocator.allocate(n);
+		if (buffer == 0) {
+			// allocator is out of memory
+			return false;
+		}
+
+		// construct the new element first, value might be part of
+		// the old buffer
+		::new ((void *) &buffer[this->size]) T(value);
+		this->adopt(buffer, n);
+	}
+	else {
+		::new ((void *) &this->values[this->size]) T(value);
+	}
+	++this->size;
+
+	return true;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+bool
+xpcc::SmallArray<T, InlineN, Allocator>::append(T&& value)
+{
+	if (this->capacity == this->size)
+	{
+		const SizeType n = this->getGrownCapacity();
+		T* buffer = this->allocator.allocate(n);
+		if (buffer == 0) {
+			return false;
+		}
+
+		::new ((void *) &buffer[this->size]) T(static_cast<T&&>(value));
+		this->adopt(buffer, n);
+	}
+	else {
+		::new ((void *) &this->values[this->size]) T(static_cast<T&&>(value));
+	}
+	++this->size;
+
+	return true;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::removeBack()
+{
+	--this->size;
+	destroy(&this->values[this->size], 1, IsTrivial());
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+typename xpcc::SmallArray<T, InlineN, Allocator>::iterator
+xpcc::SmallArray<T, InlineN, Allocator>::find(const T& value)
+{
+	iterator iter = this->begin();
+	for (; iter != this->end(); ++iter)
+	{
+		if ((*iter) == value) {
+			return iter;
+		}
+	}
+
+	// return end() if value has not been found
+	return iter;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+typename xpcc::SmallArray<T, InlineN, Allocator>::const_iterator
+xpcc::SmallArray<T, InlineN, Allocator>::find(const T& value) const
+{
+	const_iterator iter = this->begin();
+	for (; iter != this->end(); ++iter)
+	{
+		if ((*iter) == value) {
+			return iter;
+		}
+	}
+
+	return iter;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+typename xpcc::SmallArray<T, InlineN, Allocator>::SizeType
+xpcc::SmallArray<T, InlineN, Allocator>::getGrownCapacity() const
+{
+	const SizeType n = this->capacity + (this->capacity * this->growth) / 100;
+	if (n == this->capacity) {
+		// grow at least by one element
+		return n + 1;
+	}
+	return n;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+bool
+xpcc::SmallArray<T, InlineN, Allocator>::relocate(SizeType n)
+{
+	T* buffer;
+	if (n <= InlineN)
+	{
+		if (this->isInline()) {
+			// the inline storage is always big enough
+			return true;
+		}
+		buffer = getInlineValues();
+		n = InlineN;
+	}
+	else
+	{
+		buffer = this->allocator.allocate(n);
+		if (buffer == 0) {
+			// keep the old buffer
+			return false;
+		}
+	}
+
+	this->adopt(buffer, n);
+	return true;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::adopt(T* buffer, SizeType n)
+{
+	move(buffer, this->values, this->size, IsTrivial());
+	if (!this->isInline()) {
+		this->allocator.deallocate(this->values);
+	}
+
+	this->values = buffer;
+	this->capacity = n;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::take(SmallArray& other)
+{
+	this->size = other.size;
+	if (other.isInline())
+	{
+		// inline elements can not be stolen, move them one by one
+		this->values = getInlineValues();
+		this->capacity = InlineN;
+		move(this->values, other.values, other.size, IsTrivial());
+	}
+	else
+	{
+		this->values = other.values;
+		this->capacity = other.capacity;
+
+		other.values = other.getInlineValues();
+		other.capacity = InlineN;
+	}
+	other.size = 0;
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::release()
+{
+	destroy(this->values, this->size, IsTrivial());
+	if (!this->isInline()) {
+		this->allocator.deallocate(this->values);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::copy(T* destination, const T* source, SizeType n, Trivial<true>)
+{
+	if (n > 0) {
+		std::memcpy((void *) destination, (const void *) source, n * sizeof(T));
+	}
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::copy(T* destination, const T* source, SizeType n, Trivial<false>)
+{
+	for (SizeType i = 0; i < n; ++i) {
+		::new ((void *) &destination[i]) T(source[i]);
+	}
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::move(T* destination, T* source, SizeType n, Trivial<true>)
+{
+	if (n > 0) {
+		std::memcpy((void *) destination, (const void *) source, n * sizeof(T));
+	}
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::move(T* destination, T* source, SizeType n, Trivial<false>)
+{
+	for (SizeType i = 0; i < n; ++i) {
+		::new ((void *) &destination[i]) T(static_cast<T&&>(source[i]));
+		source[i].~T();
+	}
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::destroy(T*, SizeType, Trivial<true>)
+{
+	// nothing to do
+}
+
+template <typename T, std::size_t InlineN, typename Allocator>
+void
+xpcc::SmallArray<T, InlineN, Allocator>::destroy(T* values, SizeType n, Trivial<false>)
+{
+	for (SizeType i = 0; i < n; ++i) {
+		values[i].~T();
+	}
+}
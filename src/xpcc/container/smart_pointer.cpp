@@ -56,6 +56,13 @@ xpcc::SmartPointer::SmartPointer(uint16_t size) :
 	*reinterpret_cast<uint16_t*>(ptr + 2) = size;
 }
 
+xpcc::SmartPointer::SmartPointer(uint16_t size, xpcc::MemoryTraits traits) :
+	ptr(new (traits) uint8_t[size ? size + 4 : 5])
+{
+	ptr[0] = 1;
+	*reinterpret_cast<uint16_t*>(ptr + 2) = size;
+}
+
 xpcc::SmartPointer::~SmartPointer()
 {
 	if (--ptr[0] == 0) {
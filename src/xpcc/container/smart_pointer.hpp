@@ -34,6 +34,7 @@
 #include <cstring>		// for std::memcpy
 #include <stdint.h>
 #include <xpcc/architecture/utils.hpp>
+#include <xpcc/architecture/interface/memory.hpp>
 
 #include <xpcc/io/iostream.hpp>
 
@@ -50,6 +51,9 @@ namespace xpcc
 	 * records when it is copied - when the last copy is destroyed the
 	 * memory is released.
 	 *
+	 * The constructors with xpcc::MemoryTraits place the data in a
+	 * specific memory region.
+	 *
 	 * \ingroup container
 	 */
 	class SmartPointer
@@ -66,6 +70,16 @@ namespace xpcc
 		 */
 		SmartPointer(uint16_t size);
 
+		/**
+		 * \brief	Allocates memory with the given traits
+		 *
+		 * \param	size	the amount of memory to be allocated, has to be
+		 * 					smaller than 65530
+		 * \param	traits	e.g. xpcc::MemoryFastData for messages which are
+		 * 					processed often
+		 */
+		SmartPointer(uint16_t size, xpcc::MemoryTraits traits);
+
 		// Must use a pointer to T here, otherwise the compiler can't distinguish
 		// between constructor and copy constructor!
 		template<typename T>
@@ -77,6 +91,16 @@ namespace xpcc
 			std::memcpy(ptr + 4, data, sizeof(T));
 		}
 
+		/// Copy \p data into memory with the given traits
+		template<typename T>
+		SmartPointer(const T *data, xpcc::MemoryTraits traits)
+		: ptr(new (traits) uint8_t[sizeof(T) + 4])
+		{
+			ptr[0] = 1;
+			*reinterpret_cast<uint16_t*>(ptr + 2) = sizeof(T);
+			std::memcpy(ptr + 4, data, sizeof(T));
+		}
+
 		SmartPointer(const SmartPointer& other);
 
 		~SmartPointer();
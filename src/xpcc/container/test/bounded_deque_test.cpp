@@ -383,3 +383,144 @@ BoundedDequeTest::testElementAccess()
 	TEST_ASSERT_EQUALS(deque.rget(2), 2);
 	
 }
+
+void
+BoundedDequeTest::testBulkAppend()
+{
+	xpcc::BoundedDeque<int16_t, 5> deque;
+	const int16_t values[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	
+	TEST_ASSERT_EQUALS(deque.append(values, 3), 3U);
+	TEST_ASSERT_EQUALS(deque.getSize(), 3U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 1);
+	TEST_ASSERT_EQUALS(deque.getBack(), 3);
+	
+	// only two more fit
+	TEST_ASSERT_EQUALS(deque.append(values + 3, 4), 2U);
+	TEST_ASSERT_TRUE(deque.isFull());
+	TEST_ASSERT_EQUALS(deque.getBack(), 5);
+	TEST_ASSERT_EQUALS(deque.append(values, 1), 0U);
+	
+	// wraps around the end of the buffer
+	deque.removeFront();
+	deque.removeFront();
+	deque.removeFront();
+	TEST_ASSERT_EQUALS(deque.append(values + 5, 3), 3U);
+	TEST_ASSERT_EQUALS(deque.getSize(), 5U);
+	for (uint8_t i = 0; i < 5; ++i) {
+		TEST_ASSERT_EQUALS(deque[i], i + 4);
+	}
+	
+	TEST_ASSERT_EQUALS(deque.append(values, 0), 0U);
+}
+
+void
+BoundedDequeTest::testBulkRemove()
+{
+	xpcc::BoundedDeque<int16_t, 5> deque;
+	
+	TEST_ASSERT_EQUALS(deque.removeFront(2), 0U);
+	
+	for (int16_t i = 1; i <= 5; ++i) {
+		deque.append(i);
+	}
+	TEST_ASSERT_EQUALS(deque.removeFront(2), 2U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 3);
+	
+	deque.append(6);
+	deque.append(7);
+	TEST_ASSERT_EQUALS(deque.removeFront(4), 4U);
+	TEST_ASSERT_EQUALS(deque.getSize(), 1U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 7);
+	
+	TEST_ASSERT_EQUALS(deque.removeFront(10), 1U);
+	TEST_ASSERT_TRUE(deque.isEmpty());
+	
+	// still usable afterwards
+	deque.append(8);
+	TEST_ASSERT_EQUALS(deque.getFront(), 8);
+	TEST_ASSERT_EQUALS(deque.getBack(), 8);
+}
+
+void
+BoundedDequeTest::testSpans()
+{
+	xpcc::BoundedDeque<int16_t, 5> deque;
+	xpcc::BoundedDeque<int16_t, 5>::Span first, second;
+	
+	deque.getSpans(first, second);
+	TEST_ASSERT_EQUALS(first.size, 0U);
+	TEST_ASSERT_EQUALS(second.size, 0U);
+	
+	for (int16_t i = 1; i <= 4; ++i) {
+		deque.append(i);
+	}
+	deque.getSpans(first, second);
+	TEST_ASSERT_EQUALS(first.size, 4U);
+	TEST_ASSERT_EQUALS(second.size, 0U);
+	const int16_t expected1[] = { 1, 2, 3, 4 };
+	TEST_ASSERT_EQUALS_ARRAY(first.data, expected1, 4);
+	
+	// wrapped content
+	deque.removeFront(3);
+	deque.append(5);
+	deque.append(6);
+	deque.append(7);
+	
+	const auto& constDeque = deque;
+	xpcc::BoundedDeque<int16_t, 5>::ConstSpan constFirst, constSecond;
+	constDeque.getSpans(constFirst, constSecond);
+	TEST_ASSERT_EQUALS(constFirst.size + constSecond.size, 4);
+	TEST_ASSERT_TRUE(constSecond.size > 0);
+	
+	int16_t result[4];
+	for (uint8_t i = 0; i < constFirst.size; ++i) {
+		result[i] = constFirst.data[i];
+	}
+	for (uint8_t i = 0; i < constSecond.size; ++i) {
+		result[constFirst.size + i] = constSecond.data[i];
+	}
+	const int16_t expected2[] = { 4, 5, 6, 7 };
+	TEST_ASSERT_EQUALS_ARRAY(result, expected2, 4);
+	
+	// writing through the span changes the content
+	deque.getSpans(first, second);
+	first.data[0] = 40;
+	TEST_ASSERT_EQUALS(deque.getFront(), 40);
+}
+
+void
+BoundedDequeTest::testPowerOfTwo()
+{
+	xpcc::BoundedDeque<int16_t, 4> deque;
+	const int16_t values[] = { 1, 2, 3 };
+	
+	for (int16_t round = 0; round < 10; ++round)
+	{
+		TEST_ASSERT_EQUALS(deque.append(values, 3), 3U);
+		TEST_ASSERT_TRUE(deque.prepend(round));
+		TEST_ASSERT_TRUE(deque.isFull());
+		
+		TEST_ASSERT_EQUALS(deque.getFront(), round);
+		TEST_ASSERT_EQUALS(deque.get(3), 3);
+		TEST_ASSERT_EQUALS(deque.rget(0), 3);
+		TEST_ASSERT_EQUALS(deque.rget(3), round);
+		
+		int16_t sum = 0;
+		for (auto it = deque.begin(); it != deque.end(); ++it) {
+			sum += *it;
+		}
+		TEST_ASSERT_EQUALS(sum, round + 6);
+		
+		deque.removeBack();
+		TEST_ASSERT_EQUALS(deque.getBack(), 2);
+		TEST_ASSERT_EQUALS(deque.removeFront(2), 2U);
+		TEST_ASSERT_EQUALS(deque.getFront(), 2);
+		deque.removeFront();
+		TEST_ASSERT_TRUE(deque.isEmpty());
+		
+		// shift the start position for the next round
+		deque.append(0);
+		deque.removeFront();
+	}
+}
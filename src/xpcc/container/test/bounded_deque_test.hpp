@@ -61,4 +61,17 @@ public:
 	
 	void
 	testElementAccess();
+	
+	void
+	testBulkAppend();
+	
+	void
+	testBulkRemove();
+	
+	void
+	testSpans();
+	
+	// Same operations with a power of two size (masked indices)
+	void
+	testPowerOfTwo();
 };
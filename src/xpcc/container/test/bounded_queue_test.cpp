@@ -77,3 +77,65 @@ BoundedQueueTest::testQueue()
 	
 	TEST_ASSERT_TRUE(queue.isEmpty());
 }
+
+void
+BoundedQueueTest::testBulk()
+{
+	xpcc::BoundedQueue<uint8_t, 8> queue;
+	const uint8_t data[] = "abcdefghij";
+	
+	TEST_ASSERT_EQUALS(queue.push(data, 6), 6U);
+	TEST_ASSERT_EQUALS(queue.pop(4), 4U);
+	TEST_ASSERT_EQUALS(queue.push(data + 6, 4), 4U);
+	TEST_ASSERT_EQUALS(queue.getSize(), 6U);
+	
+	xpcc::BoundedDeque<uint8_t, 8>::ConstSpan first, second;
+	queue.getSpans(first, second);
+	TEST_ASSERT_EQUALS(first.size + second.size, 6);
+	TEST_ASSERT_TRUE(second.size > 0);
+	TEST_ASSERT_EQUALS_ARRAY(first.data, data + 4, first.size);
+	TEST_ASSERT_EQUALS_ARRAY(second.data, data + 4 + first.size, second.size);
+	
+	TEST_ASSERT_EQUALS(queue.pop(first.size), first.size);
+	TEST_ASSERT_EQUALS(queue.get(), data[4 + first.size]);
+}
+
+namespace
+{
+	// provides only what xpcc::Queue needs, no spans
+	template<typename T, std::size_t N>
+	class MinimalContainer
+	{
+	public:
+		typedef typename xpcc::BoundedDeque<T, N>::Size Size;
+
+		bool isEmpty() const { return deque.isEmpty(); }
+		bool isFull() const { return deque.isFull(); }
+		Size getSize() const { return deque.getSize(); }
+		Size getMaxSize() const { return deque.getMaxSize(); }
+		T& getFront() { return deque.getFront(); }
+		const T& getFront() const { return deque.getFront(); }
+		bool append(const T& value) { return deque.append(value); }
+		void removeFront() { deque.removeFront(); }
+
+	private:
+		xpcc::BoundedDeque<T, N> deque;
+	};
+}
+
+void
+BoundedQueueTest::testCustomContainer()
+{
+	xpcc::BoundedQueue<int16_t, 4, MinimalContainer<int16_t, 4> > queue;
+	
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 4U);
+	
+	TEST_ASSERT_TRUE(queue.push(-3));
+	TEST_ASSERT_TRUE(queue.push(7));
+	TEST_ASSERT_EQUALS(queue.getSize(), 2U);
+	
+	TEST_ASSERT_EQUALS(queue.get(), -3);
+	queue.pop();
+	TEST_ASSERT_EQUALS(queue.get(), 7);
+}
@@ -35,4 +35,10 @@ class BoundedQueueTest : public unittest::TestSuite
 public:
 	void
 	testQueue();
+	
+	void
+	testBulk();
+	
+	void
+	testCustomContainer();
 };
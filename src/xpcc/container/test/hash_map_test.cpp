@@ -0,0 +1,392 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include <unittest/type/count_type.hpp>
+#include <xpcc/container/hash_map.hpp>
+#include <xpcc/utils/allocator/static.hpp>
+
+#include "hash_map_test.hpp"
+
+namespace
+{
+	/// Puts all keys into the same bucket
+	struct CollidingHash
+	{
+		uint32_t
+		operator () (uint16_t) const
+		{
+			return 0;
+		}
+	};
+
+	struct Name
+	{
+		char text[8];
+	};
+
+	/// Allows searching for a Name with a plain string
+	struct NameHash
+	{
+		uint32_t
+		operator () (const char* name) const
+		{
+			return xpcc::Hash<const char*>()(name);
+		}
+
+		uint32_t
+		operator () (const Name& name) const
+		{
+			return xpcc::Hash<const char*>()(name.text);
+		}
+	};
+
+	struct NameEqual
+	{
+		bool
+		operator () (const Name& a, const char* b) const
+		{
+			return (std::strcmp(a.text, b) == 0);
+		}
+
+		bool
+		operator () (const Name& a, const Name& b) const
+		{
+			return (std::strcmp(a.text, b.text) == 0);
+		}
+	};
+}
+
+void
+HashMapTest::setUp()
+{
+	unittest::CountType::reset();
+}
+
+void
+HashMapTest::testBoundedInsertAndGet()
+{
+	xpcc::BoundedHashMap<uint16_t, int16_t, 8> map;
+
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_EQUALS(map.getCapacity(), 8U);
+	TEST_ASSERT_TRUE(map.get(1) == nullptr);
+	TEST_ASSERT_FALSE(map.contains(1));
+
+	TEST_ASSERT_TRUE(map.insert(1, 10));
+	TEST_ASSERT_TRUE(map.insert(1000, -20));
+	TEST_ASSERT_TRUE(map.insert(42, 30));
+
+	TEST_ASSERT_FALSE(map.isEmpty());
+	TEST_ASSERT_EQUALS(map.getSize(), 3U);
+
+	TEST_ASSERT_TRUE(map.contains(1000));
+	TEST_ASSERT_EQUALS(*map.get(1), 10);
+	TEST_ASSERT_EQUALS(*map.get(1000), -20);
+	TEST_ASSERT_EQUALS(*map.get(42), 30);
+	TEST_ASSERT_TRUE(map.get(2) == nullptr);
+
+	// existing keys are not overwritten
+	TEST_ASSERT_FALSE(map.insert(42, 31));
+	TEST_ASSERT_EQUALS(*map.get(42), 30);
+	TEST_ASSERT_EQUALS(map.getSize(), 3U);
+
+	*map.get(42) = 32;
+	TEST_ASSERT_EQUALS(*map.get(42), 32);
+
+	TEST_ASSERT_TRUE(map.find(1000) != map.end());
+	TEST_ASSERT_EQUALS(map.find(1000)->first, 1000U);
+	TEST_ASSERT_TRUE(map.find(1001) == map.end());
+
+	map.removeAll();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_FALSE(map.contains(1));
+}
+
+void
+HashMapTest::testBoundedFull()
+{
+	xpcc::BoundedHashMap<uint16_t, uint16_t, 16> map;
+
+	for (uint16_t i = 0; i < 16; ++i) {
+		TEST_ASSERT_TRUE(map.insert(i * 7, i));
+	}
+	TEST_ASSERT_TRUE(map.isFull());
+	TEST_ASSERT_FALSE(map.insert(1000, 0));
+
+	for (uint16_t i = 0; i < 16; ++i) {
+		TEST_ASSERT_EQUALS(*map.get(i * 7), i);
+	}
+	TEST_ASSERT_FALSE(map.contains(1000));
+
+	TEST_ASSERT_TRUE(map.remove(7));
+	TEST_ASSERT_FALSE(map.isFull());
+	TEST_ASSERT_TRUE(map.insert(1000, 0));
+	TEST_ASSERT_TRUE(map.contains(1000));
+	TEST_ASSERT_FALSE(map.contains(7));
+}
+
+void
+HashMapTest::testRemove()
+{
+	xpcc::BoundedHashMap<uint16_t, uint16_t, 32> map;
+
+	for (uint16_t i = 0; i < 24; ++i) {
+		map.insert(i, i + 100);
+	}
+	TEST_ASSERT_FALSE(map.remove(24));
+
+	for (uint16_t i = 0; i < 24; i += 2) {
+		TEST_ASSERT_TRUE(map.remove(i));
+	}
+	TEST_ASSERT_EQUALS(map.getSize(), 12U);
+
+	for (uint16_t i = 0; i < 24; ++i)
+	{
+		if (i % 2) {
+			TEST_ASSERT_EQUALS(*map.get(i), i + 100);
+		}
+		else {
+			TEST_ASSERT_FALSE(map.contains(i));
+		}
+	}
+}
+
+void
+HashMapTest::testCollisions()
+{
+	xpcc::BoundedHashMap<uint16_t, uint16_t, 8, CollidingHash> map;
+
+	for (uint16_t i = 0; i < 8; ++i) {
+		TEST_ASSERT_TRUE(map.insert(i, i));
+	}
+	for (uint16_t i = 0; i < 8; ++i) {
+		TEST_ASSERT_EQUALS(*map.get(i), i);
+	}
+
+	// removing from the middle of the chain shifts the following entries
+	TEST_ASSERT_TRUE(map.remove(3));
+	TEST_ASSERT_TRUE(map.remove(0));
+	TEST_ASSERT_FALSE(map.contains(3));
+	TEST_ASSERT_FALSE(map.contains(0));
+	for (uint16_t i = 1; i < 8; ++i)
+	{
+		if (i != 3) {
+			TEST_ASSERT_EQUALS(*map.get(i), i);
+		}
+	}
+
+	TEST_ASSERT_TRUE(map.insert(3, 30));
+	TEST_ASSERT_EQUALS(*map.get(3), 30U);
+	TEST_ASSERT_EQUALS(map.getSize(), 7U);
+}
+
+void
+HashMapTest::testIterator()
+{
+	xpcc::BoundedHashMap<uint16_t, uint16_t, 16> map;
+	TEST_ASSERT_TRUE(map.begin() == map.end());
+
+	uint16_t keys = 0;
+	for (uint16_t i = 1; i <= 10; ++i) {
+		map.insert(i, 2 * i);
+		keys += i;
+	}
+
+	std::size_t count = 0;
+	uint16_t sum = 0;
+	for (auto it = map.begin(); it != map.end(); ++it)
+	{
+		TEST_ASSERT_EQUALS(it->second, 2 * it->first);
+		sum += it->first;
+		count++;
+	}
+	TEST_ASSERT_EQUALS(count, 10U);
+	TEST_ASSERT_EQUALS(sum, keys);
+
+	const xpcc::BoundedHashMap<uint16_t, uint16_t, 16>& constMap = map;
+	count = 0;
+	for (const auto& entry : constMap) {
+		(void) entry;
+		count++;
+	}
+	TEST_ASSERT_EQUALS(count, 10U);
+}
+
+void
+HashMapTest::testGrowth()
+{
+	xpcc::HashMap<uint32_t, uint32_t> map;
+
+	TEST_ASSERT_EQUALS(map.getCapacity(), 0U);
+	TEST_ASSERT_TRUE(map.get(1) == nullptr);
+	TEST_ASSERT_FALSE(map.remove(1));
+
+	for (uint32_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_TRUE(map.insert(i * 1000, i));
+	}
+	TEST_ASSERT_EQUALS(map.getCapacity(), 8U);
+
+	for (uint32_t i = 7; i < 1000; ++i) {
+		TEST_ASSERT_TRUE(map.insert(i * 1000, i));
+	}
+	TEST_ASSERT_EQUALS(map.getSize(), 1000U);
+	TEST_ASSERT_EQUALS(map.getCapacity(), 2048U);
+
+	for (uint32_t i = 0; i < 1000; ++i) {
+		TEST_ASSERT_EQUALS(*map.get(i * 1000), i);
+	}
+	TEST_ASSERT_FALSE(map.contains(1));
+
+	map.clear();
+	TEST_ASSERT_TRUE(map.isEmpty());
+	TEST_ASSERT_EQUALS(map.getCapacity(), 0U);
+	TEST_ASSERT_TRUE(map.insert(5, 5));
+}
+
+void
+HashMapTest::testReserve()
+{
+	xpcc::HashMap<uint16_t, uint16_t> map(20);
+	TEST_ASSERT_EQUALS(map.getCapacity(), 32U);
+
+	TEST_ASSERT_TRUE(map.reserve(10));
+	TEST_ASSERT_EQUALS(map.getCapacity(), 32U);
+
+	for (uint16_t i = 0; i < 28; ++i) {
+		map.insert(i, i);
+	}
+	TEST_ASSERT_EQUALS(map.getCapacity(), 32U);
+
+	TEST_ASSERT_TRUE(map.reserve(100));
+	TEST_ASSERT_EQUALS(map.getCapacity(), 128U);
+	for (uint16_t i = 0; i < 28; ++i) {
+		TEST_ASSERT_EQUALS(*map.get(i), i);
+	}
+}
+
+void
+HashMapTest::testOutOfMemory()
+{
+	// enough for 8 buckets, but not for 8 and 16 during growing
+	xpcc::HashMap<uint16_t, uint16_t, xpcc::Hash<uint16_t>,
+			xpcc::EqualTo<uint16_t>, xpcc::allocator::Static<uint16_t, 20> > map;
+
+	for (uint16_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_TRUE(map.insert(i, i));
+	}
+	TEST_ASSERT_FALSE(map.insert(7, 7));
+	TEST_ASSERT_EQUALS(map.getSize(), 7U);
+	TEST_ASSERT_EQUALS(map.getAllocator().getFailed(), 1U);
+
+	for (uint16_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_EQUALS(*map.get(i), i);
+	}
+}
+
+void
+HashMapTest::testStringKeys()
+{
+	xpcc::HashMap<const char*, uint8_t> map;
+
+	TEST_ASSERT_TRUE(map.insert("speed", 1));
+	TEST_ASSERT_TRUE(map.insert("position", 2));
+
+	// compared by content, not by the pointer
+	char buffer[] = "speed";
+	TEST_ASSERT_EQUALS(*map.get(static_cast<const char*>(buffer)), 1);
+	TEST_ASSERT_FALSE(map.insert(static_cast<const char*>(buffer), 3));
+	TEST_ASSERT_FALSE(map.contains("angle"));
+}
+
+void
+HashMapTest::testHeterogeneousLookup()
+{
+	xpcc::BoundedHashMap<Name, uint8_t, 8, NameHash, NameEqual> map;
+
+	Name speed = { "speed" };
+	Name angle = { "angle" };
+	map.insert(speed, 1);
+	map.insert(angle, 2);
+
+	// no temporary Name needed
+	TEST_ASSERT_EQUALS(*map.get("speed"), 1);
+	TEST_ASSERT_EQUALS(*map.get("angle"), 2);
+	TEST_ASSERT_FALSE(map.contains("position"));
+
+	TEST_ASSERT_TRUE(map.remove("speed"));
+	TEST_ASSERT_FALSE(map.contains(speed));
+}
+
+void
+HashMapTest::testConstructorDestructorCalls()
+{
+	{
+		// no entries are swapped if all keys have the same home bucket
+		xpcc::BoundedHashMap<uint16_t, unittest::CountType, 8, CollidingHash> map;
+		unittest::CountType data;
+
+		for (uint16_t i = 0; i < 7; ++i) {
+			map.insert(i, data);
+		}
+		TEST_ASSERT_EQUALS(map.getSize(), 7U);
+
+		// a copy for the temporary entry and one for the bucket
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 14U);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 7U);
+
+		unittest::CountType::reset();
+		TEST_ASSERT_TRUE(map.remove(3));
+		TEST_ASSERT_FALSE(map.remove(3));
+
+		// the following three entries are shifted back by one bucket
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 3U);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 4U);
+
+		unittest::CountType::reset();
+	}
+	// 6 entries in the map and the local variable
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 7U);
+}
+
+void
+HashMapTest::testSet()
+{
+	xpcc::BoundedHashSet<uint8_t, 8> bounded;
+	TEST_ASSERT_TRUE(bounded.insert(3));
+	TEST_ASSERT_FALSE(bounded.insert(3));
+	TEST_ASSERT_TRUE(bounded.contains(3));
+	TEST_ASSERT_FALSE(bounded.contains(4));
+	TEST_ASSERT_TRUE(bounded.remove(3));
+	TEST_ASSERT_TRUE(bounded.isEmpty());
+
+	// only the keys are stored
+	xpcc::HashSet<uint16_t, CollidingHash> set;
+	uint16_t keys = 0;
+	for (uint16_t i = 1; i <= 20; ++i)
+	{
+		TEST_ASSERT_TRUE(set.insert(i));
+		keys += i;
+	}
+	TEST_ASSERT_FALSE(set.insert(7));
+	TEST_ASSERT_EQUALS(set.getSize(), 20U);
+	TEST_ASSERT_TRUE(set.remove(7));
+	TEST_ASSERT_FALSE(set.contains(7));
+	TEST_ASSERT_TRUE(set.contains(20));
+
+	uint16_t sum = 0;
+	for (uint16_t key : set) {
+		sum += key;
+	}
+	TEST_ASSERT_EQUALS(sum, keys - 7);
+
+	set.clear();
+	TEST_ASSERT_EQUALS(set.getCapacity(), 0U);
+}
@@ -0,0 +1,53 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class HashMapTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testBoundedInsertAndGet();
+
+	void
+	testBoundedFull();
+
+	void
+	testRemove();
+
+	void
+	testCollisions();
+
+	void
+	testIterator();
+
+	void
+	testGrowth();
+
+	void
+	testReserve();
+
+	void
+	testOutOfMemory();
+
+	void
+	testStringKeys();
+
+	void
+	testHeterogeneousLookup();
+
+	void
+	testConstructorDestructorCalls();
+
+	void
+	testSet();
+};
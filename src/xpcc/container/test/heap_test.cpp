@@ -0,0 +1,321 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/type/count_type.hpp>
+#include <xpcc/container/heap.hpp>
+#include <xpcc/utils/allocator/static.hpp>
+
+#include "heap_test.hpp"
+
+namespace
+{
+	struct Greater
+	{
+		bool
+		operator () (int16_t a, int16_t b) const
+		{
+			return (a > b);
+		}
+	};
+
+	struct CountTypeLess
+	{
+		bool
+		operator () (const unittest::CountType&, const unittest::CountType&) const
+		{
+			return false;
+		}
+	};
+}
+
+void
+HeapTest::setUp()
+{
+	unittest::CountType::reset();
+}
+
+void
+HeapTest::testOrder()
+{
+	xpcc::BoundedHeap<int16_t, 16> heap;
+
+	TEST_ASSERT_TRUE(heap.isEmpty());
+	TEST_ASSERT_EQUALS(heap.getCapacity(), 16U);
+
+	const int16_t values[] = { 5, -3, 12, 7, 0, 7, 100, -50, 3, 1 };
+	for (int16_t value : values) {
+		heap.push(value);
+	}
+	TEST_ASSERT_EQUALS(heap.getSize(), 10U);
+
+	const int16_t expected[] = { -50, -3, 0, 1, 3, 5, 7, 7, 12, 100 };
+	for (int16_t value : expected) {
+		TEST_ASSERT_EQUALS(heap.getTop(), value);
+		heap.pop();
+	}
+	TEST_ASSERT_TRUE(heap.isEmpty());
+}
+
+void
+HeapTest::testCompare()
+{
+	xpcc::BoundedHeap<int16_t, 8, Greater> heap;
+
+	heap.push(3);
+	heap.push(10);
+	heap.push(-1);
+
+	TEST_ASSERT_EQUALS(heap.getTop(), 10);
+	heap.pop();
+	TEST_ASSERT_EQUALS(heap.getTop(), 3);
+	heap.pop();
+	TEST_ASSERT_EQUALS(heap.getTop(), -1);
+}
+
+void
+HeapTest::testFull()
+{
+	xpcc::BoundedHeap<int16_t, 3> heap;
+	typedef xpcc::BoundedHeap<int16_t, 3>::Handle Handle;
+
+	TEST_ASSERT_TRUE(heap.push(1) != heap.invalidHandle);
+	TEST_ASSERT_TRUE(heap.push(2) != heap.invalidHandle);
+	TEST_ASSERT_TRUE(heap.push(3) != heap.invalidHandle);
+	TEST_ASSERT_TRUE(heap.isFull());
+
+	const Handle handle = heap.push(0);
+	TEST_ASSERT_TRUE(handle == heap.invalidHandle);
+	TEST_ASSERT_FALSE(heap.contains(handle));
+	TEST_ASSERT_EQUALS(heap.getTop(), 1);
+
+	heap.pop();
+	TEST_ASSERT_FALSE(heap.isFull());
+	TEST_ASSERT_TRUE(heap.push(0) != heap.invalidHandle);
+	TEST_ASSERT_EQUALS(heap.getTop(), 0);
+}
+
+void
+HeapTest::testUpdate()
+{
+	xpcc::BoundedHeap<int16_t, 16> heap;
+	typedef xpcc::BoundedHeap<int16_t, 16>::Handle Handle;
+
+	Handle handles[10];
+	for (int16_t i = 0; i < 10; ++i) {
+		handles[i] = heap.push(10 * i);
+	}
+
+	// decrease-key
+	heap.update(handles[7], -5);
+	TEST_ASSERT_EQUALS(heap.getTop(), -5);
+	TEST_ASSERT_EQUALS(heap.getTopHandle(), handles[7]);
+	TEST_ASSERT_EQUALS(heap.get(handles[7]), -5);
+
+	// increase-key
+	heap.update(handles[7], 55);
+	heap.update(handles[0], 1000);
+	TEST_ASSERT_EQUALS(heap.getTop(), 10);
+	TEST_ASSERT_EQUALS(heap.get(handles[0]), 1000);
+
+	const int16_t expected[] = { 10, 20, 30, 40, 50, 55, 60, 80, 90, 1000 };
+	for (int16_t value : expected) {
+		TEST_ASSERT_EQUALS(heap.getTop(), value);
+		heap.pop();
+	}
+}
+
+void
+HeapTest::testRemove()
+{
+	xpcc::BoundedHeap<int16_t, 16> heap;
+	typedef xpcc::BoundedHeap<int16_t, 16>::Handle Handle;
+
+	Handle handles[10];
+	for (int16_t i = 0; i < 10; ++i) {
+		handles[i] = heap.push(9 - i);
+	}
+
+	// top, last position and somewhere in between
+	heap.remove(handles[9]);
+	heap.remove(heap.getTopHandle());
+	heap.remove(handles[2]);
+	heap.remove(handles[4]);
+
+	TEST_ASSERT_EQUALS(heap.getSize(), 6U);
+	TEST_ASSERT_FALSE(heap.contains(handles[9]));
+	TEST_ASSERT_FALSE(heap.contains(handles[2]));
+	TEST_ASSERT_TRUE(heap.contains(handles[0]));
+	TEST_ASSERT_EQUALS(heap.get(handles[0]), 9);
+
+	const int16_t expected[] = { 2, 3, 4, 6, 8, 9 };
+	for (int16_t value : expected) {
+		TEST_ASSERT_EQUALS(heap.getTop(), value);
+		heap.pop();
+	}
+	TEST_ASSERT_TRUE(heap.isEmpty());
+}
+
+void
+HeapTest::testHandleReuse()
+{
+	xpcc::BoundedHeap<int16_t, 4> heap;
+	typedef xpcc::BoundedHeap<int16_t, 4>::Handle Handle;
+
+	const Handle a = heap.push(1);
+	const Handle b = heap.push(2);
+	heap.remove(a);
+
+	// the slot of the removed element is used again
+	const Handle c = heap.push(3);
+	TEST_ASSERT_EQUALS(c, a);
+	TEST_ASSERT_EQUALS(heap.get(b), 2);
+	TEST_ASSERT_EQUALS(heap.get(c), 3);
+
+	heap.removeAll();
+	TEST_ASSERT_TRUE(heap.isEmpty());
+	TEST_ASSERT_FALSE(heap.contains(b));
+	for (int16_t i = 0; i < 4; ++i) {
+		TEST_ASSERT_TRUE(heap.push(i) != heap.invalidHandle);
+	}
+}
+
+void
+HeapTest::testGrowth()
+{
+	xpcc::Heap<int32_t> heap;
+	typedef xpcc::Heap<int32_t>::Handle Handle;
+
+	TEST_ASSERT_EQUALS(heap.getCapacity(), 0U);
+	TEST_ASSERT_FALSE(heap.contains(0));
+
+	Handle handles[100];
+	for (int32_t i = 0; i < 100; ++i) {
+		handles[i] = heap.push((i * 37) % 100);
+	}
+	TEST_ASSERT_EQUALS(heap.getSize(), 100U);
+	TEST_ASSERT_EQUALS(heap.getCapacity(), 128U);
+
+	// handles survive growing
+	for (int32_t i = 0; i < 100; ++i) {
+		TEST_ASSERT_EQUALS(heap.get(handles[i]), (i * 37) % 100);
+	}
+
+	for (int32_t i = 0; i < 100; ++i) {
+		TEST_ASSERT_EQUALS(heap.getTop(), i);
+		heap.pop();
+	}
+
+	heap.clear();
+	TEST_ASSERT_EQUALS(heap.getCapacity(), 0U);
+
+	xpcc::Heap<int32_t> reserved(20);
+	TEST_ASSERT_EQUALS(reserved.getCapacity(), 20U);
+}
+
+void
+HeapTest::testOutOfMemory()
+{
+	// enough for 8 slots, but not for 8 and 16 during growing
+	xpcc::Heap<int16_t, xpcc::Less<int16_t>, xpcc::allocator::Static<int16_t, 20> > heap;
+
+	for (int16_t i = 0; i < 8; ++i) {
+		TEST_ASSERT_TRUE(heap.push(i) != heap.invalidHandle);
+	}
+	TEST_ASSERT_TRUE(heap.push(8) == heap.invalidHandle);
+	TEST_ASSERT_EQUALS(heap.getSize(), 8U);
+	TEST_ASSERT_EQUALS(heap.getAllocator().getFailed(), 1U);
+	TEST_ASSERT_EQUALS(heap.getTop(), 0);
+}
+
+void
+HeapTest::testRandom()
+{
+	xpcc::BoundedHeap<uint16_t, 64> heap;
+	typedef xpcc::BoundedHeap<uint16_t, 64>::Handle Handle;
+
+	// reference: value for every handle, 0xffff for unused handles
+	uint16_t values[64];
+	for (uint8_t i = 0; i < 64; ++i) {
+		values[i] = 0xffff;
+	}
+
+	uint32_t random = 12345;
+	for (uint16_t step = 0; step < 2000; ++step)
+	{
+		random = random * 1103515245 + 12345;
+		const uint16_t value = (random >> 16) % 1000;
+		const Handle handle = (random >> 8) % 64;
+
+		switch (random % 4)
+		{
+			case 0:
+			case 1:
+				if (!heap.isFull()) {
+					Handle h = heap.push(value);
+					TEST_ASSERT_EQUALS(values[h], 0xffff);
+					values[h] = value;
+				}
+				break;
+			case 2:
+				if (heap.contains(handle)) {
+					heap.update(handle, value);
+					values[handle] = value;
+				}
+				break;
+			case 3:
+				if (heap.contains(handle)) {
+					heap.remove(handle);
+					values[handle] = 0xffff;
+				}
+				break;
+		}
+
+		uint16_t minimum = 0xffff;
+		uint8_t count = 0;
+		for (uint8_t i = 0; i < 64; ++i)
+		{
+			TEST_ASSERT_EQUALS(heap.contains(i), values[i] != 0xffff);
+			if (values[i] != 0xffff) {
+				count++;
+				if (values[i] < minimum) {
+					minimum = values[i];
+				}
+			}
+		}
+		TEST_ASSERT_EQUALS(heap.getSize(), count);
+		if (count > 0) {
+			TEST_ASSERT_EQUALS(heap.getTop(), minimum);
+		}
+	}
+}
+
+void
+HeapTest::testConstructorDestructorCalls()
+{
+	{
+		xpcc::Heap<unittest::CountType, CountTypeLess> heap;
+		unittest::CountType data;
+
+		for (uint8_t i = 0; i < 9; ++i) {
+			heap.push(data);
+		}
+		// growing from 8 to 16 slots moves (copies) the first eight elements
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 17U);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 8U);
+
+		unittest::CountType::reset();
+		heap.pop();
+		heap.remove(heap.getTopHandle());
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 2U);
+
+		unittest::CountType::reset();
+	}
+	// 7 elements in the heap and the local variable
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 8U);
+}
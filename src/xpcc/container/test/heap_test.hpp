@@ -0,0 +1,48 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class HeapTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testOrder();
+
+	void
+	testCompare();
+
+	void
+	testFull();
+
+	void
+	testUpdate();
+
+	void
+	testRemove();
+
+	void
+	testHandleReuse();
+
+	void
+	testGrowth();
+
+	void
+	testOutOfMemory();
+
+	// Random operations compared with a simple search for the minimum
+	void
+	testRandom();
+
+	void
+	testConstructorDestructorCalls();
+};
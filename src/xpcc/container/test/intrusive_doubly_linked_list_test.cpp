@@ -0,0 +1,244 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
+
+#include "intrusive_doubly_linked_list_test.hpp"
+
+namespace
+{
+	struct Item : public xpcc::IntrusiveDoublyLinkedListHook<>
+	{
+		Item(int16_t value = 0) :
+			value(value)
+		{
+		}
+
+		int16_t value;
+	};
+
+	typedef xpcc::IntrusiveDoublyLinkedList<Item> List;
+
+	static int16_t
+	sum(const List& list)
+	{
+		int16_t s = 0;
+		for (const Item& item : list) {
+			s = s * 10 + item.value;
+		}
+		return s;
+	}
+}
+
+void
+IntrusiveDoublyLinkedListTest::testConstructor()
+{
+	List list;
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+	TEST_ASSERT_TRUE(list.begin() == list.end());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testAppendPrepend()
+{
+	Item a(1), b(2), c(3);
+	List list;
+
+	list.append(b);
+	list.append(c);
+	list.prepend(a);
+
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &c);
+	TEST_ASSERT_EQUALS(sum(list), 123);
+	TEST_ASSERT_TRUE(b.isLinked());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRemoveFrontBack()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	list.append(a);
+	list.append(b);
+	list.append(c);
+
+	list.removeFront();
+	TEST_ASSERT_FALSE(a.isLinked());
+	TEST_ASSERT_EQUALS(sum(list), 23);
+
+	list.removeBack();
+	TEST_ASSERT_FALSE(c.isLinked());
+	TEST_ASSERT_EQUALS(sum(list), 2);
+
+	list.removeAll();
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_FALSE(b.isLinked());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testRemoveWhileIterating()
+{
+	Item items[6] = { 0, 1, 2, 3, 4, 5 };
+	List list;
+	for (Item& item : items) {
+		list.append(item);
+	}
+
+	for (List::iterator it = list.begin(); it != list.end(); )
+	{
+		if (it->value % 2) {
+			it = list.remove(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(sum(list), 24);
+	TEST_ASSERT_EQUALS(list.getBack().value, 4);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testUnlink()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	list.append(a);
+	list.append(b);
+	list.append(c);
+
+	// iterators to other elements stay valid
+	List::iterator it = list.begin();
+	b.unlink();
+	TEST_ASSERT_FALSE(b.isLinked());
+	++it;
+	TEST_ASSERT_EQUALS(it->value, 3);
+
+	// unlinking twice does nothing
+	b.unlink();
+	list.remove(c);
+	TEST_ASSERT_EQUALS(sum(list), 1);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testDestructorUnlinks()
+{
+	List list;
+	Item a(1);
+	list.append(a);
+	{
+		Item b(2);
+		list.append(b);
+		TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	}
+	TEST_ASSERT_EQUALS(list.getSize(), 1U);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+
+	{
+		List other;
+		other.append(a);
+	}
+	TEST_ASSERT_FALSE(a.isLinked());
+
+	// copies are not linked
+	list.append(a);
+	Item copy(a);
+	TEST_ASSERT_FALSE(copy.isLinked());
+	TEST_ASSERT_EQUALS(list.getSize(), 1U);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testMoveBetweenLists()
+{
+	Item a(1), b(2), c(3);
+	List pending;
+	List finished;
+	pending.append(a);
+	pending.append(b);
+	pending.append(c);
+
+	finished.append(b);
+	TEST_ASSERT_EQUALS(sum(pending), 13);
+	TEST_ASSERT_EQUALS(sum(finished), 2);
+
+	// moving inside of the same list
+	pending.append(a);
+	TEST_ASSERT_EQUALS(sum(pending), 31);
+	pending.append(a);
+	TEST_ASSERT_EQUALS(sum(pending), 31);
+	pending.prepend(c);
+	TEST_ASSERT_EQUALS(sum(pending), 31);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testSplice()
+{
+	Item a(1), b(2), c(3), d(4);
+	List list;
+	List other;
+
+	list.splice(other);
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	other.append(a);
+	other.append(b);
+	list.splice(other);
+	TEST_ASSERT_TRUE(other.isEmpty());
+	TEST_ASSERT_EQUALS(sum(list), 12);
+
+	other.append(c);
+	other.append(d);
+	list.splice(other);
+	TEST_ASSERT_EQUALS(sum(list), 1234);
+	TEST_ASSERT_EQUALS(sum(other), 0);
+
+	// the elements can be used with the other list again
+	other.append(b);
+	other.splice(list);
+	TEST_ASSERT_EQUALS(sum(other), 2134);
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveDoublyLinkedListTest::testInsert()
+{
+	Item a(1), b(2), c(3);
+	List list;
+
+	List::iterator it = list.insert(list.end(), c);
+	TEST_ASSERT_EQUALS(it->value, 3);
+
+	list.insert(it, a);
+	list.insert(it, b);
+	TEST_ASSERT_EQUALS(sum(list), 123);
+}
+
+void
+IntrusiveDoublyLinkedListTest::testBackwardIteration()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	list.append(a);
+	list.append(b);
+	list.append(c);
+
+	int16_t s = 0;
+	List::iterator it = list.end();
+	while (it != list.begin())
+	{
+		--it;
+		s = s * 10 + it->value;
+	}
+	TEST_ASSERT_EQUALS(s, 321);
+}
@@ -0,0 +1,189 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/container/intrusive_linked_list.hpp>
+
+#include "intrusive_linked_list_test.hpp"
+
+namespace
+{
+	struct Other;
+
+	struct Item : public xpcc::IntrusiveLinkedListHook<>,
+				  public xpcc::IntrusiveLinkedListHook<Other>
+	{
+		Item(int16_t value = 0) :
+			value(value)
+		{
+		}
+
+		int16_t value;
+	};
+
+	typedef xpcc::IntrusiveLinkedList<Item> List;
+}
+
+void
+IntrusiveLinkedListTest::testConstructor()
+{
+	List list;
+
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+	TEST_ASSERT_TRUE(list.begin() == list.end());
+}
+
+void
+IntrusiveLinkedListTest::testAppendPrepend()
+{
+	Item a(1), b(2), c(3);
+	List list;
+
+	list.append(b);
+	TEST_ASSERT_FALSE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getFront().value, 2);
+	TEST_ASSERT_EQUALS(list.getBack().value, 2);
+
+	list.append(c);
+	list.prepend(a);
+
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &c);
+
+	// the elements are not copied
+	b.value = 5;
+
+	List::iterator it = list.begin();
+	TEST_ASSERT_EQUALS(it->value, 1);
+	++it;
+	TEST_ASSERT_EQUALS(it->value, 5);
+	++it;
+	TEST_ASSERT_EQUALS((*it).value, 3);
+	++it;
+	TEST_ASSERT_TRUE(it == list.end());
+}
+
+void
+IntrusiveLinkedListTest::testRemoveFront()
+{
+	Item a(1), b(2);
+	List list;
+
+	list.append(a);
+	list.append(b);
+
+	list.removeFront();
+	TEST_ASSERT_EQUALS(&list.getFront(), &b);
+	TEST_ASSERT_EQUALS(&list.getBack(), &b);
+
+	list.removeFront();
+	TEST_ASSERT_TRUE(list.isEmpty());
+
+	// the list is usable again
+	list.append(a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+
+	list.removeAll();
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveLinkedListTest::testRemoveWhileIterating()
+{
+	Item items[6] = { 0, 1, 2, 3, 4, 5 };
+	List list;
+	for (Item& item : items) {
+		list.append(item);
+	}
+
+	// remove all odd elements, including the last one
+	for (List::iterator it = list.begin(); it != list.end(); )
+	{
+		if (it->value % 2) {
+			it = list.remove(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(list.getBack().value, 4);
+
+	// the back pointer needs to be correct
+	list.append(items[1]);
+	TEST_ASSERT_EQUALS(list.getBack().value, 1);
+
+	// remove the first element
+	List::iterator it = list.remove(list.begin());
+	TEST_ASSERT_EQUALS(it->value, 2);
+	TEST_ASSERT_EQUALS(list.getFront().value, 2);
+
+	int16_t expected[] = { 2, 4, 1 };
+	uint8_t i = 0;
+	for (Item& item : list) {
+		TEST_ASSERT_EQUALS(item.value, expected[i++]);
+	}
+	TEST_ASSERT_EQUALS(i, 3U);
+}
+
+void
+IntrusiveLinkedListTest::testRemoveValue()
+{
+	Item a(1), b(2), c(3), d(4);
+	List list;
+
+	list.append(a);
+	list.append(b);
+	list.append(c);
+
+	TEST_ASSERT_TRUE(list.remove(c));
+	TEST_ASSERT_EQUALS(&list.getBack(), &b);
+	TEST_ASSERT_FALSE(list.remove(d));
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+}
+
+void
+IntrusiveLinkedListTest::testTwoHooks()
+{
+	Item a(1), b(2);
+	List list;
+	xpcc::IntrusiveLinkedList<Item, Other> other;
+
+	list.append(a);
+	list.append(b);
+	other.append(b);
+	other.append(a);
+
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&other.getFront(), &b);
+
+	list.removeFront();
+	TEST_ASSERT_EQUALS(other.getSize(), 2U);
+}
+
+void
+IntrusiveLinkedListTest::testConstIterator()
+{
+	Item a(1), b(2);
+	List list;
+	list.append(a);
+	list.append(b);
+
+	const List& constList = list;
+	int16_t sum = 0;
+	for (List::const_iterator it = constList.begin(); it != constList.end(); ++it) {
+		sum += it->value;
+	}
+	TEST_ASSERT_EQUALS(sum, 3);
+
+	List::const_iterator it = list.begin();
+	TEST_ASSERT_EQUALS((*it).value, 1);
+}
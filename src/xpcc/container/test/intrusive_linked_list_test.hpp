@@ -0,0 +1,35 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class IntrusiveLinkedListTest : public unittest::TestSuite
+{
+public:
+	void
+	testConstructor();
+
+	void
+	testAppendPrepend();
+
+	void
+	testRemoveFront();
+
+	void
+	testRemoveWhileIterating();
+
+	void
+	testRemoveValue();
+
+	void
+	testTwoHooks();
+
+	void
+	testConstIterator();
+};
@@ -0,0 +1,331 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/type/count_type.hpp>
+#include <xpcc/container/small_array.hpp>
+#include <xpcc/utils/allocator/static.hpp>
+
+#include "small_array_test.hpp"
+
+typedef xpcc::SmallArray<int16_t, 4> Container;
+
+void
+SmallArrayTest::setUp()
+{
+	unittest::CountType::reset();
+}
+
+void
+SmallArrayTest::testDefaultConstructor()
+{
+	Container array;
+
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getSize(), 0U);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+	TEST_ASSERT_EQUALS(array.getGrowth(), Container::defaultGrowth);
+	TEST_ASSERT_TRUE(array.begin() == array.end());
+}
+
+void
+SmallArrayTest::testAllocationConstructor()
+{
+	Container array1(3);
+
+	TEST_ASSERT_TRUE(array1.isEmpty());
+	TEST_ASSERT_TRUE(array1.isInline());
+	TEST_ASSERT_EQUALS(array1.getCapacity(), 4U);
+
+	Container array2(10);
+
+	TEST_ASSERT_TRUE(array2.isEmpty());
+	TEST_ASSERT_FALSE(array2.isInline());
+	TEST_ASSERT_EQUALS(array2.getCapacity(), 10U);
+}
+
+void
+SmallArrayTest::testSequenceConstructor()
+{
+	Container array(10, 123);
+
+	TEST_ASSERT_EQUALS(array.getSize(), 10U);
+	TEST_ASSERT_FALSE(array.isInline());
+
+	for (std::size_t i = 0; i < array.getSize(); ++i) {
+		TEST_ASSERT_EQUALS(array[i], 123);
+	}
+}
+
+void
+SmallArrayTest::testInitializerListConstructor()
+{
+	Container array{1, 2, 3};
+
+	TEST_ASSERT_EQUALS(array.getSize(), 3U);
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array[0], 1);
+	TEST_ASSERT_EQUALS(array[1], 2);
+	TEST_ASSERT_EQUALS(array[2], 3);
+	TEST_ASSERT_EQUALS(array.getFront(), 1);
+	TEST_ASSERT_EQUALS(array.getBack(), 3);
+}
+
+void
+SmallArrayTest::testCopyConstructor()
+{
+	Container array1{1, 2, 3};
+	Container array2(array1);
+
+	TEST_ASSERT_EQUALS(array2.getSize(), 3U);
+	TEST_ASSERT_TRUE(array2.isInline());
+
+	array1[0] = 10;
+	TEST_ASSERT_EQUALS(array2[0], 1);
+
+	Container array3(10, 5);
+	Container array4(array3);
+
+	TEST_ASSERT_EQUALS(array4.getSize(), 10U);
+	TEST_ASSERT_FALSE(array4.isInline());
+	TEST_ASSERT_EQUALS(array4[9], 5);
+
+	array3[9] = 6;
+	TEST_ASSERT_EQUALS(array4[9], 5);
+}
+
+void
+SmallArrayTest::testMoveConstructor()
+{
+	// inline elements are moved one by one
+	Container array1{1, 2, 3};
+	Container array2(static_cast<Container&&>(array1));
+
+	TEST_ASSERT_TRUE(array1.isEmpty());
+	TEST_ASSERT_EQUALS(array2.getSize(), 3U);
+	TEST_ASSERT_TRUE(array2.isInline());
+	TEST_ASSERT_EQUALS(array2[2], 3);
+
+	// allocated memory is stolen
+	Container array3(10, 7);
+	const int16_t* values = array3.begin();
+	Container array4(static_cast<Container&&>(array3));
+
+	TEST_ASSERT_TRUE(array3.isEmpty());
+	TEST_ASSERT_TRUE(array3.isInline());
+	TEST_ASSERT_EQUALS(array3.getCapacity(), 4U);
+	TEST_ASSERT_TRUE(array4.begin() == values);
+	TEST_ASSERT_EQUALS(array4.getSize(), 10U);
+
+	// the moved from array is still usable
+	TEST_ASSERT_TRUE(array3.append(1));
+	TEST_ASSERT_EQUALS(array3[0], 1);
+}
+
+void
+SmallArrayTest::testAssignment()
+{
+	Container array1{1, 2, 3};
+	Container array2(10, 5);
+
+	array2 = array1;
+	TEST_ASSERT_EQUALS(array2.getSize(), 3U);
+	TEST_ASSERT_EQUALS(array2[0], 1);
+
+	array1 = array1;
+	TEST_ASSERT_EQUALS(array1.getSize(), 3U);
+
+	Container array3(8, 9);
+	array1 = array3;
+	TEST_ASSERT_EQUALS(array1.getSize(), 8U);
+	TEST_ASSERT_FALSE(array1.isInline());
+	TEST_ASSERT_EQUALS(array1[7], 9);
+
+	array2 = static_cast<Container&&>(array3);
+	TEST_ASSERT_EQUALS(array2.getSize(), 8U);
+	TEST_ASSERT_EQUALS(array2[7], 9);
+	TEST_ASSERT_TRUE(array3.isEmpty());
+}
+
+void
+SmallArrayTest::testAppendInline()
+{
+	Container array;
+
+	for (int16_t i = 0; i < 4; ++i) {
+		TEST_ASSERT_TRUE(array.append(i));
+	}
+
+	TEST_ASSERT_EQUALS(array.getSize(), 4U);
+	TEST_ASSERT_TRUE(array.isInline());
+
+	array.removeBack();
+	TEST_ASSERT_EQUALS(array.getSize(), 3U);
+	TEST_ASSERT_EQUALS(array.getBack(), 2);
+}
+
+void
+SmallArrayTest::testAppendGrowth()
+{
+	Container array;
+
+	for (int16_t i = 0; i < 5; ++i) {
+		array.append(i);
+	}
+
+	// 4 + 50%
+	TEST_ASSERT_FALSE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 6U);
+	for (int16_t i = 0; i < 5; ++i) {
+		TEST_ASSERT_EQUALS(array[i], i);
+	}
+
+	Container array2;
+	array2.setGrowth(100);
+	for (int16_t i = 0; i < 5; ++i) {
+		array2.append(i);
+	}
+	TEST_ASSERT_EQUALS(array2.getCapacity(), 8U);
+
+	// grows at least by one element
+	Container array3;
+	array3.setGrowth(0);
+	for (int16_t i = 0; i < 6; ++i) {
+		array3.append(i);
+	}
+	TEST_ASSERT_EQUALS(array3.getCapacity(), 6U);
+	TEST_ASSERT_EQUALS(array3[5], 5);
+}
+
+void
+SmallArrayTest::testAppendOwnElement()
+{
+	Container array{1, 2, 3, 4};
+
+	// the reference points into the buffer which is replaced
+	TEST_ASSERT_TRUE(array.append(array[0]));
+	TEST_ASSERT_EQUALS(array.getSize(), 5U);
+	TEST_ASSERT_EQUALS(array[4], 1);
+}
+
+void
+SmallArrayTest::testReserve()
+{
+	Container array{1, 2};
+
+	TEST_ASSERT_TRUE(array.reserve(2));
+	TEST_ASSERT_TRUE(array.isInline());
+
+	TEST_ASSERT_TRUE(array.reserve(10));
+	TEST_ASSERT_FALSE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 12U);
+	TEST_ASSERT_EQUALS(array[1], 2);
+}
+
+void
+SmallArrayTest::testShrinkToFit()
+{
+	Container array(10, 1);
+
+	array.removeBack();
+	array.shrinkToFit();
+	TEST_ASSERT_EQUALS(array.getCapacity(), 9U);
+	TEST_ASSERT_FALSE(array.isInline());
+
+	while (array.getSize() > 2) {
+		array.removeBack();
+	}
+	array.shrinkToFit();
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+	TEST_ASSERT_EQUALS(array.getSize(), 2U);
+	TEST_ASSERT_EQUALS(array[1], 1);
+}
+
+void
+SmallArrayTest::testClear()
+{
+	Container array(10, 1);
+
+	array.removeAll();
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 10U);
+
+	array.clear();
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+}
+
+void
+SmallArrayTest::testOutOfMemory()
+{
+	xpcc::SmallArray<int16_t, 2, xpcc::allocator::Static<int16_t, 3> > array;
+
+	TEST_ASSERT_TRUE(array.append(1));
+	TEST_ASSERT_TRUE(array.append(2));
+	TEST_ASSERT_TRUE(array.append(3));
+
+	TEST_ASSERT_FALSE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 3U);
+
+	// the pool is exhausted, the array is unchanged
+	TEST_ASSERT_FALSE(array.append(4));
+	TEST_ASSERT_EQUALS(array.getSize(), 3U);
+	TEST_ASSERT_EQUALS(array[2], 3);
+
+	// back to the inline storage, the pool is free again
+	array.removeBack();
+	array.shrinkToFit();
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getAllocator().getUsed(), 0U);
+}
+
+void
+SmallArrayTest::testNonTrivialType()
+{
+	{
+		xpcc::SmallArray<unittest::CountType, 2> array;
+		unittest::CountType data;
+
+		array.append(data);
+		array.append(data);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 2U);
+
+		// growth moves the two elements and copies the new one
+		array.append(data);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 5U);
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 2U);
+
+		array.removeBack();
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 3U);
+	}
+
+	// the two remaining elements and data
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls, 6U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfAssignments, 0U);
+}
+
+void
+SmallArrayTest::testIterator()
+{
+	Container array{1, 2, 3, 4, 5};
+
+	int16_t sum = 0;
+	for (int16_t value : array) {
+		sum += value;
+	}
+	TEST_ASSERT_EQUALS(sum, 15);
+
+	TEST_ASSERT_TRUE(array.find(3) == &array[2]);
+	TEST_ASSERT_TRUE(array.find(6) == array.end());
+
+	const Container& constArray = array;
+	TEST_ASSERT_TRUE(constArray.find(5) == constArray.end() - 1);
+}
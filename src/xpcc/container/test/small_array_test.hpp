@@ -0,0 +1,65 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class SmallArrayTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testDefaultConstructor();
+
+	void
+	testAllocationConstructor();
+
+	void
+	testSequenceConstructor();
+
+	void
+	testInitializerListConstructor();
+
+	void
+	testCopyConstructor();
+
+	void
+	testMoveConstructor();
+
+	void
+	testAssignment();
+
+	void
+	testAppendInline();
+
+	void
+	testAppendGrowth();
+
+	void
+	testAppendOwnElement();
+
+	void
+	testReserve();
+
+	void
+	testShrinkToFit();
+
+	void
+	testClear();
+
+	void
+	testOutOfMemory();
+
+	void
+	testNonTrivialType();
+
+	void
+	testIterator();
+};
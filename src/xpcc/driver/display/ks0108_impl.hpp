@@ -99,36 +99,54 @@ template < typename E, typename RW, typename RS,
 void
 xpcc::Ks0108<E, RW, RS, PIN_CS1, PIN_CS2, PORT>::update()
 {
-	this->selectLeftChip();
-	this->waitBusy();
-	this->writeCommand(KS0108_SET_Y_ADDRESS | 0);
-	
-	this->selectRightChip();
-	this->waitBusy();
-	this->writeCommand(KS0108_SET_Y_ADDRESS | 0);
-	
+	uint32_t bytes = 0;
+
 	for (uint8_t page = 0; page < 8; ++page)
 	{
-		this->selectLeftChip();
-		this->waitBusy();
-		this->writeCommand(KS0108_SET_X_PAGE | page);
-		
-		this->selectRightChip();
-		this->waitBusy();
-		this->writeCommand(KS0108_SET_X_PAGE | page);
-		
-		uint8_t i;
-		for (i = 0; i < 64; ++i)
+		// only transfer the changed columns of every page
+		if (!this->isDirty(page)) {
+			continue;
+		}
+		const uint8_t begin = this->getDirtyBegin(page);
+		const uint8_t end = this->getDirtyEnd(page);
+
+		// columns 0..63 belong to the left controller
+		if (begin < 64)
 		{
 			this->selectLeftChip();
 			this->waitBusy();
-			this->writeData(this->display_buffer[i][page]);
-			
+			this->writeCommand(KS0108_SET_X_PAGE | page);
+			this->waitBusy();
+			this->writeCommand(KS0108_SET_Y_ADDRESS | begin);
+
+			for (uint8_t i = begin; i < end && i < 64; ++i)
+			{
+				this->waitBusy();
+				this->writeData(this->display_buffer[i][page]);
+			}
+		}
+
+		// columns 64..127 to the right one
+		if (end > 64)
+		{
+			const uint8_t first = (begin > 64) ? begin : 64;
+
 			this->selectRightChip();
 			this->waitBusy();
-			this->writeData(this->display_buffer[i + 64][page]);
+			this->writeCommand(KS0108_SET_X_PAGE | page);
+			this->waitBusy();
+			this->writeCommand(KS0108_SET_Y_ADDRESS | (first - 64));
+
+			for (uint8_t i = first; i < end; ++i)
+			{
+				this->waitBusy();
+				this->writeData(this->display_buffer[i][page]);
+			}
 		}
+		bytes += end - begin;
 	}
+
+	this->markClean(bytes);
 }
 
 // ----------------------------------------------------------------------------
@@ -40,18 +40,28 @@ template< typename Spi, typename Ce, typename Dc, typename Reset >
 void
 Nokia5110< Spi, Ce, Dc, Reset >::update()
 {
-	// goto 0, 0
-	writeCommand(0x80); // Column
+	// The vertical addressing wraps into the next column after the last
+	// page, so the changed columns are transferred across all pages.
+	uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+	if (!this->getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd)) {
+		this->markClean(0);
+		return;
+	}
+
+	// goto columnBegin, 0
+	writeCommand(0x80 | columnBegin); // Column
 	writeCommand(0x40); // Row
 
 	Ce::reset();
 	Dc::set(); // high = data
-	for (uint8_t xx = 0; xx < this->getWidth(); ++xx) {
+	for (uint8_t xx = columnBegin; xx < columnEnd; ++xx) {
 		for (uint8_t yy = 0; yy < this->getHeight() / 8; ++yy) {
 			Spi::transferBlocking(this->display_buffer[xx][yy]);
 		}
 	}
 	Ce::set();
+
+	this->markClean((columnEnd - columnBegin) * (this->getHeight() / 8));
 }
 
 template< typename Spi, typename Ce, typename Dc, typename Reset >
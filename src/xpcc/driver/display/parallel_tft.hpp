@@ -103,6 +103,13 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 
+		// Sets the cursor once and streams the pixels
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
 		void
 		writeCursor(uint16_t x, uint16_t y);
 
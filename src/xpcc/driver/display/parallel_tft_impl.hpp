@@ -183,6 +183,42 @@ xpcc::ParallelTft<INTERFACE>::getPixel(int16_t x, int16_t y)
 	return false;
 }
 
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::fillSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	// The entry mode 0x6068 set by initialize() increments the GRAM
+	// y-address after every write. writeCursor() maps the x-axis of the
+	// display to this address, for 270 degree reversed.
+#if ( DISP_ORIENTATION == 270 )
+	writeCursor(x1, y);
+#elif ( DISP_ORIENTATION == 90 )
+	writeCursor(x0, y);
+#else
+	// the address moves along the y-axis of the display
+	for (int_fast16_t x = x0; x <= x1; ++x) {
+		this->setPixel(x, y);
+	}
+	return;
+#endif
+
+	interface.writeIndex(0x0022);
+	const uint16_t color = foregroundColor.getValue();
+	for (int_fast16_t x = x0; x <= x1; ++x) {
+		interface.writeData(color);
+	}
+}
+
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::clearSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	// like clearPixel()
+	(void) x0;
+	(void) x1;
+	(void) y;
+}
+
 // ----------------------------------------------------------------------------
 template <typename INTERFACE>
 void
@@ -123,8 +123,11 @@ public:
 		setCommandBuffer(uint8_t *buffer)
 		{ commands = buffer; }
 
+		/// Writes the columns and pages from begin to end (exclusive)
 		bool
-		configureDisplayWrite(uint8_t (*buffer)[Height / 8], std::size_t size);
+		configureDisplayWrite(uint8_t (*buffer)[Height / 8],
+				uint8_t columnBegin, uint8_t columnEnd,
+				uint8_t pageBegin, uint8_t pageEnd);
 
 	protected:
 		virtual Writing
@@ -135,6 +138,12 @@ public:
 
 	private:
 		uint8_t *commands;
+		uint8_t (*frame)[Height / 8];
+		uint8_t columnBegin;
+		uint8_t columnEnd;
+		uint8_t pageBegin;
+		uint8_t pageEnd;
+		uint8_t column;
 	public:
 		bool writeable;
 	};
@@ -146,6 +155,10 @@ public:
  * This display is only rated to be driven with 400kHz, which limits
  * the frame rate to about 40Hz.
  *
+ * Only the window of the frame buffer containing the changes since the
+ * last transfer is written to the display, see getUpdateBytes(). After a
+ * failed transfer the next one writes the whole frame buffer.
+ *
  * @author	Niklas Hauser
  * @ingroup	driver_display
  */
@@ -239,6 +252,11 @@ private:
 	xpcc::ResumableResult<void>
 	startWriteDisplay();
 
+	/// Starts the transfer of the changed window, `true` if started or
+	/// nothing has changed
+	bool
+	startDisplayTransaction();
+
 	bool
 	startTransactionWithLength(uint8_t length);
 
@@ -57,11 +57,38 @@ xpcc::Ssd1306<I2cMaster, Height>::startWriteDisplay()
 {
 	RF_BEGIN();
 
-	RF_WAIT_UNTIL( this->transaction.configureDisplayWrite(this->display_buffer, (this->DisplayBufferWidth * this->DisplayBufferHeight)) and this->startTransaction() );
+	RF_WAIT_UNTIL( startDisplayTransaction() );
 
 	RF_END();
 }
 
+template < class I2cMaster, uint8_t Height >
+bool
+xpcc::Ssd1306<I2cMaster, Height>::startDisplayTransaction()
+{
+	// The window was marked clean when the previous transfer started.
+	// If that (or a command) failed, the content of the display is unknown.
+	if (not this->wasTransactionSuccessful()) {
+		this->invalidate();
+	}
+
+	uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+	if (!this->getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd))
+	{
+		this->markClean(0);
+		return true;
+	}
+
+	if (this->transaction.configureDisplayWrite(this->display_buffer,
+			columnBegin, columnEnd, pageBegin, pageEnd) and this->startTransaction())
+	{
+		// changes from now on are transferred by the next update
+		this->markClean((columnEnd - columnBegin) * (pageEnd - pageBegin));
+		return true;
+	}
+	return false;
+}
+
 template < class I2cMaster, uint8_t Height >
 xpcc::ResumableResult<bool>
 xpcc::Ssd1306<I2cMaster, Height>::writeDisplay()
@@ -14,15 +14,25 @@
 // ----------------------------------------------------------------------------
 template < uint8_t Height >
 xpcc::ssd1306::DataTransmissionAdapter<Height>::DataTransmissionAdapter(uint8_t address) :
-	I2cWriteTransaction(address), writeable(true)
+	I2cWriteTransaction(address), frame(nullptr),
+	columnBegin(0), columnEnd(0), pageBegin(0), pageEnd(0), column(0),
+	writeable(true)
 {}
 
 template < uint8_t Height >
 bool
-xpcc::ssd1306::DataTransmissionAdapter<Height>::configureDisplayWrite(uint8_t (*buffer)[Height / 8], std::size_t size)
+xpcc::ssd1306::DataTransmissionAdapter<Height>::configureDisplayWrite(uint8_t (*buffer)[Height / 8],
+		uint8_t columnBegin, uint8_t columnEnd, uint8_t pageBegin, uint8_t pageEnd)
 {
-	if (I2cWriteTransaction::configureWrite(&buffer[0][0], size))
+	const std::size_t size = (columnEnd - columnBegin) * (pageEnd - pageBegin);
+	if (I2cWriteTransaction::configureWrite(&buffer[columnBegin][pageBegin], size))
 	{
+		this->frame = buffer;
+		this->columnBegin = columnBegin;
+		this->columnEnd = columnEnd;
+		this->pageBegin = pageBegin;
+		this->pageEnd = pageEnd;
+		this->column = columnBegin;
 		commands[13] = 0xfe;
 		writeable = false;
 		return true;
@@ -38,8 +48,8 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 	if (commands[13] == 0xfe)
 	{
 		commands[1] = Command::SetColumnAddress;
-		commands[3] = 0;
-		commands[5] = 127;
+		commands[3] = columnBegin;
+		commands[5] = columnEnd - 1;
 		commands[13] = 0xfd;
 		return Writing(commands, 6, OperationAfterWrite::Restart);
 	}
@@ -47,8 +57,8 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 	if (commands[13] == 0xfd)
 	{
 		commands[1] = Command::SetPageAddress;
-		commands[3] = (Height == 64 ? 0 : 4);
-		commands[5] = 7;
+		commands[3] = (Height == 64 ? 0 : 4) + pageBegin;
+		commands[5] = (Height == 64 ? 0 : 4) + pageEnd - 1;
 		commands[13] = 0xfc;
 		return Writing(commands, 6, OperationAfterWrite::Restart);
 	}
@@ -59,8 +69,17 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 		return Writing(&commands[13], 1, OperationAfterWrite::Write);
 	}
 
-	// now we write the entire frame buffer into it.
-	return Writing(buffer, size, OperationAfterWrite::Stop);
+	// now we write the window of the frame buffer into it, which is
+	// continuous in memory if it contains all pages.
+	if ((pageEnd - pageBegin) == (Height / 8)) {
+		return Writing(buffer, size, OperationAfterWrite::Stop);
+	}
+
+	// otherwise column by column
+	const uint8_t *data = &frame[column][pageBegin];
+	column++;
+	return Writing(data, pageEnd - pageBegin,
+			(column < columnEnd) ? OperationAfterWrite::Write : OperationAfterWrite::Stop);
 }
 
 template < uint8_t Height >
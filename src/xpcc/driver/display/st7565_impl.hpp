@@ -39,28 +39,35 @@ template <typename SPI, typename CS, typename A0, typename Reset, unsigned int W
 void
 xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::update()
 {
+	uint32_t bytes = 0;
+
 	cs.reset();
 	for(uint8_t y = 0; y < (Height / 8); ++y)
 	{
+		// only transfer the changed columns of every page
+		if (!this->isDirty(y)) {
+			continue;
+		}
+		const uint8_t begin = this->getDirtyBegin(y);
+		const uint8_t end = this->getDirtyEnd(y);
+		const uint8_t column = TopView ? (begin + 4) : begin;
+
 		// command mode
 		a0.reset();
 		spi.transferBlocking(ST7565_PAGE_ADDRESS | y);		// Row select
-		spi.transferBlocking(ST7565_COL_ADDRESS_MSB);		// Column select high
-
-		if (TopView) {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB | 4);	// Column select low
-		}
-		else {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB);	// Column select low
-		}
+		spi.transferBlocking(ST7565_COL_ADDRESS_MSB | (column >> 4));	// Column select high
+		spi.transferBlocking(ST7565_COL_ADDRESS_LSB | (column & 0x0f));	// Column select low
 
 		// switch to data mode
 		a0.set();
-		for(uint8_t x = 0; x < Width; ++x) {
+		for(uint8_t x = begin; x < end; ++x) {
 			spi.transferBlocking(this->display_buffer[x][y]);
 		}
+		bytes += end - begin;
 	}
 	cs.set();
+
+	this->markClean(bytes);
 }
 
 template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
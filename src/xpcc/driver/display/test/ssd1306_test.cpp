@@ -0,0 +1,423 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/driver/display/ssd1306.hpp>
+#include <xpcc/ui/display/font/fixed_width_5x8.hpp>
+#include <xpcc/ui/display/image/home_16x16.hpp>
+#include <string.h>
+
+#include "ssd1306_test.hpp"
+
+using xpcc::glcd::Point;
+
+namespace
+{
+	/// Display RAM of the SSD1306 in vertical addressing mode, as
+	/// configured by initialize()
+	class Controller
+	{
+	public:
+		void
+		reset(uint8_t content)
+		{
+			memset(ram, content, sizeof(ram));
+			columnStart = column = 0;
+			columnEnd = 127;
+			pageStart = page = 0;
+			pageEnd = 7;
+			transactions = 0;
+			dataBytes = 0;
+			unknownCommands = 0;
+			abortAfter = uint32_t(-1);
+			arguments = 0;
+			start();
+		}
+
+		/// Called after every (re-)start condition
+		void
+		start()
+		{
+			isControl = true;
+			isData = false;
+		}
+
+		void
+		receive(uint8_t byte)
+		{
+			if (isData) {
+				write(byte);
+			}
+			else if (isControl) {
+				// Co bit: only a single command byte follows
+				isContinuation = (byte & 0x80);
+				isData = (byte & 0x40);
+				isControl = false;
+			}
+			else {
+				execute(byte);
+				isControl = isContinuation;
+			}
+		}
+
+		uint8_t ram[128][8];
+
+		uint8_t columnStart;
+		uint8_t columnEnd;
+		uint8_t pageStart;
+		uint8_t pageEnd;
+
+		uint16_t transactions;
+		uint32_t dataBytes;
+		uint16_t unknownCommands;
+
+		/// The transfer aborts after this number of bytes of a transaction
+		uint32_t abortAfter;
+
+	private:
+		void
+		write(uint8_t byte)
+		{
+			ram[column][page] = byte;
+			dataBytes++;
+
+			// vertical addressing: pages first, then the next column
+			if (page++ == pageEnd)
+			{
+				page = pageStart;
+				column = (column == columnEnd) ? columnStart : (column + 1);
+			}
+		}
+
+		void
+		execute(uint8_t byte)
+		{
+			if (arguments == 0)
+			{
+				command = byte;
+				if (command == 0x21 or command == 0x22) {
+					arguments = 2;
+				} else {
+					unknownCommands++;
+				}
+				return;
+			}
+
+			arguments--;
+			if (command == 0x21)
+			{
+				if (arguments) {
+					columnStart = column = byte;
+				} else {
+					columnEnd = byte;
+				}
+			}
+			else
+			{
+				if (arguments) {
+					pageStart = page = byte;
+				} else {
+					pageEnd = byte;
+				}
+			}
+		}
+
+		// address pointer
+		uint8_t column;
+		uint8_t page;
+
+		bool isControl;
+		bool isContinuation;
+		bool isData;
+		uint8_t command;
+		uint8_t arguments;
+	};
+
+	Controller controller;
+
+	/// Runs every transaction immediately with the simulated controller
+	class SimulatedI2cMaster : public xpcc::I2c
+	{
+	public:
+		static bool
+		start(xpcc::I2cTransaction *transaction, ConfigurationHandler = nullptr)
+		{
+			if (not transaction->attaching()) {
+				return false;
+			}
+			controller.transactions++;
+			uint32_t bytes = 0;
+
+			OperationAfterWrite next = OperationAfterWrite::Restart;
+			while (next == OperationAfterWrite::Restart)
+			{
+				controller.start();
+				if (transaction->starting().next != OperationAfterStart::Write) {
+					break;
+				}
+				do {
+					const xpcc::I2cTransaction::Writing writing = transaction->writing();
+					for (std::size_t ii = 0; ii < writing.length; ++ii)
+					{
+						if (bytes++ == controller.abortAfter) {
+							transaction->detaching(DetachCause::ErrorCondition);
+							return true;
+						}
+						controller.receive(writing.buffer[ii]);
+					}
+					next = writing.next;
+				}
+				while (next == OperationAfterWrite::Write);
+			}
+			transaction->detaching(DetachCause::NormalStop);
+			return true;
+		}
+	};
+
+	template< uint8_t Height >
+	class Display : public xpcc::Ssd1306<SimulatedI2cMaster, Height>
+	{
+	public:
+		using xpcc::Ssd1306<SimulatedI2cMaster, Height>::getDirtyWindow;
+
+		/// \c true if the RAM of the controller shows the buffer
+		bool
+		isTransferred() const
+		{
+			// the 32 pixel high displays use the lower half of the RAM
+			const uint8_t offset = (Height == 64) ? 0 : 4;
+			for (uint8_t x = 0; x < 128; ++x)
+			{
+				for (uint8_t page = 0; page < Height / 8; ++page)
+				{
+					if (controller.ram[x][page + offset] != this->display_buffer[x][page]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+
+	template< uint8_t Height >
+	void
+	drawRandom(Display<Height>& display, uint32_t& state)
+	{
+		auto random = [&state](int16_t min, int16_t max) -> int16_t
+		{
+			state = state * 1103515245 + 12345;
+			return min + int16_t((state >> 16) % uint16_t(max - min));
+		};
+
+		const Point point(random(-10, 138), random(-10, Height + 10));
+		switch (random(0, 6))
+		{
+			case 0:
+				display.drawPixel(point);
+				break;
+			case 1:
+				display.drawLine(point, Point(random(-10, 138), random(-10, Height + 10)));
+				break;
+			case 2:
+				display.fillRectangle(point, random(0, 30), random(0, 20));
+				break;
+			case 3:
+				display.drawCircle(point, random(0, 20));
+				break;
+			case 4:
+				display.drawImage(point, xpcc::accessor::asFlash(bitmap::home_16x16));
+				break;
+			default:
+				display.drawText(point, "12:34");
+				break;
+		}
+	}
+
+	template< uint8_t Height >
+	bool
+	isUpdatedRandomly(uint32_t seed)
+	{
+		Display<Height> display;
+		display.setFont(xpcc::font::FixedWidth5x8);
+		controller.reset(0xa5);
+
+		uint32_t state = seed;
+		uint32_t bytes = 0;
+		for (uint16_t round = 0; round < 300; ++round)
+		{
+			// several changes between the updates
+			const uint8_t changes = (state >> 24) % 4;
+			for (uint8_t ii = 0; ii <= changes; ++ii) {
+				drawRandom(display, state);
+			}
+			display.update();
+			bytes += display.getUpdateBytes();
+
+			if (not display.isTransferred()) {
+				return false;
+			}
+		}
+		return (controller.dataBytes == bytes) and
+				(display.getTotalUpdateBytes() == bytes) and
+				(controller.unknownCommands == 0);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+Ssd1306Test::testFullUpdate()
+{
+	Display<64> display;
+	controller.reset(0xa5);
+
+	// the content of the controller is unknown at first
+	display.fillRectangle(Point(10, 10), 30, 20);
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1024U);
+	TEST_ASSERT_EQUALS(controller.dataBytes, 1024U);
+	TEST_ASSERT_EQUALS(controller.columnStart, 0);
+	TEST_ASSERT_EQUALS(controller.columnEnd, 127);
+	TEST_ASSERT_EQUALS(controller.pageStart, 0);
+	TEST_ASSERT_EQUALS(controller.pageEnd, 7);
+
+	// all pages of some columns are continuous in the buffer
+	display.drawLine(Point(60, 0), Point(62, 63));
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 3U * 8U);
+	TEST_ASSERT_EQUALS(controller.columnStart, 60);
+	TEST_ASSERT_EQUALS(controller.columnEnd, 62);
+
+	// the 32 pixel high displays are written to pages 4 to 7
+	Display<32> small;
+	controller.reset(0xa5);
+	small.update();
+	TEST_ASSERT_TRUE(small.isTransferred());
+	TEST_ASSERT_EQUALS(small.getUpdateBytes(), 512U);
+	TEST_ASSERT_EQUALS(controller.pageStart, 4);
+	TEST_ASSERT_EQUALS(controller.pageEnd, 7);
+}
+
+void
+Ssd1306Test::testPartialUpdate()
+{
+	Display<64> display;
+	display.setFont(xpcc::font::FixedWidth5x8);
+	controller.reset(0);
+	display.update();
+
+	// a single byte
+	display.drawPixel(70, 20);
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1U);
+	TEST_ASSERT_EQUALS(controller.columnStart, 70);
+	TEST_ASSERT_EQUALS(controller.columnEnd, 70);
+	TEST_ASSERT_EQUALS(controller.pageStart, 2);
+	TEST_ASSERT_EQUALS(controller.pageEnd, 2);
+
+	// across two pages, sent column by column
+	display.drawText(Point(40, 12), "12:34");
+	uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd));
+	TEST_ASSERT_EQUALS(pageBegin, 1);
+	TEST_ASSERT_EQUALS(pageEnd, 3);
+
+	const uint32_t bytes = controller.dataBytes;
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), uint32_t((columnEnd - columnBegin) * 2));
+	TEST_ASSERT_EQUALS(controller.dataBytes - bytes, display.getUpdateBytes());
+	TEST_ASSERT_EQUALS(controller.columnStart, columnBegin);
+	TEST_ASSERT_EQUALS(controller.columnEnd, columnEnd - 1);
+	TEST_ASSERT_EQUALS(controller.pageStart, 1);
+	TEST_ASSERT_EQUALS(controller.pageEnd, 2);
+
+	// the window contains the changes of all pages
+	display.drawPixel(3, 60);
+	display.drawPixel(120, 1);
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 118U * 8U);
+	TEST_ASSERT_EQUALS(controller.unknownCommands, 0);
+}
+
+void
+Ssd1306Test::testNothingChanged()
+{
+	Display<64> display;
+	controller.reset(0);
+	display.update();
+	TEST_ASSERT_EQUALS(controller.transactions, 1);
+
+	// no transfer at all
+	display.update();
+	TEST_ASSERT_EQUALS(controller.transactions, 1);
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 0U);
+	TEST_ASSERT_EQUALS(display.getTotalUpdateBytes(), 1024U);
+
+	// drawing outside of the display changes nothing
+	display.drawPixel(128, 10);
+	display.update();
+	TEST_ASSERT_EQUALS(controller.transactions, 1);
+
+	// everything again
+	display.invalidate();
+	display.update();
+	TEST_ASSERT_EQUALS(controller.transactions, 2);
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1024U);
+	TEST_ASSERT_TRUE(display.isTransferred());
+}
+
+void
+Ssd1306Test::testFailedUpdate()
+{
+	Display<64> display;
+	display.clear();
+	controller.reset(0);
+	display.update();
+
+	// not acknowledged
+	display.drawPixel(10, 10);
+	controller.abortAfter = 0;
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(display.writeDisplay()));
+	TEST_ASSERT_FALSE(display.isTransferred());
+
+	// the next transfer writes everything
+	controller.abortAfter = uint32_t(-1);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(display.writeDisplay()));
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1024U);
+
+	// aborted while writing the data column by column
+	display.drawText(Point(40, 12), "12:34");
+	controller.abortAfter = 30;
+	display.update();
+	TEST_ASSERT_FALSE(display.isTransferred());
+
+	controller.abortAfter = uint32_t(-1);
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1024U);
+
+	// and only the changes afterwards
+	display.drawPixel(100, 50);
+	display.update();
+	TEST_ASSERT_TRUE(display.isTransferred());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 1U);
+}
+
+void
+Ssd1306Test::testRandomUpdates()
+{
+	TEST_ASSERT_TRUE(isUpdatedRandomly<64>(42));
+	TEST_ASSERT_TRUE(isUpdatedRandomly<64>(1234567));
+	TEST_ASSERT_TRUE(isUpdatedRandomly<32>(42));
+	TEST_ASSERT_TRUE(isUpdatedRandomly<32>(7654321));
+}
@@ -39,6 +39,7 @@
 #include "math/filter.hpp"
 #include "math/geometry.hpp"
 #include "math/matrix.hpp"
+#include "math/symmetric_matrix.hpp"
 #include "math/lu_decomposition.hpp"
 #include "math/interpolation.hpp"
 #include "math/tolerance.hpp"
@@ -0,0 +1,241 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__KALMAN_HPP
+#define XPCC__KALMAN_HPP
+
+#include <stdint.h>
+
+#include <xpcc/math/matrix.hpp>
+#include <xpcc/math/symmetric_matrix.hpp>
+
+namespace xpcc
+{
+	namespace filter
+	{
+		/**
+		 * \brief	Linear Kalman filter with compile-time dimensions
+		 *
+		 * The covariance is kept in a SymmetricMatrix, so only the lower
+		 * triangle is stored and updated. None of the steps allocate
+		 * memory, all intermediate results live on the stack and have a
+		 * size known at compile time.
+		 *
+		 * Measurements are incorporated with the Joseph form
+		 * \f$ P = (I - KH) P (I - KH)^T + K R K^T \f$, which keeps the
+		 * covariance positive semi-definite even with rounding errors.
+		 *
+		 * If the measurement noise is uncorrelated (diagonal \f$ R \f$),
+		 * update() processes the measurement rows one after another as
+		 * scalar measurements. The innovation covariance then is a scalar
+		 * and no matrix has to be inverted. Use updateCorrelated() for a
+		 * full measurement covariance, which solves the innovation
+		 * covariance with a LUDecomposition.
+		 *
+		 * \code
+		 * // constant velocity model: x = (position, velocity)
+		 * xpcc::filter::Kalman<float, 2> kalman;
+		 * kalman.reset(Kalman::StateVector::zeroMatrix(),
+		 *              Kalman::Covariance::diagonalMatrix(10.f));
+		 *
+		 * const float f[4] = { 1, dt,
+		 *                      0, 1 };
+		 * const float h[2] = { 1, 0 };
+		 *
+		 * kalman.predict(xpcc::Matrix<float, 2, 2>(f), q);
+		 * kalman.updateScalar(xpcc::Matrix<float, 1, 2>(h), position, r);
+		 * \endcode
+		 *
+		 * \tparam	T	Floating point type
+		 * \tparam	N	Number of states
+		 *
+		 * \ingroup	filter
+		 */
+		template<typename T, uint8_t N>
+		class Kalman
+		{
+		public:
+			typedef Matrix<T, N, 1> StateVector;
+			typedef Matrix<T, N, N> StateMatrix;
+			typedef SymmetricMatrix<T, N> Covariance;
+
+		public:
+			/// State and covariance are zero-initialized
+			Kalman();
+
+			Kalman(const StateVector& state, const Covariance& covariance);
+
+			void
+			reset(const StateVector& state, const Covariance& covariance);
+
+			/**
+			 * \brief	Time update
+			 *
+			 * \f$ x = F x \f$ and \f$ P = F P F^T + Q \f$
+			 *
+			 * \param	transition		State transition matrix F
+			 * \param	processNoise	Process noise covariance Q
+			 */
+			void
+			predict(const StateMatrix& transition,
+					const Covariance& processNoise);
+
+			/**
+			 * \brief	Time update with control input
+			 *
+			 * \f$ x = F x + B u \f$ and \f$ P = F P F^T + Q \f$
+			 */
+			template<uint8_t U>
+			void
+			predict(const StateMatrix& transition,
+					const Matrix<T, N, U>& control,
+					const Matrix<T, U, 1>& input,
+					const Covariance& processNoise);
+
+			/**
+			 * \brief	Incorporate a single scalar measurement
+			 *
+			 * \f$ z = h x + v \f$ with the variance of v given by \p variance.
+			 * Needs O(N^2) operations and no matrix inversion.
+			 *
+			 * \return	Innovation \f$ z - h x \f$ before the update
+			 */
+			T
+			updateScalar(const Matrix<T, 1, N>& observation,
+					const T& measurement, const T& variance);
+
+			/**
+			 * \brief	Sequential update with uncorrelated measurement noise
+			 *
+			 * \param	observation		Observation matrix H
+			 * \param	measurement		Measurement vector z
+			 * \param	variance		Diagonal of the measurement noise
+			 * 							covariance R
+			 */
+			template<uint8_t M>
+			void
+			update(const Matrix<T, M, N>& observation,
+					const Matrix<T, M, 1>& measurement,
+					const Matrix<T, M, 1>& variance);
+
+			/**
+			 * \brief	Joint update with correlated measurement noise
+			 *
+			 * Solves the MxM innovation covariance through a
+			 * LUDecomposition.
+			 *
+			 * \return	\c false if the innovation covariance is singular,
+			 * 			the filter is left unchanged in this case.
+			 */
+			template<uint8_t M>
+			bool
+			updateCorrelated(const Matrix<T, M, N>& observation,
+					const Matrix<T, M, 1>& measurement,
+					const SymmetricMatrix<T, M>& noise);
+
+			inline const StateVector&
+			getState() const
+			{
+				return state;
+			}
+
+			inline const Covariance&
+			getCovariance() const
+			{
+				return covariance;
+			}
+
+		protected:
+			/// P = F P F^T + Q
+			void
+			propagateCovariance(const StateMatrix& transition,
+					const Covariance& processNoise);
+
+			/**
+			 * Joseph form update for a scalar measurement with the
+			 * observation row h.
+			 *
+			 * \param	innovation	z - h x
+			 */
+			void
+			correctScalar(const T* observation, const T& innovation,
+					const T& variance);
+
+		protected:
+			StateVector state;
+			Covariance covariance;
+		};
+
+		/**
+		 * \brief	Extended Kalman filter
+		 *
+		 * Works on linearized models: the caller evaluates the nonlinear
+		 * state transition and measurement functions and passes the
+		 * results together with their Jacobians. This keeps the filter
+		 * independent of the way the models are implemented and free of
+		 * virtual calls.
+		 *
+		 * \code
+		 * ekf.predict(f(ekf.getState(), u), jacobianF(ekf.getState(), u), q);
+		 * ekf.updateScalar(z - h(ekf.getState()), jacobianH(ekf.getState()), r);
+		 * \endcode
+		 *
+		 * \ingroup	filter
+		 */
+		template<typename T, uint8_t N>
+		class ExtendedKalman : public Kalman<T, N>
+		{
+		public:
+			typedef typename Kalman<T, N>::StateVector StateVector;
+			typedef typename Kalman<T, N>::StateMatrix StateMatrix;
+			typedef typename Kalman<T, N>::Covariance Covariance;
+
+		public:
+			ExtendedKalman();
+
+			ExtendedKalman(const StateVector& state, const Covariance& covariance);
+
+			/**
+			 * \param	predictedState	f(x, u)
+			 * \param	jacobian		Jacobian of f at the current state
+			 * \param	processNoise	Process noise covariance Q
+			 */
+			void
+			predict(const StateVector& predictedState,
+					const StateMatrix& jacobian,
+					const Covariance& processNoise);
+
+			/**
+			 * \param	innovation	z - h(x)
+			 * \param	jacobian	Jacobian of h at the current state
+			 * \param	variance	Variance of the measurement noise
+			 */
+			void
+			updateScalar(const T& innovation,
+					const Matrix<T, 1, N>& jacobian, const T& variance);
+
+			/**
+			 * \brief	Sequential update with uncorrelated measurement noise
+			 *
+			 * All rows are linearized at the state before the update.
+			 * The innovation of every row is corrected for the state
+			 * changes caused by the rows processed before it.
+			 */
+			template<uint8_t M>
+			void
+			update(const Matrix<T, M, 1>& innovation,
+					const Matrix<T, M, N>& jacobian,
+					const Matrix<T, M, 1>& variance);
+		};
+	}
+}
+
+#include "kalman_impl.hpp"
+
+#endif	// XPCC__KALMAN_HPP
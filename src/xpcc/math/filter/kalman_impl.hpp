@@ -0,0 +1,295 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__KALMAN_HPP
+#	error	"Don't include this file directly, use 'kalman.hpp' instead!"
+#endif
+
+#include <cmath>
+#include <xpcc/math/lu_decomposition.hpp>
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::filter::Kalman<T, N>::Kalman() :
+	state(StateVector::zeroMatrix()), covariance(Covariance::zeroMatrix())
+{
+}
+
+template<typename T, uint8_t N>
+xpcc::filter::Kalman<T, N>::Kalman(const StateVector& state,
+		const Covariance& covariance) :
+	state(state), covariance(covariance)
+{
+}
+
+template<typename T, uint8_t N>
+void
+xpcc::filter::Kalman<T, N>::reset(const StateVector& state,
+		const Covariance& covariance)
+{
+	this->state = state;
+	this->covariance = covariance;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+void
+xpcc::filter::Kalman<T, N>::predict(const StateMatrix& transition,
+		const Covariance& processNoise)
+{
+	state = transition * state;
+	propagateCovariance(transition, processNoise);
+}
+
+template<typename T, uint8_t N>
+template<uint8_t U>
+void
+xpcc::filter::Kalman<T, N>::predict(const StateMatrix& transition,
+		const Matrix<T, N, U>& control,
+		const Matrix<T, U, 1>& input,
+		const Covariance& processNoise)
+{
+	state = transition * state;
+	state += control * input;
+	propagateCovariance(transition, processNoise);
+}
+
+template<typename T, uint8_t N>
+void
+xpcc::filter::Kalman<T, N>::propagateCovariance(const StateMatrix& f,
+		const Covariance& q)
+{
+	// a = F * P
+	StateMatrix a;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j < N; ++j) {
+			T sum = T();
+			for (uint_fast8_t k = 0; k < N; ++k) {
+				sum += f[i][k] * covariance(k, j);
+			}
+			a[i][j] = sum;
+		}
+	}
+
+	// P = a * F^T + Q, only the lower triangle is calculated
+	uint_fast16_t index = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j <= i; ++j) {
+			T sum = q.element[index];
+			for (uint_fast8_t k = 0; k < N; ++k) {
+				sum += a[i][k] * f[j][k];
+			}
+			covariance.element[index++] = sum;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+T
+xpcc::filter::Kalman<T, N>::updateScalar(const Matrix<T, 1, N>& observation,
+		const T& measurement, const T& variance)
+{
+	T innovation = measurement;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		innovation -= observation.element[i] * state.element[i];
+	}
+
+	correctScalar(observation.element, innovation, variance);
+	return innovation;
+}
+
+template<typename T, uint8_t N>
+template<uint8_t M>
+void
+xpcc::filter::Kalman<T, N>::update(const Matrix<T, M, N>& observation,
+		const Matrix<T, M, 1>& measurement,
+		const Matrix<T, M, 1>& variance)
+{
+	for (uint_fast8_t m = 0; m < M; ++m)
+	{
+		const T* h = observation[m];
+		T innovation = measurement.element[m];
+		for (uint_fast8_t i = 0; i < N; ++i) {
+			innovation -= h[i] * state.element[i];
+		}
+
+		correctScalar(h, innovation, variance.element[m]);
+	}
+}
+
+template<typename T, uint8_t N>
+void
+xpcc::filter::Kalman<T, N>::correctScalar(const T* h, const T& innovation,
+		const T& variance)
+{
+	// b = P * h^T
+	T b[N];
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		T sum = T();
+		for (uint_fast8_t k = 0; k < N; ++k) {
+			sum += covariance(i, k) * h[k];
+		}
+		b[i] = sum;
+	}
+
+	// innovation covariance s = h * P * h^T + r
+	T s = variance;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		s += h[i] * b[i];
+	}
+	if (!(s > T())) {
+		// measurement carries no information or the covariance is broken
+		return;
+	}
+
+	T gain[N];
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		gain[i] = b[i] / s;
+		state.element[i] += gain[i] * innovation;
+	}
+
+	// Joseph form (I - K h) P (I - K h)^T + K r K^T, expanded for a
+	// scalar measurement to  P - K b^T - b K^T + s K K^T
+	uint_fast16_t index = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j <= i; ++j) {
+			covariance.element[index++] +=
+					(s * gain[j] - b[j]) * gain[i] - b[i] * gain[j];
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+template<uint8_t M>
+bool
+xpcc::filter::Kalman<T, N>::updateCorrelated(const Matrix<T, M, N>& h,
+		const Matrix<T, M, 1>& measurement,
+		const SymmetricMatrix<T, M>& noise)
+{
+	// b = P * H^T
+	Matrix<T, N, M> b;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t m = 0; m < M; ++m) {
+			T sum = T();
+			for (uint_fast8_t k = 0; k < N; ++k) {
+				sum += covariance(i, k) * h[m][k];
+			}
+			b[i][m] = sum;
+		}
+	}
+
+	// S = H * b + R
+	Matrix<T, M, M> s;
+	for (uint_fast8_t m = 0; m < M; ++m) {
+		for (uint_fast8_t n = 0; n <= m; ++n) {
+			T sum = noise(m, n);
+			for (uint_fast8_t k = 0; k < N; ++k) {
+				sum += h[m][k] * b[k][n];
+			}
+			s[m][n] = sum;
+			s[n][m] = sum;
+		}
+	}
+
+	// K^T = S^-1 * b^T (S is symmetric)
+	Matrix<T, M, N> gainT = b.asTransposed();
+	if (!LUDecomposition::solve(s, &gainT)) {
+		return false;
+	}
+	for (uint_fast16_t i = 0; i < uint_fast16_t(M) * N; ++i) {
+		if (!std::isfinite(gainT.element[i])) {
+			return false;
+		}
+	}
+
+	Matrix<T, M, 1> innovation = measurement - h * state;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t m = 0; m < M; ++m) {
+			state.element[i] += gainT[m][i] * innovation.element[m];
+		}
+	}
+
+	// c = K * S
+	Matrix<T, N, M> c;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t m = 0; m < M; ++m) {
+			T sum = T();
+			for (uint_fast8_t n = 0; n < M; ++n) {
+				sum += gainT[n][i] * s[n][m];
+			}
+			c[i][m] = sum;
+		}
+	}
+
+	// Joseph form, expanded to  P - K b^T - b K^T + K S K^T
+	uint_fast16_t index = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j <= i; ++j) {
+			T sum = T();
+			for (uint_fast8_t m = 0; m < M; ++m) {
+				sum += (c[i][m] - b[i][m]) * gainT[m][j] - gainT[m][i] * b[j][m];
+			}
+			covariance.element[index++] += sum;
+		}
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::filter::ExtendedKalman<T, N>::ExtendedKalman() :
+	Kalman<T, N>()
+{
+}
+
+template<typename T, uint8_t N>
+xpcc::filter::ExtendedKalman<T, N>::ExtendedKalman(const StateVector& state,
+		const Covariance& covariance) :
+	Kalman<T, N>(state, covariance)
+{
+}
+
+template<typename T, uint8_t N>
+void
+xpcc::filter::ExtendedKalman<T, N>::predict(const StateVector& predictedState,
+		const StateMatrix& jacobian, const Covariance& processNoise)
+{
+	this->state = predictedState;
+	this->propagateCovariance(jacobian, processNoise);
+}
+
+template<typename T, uint8_t N>
+void
+xpcc::filter::ExtendedKalman<T, N>::updateScalar(const T& innovation,
+		const Matrix<T, 1, N>& jacobian, const T& variance)
+{
+	this->correctScalar(jacobian.element, innovation, variance);
+}
+
+template<typename T, uint8_t N>
+template<uint8_t M>
+void
+xpcc::filter::ExtendedKalman<T, N>::update(const Matrix<T, M, 1>& innovation,
+		const Matrix<T, M, N>& jacobian, const Matrix<T, M, 1>& variance)
+{
+	const StateVector linearizationPoint = this->state;
+	for (uint_fast8_t m = 0; m < M; ++m)
+	{
+		const T* h = jacobian[m];
+		T y = innovation.element[m];
+		for (uint_fast8_t i = 0; i < N; ++i) {
+			y -= h[i] * (this->state.element[i] - linearizationPoint.element[i]);
+		}
+
+		this->correctScalar(h, y, variance.element[m]);
+	}
+}
@@ -0,0 +1,200 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/filter/kalman.hpp>
+
+#include "kalman_test.hpp"
+
+typedef xpcc::filter::Kalman<float, 2> Kalman2;
+
+static void
+checkCovariance(const xpcc::SymmetricMatrix<float, 2>& a,
+		const xpcc::Matrix<float, 2, 2>& b)
+{
+	for (uint_fast8_t i = 0; i < 2; ++i) {
+		for (uint_fast8_t j = 0; j < 2; ++j) {
+			TEST_ASSERT_EQUALS_DELTA(a(i, j), b[i][j], 1e-4f);
+		}
+	}
+}
+
+void
+KalmanTest::testSymmetricMatrix()
+{
+	TEST_ASSERT_EQUALS((xpcc::SymmetricMatrix<float, 3>::NumberOfElements), 6U);
+
+	const float m[9] = {
+		1, 2, 4,
+		2, 3, 5,
+		4, 5, 6,
+	};
+	xpcc::SymmetricMatrix<float, 3> a((xpcc::Matrix<float, 3, 3>(m)));
+
+	const float packed[6] = { 1, 2, 3, 4, 5, 6 };
+	TEST_ASSERT_EQUALS_ARRAY(a.element, packed, 6);
+
+	TEST_ASSERT_EQUALS(a(0, 2), 4.f);
+	TEST_ASSERT_EQUALS(a(2, 0), 4.f);
+	a(1, 2) = 7.f;
+	TEST_ASSERT_EQUALS(a(2, 1), 7.f);
+	a(1, 2) = 5.f;
+
+	TEST_ASSERT_TRUE(a.asMatrix() == (xpcc::Matrix<float, 3, 3>(m)));
+
+	xpcc::SymmetricMatrix<float, 3> i = xpcc::SymmetricMatrix<float, 3>::identityMatrix();
+	TEST_ASSERT_TRUE(i.asMatrix() == (xpcc::Matrix<float, 3, 3>::identityMatrix()));
+
+	a -= a;
+	TEST_ASSERT_TRUE(a == (xpcc::SymmetricMatrix<float, 3>::zeroMatrix()));
+}
+
+void
+KalmanTest::testPredict()
+{
+	const float x[2] = { 1.f, 2.f };
+	const float p[4] = {
+		2.0f, 0.5f,
+		0.5f, 1.0f,
+	};
+	const float f[4] = {
+		1.f, 0.1f,
+		0.f, 1.f,
+	};
+	const xpcc::Matrix<float, 2, 2> fm(f);
+	const xpcc::Matrix<float, 2, 2> pm(p);
+	const Kalman2::Covariance q = Kalman2::Covariance::diagonalMatrix(0.01f);
+
+	Kalman2 kalman((Kalman2::StateVector(x)), Kalman2::Covariance(pm));
+	kalman.predict(fm, q);
+
+	TEST_ASSERT_EQUALS_FLOAT(kalman.getState()[0][0], 1.2f);
+	TEST_ASSERT_EQUALS_FLOAT(kalman.getState()[1][0], 2.0f);
+	checkCovariance(kalman.getCovariance(),
+			fm * pm * fm.asTransposed() + q.asMatrix());
+
+	// with control input
+	const float b[2] = { 0.5f, 1.f };
+	const float u[1] = { 2.f };
+	kalman.predict(fm, xpcc::Matrix<float, 2, 1>(b), xpcc::Matrix<float, 1, 1>(u), q);
+	TEST_ASSERT_EQUALS_FLOAT(kalman.getState()[0][0], 2.4f);
+	TEST_ASSERT_EQUALS_FLOAT(kalman.getState()[1][0], 4.0f);
+}
+
+void
+KalmanTest::testScalarUpdate()
+{
+	// estimate a constant: the result has to be the mean of all
+	// measurements weighted with the prior
+	xpcc::filter::Kalman<float, 1> kalman;
+	const float one[1] = { 1.f };
+	const xpcc::Matrix<float, 1, 1> h(one);
+
+	kalman.reset(xpcc::Matrix<float, 1, 1>::zeroMatrix(),
+			xpcc::SymmetricMatrix<float, 1>::diagonalMatrix(1000.f));
+
+	const float measurements[6] = { 9.f, 11.f, 10.f, 10.5f, 9.5f, 10.f };
+	for (uint_fast8_t i = 0; i < 6; ++i) {
+		kalman.updateScalar(h, measurements[i], 4.f);
+	}
+
+	// P = 1 / (1/P0 + n/r)
+	const float variance = 1.f / (1.f / 1000.f + 6.f / 4.f);
+	TEST_ASSERT_EQUALS_DELTA(kalman.getCovariance()(0, 0), variance, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(kalman.getState()[0][0], 60.f * variance / 4.f, 1e-3f);
+
+	// a zero innovation covariance must not corrupt the filter
+	xpcc::filter::Kalman<float, 1> empty;
+	empty.updateScalar(h, 5.f, 0.f);
+	TEST_ASSERT_EQUALS(empty.getState()[0][0], 0.f);
+}
+
+void
+KalmanTest::testSequentialEqualsCorrelated()
+{
+	const float x[2] = { 0.5f, -1.f };
+	const float p[4] = {
+		3.0f, 0.8f,
+		0.8f, 2.0f,
+	};
+	const float h[4] = {
+		1.0f, 0.5f,
+		0.2f, 1.0f,
+	};
+	const float z[2] = { 1.f, 0.f };
+	const float r[2] = { 0.5f, 0.25f };
+
+	Kalman2 sequential((Kalman2::StateVector(x)), Kalman2::Covariance(xpcc::Matrix<float, 2, 2>(p)));
+	Kalman2 correlated = sequential;
+
+	sequential.update(xpcc::Matrix<float, 2, 2>(h), xpcc::Matrix<float, 2, 1>(z),
+			xpcc::Matrix<float, 2, 1>(r));
+
+	xpcc::SymmetricMatrix<float, 2> noise = xpcc::SymmetricMatrix<float, 2>::zeroMatrix();
+	noise(0, 0) = r[0];
+	noise(1, 1) = r[1];
+	TEST_ASSERT_TRUE(correlated.updateCorrelated(xpcc::Matrix<float, 2, 2>(h),
+			xpcc::Matrix<float, 2, 1>(z), noise));
+
+	TEST_ASSERT_EQUALS_DELTA(sequential.getState()[0][0], correlated.getState()[0][0], 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(sequential.getState()[1][0], correlated.getState()[1][0], 1e-4f);
+	checkCovariance(sequential.getCovariance(), correlated.getCovariance().asMatrix());
+
+	// compare against the textbook formula with explicit inversion
+	const xpcc::Matrix<float, 2, 2> pm(p);
+	const xpcc::Matrix<float, 2, 2> hm(h);
+	xpcc::Matrix<float, 2, 2> s = hm * pm * hm.asTransposed() + noise.asMatrix();
+	xpcc::Matrix<float, 2, 2> sInverse = xpcc::Matrix<float, 2, 2>::identityMatrix();
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::solve(s, &sInverse));
+	xpcc::Matrix<float, 2, 2> k = pm * hm.asTransposed() * sInverse;
+	xpcc::Matrix<float, 2, 2> expected = (xpcc::Matrix<float, 2, 2>::identityMatrix() - k * hm) * pm;
+	checkCovariance(correlated.getCovariance(), expected);
+}
+
+void
+KalmanTest::testCorrelatedSingular()
+{
+	const float h[2] = { 1.f, 0.f };
+	const float z[1] = { 1.f };
+
+	Kalman2 kalman;
+	TEST_ASSERT_FALSE(kalman.updateCorrelated(xpcc::Matrix<float, 1, 2>(h),
+			xpcc::Matrix<float, 1, 1>(z), xpcc::SymmetricMatrix<float, 1>::zeroMatrix()));
+	TEST_ASSERT_EQUALS(kalman.getState()[0][0], 0.f);
+}
+
+void
+KalmanTest::testExtendedSequential()
+{
+	// with a linear model the extended filter must give the same
+	// result as the linear one
+	const float x[2] = { 0.5f, -1.f };
+	const float p[4] = {
+		3.0f, 0.8f,
+		0.8f, 2.0f,
+	};
+	const float h[4] = {
+		1.0f, 0.5f,
+		0.2f, 1.0f,
+	};
+	const float z[2] = { 1.f, 0.f };
+	const float r[2] = { 0.5f, 0.25f };
+	const xpcc::Matrix<float, 2, 2> hm(h);
+	const Kalman2::Covariance pm((xpcc::Matrix<float, 2, 2>(p)));
+
+	Kalman2 linear((Kalman2::StateVector(x)), pm);
+	xpcc::filter::ExtendedKalman<float, 2> extended((Kalman2::StateVector(x)), pm);
+
+	linear.update(hm, xpcc::Matrix<float, 2, 1>(z), xpcc::Matrix<float, 2, 1>(r));
+	extended.update(xpcc::Matrix<float, 2, 1>(z) - hm * extended.getState(),
+			hm, xpcc::Matrix<float, 2, 1>(r));
+
+	TEST_ASSERT_EQUALS_DELTA(linear.getState()[0][0], extended.getState()[0][0], 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(linear.getState()[1][0], extended.getState()[1][0], 1e-5f);
+	checkCovariance(linear.getCovariance(), extended.getCovariance().asMatrix());
+}
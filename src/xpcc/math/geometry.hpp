@@ -37,14 +37,21 @@
 #ifndef	XPCC__GEOMETRY_HPP
 #define	XPCC__GEOMETRY_HPP
 
+#include "geometry/aabb_tree_2d.hpp"
 #include "geometry/angle.hpp"
+#include "geometry/bounding_box_2d.hpp"
 #include "geometry/circle_2d.hpp"
+#include "geometry/fixed_angle.hpp"
 #include "geometry/line_2d.hpp"
 #include "geometry/line_segment_2d.hpp"
+#include "geometry/line_segment_array_2d.hpp"
 #include "geometry/location_2d.hpp"
+#include "geometry/point_array_2d.hpp"
 #include "geometry/point_set_2d.hpp"
 #include "geometry/polygon_2d.hpp"
 #include "geometry/quaternion.hpp"
+#include "geometry/shape_2d.hpp"
+#include "geometry/spatial_grid_2d.hpp"
 #include "geometry/vector.hpp"
 
 #endif	// XPCC__GEOMETRY_HPP
@@ -0,0 +1,253 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AABB_TREE_2D_HPP
+#define XPCC__AABB_TREE_2D_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/container/dynamic_array.hpp>
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+#include "bounding_box_2d.hpp"
+#include "shape_2d.hpp"
+#include "ray_2d.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Bounding volume hierarchy of axis aligned bounding boxes
+	 *
+	 * Binary tree with the shapes in the leaves, every inner node stores
+	 * the bounding box of its children. Queries descend only into the
+	 * subtrees whose box can contain a result, which needs O(log n) box
+	 * tests for most queries.
+	 *
+	 * The tree can either be built at once from a static set of shapes
+	 * with build() (median split, optimal height) or grown incrementally
+	 * with insert() and remove(). Incremental insertion places new
+	 * shapes with a perimeter heuristic and keeps the tree balanced by
+	 * rotations.
+	 *
+	 * For moving shapes the leaf boxes are enlarged by \p margin. As long
+	 * as a shape stays inside of its enlarged box, update() does not
+	 * need to touch the tree.
+	 *
+	 * The nodes are stored in a DynamicArray which grows on demand, so
+	 * this index is meant for hosted builds and large numbers of shapes.
+	 * Use SpatialGrid2D on microcontrollers.
+	 *
+	 * \code
+	 * xpcc::AabbTree2D<float> tree;
+	 * for (const auto& obstacle : obstacles) {
+	 *     tree.insert(obstacle);
+	 * }
+	 *
+	 * xpcc::AabbTree2D<float>::Hit hit;
+	 * if (tree.getNearest(robot, 500.f, &hit)) {
+	 *     ...
+	 * }
+	 * \endcode
+	 *
+	 * \tparam	T	Coordinate type
+	 *
+	 * \see		SpatialGrid2D
+	 * \ingroup	geometry
+	 */
+	template <typename T>
+	class AabbTree2D
+	{
+	public:
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+		typedef uint32_t Handle;
+
+		static constexpr Handle Invalid = 0xffffffff;
+
+		struct Hit
+		{
+			Handle handle;
+
+			/// Distance from the ray origin or the query point
+			FloatType distance;
+		};
+
+	public:
+		/**
+		 * \param	margin	Enlargement of the leaf boxes, should be in
+		 * 					the order of the distance moving shapes
+		 * 					travel between two calls of update().
+		 */
+		AabbTree2D(T margin = T());
+
+		/// Add a shape, the tree is rebalanced if necessary
+		Handle
+		insert(const Shape2D<T>& shape);
+
+		void
+		remove(Handle handle);
+
+		/**
+		 * \brief	Notify the index that a shape has been changed
+		 *
+		 * \return	\c true if the shape had to be moved inside of the tree
+		 */
+		bool
+		update(Handle handle);
+
+		/**
+		 * \brief	Replace the content by a static set of shapes
+		 *
+		 * Builds the tree top down, splitting the shapes at the median of
+		 * the longer axis. Queries on the result are faster than on a
+		 * tree built by repeated insert().
+		 *
+		 * \param[out]	handles	Handle for every shape, may be \c nullptr
+		 */
+		void
+		build(const Shape2D<T>* shapes, std::size_t count, Handle* handles);
+
+		void
+		removeAll();
+
+		inline const Shape2D<T>&
+		getShape(Handle handle) const
+		{
+			return nodes[handle].shape;
+		}
+
+		inline std::size_t
+		getNumberOfShapes() const
+		{
+			return numberOfShapes;
+		}
+
+		/// Number of levels of the tree, zero for an empty tree
+		uint_fast16_t
+		getHeight() const;
+
+		/**
+		 * \brief	All shapes whose bounding box overlaps the area
+		 *
+		 * \param[out]	result		Handles of the shapes found
+		 * \param		maxResults	Size of \p result
+		 * \return	Number of shapes found, at most \p maxResults
+		 */
+		std::size_t
+		query(const BoundingBox2D<T>& area,
+				Handle* result, std::size_t maxResults) const;
+
+		/**
+		 * \brief	All shapes closer than \p radius to \p center
+		 *
+		 * Exact test, not only the bounding boxes are compared.
+		 */
+		std::size_t
+		query(const Vector<T, 2>& center, T radius,
+				Handle* result, std::size_t maxResults) const;
+
+		/**
+		 * \brief	Find the first shape hit by a ray
+		 *
+		 * \param	ray			Start point and direction
+		 * \param	maxLength	Maximum length in multiples of the
+		 * 						direction vector.
+		 */
+		bool
+		raycast(const Ray2D<T>& ray, FloatType maxLength, Hit* hit) const;
+
+		/**
+		 * \brief	Find the shape closest to a point
+		 *
+		 * \param	maxDistance		Shapes further away are ignored
+		 */
+		bool
+		getNearest(const Vector<T, 2>& point, FloatType maxDistance,
+				Hit* hit) const;
+
+	protected:
+		/**
+		 * Size of the stack used for the traversal. A balanced tree
+		 * with 2^32 leaves is less than 48 levels high.
+		 */
+		static constexpr uint_fast8_t StackSize = 64;
+
+		struct Node
+		{
+			/// Enlarged box for leaves
+			BoundingBox2D<T> box;
+
+			/// Exact box of the shape, only used for leaves
+			BoundingBox2D<T> shapeBox;
+			Shape2D<T> shape;
+
+			/// Parent or next free node
+			Handle parent;
+			Handle left;
+			Handle right;
+
+			/// Leaves have height 1, unused nodes 0
+			int16_t height;
+
+			inline bool
+			isLeaf() const
+			{
+				return (left == Invalid);
+			}
+		};
+
+		Handle
+		allocateNode();
+
+		void
+		freeNode(Handle index);
+
+		/// Initializes a leaf for the shape, it is not yet part of the tree
+		Handle
+		createLeaf(const Shape2D<T>& shape);
+
+		void
+		insertLeaf(Handle leaf);
+
+		void
+		removeLeaf(Handle leaf);
+
+		/// Recalculate boxes and heights from \p index up to the root
+		void
+		refit(Handle index);
+
+		/// Rotate the subtree if it is imbalanced, returns its new root
+		Handle
+		balance(Handle index);
+
+		Handle
+		build(Handle* leaves, std::size_t count);
+
+		/// Shapes overlapping the area accepted by the filter
+		template<typename Filter>
+		std::size_t
+		queryArea(const BoundingBox2D<T>& area,
+				Handle* result, std::size_t maxResults, Filter filter) const;
+
+	protected:
+		DynamicArray<Node> nodes;
+
+		Handle root;
+		Handle freeList;
+		std::size_t numberOfShapes;
+		T margin;
+	};
+}
+
+#include "aabb_tree_2d_impl.hpp"
+
+#endif // XPCC__AABB_TREE_2D_HPP
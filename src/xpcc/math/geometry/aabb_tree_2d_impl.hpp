@@ -0,0 +1,673 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AABB_TREE_2D_HPP
+	#error	"Don't include this file directly, use 'aabb_tree_2d.hpp' instead!"
+#endif
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+template<typename T>
+constexpr typename xpcc::AabbTree2D<T>::Handle xpcc::AabbTree2D<T>::Invalid;
+
+template<typename T>
+constexpr uint_fast8_t xpcc::AabbTree2D<T>::StackSize;
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::AabbTree2D<T>::AabbTree2D(T margin) :
+	nodes(), root(Invalid), freeList(Invalid), numberOfShapes(0), margin(margin)
+{
+}
+
+template<typename T>
+void
+xpcc::AabbTree2D<T>::removeAll()
+{
+	nodes.removeAll();
+	root = Invalid;
+	freeList = Invalid;
+	numberOfShapes = 0;
+}
+
+template<typename T>
+uint_fast16_t
+xpcc::AabbTree2D<T>::getHeight() const
+{
+	return (root == Invalid) ? 0 : nodes[root].height;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::AabbTree2D<T>::Handle
+xpcc::AabbTree2D<T>::allocateNode()
+{
+	Handle index;
+	if (freeList != Invalid)
+	{
+		index = freeList;
+		freeList = nodes[index].parent;
+	}
+	else
+	{
+		index = nodes.getSize();
+		nodes.append(Node());
+	}
+
+	Node& node = nodes[index];
+	node.parent = Invalid;
+	node.left = Invalid;
+	node.right = Invalid;
+	node.height = 1;
+	return index;
+}
+
+template<typename T>
+void
+xpcc::AabbTree2D<T>::freeNode(Handle index)
+{
+	Node& node = nodes[index];
+	node.shape = Shape2D<T>();
+	node.height = 0;
+	node.parent = freeList;
+	freeList = index;
+}
+
+template<typename T>
+typename xpcc::AabbTree2D<T>::Handle
+xpcc::AabbTree2D<T>::createLeaf(const Shape2D<T>& shape)
+{
+	const Handle leaf = allocateNode();
+
+	Node& node = nodes[leaf];
+	node.shape = shape;
+	node.shapeBox = shape.getBoundingBox();
+	node.box = node.shapeBox;
+	node.box.inflate(margin);
+
+	++numberOfShapes;
+	return leaf;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::AabbTree2D<T>::Handle
+xpcc::AabbTree2D<T>::insert(const Shape2D<T>& shape)
+{
+	const Handle leaf = createLeaf(shape);
+	insertLeaf(leaf);
+	return leaf;
+}
+
+template<typename T>
+void
+xpcc::AabbTree2D<T>::remove(Handle handle)
+{
+	removeLeaf(handle);
+	freeNode(handle);
+	--numberOfShapes;
+}
+
+template<typename T>
+bool
+xpcc::AabbTree2D<T>::update(Handle handle)
+{
+	Node& node = nodes[handle];
+	node.shapeBox = node.shape.getBoundingBox();
+	if (node.box.contains(node.shapeBox)) {
+		return false;
+	}
+
+	removeLeaf(handle);
+	node.box = node.shapeBox;
+	node.box.inflate(margin);
+	insertLeaf(handle);
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+void
+xpcc::AabbTree2D<T>::insertLeaf(Handle leaf)
+{
+	if (root == Invalid)
+	{
+		root = leaf;
+		nodes[leaf].parent = Invalid;
+		return;
+	}
+
+	// Find the best sibling: the cost of a subtree is the sum of the
+	// perimeters of all its boxes, every box containing the new leaf
+	// grows.
+	const BoundingBox2D<T> leafBox = nodes[leaf].box;
+	Handle index = root;
+	while (!nodes[index].isLeaf())
+	{
+		const Node& node = nodes[index];
+
+		const WideType combined = BoundingBox2D<T>::merge(node.box, leafBox).getPerimeter();
+
+		// cost of creating a new parent for this node and the new leaf
+		const WideType cost = 2 * combined;
+
+		// minimum cost of pushing the leaf further down the tree
+		const WideType inheritance = 2 * (combined - node.box.getPerimeter());
+
+		WideType costs[2];
+		const Handle children[2] = { node.left, node.right };
+		for (uint_fast8_t i = 0; i < 2; ++i)
+		{
+			const Node& child = nodes[children[i]];
+			costs[i] = BoundingBox2D<T>::merge(child.box, leafBox).getPerimeter() + inheritance;
+			if (!child.isLeaf()) {
+				costs[i] -= child.box.getPerimeter();
+			}
+		}
+
+		if (cost < costs[0] && cost < costs[1]) {
+			break;
+		}
+		index = (costs[0] < costs[1]) ? children[0] : children[1];
+	}
+
+	const Handle sibling = index;
+	const Handle newParent = allocateNode();
+	const Handle oldParent = nodes[sibling].parent;
+
+	Node& parent = nodes[newParent];
+	parent.parent = oldParent;
+	parent.left = sibling;
+	parent.right = leaf;
+	parent.box = BoundingBox2D<T>::merge(leafBox, nodes[sibling].box);
+	parent.height = nodes[sibling].height + 1;
+
+	if (oldParent == Invalid) {
+		root = newParent;
+	}
+	else if (nodes[oldParent].left == sibling) {
+		nodes[oldParent].left = newParent;
+	}
+	else {
+		nodes[oldParent].right = newParent;
+	}
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	refit(oldParent);
+}
+
+template<typename T>
+void
+xpcc::AabbTree2D<T>::removeLeaf(Handle leaf)
+{
+	if (leaf == root)
+	{
+		root = Invalid;
+		return;
+	}
+
+	const Handle parent = nodes[leaf].parent;
+	const Handle grandParent = nodes[parent].parent;
+	const Handle sibling = (nodes[parent].left == leaf) ?
+			nodes[parent].right : nodes[parent].left;
+
+	// the sibling takes the place of the parent
+	if (grandParent == Invalid) {
+		root = sibling;
+	}
+	else if (nodes[grandParent].left == parent) {
+		nodes[grandParent].left = sibling;
+	}
+	else {
+		nodes[grandParent].right = sibling;
+	}
+	nodes[sibling].parent = grandParent;
+	freeNode(parent);
+
+	refit(grandParent);
+}
+
+template<typename T>
+void
+xpcc::AabbTree2D<T>::refit(Handle index)
+{
+	while (index != Invalid)
+	{
+		index = balance(index);
+
+		Node& node = nodes[index];
+		const Node& left = nodes[node.left];
+		const Node& right = nodes[node.right];
+
+		node.height = 1 + ((left.height > right.height) ? left.height : right.height);
+		node.box = BoundingBox2D<T>::merge(left.box, right.box);
+
+		index = node.parent;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::AabbTree2D<T>::Handle
+xpcc::AabbTree2D<T>::balance(Handle indexA)
+{
+	Node& a = nodes[indexA];
+	if (a.isLeaf() || a.height < 3) {
+		return indexA;
+	}
+
+	const Handle indexB = a.left;
+	const Handle indexC = a.right;
+	Node& b = nodes[indexB];
+	Node& c = nodes[indexC];
+
+	const int_fast16_t difference = c.height - b.height;
+	if (difference > 1)
+	{
+		// rotate C up
+		const Handle indexF = c.left;
+		const Handle indexG = c.right;
+		Node& f = nodes[indexF];
+		Node& g = nodes[indexG];
+
+		c.left = indexA;
+		c.parent = a.parent;
+		a.parent = indexC;
+
+		if (c.parent == Invalid) {
+			root = indexC;
+		}
+		else if (nodes[c.parent].left == indexA) {
+			nodes[c.parent].left = indexC;
+		}
+		else {
+			nodes[c.parent].right = indexC;
+		}
+
+		// the higher grandchild stays below C
+		Handle indexUp = indexF;
+		Handle indexDown = indexG;
+		if (g.height > f.height) {
+			indexUp = indexG;
+			indexDown = indexF;
+		}
+		Node& up = nodes[indexUp];
+		Node& down = nodes[indexDown];
+
+		c.right = indexUp;
+		a.right = indexDown;
+		down.parent = indexA;
+
+		a.box = BoundingBox2D<T>::merge(b.box, down.box);
+		c.box = BoundingBox2D<T>::merge(a.box, up.box);
+		a.height = 1 + ((b.height > down.height) ? b.height : down.height);
+		c.height = 1 + ((a.height > up.height) ? a.height : up.height);
+		return indexC;
+	}
+
+	if (difference < -1)
+	{
+		// rotate B up
+		const Handle indexD = b.left;
+		const Handle indexE = b.right;
+		Node& d = nodes[indexD];
+		Node& e = nodes[indexE];
+
+		b.left = indexA;
+		b.parent = a.parent;
+		a.parent = indexB;
+
+		if (b.parent == Invalid) {
+			root = indexB;
+		}
+		else if (nodes[b.parent].left == indexA) {
+			nodes[b.parent].left = indexB;
+		}
+		else {
+			nodes[b.parent].right = indexB;
+		}
+
+		Handle indexUp = indexD;
+		Handle indexDown = indexE;
+		if (e.height > d.height) {
+			indexUp = indexE;
+			indexDown = indexD;
+		}
+		Node& up = nodes[indexUp];
+		Node& down = nodes[indexDown];
+
+		b.right = indexUp;
+		a.left = indexDown;
+		down.parent = indexA;
+
+		a.box = BoundingBox2D<T>::merge(c.box, down.box);
+		b.box = BoundingBox2D<T>::merge(a.box, up.box);
+		a.height = 1 + ((c.height > down.height) ? c.height : down.height);
+		b.height = 1 + ((a.height > up.height) ? a.height : up.height);
+		return indexB;
+	}
+
+	return indexA;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+void
+xpcc::AabbTree2D<T>::build(const Shape2D<T>* shapes, std::size_t count,
+		Handle* handles)
+{
+	removeAll();
+	if (count == 0) {
+		return;
+	}
+
+	// a tree with n leaves has n - 1 inner nodes
+	nodes.reserve(2 * count - 1);
+
+	DynamicArray<Handle> leaves(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Handle leaf = createLeaf(shapes[i]);
+		leaves.append(leaf);
+		if (handles != nullptr) {
+			handles[i] = leaf;
+		}
+	}
+
+	root = build(&leaves[0], count);
+	nodes[root].parent = Invalid;
+}
+
+template<typename T>
+typename xpcc::AabbTree2D<T>::Handle
+xpcc::AabbTree2D<T>::build(Handle* leaves, std::size_t count)
+{
+	if (count == 1) {
+		return leaves[0];
+	}
+
+	// split along the longer side of the box containing all centers
+	BoundingBox2D<T> centers(nodes[leaves[0]].box.getMin(), nodes[leaves[0]].box.getMin());
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const BoundingBox2D<T>& box = nodes[leaves[i]].box;
+		centers.extend(Vector<T, 2>(
+				box.getMin().x + (box.getMax().x - box.getMin().x) / 2,
+				box.getMin().y + (box.getMax().y - box.getMin().y) / 2));
+	}
+	const uint8_t axis =
+			((centers.getMax().x - centers.getMin().x) <
+			 (centers.getMax().y - centers.getMin().y)) ? 1 : 0;
+
+	// Partially sort the leaves (quickselect), so that the lower half
+	// is left of the median. The sum of min and max is twice the center.
+	const std::size_t median = count / 2;
+	std::size_t first = 0;
+	std::size_t last = count - 1;
+	while (first < last)
+	{
+		const BoundingBox2D<T>& pivotBox = nodes[leaves[(first + last) / 2]].box;
+		const WideType pivot = static_cast<WideType>(pivotBox.getMin()[axis]) +
+				static_cast<WideType>(pivotBox.getMax()[axis]);
+
+		std::size_t i = first;
+		std::size_t j = last;
+		while (i <= j)
+		{
+			while (static_cast<WideType>(nodes[leaves[i]].box.getMin()[axis]) +
+				   static_cast<WideType>(nodes[leaves[i]].box.getMax()[axis]) < pivot) {
+				++i;
+			}
+			while (static_cast<WideType>(nodes[leaves[j]].box.getMin()[axis]) +
+				   static_cast<WideType>(nodes[leaves[j]].box.getMax()[axis]) > pivot) {
+				--j;
+			}
+			if (i <= j)
+			{
+				const Handle tmp = leaves[i];
+				leaves[i] = leaves[j];
+				leaves[j] = tmp;
+				++i;
+				if (j == 0) {
+					break;
+				}
+				--j;
+			}
+		}
+
+		if (median <= j) {
+			last = j;
+		}
+		else if (median >= i) {
+			first = i;
+		}
+		else {
+			break;
+		}
+	}
+
+	const Handle left = build(leaves, median);
+	const Handle right = build(leaves + median, count - median);
+
+	const Handle index = allocateNode();
+	Node& node = nodes[index];
+	node.left = left;
+	node.right = right;
+	node.box = BoundingBox2D<T>::merge(nodes[left].box, nodes[right].box);
+	node.height = 1 + ((nodes[left].height > nodes[right].height) ?
+			nodes[left].height : nodes[right].height);
+	nodes[left].parent = index;
+	nodes[right].parent = index;
+	return index;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+std::size_t
+xpcc::AabbTree2D<T>::query(const BoundingBox2D<T>& area,
+		Handle* result, std::size_t maxResults) const
+{
+	return queryArea(area, result, maxResults,
+			[](const Node&) { return true; });
+}
+
+template<typename T>
+std::size_t
+xpcc::AabbTree2D<T>::query(const Vector<T, 2>& center, T radius,
+		Handle* result, std::size_t maxResults) const
+{
+	BoundingBox2D<T> area(center, center);
+	area.inflate(radius);
+
+	return queryArea(area, result, maxResults,
+			[&center, radius](const Node& node) {
+				return (node.shape.getDistanceTo(center) <= radius);
+			});
+}
+
+template<typename T>
+template<typename Filter>
+std::size_t
+xpcc::AabbTree2D<T>::queryArea(const BoundingBox2D<T>& area,
+		Handle* result, std::size_t maxResults, Filter filter) const
+{
+	if (root == Invalid) {
+		return 0;
+	}
+
+	Handle stack[StackSize];
+	uint_fast8_t top = 0;
+	stack[top++] = root;
+
+	std::size_t count = 0;
+	while (top > 0)
+	{
+		const Handle index = stack[--top];
+		const Node& node = nodes[index];
+		if (!node.box.intersects(area)) {
+			continue;
+		}
+
+		if (node.isLeaf())
+		{
+			if (node.shapeBox.intersects(area) && filter(node))
+			{
+				if (count >= maxResults) {
+					return count;
+				}
+				result[count++] = index;
+			}
+		}
+		else
+		{
+			stack[top++] = node.right;
+			stack[top++] = node.left;
+		}
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::AabbTree2D<T>::raycast(const Ray2D<T>& ray, FloatType maxLength,
+		Hit* hit) const
+{
+	const Vector<FloatType, 2> start(
+			static_cast<FloatType>(ray.getStartPoint().x),
+			static_cast<FloatType>(ray.getStartPoint().y));
+	const Vector<FloatType, 2> direction(
+			static_cast<FloatType>(ray.getDirectionVector().x),
+			static_cast<FloatType>(ray.getDirectionVector().y));
+	if (root == Invalid || (direction.x == 0 && direction.y == 0)) {
+		return false;
+	}
+
+	Handle stack[StackSize];
+	uint_fast8_t top = 0;
+	stack[top++] = root;
+
+	FloatType best = maxLength;
+	Handle handle = Invalid;
+	while (top > 0)
+	{
+		const Handle index = stack[--top];
+		const Node& node = nodes[index];
+		if (node.isLeaf())
+		{
+			FloatType t;
+			if (node.shapeBox.intersects(start, direction, best) &&
+				node.shape.intersects(start, direction, best, &t) &&
+				(t < best || handle == Invalid))
+			{
+				best = t;
+				handle = index;
+			}
+			continue;
+		}
+
+		// visit the child entered first by the ray first
+		FloatType entryLeft;
+		FloatType entryRight;
+		const bool left = nodes[node.left].box.intersects(start, direction, best, &entryLeft);
+		const bool right = nodes[node.right].box.intersects(start, direction, best, &entryRight);
+		if (left && right)
+		{
+			if (entryLeft < entryRight) {
+				stack[top++] = node.right;
+				stack[top++] = node.left;
+			}
+			else {
+				stack[top++] = node.left;
+				stack[top++] = node.right;
+			}
+		}
+		else if (left) {
+			stack[top++] = node.left;
+		}
+		else if (right) {
+			stack[top++] = node.right;
+		}
+	}
+
+	if (handle == Invalid) {
+		return false;
+	}
+
+	hit->handle = handle;
+	hit->distance = best * std::sqrt(direction.x * direction.x + direction.y * direction.y);
+	return true;
+}
+
+template<typename T>
+bool
+xpcc::AabbTree2D<T>::getNearest(const Vector<T, 2>& point,
+		FloatType maxDistance, Hit* hit) const
+{
+	if (root == Invalid) {
+		return false;
+	}
+
+	Handle stack[StackSize];
+	uint_fast8_t top = 0;
+	stack[top++] = root;
+
+	FloatType best = maxDistance;
+	Handle handle = Invalid;
+	while (top > 0)
+	{
+		const Handle index = stack[--top];
+		const Node& node = nodes[index];
+		if (node.isLeaf())
+		{
+			if (node.shapeBox.getDistanceSquaredTo(point) > best * best) {
+				continue;
+			}
+
+			const FloatType distance = node.shape.getDistanceTo(point);
+			if (distance < best || (handle == Invalid && distance <= best))
+			{
+				best = distance;
+				handle = index;
+			}
+			continue;
+		}
+
+		const FloatType limit = best * best;
+		if (node.box.getDistanceSquaredTo(point) > limit) {
+			// a better result has been found since the node was pushed
+			continue;
+		}
+
+		// the closer child is searched first, because it most likely
+		// contains a better result which prunes the other one
+		const FloatType left = nodes[node.left].box.getDistanceSquaredTo(point);
+		const FloatType right = nodes[node.right].box.getDistanceSquaredTo(point);
+		if (left < right)
+		{
+			if (right <= limit) { stack[top++] = node.right; }
+			if (left <= limit) { stack[top++] = node.left; }
+		}
+		else
+		{
+			if (left <= limit) { stack[top++] = node.left; }
+			if (right <= limit) { stack[top++] = node.right; }
+		}
+	}
+
+	if (handle == Invalid) {
+		return false;
+	}
+
+	hit->handle = handle;
+	hit->distance = best;
+	return true;
+}
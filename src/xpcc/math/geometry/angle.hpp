@@ -84,6 +84,10 @@ namespace xpcc
 	 * Angles are always represented by float values in the range
 	 * from -Pi to Pi.
 	 *
+	 * On controllers without an FPU use FixedAngle for calculations
+	 * with sine, cosine or atan2, it needs no libm calls.
+	 *
+	 * \see	FixedAngle
 	 * \ingroup	geometry
 	 */
 	class Angle
@@ -0,0 +1,132 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BOUNDING_BOX_2D_HPP
+#define XPCC__BOUNDING_BOX_2D_HPP
+
+#include <xpcc/io/iostream.hpp>
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Axis aligned bounding box
+	 *
+	 * Used by the spatial indices to quickly reject shapes before the
+	 * exact (and expensive) intersection tests are done. The borders
+	 * belong to the box.
+	 *
+	 * \see		SpatialGrid2D
+	 * \see		AabbTree2D
+	 * \ingroup	geometry
+	 */
+	template <typename T>
+	class BoundingBox2D
+	{
+	public:
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	public:
+		BoundingBox2D();
+
+		BoundingBox2D(const Vector<T, 2>& min, const Vector<T, 2>& max);
+
+		inline const Vector<T, 2>&
+		getMin() const
+		{
+			return min;
+		}
+
+		inline const Vector<T, 2>&
+		getMax() const
+		{
+			return max;
+		}
+
+		/// Grow the box until it contains the point
+		void
+		extend(const Vector<T, 2>& point);
+
+		/// Grow the box until it contains the other box
+		void
+		extend(const BoundingBox2D& other);
+
+		/// Grow the box by \p margin in all directions
+		void
+		inflate(T margin);
+
+		/// Smallest box containing both boxes
+		static BoundingBox2D
+		merge(const BoundingBox2D& a, const BoundingBox2D& b);
+
+		bool
+		contains(const Vector<T, 2>& point) const;
+
+		bool
+		contains(const BoundingBox2D& other) const;
+
+		bool
+		intersects(const BoundingBox2D& other) const;
+
+		/**
+		 * \brief	Perimeter of the box
+		 *
+		 * Used as cost function when building trees of boxes, in 2D it
+		 * is a better measure for the probability of being hit by a
+		 * query than the area.
+		 */
+		WideType
+		getPerimeter() const;
+
+		/// Squared distance to a point, zero if the point is inside
+		FloatType
+		getDistanceSquaredTo(const Vector<T, 2>& point) const;
+
+		/**
+		 * \brief	Check if a ray passes through the box
+		 *
+		 * The ray is given as \f$ origin + t \cdot direction \f$ and only
+		 * the part with \f$ 0 \le t \le maxParameter \f$ is checked.
+		 *
+		 * \param[out]	entry	Parameter t at which the ray enters the
+		 * 						box, zero if the origin is inside.
+		 * \param[out]	exit	Parameter t at which the ray leaves the box
+		 * 						or \p maxParameter.
+		 */
+		bool
+		intersects(const Vector<FloatType, 2>& origin,
+				const Vector<FloatType, 2>& direction,
+				FloatType maxParameter,
+				FloatType* entry = nullptr, FloatType* exit = nullptr) const;
+
+		bool
+		operator == (const BoundingBox2D& other) const;
+
+		bool
+		operator != (const BoundingBox2D& other) const;
+
+	protected:
+		Vector<T, 2> min;
+		Vector<T, 2> max;
+	};
+
+	// ------------------------------------------------------------------------
+	// Global functions
+	// ------------------------------------------------------------------------
+	template<typename T>
+	IOStream&
+	operator << (IOStream& os, const BoundingBox2D<T>& box);
+}
+
+#include "bounding_box_2d_impl.hpp"
+
+#endif // XPCC__BOUNDING_BOX_2D_HPP
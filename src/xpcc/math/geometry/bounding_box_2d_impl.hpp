@@ -0,0 +1,199 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BOUNDING_BOX_2D_HPP
+	#error	"Don't include this file directly, use 'bounding_box_2d.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D() :
+	min(), max()
+{
+}
+
+template<typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D(const Vector<T, 2>& min,
+		const Vector<T, 2>& max) :
+	min(min), max(max)
+{
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+void
+xpcc::BoundingBox2D<T>::extend(const Vector<T, 2>& point)
+{
+	if (point.x < min.x) { min.x = point.x; }
+	if (point.y < min.y) { min.y = point.y; }
+	if (point.x > max.x) { max.x = point.x; }
+	if (point.y > max.y) { max.y = point.y; }
+}
+
+template<typename T>
+void
+xpcc::BoundingBox2D<T>::extend(const BoundingBox2D& other)
+{
+	if (other.min.x < min.x) { min.x = other.min.x; }
+	if (other.min.y < min.y) { min.y = other.min.y; }
+	if (other.max.x > max.x) { max.x = other.max.x; }
+	if (other.max.y > max.y) { max.y = other.max.y; }
+}
+
+template<typename T>
+void
+xpcc::BoundingBox2D<T>::inflate(T margin)
+{
+	min.x -= margin;
+	min.y -= margin;
+	max.x += margin;
+	max.y += margin;
+}
+
+template<typename T>
+xpcc::BoundingBox2D<T>
+xpcc::BoundingBox2D<T>::merge(const BoundingBox2D& a, const BoundingBox2D& b)
+{
+	BoundingBox2D box(a);
+	box.extend(b);
+	return box;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::contains(const Vector<T, 2>& point) const
+{
+	return (min.x <= point.x && point.x <= max.x &&
+			min.y <= point.y && point.y <= max.y);
+}
+
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::contains(const BoundingBox2D& other) const
+{
+	return (min.x <= other.min.x && other.max.x <= max.x &&
+			min.y <= other.min.y && other.max.y <= max.y);
+}
+
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const BoundingBox2D& other) const
+{
+	return (min.x <= other.max.x && other.min.x <= max.x &&
+			min.y <= other.max.y && other.min.y <= max.y);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::BoundingBox2D<T>::WideType
+xpcc::BoundingBox2D<T>::getPerimeter() const
+{
+	return 2 * ((static_cast<WideType>(max.x) - static_cast<WideType>(min.x)) +
+				(static_cast<WideType>(max.y) - static_cast<WideType>(min.y)));
+}
+
+template<typename T>
+typename xpcc::BoundingBox2D<T>::FloatType
+xpcc::BoundingBox2D<T>::getDistanceSquaredTo(const Vector<T, 2>& point) const
+{
+	FloatType dx = 0;
+	if (point.x < min.x) {
+		dx = static_cast<FloatType>(min.x) - static_cast<FloatType>(point.x);
+	}
+	else if (point.x > max.x) {
+		dx = static_cast<FloatType>(point.x) - static_cast<FloatType>(max.x);
+	}
+
+	FloatType dy = 0;
+	if (point.y < min.y) {
+		dy = static_cast<FloatType>(min.y) - static_cast<FloatType>(point.y);
+	}
+	else if (point.y > max.y) {
+		dy = static_cast<FloatType>(point.y) - static_cast<FloatType>(max.y);
+	}
+
+	return dx * dx + dy * dy;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const Vector<FloatType, 2>& origin,
+		const Vector<FloatType, 2>& direction,
+		FloatType maxParameter, FloatType* entry, FloatType* exit) const
+{
+	// Slab test: intersect the parameter interval of the ray with the
+	// intervals in which it is between the borders of each axis.
+	FloatType tMin = 0;
+	FloatType tMax = maxParameter;
+
+	for (uint_fast8_t axis = 0; axis < 2; ++axis)
+	{
+		const FloatType lower = static_cast<FloatType>(min[axis]);
+		const FloatType upper = static_cast<FloatType>(max[axis]);
+
+		if (direction[axis] == 0)
+		{
+			// ray is parallel to the slab
+			if (origin[axis] < lower || origin[axis] > upper) {
+				return false;
+			}
+		}
+		else
+		{
+			const FloatType inverse = FloatType(1) / direction[axis];
+			FloatType t1 = (lower - origin[axis]) * inverse;
+			FloatType t2 = (upper - origin[axis]) * inverse;
+			if (t1 > t2) {
+				FloatType t = t1;
+				t1 = t2;
+				t2 = t;
+			}
+
+			if (t1 > tMin) { tMin = t1; }
+			if (t2 < tMax) { tMax = t2; }
+			if (tMin > tMax) {
+				return false;
+			}
+		}
+	}
+
+	if (entry != nullptr) {
+		*entry = tMin;
+	}
+	if (exit != nullptr) {
+		*exit = tMax;
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::operator == (const BoundingBox2D& other) const
+{
+	return (min == other.min && max == other.max);
+}
+
+template<typename T>
+bool
+xpcc::BoundingBox2D<T>::operator != (const BoundingBox2D& other) const
+{
+	return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::IOStream&
+xpcc::operator << (xpcc::IOStream& os, const xpcc::BoundingBox2D<T>& box)
+{
+	os << "min=(" << box.getMin() << "), max=(" << box.getMax() << ")";
+	return os;
+}
@@ -0,0 +1,263 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/accessor/flash.hpp>
+
+#include "angle.hpp"
+#include "fixed_angle.hpp"
+
+namespace
+{
+	// round(32768 * sin(i * Pi / 512)) for i = 0..256
+	FLASH_STORAGE(uint16_t sineTable[257]) =
+	{
+	    0,   201,   402,   603,   804,  1005,  1206,  1407,
+	 1608,  1809,  2009,  2210,  2411,  2611,  2811,  3012,
+	 3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,
+	 4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,
+	 6393,  6590,  6787,  6983,  7180,  7376,  7571,  7767,
+	 7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+	 9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850,
+	11039, 11228, 11417, 11605, 11793, 11980, 12167, 12354,
+	12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+	14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+	15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673,
+	16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+	18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358,
+	19520, 19681, 19841, 20001, 20160, 20318, 20475, 20632,
+	20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+	22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028,
+	23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144,
+	24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+	25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199,
+	26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+	27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+	28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803,
+	28899, 28993, 29086, 29178, 29269, 29359, 29448, 29535,
+	29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+	30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784,
+	30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298,
+	31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+	31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099,
+	32138, 32177, 32214, 32251, 32286, 32319, 32352, 32383,
+	32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+	32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718,
+	32729, 32738, 32746, 32753, 32758, 32762, 32766, 32767,
+	32768
+	};
+
+	// round(atan(2^-i) * 2^32 / (2 * Pi)) for i = 0..17
+	FLASH_STORAGE(uint32_t arctanTable[18]) =
+	{
+	536870912, 316933406, 167458907, 85004756,
+	42667331, 21354465, 10679838, 5340245,
+	2670163, 1335087, 667544, 333772,
+	166886, 83443, 41722, 20861,
+	10430, 5215
+	};
+
+	static constexpr uint_fast8_t cordicIterations = 18;
+
+	// 2^30 / K with the CORDIC gain K = prod(sqrt(1 + 2^(-2i)))
+	static constexpr uint32_t cordicInverseGain = 652032874;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::FixedAngle
+xpcc::FixedAngle::fromRadian(float angle)
+{
+	const float steps = angle * static_cast<float>(32768.0 / M_PI);
+	return FixedAngle(static_cast<uint16_t>(
+			static_cast<int32_t>(steps + ((steps < 0) ? -0.5f : 0.5f))));
+}
+
+xpcc::FixedAngle
+xpcc::FixedAngle::fromDegree(float angle)
+{
+	const float steps = angle * (65536.f / 360.f);
+	return FixedAngle(static_cast<uint16_t>(
+			static_cast<int32_t>(steps + ((steps < 0) ? -0.5f : 0.5f))));
+}
+
+float
+xpcc::FixedAngle::toRadian() const
+{
+	return getSigned() * static_cast<float>(M_PI / 32768.0);
+}
+
+float
+xpcc::FixedAngle::toDegree() const
+{
+	return getSigned() * (360.f / 65536.f);
+}
+
+// ----------------------------------------------------------------------------
+uint16_t
+xpcc::FixedAngle::getQuarterSine(uint16_t index)
+{
+	// 256 intervals with 64 steps each
+	const uint16_t i = index >> 6;
+	const uint16_t fraction = index & 0x3f;
+
+	const uint16_t a = xpcc::accessor::asFlash(sineTable)[i];
+	if (fraction == 0) {
+		// also avoids reading behind the table for index = 0x4000
+		return a;
+	}
+	const uint16_t b = xpcc::accessor::asFlash(sineTable)[i + 1];
+
+	// the table is monotonic and the difference at most 201, so the
+	// product fits into 16 bit
+	return a + (((b - a) * fraction + 32) >> 6);
+}
+
+int16_t
+xpcc::FixedAngle::sin() const
+{
+	uint16_t index = value & 0x3fff;
+	if (value & 0x4000) {
+		// second half of each half wave is mirrored
+		index = 0x4000 - index;
+	}
+
+	uint16_t result = getQuarterSine(index);
+	if (result > 32767) {
+		result = 32767;
+	}
+
+	if (value & 0x8000) {
+		return -static_cast<int16_t>(result);
+	}
+	return static_cast<int16_t>(result);
+}
+
+int16_t
+xpcc::FixedAngle::cos() const
+{
+	return FixedAngle(static_cast<uint16_t>(value + 0x4000)).sin();
+}
+
+void
+xpcc::FixedAngle::sinCos(int16_t* sine, int16_t* cosine) const
+{
+	*sine = sin();
+	*cosine = cos();
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::FixedAngle::vectorize(int32_t x, int32_t y, uint32_t* length)
+{
+	if (x == 0 && y == 0) {
+		*length = 0;
+		return 0;
+	}
+
+	// Work in the first quadrant, the result is mirrored afterwards.
+	// The negation is done unsigned, so INT32_MIN is handled correctly.
+	uint32_t ux = (x < 0) ? -static_cast<uint32_t>(x) : static_cast<uint32_t>(x);
+	uint32_t uy = (y < 0) ? -static_cast<uint32_t>(y) : static_cast<uint32_t>(y);
+
+	// Scale the larger value into [2^28, 2^29). This gives the same
+	// relative accuracy for all inputs and leaves enough headroom for
+	// the growth by the CORDIC gain (about 1.65 * sqrt(2)).
+	uint32_t max = (ux > uy) ? ux : uy;
+	int_fast8_t shift = 0;
+	while (max >= (UINT32_C(1) << 29)) {
+		max >>= 1;
+		++shift;
+	}
+	while (max < (UINT32_C(1) << 20)) {
+		max <<= 8;
+		shift -= 8;
+	}
+	while (max < (UINT32_C(1) << 28)) {
+		max <<= 1;
+		--shift;
+	}
+
+	int32_t cx;
+	int32_t cy;
+	if (shift > 0) {
+		cx = static_cast<int32_t>(ux >> shift);
+		cy = static_cast<int32_t>(uy >> shift);
+	}
+	else {
+		cx = static_cast<int32_t>(ux << -shift);
+		cy = static_cast<int32_t>(uy << -shift);
+	}
+
+	// Rotate the vector onto the x-axis and sum up the angles needed.
+	// The direction of each step changes randomly, so it is applied with
+	// a mask instead of a branch: (x ^ mask) - mask is x for mask = 0
+	// and -x for mask = -1.
+	uint32_t angle = 0;
+	for (uint_fast8_t i = 0; i < cordicIterations; ++i)
+	{
+		// all bits set if cy <= 0, cy is at most 2^30 in magnitude
+		const int32_t mask = (cy - 1) >> 31;
+		const int32_t dx = ((cy >> i) ^ mask) - mask;
+		const int32_t dy = ((cx >> i) ^ mask) - mask;
+		const uint32_t step = xpcc::accessor::asFlash(arctanTable)[i];
+
+		cx += dx;
+		cy -= dy;
+		angle += (step ^ static_cast<uint32_t>(mask)) - static_cast<uint32_t>(mask);
+	}
+
+	uint32_t r = static_cast<uint32_t>(
+			(static_cast<uint64_t>(cx) * cordicInverseGain +
+			 (UINT32_C(1) << 29)) >> 30);
+	if (shift > 0) {
+		r <<= shift;
+	}
+	else if (shift < 0) {
+		r = (r + (UINT32_C(1) << (-shift - 1))) >> -shift;
+	}
+	*length = r;
+
+	if (x < 0) {
+		angle = UINT32_C(0x80000000) - angle;
+	}
+	if (y < 0) {
+		angle = -angle;
+	}
+	return angle;
+}
+
+xpcc::FixedAngle
+xpcc::FixedAngle::atan2(int32_t y, int32_t x)
+{
+	uint32_t length;
+	uint32_t angle = vectorize(x, y, &length);
+	return FixedAngle(static_cast<uint16_t>((angle + 0x8000) >> 16));
+}
+
+uint32_t
+xpcc::FixedAngle::hypot(int32_t x, int32_t y)
+{
+	uint32_t length;
+	vectorize(x, y, &length);
+	return length;
+}
+
+xpcc::FixedAngle
+xpcc::FixedAngle::toPolar(int32_t x, int32_t y, uint32_t* length)
+{
+	uint32_t angle = vectorize(x, y, length);
+	return FixedAngle(static_cast<uint16_t>((angle + 0x8000) >> 16));
+}
+
+// ----------------------------------------------------------------------------
+xpcc::IOStream&
+xpcc::operator << (xpcc::IOStream& os, const xpcc::FixedAngle& angle)
+{
+	os << angle.getRaw();
+	return os;
+}
@@ -0,0 +1,263 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIXED_ANGLE_HPP
+#define XPCC__FIXED_ANGLE_HPP
+
+#include <stdint.h>
+
+#include <xpcc/io/iostream.hpp>
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Binary angle with trigonometric functions without floating point
+	 *
+	 * The full circle is divided into 65536 steps, so one step is about
+	 * 0.0055 degree (9.6e-5 radian). Additions and subtractions wrap
+	 * around automatically, the angle never needs to be normalized.
+	 * As signed value the angle is in the range [-Pi, Pi).
+	 *
+	 * sin() and cos() use a quarter wave table with 257 entries (514 bytes
+	 * of flash) and linear interpolation. The results are Q15 values
+	 * (32768 = 1.0, saturated to 32767) with an error of at most
+	 * 2 LSB compared to the exact value.
+	 *
+	 * atan2() and hypot() use CORDIC in vectoring mode with 18 iterations,
+	 * only additions and shifts are needed. atan2() is exact to 1 LSB
+	 * (one step of the angle), hypot() is exact to 1 + 2^-24 of the result.
+	 *
+	 * Both need no floating point operations and are much faster than the
+	 * libm functions on controllers without an FPU.
+	 *
+	 * \code
+	 * xpcc::FixedAngle phi = xpcc::FixedAngle::fromDegree(30);
+	 *
+	 * int16_t s, c;
+	 * phi.sinCos(&s, &c);		// s = 16384, c = 28378
+	 *
+	 * xpcc::Vector2i v(100, 0);
+	 * v.rotate(phi);			// (87, 50)
+	 * \endcode
+	 *
+	 * \see		Angle
+	 * \ingroup	geometry
+	 */
+	class FixedAngle
+	{
+	public:
+		/// Q15 representation of 1.0 (not reachable, results saturate to 32767)
+		static constexpr int32_t One = 32768;
+
+	public:
+		constexpr FixedAngle() :
+			value(0)
+		{
+		}
+
+		/// \param	raw		Angle in multiples of 2*Pi / 65536
+		explicit constexpr FixedAngle(uint16_t raw) :
+			value(raw)
+		{
+		}
+
+		static FixedAngle
+		fromRadian(float angle);
+
+		static FixedAngle
+		fromDegree(float angle);
+
+		/// Angle in the range [-Pi, Pi)
+		float
+		toRadian() const;
+
+		/// Angle in the range [-180, 180)
+		float
+		toDegree() const;
+
+		inline uint16_t
+		getRaw() const
+		{
+			return value;
+		}
+
+		/// Angle as signed value in the range [-32768, 32767]
+		inline int16_t
+		getSigned() const
+		{
+			return static_cast<int16_t>(value);
+		}
+
+		/// Sine as Q15 value, error at most 2 LSB
+		int16_t
+		sin() const;
+
+		/// Cosine as Q15 value, error at most 2 LSB
+		int16_t
+		cos() const;
+
+		/// Sine and cosine together, cheaper than calling both
+		void
+		sinCos(int16_t* sine, int16_t* cosine) const;
+
+		/**
+		 * \brief	Angle of the vector (x, y)
+		 *
+		 * Same as \c std::atan2(y, x), returns zero for (0, 0). The
+		 * error is at most one step of the angle.
+		 */
+		static FixedAngle
+		atan2(int32_t y, int32_t x);
+
+		/**
+		 * \brief	Length of the vector (x, y)
+		 *
+		 * Same as \c std::hypot(x, y) rounded to an integer without the
+		 * risk of an overflow. The error is at most 1 + result * 2^-24.
+		 */
+		static uint32_t
+		hypot(int32_t x, int32_t y);
+
+		/**
+		 * \brief	Angle and length of the vector (x, y) together
+		 *
+		 * Both values come from the same CORDIC run, so this is as fast
+		 * as one call of atan2() or hypot().
+		 */
+		static FixedAngle
+		toPolar(int32_t x, int32_t y, uint32_t* length);
+
+		/**
+		 * \brief	Multiply with a Q15 value and round
+		 *
+		 * Helper for the results of sin() and cos(). Uses a 32 bit product
+		 * for types up to 16 bit, a 64 bit product for wider types and
+		 * a plain multiplication for floating point types.
+		 */
+		template <typename T>
+		static inline T
+		multiply(T value, int16_t factor)
+		{
+			return Multiplier<T>::multiply(value, factor);
+		}
+
+		/// Calculate x * factorX + y * factorY with only one rounding step
+		template <typename T>
+		static inline T
+		multiplyAdd(T x, int16_t factorX, T y, int16_t factorY)
+		{
+			return Multiplier<T>::multiplyAdd(x, factorX, y, factorY);
+		}
+
+		inline FixedAngle
+		operator + (const FixedAngle& other) const
+		{
+			return FixedAngle(static_cast<uint16_t>(value + other.value));
+		}
+
+		inline FixedAngle
+		operator - (const FixedAngle& other) const
+		{
+			return FixedAngle(static_cast<uint16_t>(value - other.value));
+		}
+
+		inline FixedAngle
+		operator - () const
+		{
+			return FixedAngle(static_cast<uint16_t>(-value));
+		}
+
+		inline FixedAngle&
+		operator += (const FixedAngle& other)
+		{
+			value = static_cast<uint16_t>(value + other.value);
+			return *this;
+		}
+
+		inline FixedAngle&
+		operator -= (const FixedAngle& other)
+		{
+			value = static_cast<uint16_t>(value - other.value);
+			return *this;
+		}
+
+		inline bool
+		operator == (const FixedAngle& other) const
+		{
+			return (value == other.value);
+		}
+
+		inline bool
+		operator != (const FixedAngle& other) const
+		{
+			return (value != other.value);
+		}
+
+	private:
+		template <typename T, bool Float = ArithmeticTraits<T>::isFloatingPoint>
+		struct Multiplier
+		{
+			typedef typename tmp::Select<(sizeof(T) <= 2),
+					int32_t, int64_t>::Result Wide;
+
+			static inline T
+			multiply(T value, int16_t factor)
+			{
+				return static_cast<T>((static_cast<Wide>(value) * factor +
+						(1 << 14)) >> 15);
+			}
+
+			static inline T
+			multiplyAdd(T x, int16_t factorX, T y, int16_t factorY)
+			{
+				// Sum of two products stays inside of 2^31 for 16 bit
+				// values, because the factors are at most 2^15 - 1
+				return static_cast<T>((static_cast<Wide>(x) * factorX +
+						static_cast<Wide>(y) * factorY + (1 << 14)) >> 15);
+			}
+		};
+
+		template <typename T>
+		struct Multiplier<T, true>
+		{
+			static inline T
+			multiply(T value, int16_t factor)
+			{
+				return value * (static_cast<T>(factor) / T(One));
+			}
+
+			static inline T
+			multiplyAdd(T x, int16_t factorX, T y, int16_t factorY)
+			{
+				return (x * static_cast<T>(factorX) +
+						y * static_cast<T>(factorY)) / T(One);
+			}
+		};
+
+		/// sin() for the first quarter, \p index in the range [0, 0x4000]
+		static uint16_t
+		getQuarterSine(uint16_t index);
+
+		/// Rotates (x, y) onto the x-axis, returns the angle in 2^32 steps
+		static uint32_t
+		vectorize(int32_t x, int32_t y, uint32_t* length);
+
+		uint16_t value;
+	};
+
+	// ------------------------------------------------------------------------
+	// Global functions
+	// ------------------------------------------------------------------------
+	IOStream&
+	operator << (IOStream& os, const FixedAngle& angle);
+}
+
+#endif // XPCC__FIXED_ANGLE_HPP
@@ -0,0 +1,152 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__LINE_SEGMENT_ARRAY_2D_HPP
+#define XPCC__LINE_SEGMENT_ARRAY_2D_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "point_array_2d.hpp"
+#include "line_segment_2d.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Fixed capacity line segment container with
+	 * 			structure-of-arrays layout
+	 *
+	 * Start and end coordinates are stored in four separate arrays, so
+	 * that the intersection tests can check many segments against one
+	 * obstacle in a single vectorizable loop. The results are identical
+	 * to the corresponding methods of LineSegment2D.
+	 *
+	 * \code
+	 * xpcc::LineSegmentArray2D<int16_t, 2048> paths;
+	 * ...
+	 * bool blocked[2048];
+	 * if (paths.intersects(fieldBorder, blocked) > 0) {
+	 *     ...
+	 * }
+	 * \endcode
+	 *
+	 * \tparam	T	Coordinate type
+	 * \tparam	N	Maximum number of line segments
+	 *
+	 * \see		PointArray2D
+	 * \ingroup	geometry
+	 */
+	template <typename T, std::size_t N>
+	class LineSegmentArray2D
+	{
+	public:
+		using SizeType = std::size_t;
+		using PointType = Vector<T, 2>;
+
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	public:
+		LineSegmentArray2D();
+
+		/// Number of line segments contained in the array
+		inline SizeType
+		getNumberOfSegments() const
+		{
+			return size;
+		}
+
+		static constexpr SizeType
+		getCapacity()
+		{
+			return N;
+		}
+
+		inline bool
+		isFull() const
+		{
+			return (size >= N);
+		}
+
+		/**
+		 * \brief	Append a line segment
+		 * \return	\c false if the array is full
+		 */
+		bool
+		append(const LineSegment2D<T>& segment);
+
+		/// Replace the segment at position \p index
+		void
+		set(SizeType index, const LineSegment2D<T>& segment);
+
+		/// Get the segment at position \p index
+		LineSegment2D<T>
+		operator [](SizeType index) const;
+
+		/// Remove all segments
+		inline void
+		removeAll()
+		{
+			size = 0;
+		}
+
+		/**
+		 * \brief	Check every segment for an intersection with \p other
+		 *
+		 * \param[out]	result	\c true for every intersecting segment,
+		 * 						needs space for getNumberOfSegments()
+		 * 						elements.
+		 * \return	Number of intersecting segments
+		 * \see		LineSegment2D::intersects()
+		 */
+		SizeType
+		intersects(const LineSegment2D<T>& other, bool* result) const;
+
+		/**
+		 * \brief	Check every segment for an intersection with the
+		 * 			border of a polygon
+		 *
+		 * \return	Number of intersecting segments
+		 * \see		Polygon2D::intersects(const LineSegment2D<T>&)
+		 */
+		SizeType
+		intersects(const Polygon2D<T>& polygon, bool* result) const;
+
+		/**
+		 * \brief	Check every segment if it touches or crosses a circle
+		 *
+		 * A segment intersects the circle if its shortest distance to
+		 * the center is less or equal than the radius. Segments lying
+		 * completely inside the circle are therefore included.
+		 *
+		 * \return	Number of intersecting segments
+		 */
+		SizeType
+		intersects(const Circle2D<T>& circle, bool* result) const;
+
+	protected:
+		/// Number of segments processed at once by the polygon test
+		static constexpr SizeType BlockSize = 64;
+
+		/// Intersection test of segment \p i with the segment (a, b)
+		inline bool
+		intersects(SizeType i, T ax, T ay, T bx, T by) const;
+
+		SizeType size;
+
+		T startX[N];
+		T startY[N];
+		T endX[N];
+		T endY[N];
+	};
+}
+
+#include "line_segment_array_2d_impl.hpp"
+
+#endif // XPCC__LINE_SEGMENT_ARRAY_2D_HPP
@@ -0,0 +1,197 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__LINE_SEGMENT_ARRAY_2D_HPP
+	#error	"Don't include this file directly, use 'line_segment_array_2d.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+constexpr std::size_t xpcc::LineSegmentArray2D<T, N>::BlockSize;
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+xpcc::LineSegmentArray2D<T, N>::LineSegmentArray2D() :
+	size(0)
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+bool
+xpcc::LineSegmentArray2D<T, N>::append(const LineSegment2D<T>& segment)
+{
+	if (size >= N) {
+		return false;
+	}
+
+	set(size, segment);
+	size++;
+	return true;
+}
+
+template <typename T, std::size_t N>
+void
+xpcc::LineSegmentArray2D<T, N>::set(SizeType index, const LineSegment2D<T>& segment)
+{
+	startX[index] = segment.getStartPoint().x;
+	startY[index] = segment.getStartPoint().y;
+	endX[index] = segment.getEndPoint().x;
+	endY[index] = segment.getEndPoint().y;
+}
+
+template <typename T, std::size_t N>
+xpcc::LineSegment2D<T>
+xpcc::LineSegmentArray2D<T, N>::operator [](SizeType index) const
+{
+	return LineSegment2D<T>(PointType(startX[index], startY[index]),
+			PointType(endX[index], endY[index]));
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+bool
+xpcc::LineSegmentArray2D<T, N>::intersects(SizeType i, T ax, T ay, T bx, T by) const
+{
+	// same test as LineSegment2D::intersects(), but without branches
+	const int_fast8_t c1 = detail::ccw2D(startX[i], startY[i], endX[i], endY[i], ax, ay);
+	const int_fast8_t c2 = detail::ccw2D(startX[i], startY[i], endX[i], endY[i], bx, by);
+	const int_fast8_t c3 = detail::ccw2D(ax, ay, bx, by, startX[i], startY[i]);
+	const int_fast8_t c4 = detail::ccw2D(ax, ay, bx, by, endX[i], endY[i]);
+
+	return ((c1 * c2) <= 0) & ((c3 * c4) <= 0);
+}
+
+template <typename T, std::size_t N>
+std::size_t
+xpcc::LineSegmentArray2D<T, N>::intersects(const LineSegment2D<T>& other, bool* result) const
+{
+	const T ax = other.getStartPoint().x;
+	const T ay = other.getStartPoint().y;
+	const T bx = other.getEndPoint().x;
+	const T by = other.getEndPoint().y;
+
+	SizeType count = 0;
+	for (SizeType i = 0; i < size; ++i)
+	{
+		bool r = intersects(i, ax, ay, bx, by);
+		result[i] = r;
+		count += r;
+	}
+	return count;
+}
+
+template <typename T, std::size_t N>
+std::size_t
+xpcc::LineSegmentArray2D<T, N>::intersects(const Polygon2D<T>& polygon, bool* result) const
+{
+	// Same width as the coordinates, so that the loop vectorizes well
+	int32_t hits[BlockSize];
+	int32_t collinear[BlockSize];
+	SizeType count = 0;
+
+	const SizeType n = polygon.getNumberOfPoints();
+	for (SizeType offset = 0; offset < size; offset += BlockSize)
+	{
+		const SizeType length = (size - offset < BlockSize) ? (size - offset) : BlockSize;
+		const T* sx = &startX[offset];
+		const T* sy = &startY[offset];
+		const T* tx = &endX[offset];
+		const T* ty = &endY[offset];
+
+		for (SizeType i = 0; i < length; ++i) {
+			hits[i] = 0;
+			collinear[i] = 0;
+		}
+
+		// Iterate over the edges in the outer loop, so that the inner
+		// loop runs over contiguous coordinates. The inner loop only
+		// handles the general case, segments with three collinear
+		// points are marked and checked again below.
+		for (SizeType k = 0; k < n; ++k)
+		{
+			// local copies, the compiler can't know that the flag
+			// arrays don't overlap with the polygon
+			const WideType ax = polygon[k].x;
+			const WideType ay = polygon[k].y;
+			const WideType bx = polygon[(k + 1) % n].x;
+			const WideType by = polygon[(k + 1) % n].y;
+			const WideType ex = bx - ax;
+			const WideType ey = by - ay;
+
+			for (SizeType i = 0; i < length; ++i)
+			{
+				const WideType dx = WideType(tx[i]) - WideType(sx[i]);
+				const WideType dy = WideType(ty[i]) - WideType(sy[i]);
+
+				// see Vector<T, 2>::ccw()
+				const WideType p1 = dx * (ay - sy[i]);
+				const WideType q1 = dy * (ax - sx[i]);
+				const WideType p2 = dx * (by - sy[i]);
+				const WideType q2 = dy * (bx - sx[i]);
+				const WideType p3 = ex * (WideType(sy[i]) - ay);
+				const WideType q3 = ey * (WideType(sx[i]) - ax);
+				const WideType p4 = ex * (WideType(ty[i]) - ay);
+				const WideType q4 = ey * (WideType(tx[i]) - ax);
+
+				hits[i] |= int32_t((p1 < q1) != (p2 < q2)) & int32_t((p3 < q3) != (p4 < q4));
+				collinear[i] |= int32_t(p1 == q1) | int32_t(p2 == q2) | int32_t(p3 == q3) | int32_t(p4 == q4);
+			}
+		}
+
+		for (SizeType i = 0; i < length; ++i)
+		{
+			bool hit = hits[i];
+			if (collinear[i] && !hit)
+			{
+				for (SizeType k = 0; k < n && !hit; ++k)
+				{
+					const PointType& a = polygon[k];
+					const PointType& b = polygon[(k + 1) % n];
+					hit = intersects(offset + i, a.x, a.y, b.x, b.y);
+				}
+			}
+			result[offset + i] = hit;
+			count += hit;
+		}
+	}
+
+	return count;
+}
+
+template <typename T, std::size_t N>
+std::size_t
+xpcc::LineSegmentArray2D<T, N>::intersects(const Circle2D<T>& circle, bool* result) const
+{
+	const FloatType cx = circle.getCenter().x;
+	const FloatType cy = circle.getCenter().y;
+	const FloatType r = circle.getRadius();
+	const FloatType r2 = r * r;
+
+	SizeType count = 0;
+	for (SizeType i = 0; i < size; ++i)
+	{
+		const FloatType ax = startX[i];
+		const FloatType ay = startY[i];
+		const FloatType dx = FloatType(endX[i]) - ax;
+		const FloatType dy = FloatType(endY[i]) - ay;
+
+		const FloatType c1 = (cx - ax) * dx + (cy - ay) * dy;
+		const FloatType c2 = dx * dx + dy * dy;
+		FloatType t = (c1 <= 0) ? FloatType(0) : ((c2 <= c1) ? FloatType(1) : (c1 / c2));
+
+		const FloatType ex = ax + t * dx - cx;
+		const FloatType ey = ay + t * dy - cy;
+
+		bool hit = (ex * ex + ey * ey) <= r2;
+		result[i] = hit;
+		count += hit;
+	}
+	return count;
+}
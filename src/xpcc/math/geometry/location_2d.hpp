@@ -36,6 +36,7 @@
 #include <xpcc/io/iostream.hpp>
 
 #include "angle.hpp"
+#include "fixed_angle.hpp"
 #include "vector.hpp"
 
 namespace xpcc
@@ -109,6 +110,23 @@ namespace xpcc
 		void
 		move(T x, float phi);
 		
+		/**
+		 * \brief	Add a increment only in x-direction without libm calls
+		 * 
+		 * Same as move(T, float) but uses the table based sine and cosine
+		 * of FixedAngle. The orientation is additionally stored as
+		 * FixedAngle, which is used and updated here without any
+		 * conversion or normalization. It is quantized to steps of about
+		 * 0.0055 degree.
+		 * 
+		 * Much faster than move(T, float) on controllers without an FPU.
+		 * 
+		 * \param	x		movement in x-direction
+		 * \param	phi		rotation
+		 */
+		void
+		move(T x, FixedAngle phi);
+		
 		/// TODO
 		Vector<T, 2>
 		translated(const Vector<T, 2>& vector) const;
@@ -131,6 +149,7 @@ namespace xpcc
 		
 		Vector<T, 2> position;
 		float orientation;
+		FixedAngle fixedOrientation;
 	};
 	
 	// ------------------------------------------------------------------------
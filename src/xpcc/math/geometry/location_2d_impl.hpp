@@ -38,7 +38,7 @@
 // -----------------------------------------------------------------------------
 template <typename T>
 xpcc::Location2D<T>::Location2D() :
-	position(), orientation()
+	position(), orientation(), fixedOrientation()
 {
 }
 
@@ -46,14 +46,16 @@ template <typename T>
 xpcc::Location2D<T>::Location2D(const Vector<T, 2>& position,
 		const float& orientation) :
 	position(position),
-	orientation(orientation)
+	orientation(orientation),
+	fixedOrientation(FixedAngle::fromRadian(orientation))
 {
 }
 
 template <typename T>
 xpcc::Location2D<T>::Location2D(const T& x, const T& y, const float& orientation) :
 	position(x, y),
-	orientation(orientation)
+	orientation(orientation),
+	fixedOrientation(FixedAngle::fromRadian(orientation))
 {
 }
 
@@ -105,6 +107,7 @@ void
 xpcc::Location2D<T>::setOrientation(const float& orientation)
 {
 	this->orientation = orientation;
+	this->fixedOrientation = FixedAngle::fromRadian(orientation);
 }
 
 // -----------------------------------------------------------------------------
@@ -116,7 +119,7 @@ xpcc::Location2D<T>::move(const Location2D<T>& diff)
 	movement.rotate(this->orientation);
 	
 	this->position.translate(movement);
-	this->orientation = Angle::normalize(this->orientation + diff.orientation);
+	this->setOrientation(Angle::normalize(this->orientation + diff.orientation));
 }
 
 template <typename T>
@@ -137,7 +140,24 @@ xpcc::Location2D<T>::move(T x, float phi)
 					   GeometricTraits<T>::round(x * std::sin(this->orientation)));
 	position.translate(vector);
 	
-	this->orientation = Angle::normalize(this->orientation + phi);
+	this->setOrientation(Angle::normalize(this->orientation + phi));
+}
+
+template <typename T>
+void
+xpcc::Location2D<T>::move(T x, FixedAngle phi)
+{
+	int16_t s;
+	int16_t c;
+	this->fixedOrientation.sinCos(&s, &c);
+	
+	Vector<T, 2> vector(FixedAngle::multiply<T>(x, c),
+					   FixedAngle::multiply<T>(x, s));
+	position.translate(vector);
+	
+	// wraps around, no normalization necessary
+	this->fixedOrientation += phi;
+	this->orientation = this->fixedOrientation.toRadian();
 }
 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,195 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_ARRAY_2D_HPP
+#define XPCC__POINT_ARRAY_2D_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+
+namespace xpcc
+{
+	// forward declaration
+	template <typename T>
+	class Polygon2D;
+
+	/// \internal
+	namespace detail
+	{
+		/**
+		 * Branch free version of Vector<T, 2>::ccw() for the batch kernels.
+		 * Gives exactly the same results, but the compiler is able to
+		 * vectorize loops containing it.
+		 */
+		template <typename T>
+		inline int_fast8_t
+		ccw2D(T ax, T ay, T bx, T by, T cx, T cy)
+		{
+			typedef typename GeometricTraits<T>::WideType WideType;
+
+			const WideType dx1 = WideType(bx) - WideType(ax);
+			const WideType dy1 = WideType(by) - WideType(ay);
+			const WideType dx2 = WideType(cx) - WideType(ax);
+			const WideType dy2 = WideType(cy) - WideType(ay);
+
+			const WideType d1 = dx1 * dy2;
+			const WideType d2 = dy1 * dx2;
+
+			// collinear points
+			const int_fast8_t collinear =
+					((dx1 * dx2 < 0) | (dy1 * dy2 < 0)) ? -1 :
+					(((dx1 * dx1 + dy1 * dy1) >= (dx2 * dx2 + dy2 * dy2)) ? 0 : 1);
+
+			return (d1 > d2) ? 1 : ((d1 < d2) ? -1 : collinear);
+		}
+	}
+
+	/**
+	 * \brief	Fixed capacity point container with structure-of-arrays layout
+	 *
+	 * Stores all x- and all y-coordinates in two separate arrays. Compared
+	 * to PointSet2D (an array of Vector<T, 2>) this allows the compiler to
+	 * vectorize the batch operations below, which process all points of
+	 * the container with one call. No memory is allocated.
+	 *
+	 * \code
+	 * xpcc::PointArray2D<float, 1024> points;
+	 * points.append(xpcc::Vector2f(10, 20));
+	 * ...
+	 *
+	 * bool inside[1024];
+	 * std::size_t count = points.isInside(polygon, inside);
+	 * \endcode
+	 *
+	 * \tparam	T	Coordinate type
+	 * \tparam	N	Maximum number of points
+	 *
+	 * \see		LineSegmentArray2D
+	 * \ingroup	geometry
+	 */
+	template <typename T, std::size_t N>
+	class PointArray2D
+	{
+	public:
+		using SizeType = std::size_t;
+		using PointType = Vector<T, 2>;
+
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	public:
+		PointArray2D();
+
+		/// Number of points contained in the array
+		inline SizeType
+		getNumberOfPoints() const
+		{
+			return size;
+		}
+
+		static constexpr SizeType
+		getCapacity()
+		{
+			return N;
+		}
+
+		inline bool
+		isFull() const
+		{
+			return (size >= N);
+		}
+
+		/**
+		 * \brief	Append a point
+		 * \return	\c false if the array is full
+		 */
+		bool
+		append(const PointType& point);
+
+		/// Replace the point at position \p index
+		void
+		set(SizeType index, const PointType& point);
+
+		/// Get the point at position \p index
+		inline PointType
+		operator [](SizeType index) const
+		{
+			return PointType(x[index], y[index]);
+		}
+
+		/// Remove all points
+		inline void
+		removeAll()
+		{
+			size = 0;
+		}
+
+		/// Access to the raw x-coordinates
+		inline const T*
+		getX() const
+		{
+			return x;
+		}
+
+		/// Access to the raw y-coordinates
+		inline const T*
+		getY() const
+		{
+			return y;
+		}
+
+		/**
+		 * \brief	Check for every point if it is inside a polygon
+		 *
+		 * Same semantics as Polygon2D::isInside(), the borders of the
+		 * polygon are included.
+		 *
+		 * \warning	Only works for convex polygons!
+		 *
+		 * \param[out]	result	\c true for every point inside of the
+		 * 						polygon, needs space for
+		 * 						getNumberOfPoints() elements.
+		 * \return	Number of points inside of the polygon
+		 */
+		SizeType
+		isInside(const Polygon2D<T>& polygon, bool* result) const;
+
+		/**
+		 * \brief	Closest point on the polyline formed by the points
+		 *
+		 * Point \c i is connected to point \c i+1, the polyline is not
+		 * closed. An array with only one point returns that point.
+		 *
+		 * \param	point			Query point
+		 * \param[out]	segment		Index of the first point of the
+		 * 							closest segment, may be \c nullptr.
+		 */
+		PointType
+		getClosestPolylinePointTo(const PointType& point,
+				SizeType* segment = nullptr) const;
+
+	protected:
+		/// Number of points processed at once by the batch operations
+		static constexpr SizeType BlockSize = 64;
+
+		SizeType size;
+
+		T x[N];
+		T y[N];
+	};
+}
+
+#include "polygon_2d.hpp"
+
+#include "point_array_2d_impl.hpp"
+
+#endif // XPCC__POINT_ARRAY_2D_HPP
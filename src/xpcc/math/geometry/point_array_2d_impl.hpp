@@ -0,0 +1,189 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_ARRAY_2D_HPP
+	#error	"Don't include this file directly, use 'point_array_2d.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+constexpr std::size_t xpcc::PointArray2D<T, N>::BlockSize;
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+xpcc::PointArray2D<T, N>::PointArray2D() :
+	size(0)
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+bool
+xpcc::PointArray2D<T, N>::append(const PointType& point)
+{
+	if (size >= N) {
+		return false;
+	}
+
+	x[size] = point.x;
+	y[size] = point.y;
+	size++;
+	return true;
+}
+
+template <typename T, std::size_t N>
+void
+xpcc::PointArray2D<T, N>::set(SizeType index, const PointType& point)
+{
+	x[index] = point.x;
+	y[index] = point.y;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+std::size_t
+xpcc::PointArray2D<T, N>::isInside(const Polygon2D<T>& polygon, bool* result) const
+{
+	// bit 0: left of an edge, bit 1: right of an edge, bit 2: collinear.
+	// Same width as the coordinates, so that the loop vectorizes well.
+	int32_t flags[BlockSize];
+	SizeType count = 0;
+
+	const SizeType n = polygon.getNumberOfPoints();
+	for (SizeType offset = 0; offset < size; offset += BlockSize)
+	{
+		const SizeType length = (size - offset < BlockSize) ? (size - offset) : BlockSize;
+		const T* px = &x[offset];
+		const T* py = &y[offset];
+
+		for (SizeType i = 0; i < length; ++i) {
+			flags[i] = 0;
+		}
+
+		for (SizeType k = 0; k < n; ++k)
+		{
+			// local copies, the compiler can't know that the flag
+			// arrays don't overlap with the polygon
+			const WideType ax = polygon[k].x;
+			const WideType ay = polygon[k].y;
+			const WideType ex = WideType(polygon[(k + 1) % n].x) - ax;
+			const WideType ey = WideType(polygon[(k + 1) % n].y) - ay;
+
+			for (SizeType i = 0; i < length; ++i)
+			{
+				// see Vector<T, 2>::ccw()
+				const WideType d1 = ex * (WideType(py[i]) - ay);
+				const WideType d2 = ey * (WideType(px[i]) - ax);
+
+				flags[i] |= int32_t(d1 > d2) | (int32_t(d1 < d2) << 1) | (int32_t(d1 == d2) << 2);
+			}
+		}
+
+		for (SizeType i = 0; i < length; ++i)
+		{
+			bool inside = ((flags[i] & 3) != 3);
+			if (flags[i] & 4)
+			{
+				// the point lies on the line through one of the edges,
+				// use the exact orientation test including the borders
+				bool cw = true;
+				bool ccw = true;
+				inside = false;
+				for (SizeType k = 0; k < n; ++k)
+				{
+					const PointType& a = polygon[k];
+					const PointType& b = polygon[(k + 1) % n];
+					int_fast8_t r = detail::ccw2D(a.x, a.y, b.x, b.y, px[i], py[i]);
+					if (r == 0) {
+						inside = true;
+						break;
+					}
+					cw = cw && (r != 1);
+					ccw = ccw && (r != -1);
+				}
+				inside = inside || cw || ccw;
+			}
+			result[offset + i] = inside;
+			count += inside;
+		}
+	}
+
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N>
+typename xpcc::PointArray2D<T, N>::PointType
+xpcc::PointArray2D<T, N>::getClosestPolylinePointTo(const PointType& point,
+		SizeType* segment) const
+{
+	FloatType distance[BlockSize];
+	FloatType parameter[BlockSize];
+
+	const FloatType qx = point.x;
+	const FloatType qy = point.y;
+
+	SizeType bestIndex = 0;
+	FloatType bestDistance = 0;
+	FloatType bestParameter = 0;
+	bool found = false;
+
+	const SizeType segments = (size > 1) ? (size - 1) : 0;
+	for (SizeType offset = 0; offset < segments; offset += BlockSize)
+	{
+		const SizeType length = (segments - offset < BlockSize) ? (segments - offset) : BlockSize;
+		const T* px = &x[offset];
+		const T* py = &y[offset];
+
+		for (SizeType i = 0; i < length; ++i)
+		{
+			const FloatType ax = px[i];
+			const FloatType ay = py[i];
+			const FloatType dx = FloatType(px[i + 1]) - ax;
+			const FloatType dy = FloatType(py[i + 1]) - ay;
+
+			const FloatType c1 = (qx - ax) * dx + (qy - ay) * dy;
+			const FloatType c2 = dx * dx + dy * dy;
+
+			// clamp the position on the segment to [0, 1]
+			FloatType t = (c1 <= 0) ? FloatType(0) : ((c2 <= c1) ? FloatType(1) : (c1 / c2));
+
+			const FloatType ex = ax + t * dx - qx;
+			const FloatType ey = ay + t * dy - qy;
+
+			parameter[i] = t;
+			distance[i] = ex * ex + ey * ey;
+		}
+
+		for (SizeType i = 0; i < length; ++i)
+		{
+			if (!found || distance[i] < bestDistance)
+			{
+				found = true;
+				bestDistance = distance[i];
+				bestParameter = parameter[i];
+				bestIndex = offset + i;
+			}
+		}
+	}
+
+	if (segment != nullptr) {
+		*segment = bestIndex;
+	}
+
+	if (!found) {
+		return (size > 0) ? (*this)[0] : PointType();
+	}
+
+	const FloatType ax = x[bestIndex];
+	const FloatType ay = y[bestIndex];
+	return PointType(
+			GeometricTraits<T>::round(ax + bestParameter * (FloatType(x[bestIndex + 1]) - ax)),
+			GeometricTraits<T>::round(ay + bestParameter * (FloatType(y[bestIndex + 1]) - ay)));
+}
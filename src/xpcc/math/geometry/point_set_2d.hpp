@@ -31,7 +31,7 @@
 #ifndef XPCC__POINT_SET_2D_HPP
 #define XPCC__POINT_SET_2D_HPP
 
-#include <xpcc/container/dynamic_array.hpp>
+#include <xpcc/container/small_array.hpp>
 #include "vector.hpp"
 
 namespace xpcc
@@ -42,9 +42,10 @@ namespace xpcc
 	 * Collection of points, represented by their corresponding vectors.
 	 * Used for example to hold the result of a intersection-operation.
 	 * 
-	 * Based on the xpcc::DynamicArray class, therefore grows automatically
-	 * if more space than currently allocated is needed. But because this
-	 * is an expensive operation it should be avoid if possible.
+	 * Based on the xpcc::SmallArray class, the first 8 points are stored
+	 * inside of the object without a heap allocation. Grows automatically
+	 * if more space is needed. But because this is an expensive operation
+	 * it should be avoid if possible.
 	 * 
 	 * \author	Fabian Greif
 	 * \ingroup	geometry
@@ -56,6 +57,9 @@ namespace xpcc
 		using SizeType = std::size_t;
 		using PointType = Vector<T, 2>;
 
+		/// Number of points stored without a heap allocation
+		static constexpr std::size_t inlinePoints = 8;
+
 	public:
 		/**
 		 * \brief	Constructs a set capable of holding n points (default = 2)
@@ -65,9 +69,14 @@ namespace xpcc
 		PointSet2D(std::initializer_list<PointType> init);
 
 		PointSet2D(const PointSet2D& other);
+
+		PointSet2D(PointSet2D&& other);
 		
 		PointSet2D&
 		operator = (const PointSet2D& other);
+
+		PointSet2D&
+		operator = (PointSet2D&& other);
 		
 		/// Number of points contained in the set
 		inline SizeType
@@ -90,8 +99,8 @@ namespace xpcc
 		removeAll();
 		
 	public:
-		typedef typename xpcc::DynamicArray< PointType >::iterator iterator;
-		typedef typename xpcc::DynamicArray< PointType >::const_iterator const_iterator;
+		typedef typename xpcc::SmallArray< PointType, inlinePoints >::iterator iterator;
+		typedef typename xpcc::SmallArray< PointType, inlinePoints >::const_iterator const_iterator;
 		
 		inline iterator
 		begin();
@@ -106,7 +115,7 @@ namespace xpcc
 		end() const;
 		
 	protected:
-		xpcc::DynamicArray< PointType > points;
+		xpcc::SmallArray< PointType, inlinePoints > points;
 	};
 }
 
@@ -51,6 +51,12 @@ xpcc::PointSet2D<T>::PointSet2D(const PointSet2D<T>& other) :
 {
 }
 
+template <typename T>
+xpcc::PointSet2D<T>::PointSet2D(PointSet2D<T>&& other) :
+	points(static_cast<SmallArray< PointType, inlinePoints >&&>(other.points))
+{
+}
+
 template <typename T>
 xpcc::PointSet2D<T>&
 xpcc::PointSet2D<T>::operator = (const PointSet2D<T>& other)
@@ -59,6 +65,14 @@ xpcc::PointSet2D<T>::operator = (const PointSet2D<T>& other)
 	return *this;
 }
 
+template <typename T>
+xpcc::PointSet2D<T>&
+xpcc::PointSet2D<T>::operator = (PointSet2D<T>&& other)
+{
+	this->points = static_cast<SmallArray< PointType, inlinePoints >&&>(other.points);
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 typename xpcc::PointSet2D<T>::SizeType
@@ -69,9 +69,14 @@ namespace xpcc
 		Polygon2D(std::initializer_list<PointType> init);
 
 		Polygon2D(const Polygon2D& other);
+
+		Polygon2D(Polygon2D&& other);
 		
 		Polygon2D&
 		operator = (const Polygon2D& other);
+
+		Polygon2D&
+		operator = (Polygon2D&& other);
 		
 		/// append a point to the polygon
 		Polygon2D&
@@ -45,6 +45,12 @@ xpcc::Polygon2D<T>::Polygon2D(const Polygon2D<T>& other) :
 {
 }
 
+template <typename T>
+xpcc::Polygon2D<T>::Polygon2D(Polygon2D<T>&& other) :
+	PointSet2D<T>(static_cast<PointSet2D<T>&&>(other))
+{
+}
+
 template <typename T>
 xpcc::Polygon2D<T>::Polygon2D(std::initializer_list<xpcc::Polygon2D<T>::PointType> init) :
 	PointSet2D<T>(init)
@@ -59,6 +65,14 @@ xpcc::Polygon2D<T>::operator = (const Polygon2D<T>& other)
 	return *this;
 }
 
+template <typename T>
+xpcc::Polygon2D<T>&
+xpcc::Polygon2D<T>::operator = (Polygon2D<T>&& other)
+{
+	PointSet2D<T>::operator = (static_cast<PointSet2D<T>&&>(other));
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 xpcc::Polygon2D<T>&
@@ -0,0 +1,161 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SHAPE_2D_HPP
+#define XPCC__SHAPE_2D_HPP
+
+#include <stdint.h>
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+#include "bounding_box_2d.hpp"
+
+namespace xpcc
+{
+	// forward declaration
+	template <typename T>
+	class Circle2D;
+
+	template <typename T>
+	class LineSegment2D;
+
+	template <typename T>
+	class Polygon2D;
+
+	/**
+	 * \brief	Reference to a line segment, circle or polygon
+	 *
+	 * Common interface for the shapes stored in a spatial index. The
+	 * shape itself is not copied, it has to stay valid as long as the
+	 * reference is used. If the shape is moved, the index has to be
+	 * notified with \c update().
+	 *
+	 * Polygons are treated as filled areas (any simple polygon, not only
+	 * convex ones), a point inside of a polygon has distance zero to it.
+	 * The same holds for circles.
+	 *
+	 * \see		SpatialGrid2D
+	 * \see		AabbTree2D
+	 * \ingroup	geometry
+	 */
+	template <typename T>
+	class Shape2D
+	{
+	public:
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+		enum class
+		Type : uint8_t
+		{
+			None,
+			LineSegment,
+			Circle,
+			Polygon,
+		};
+
+	public:
+		/// Reference to no shape
+		Shape2D();
+
+		Shape2D(const LineSegment2D<T>& segment);
+
+		Shape2D(const Circle2D<T>& circle);
+
+		Shape2D(const Polygon2D<T>& polygon);
+
+		inline Type
+		getType() const
+		{
+			return type;
+		}
+
+		/// \c nullptr if the shape is not a line segment
+		inline const LineSegment2D<T>*
+		getLineSegment() const
+		{
+			return (type == Type::LineSegment) ? segment : nullptr;
+		}
+
+		/// \c nullptr if the shape is not a circle
+		inline const Circle2D<T>*
+		getCircle() const
+		{
+			return (type == Type::Circle) ? circle : nullptr;
+		}
+
+		/// \c nullptr if the shape is not a polygon
+		inline const Polygon2D<T>*
+		getPolygon() const
+		{
+			return (type == Type::Polygon) ? polygon : nullptr;
+		}
+
+		BoundingBox2D<T>
+		getBoundingBox() const;
+
+		/// Shortest distance to a point, zero if the point is inside
+		FloatType
+		getDistanceTo(const Vector<T, 2>& point) const;
+
+		/**
+		 * \brief	First intersection with a ray
+		 *
+		 * The ray is given as \f$ origin + t \cdot direction \f$. Only
+		 * intersections with \f$ 0 \le t \le maxParameter \f$ are
+		 * reported.
+		 *
+		 * \param[out]	parameter	Smallest t at which the ray touches
+		 * 							the shape, zero if the origin is
+		 * 							inside of a circle or polygon.
+		 */
+		bool
+		intersects(const Vector<FloatType, 2>& origin,
+				const Vector<FloatType, 2>& direction,
+				FloatType maxParameter, FloatType* parameter) const;
+
+		bool
+		operator == (const Shape2D& other) const;
+
+		bool
+		operator != (const Shape2D& other) const;
+
+	protected:
+		static FloatType
+		getSegmentDistanceSquared(const Vector<T, 2>& point,
+				const Vector<T, 2>& start, const Vector<T, 2>& end);
+
+		static bool
+		intersectsSegment(const Vector<FloatType, 2>& origin,
+				const Vector<FloatType, 2>& direction,
+				const Vector<T, 2>& start, const Vector<T, 2>& end,
+				FloatType maxParameter, FloatType* parameter);
+
+		/// Even-odd rule, borders may be reported either way
+		bool
+		isInsidePolygon(FloatType x, FloatType y) const;
+
+	protected:
+		union
+		{
+			const LineSegment2D<T>* segment;
+			const Circle2D<T>* circle;
+			const Polygon2D<T>* polygon;
+		};
+		Type type;
+	};
+}
+
+#include "circle_2d.hpp"
+#include "line_segment_2d.hpp"
+#include "polygon_2d.hpp"
+
+#include "shape_2d_impl.hpp"
+
+#endif // XPCC__SHAPE_2D_HPP
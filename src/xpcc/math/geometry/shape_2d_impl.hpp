@@ -0,0 +1,334 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SHAPE_2D_HPP
+	#error	"Don't include this file directly, use 'shape_2d.hpp' instead!"
+#endif
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::Shape2D<T>::Shape2D() :
+	segment(nullptr), type(Type::None)
+{
+}
+
+template<typename T>
+xpcc::Shape2D<T>::Shape2D(const LineSegment2D<T>& segment) :
+	segment(&segment), type(Type::LineSegment)
+{
+}
+
+template<typename T>
+xpcc::Shape2D<T>::Shape2D(const Circle2D<T>& circle) :
+	circle(&circle), type(Type::Circle)
+{
+}
+
+template<typename T>
+xpcc::Shape2D<T>::Shape2D(const Polygon2D<T>& polygon) :
+	polygon(&polygon), type(Type::Polygon)
+{
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::BoundingBox2D<T>
+xpcc::Shape2D<T>::getBoundingBox() const
+{
+	switch (type)
+	{
+		case Type::LineSegment:
+		{
+			BoundingBox2D<T> box(segment->getStartPoint(), segment->getStartPoint());
+			box.extend(segment->getEndPoint());
+			return box;
+		}
+
+		case Type::Circle:
+		{
+			const Vector<T, 2>& center = circle->getCenter();
+			const T radius = circle->getRadius();
+			return BoundingBox2D<T>(
+					Vector<T, 2>(center.x - radius, center.y - radius),
+					Vector<T, 2>(center.x + radius, center.y + radius));
+		}
+
+		case Type::Polygon:
+		{
+			const std::size_t n = polygon->getNumberOfPoints();
+			if (n == 0) {
+				break;
+			}
+			BoundingBox2D<T> box((*polygon)[0], (*polygon)[0]);
+			for (std::size_t i = 1; i < n; ++i) {
+				box.extend((*polygon)[i]);
+			}
+			return box;
+		}
+
+		case Type::None:
+			break;
+	}
+	return BoundingBox2D<T>();
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::Shape2D<T>::FloatType
+xpcc::Shape2D<T>::getDistanceTo(const Vector<T, 2>& point) const
+{
+	switch (type)
+	{
+		case Type::LineSegment:
+			return std::sqrt(getSegmentDistanceSquared(point,
+					segment->getStartPoint(), segment->getEndPoint()));
+
+		case Type::Circle:
+		{
+			const FloatType dx = static_cast<FloatType>(point.x) -
+					static_cast<FloatType>(circle->getCenter().x);
+			const FloatType dy = static_cast<FloatType>(point.y) -
+					static_cast<FloatType>(circle->getCenter().y);
+			const FloatType distance = std::sqrt(dx * dx + dy * dy) -
+					static_cast<FloatType>(circle->getRadius());
+			return (distance > 0) ? distance : FloatType(0);
+		}
+
+		case Type::Polygon:
+		{
+			const std::size_t n = polygon->getNumberOfPoints();
+			if (n == 0) {
+				break;
+			}
+			if (isInsidePolygon(point.x, point.y)) {
+				return 0;
+			}
+
+			FloatType minimum = getSegmentDistanceSquared(point,
+					(*polygon)[n - 1], (*polygon)[0]);
+			for (std::size_t i = 1; i < n; ++i)
+			{
+				FloatType d = getSegmentDistanceSquared(point,
+						(*polygon)[i - 1], (*polygon)[i]);
+				if (d < minimum) {
+					minimum = d;
+				}
+			}
+			return std::sqrt(minimum);
+		}
+
+		case Type::None:
+			break;
+	}
+	return 0;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::Shape2D<T>::intersects(const Vector<FloatType, 2>& origin,
+		const Vector<FloatType, 2>& direction,
+		FloatType maxParameter, FloatType* parameter) const
+{
+	switch (type)
+	{
+		case Type::LineSegment:
+			return intersectsSegment(origin, direction,
+					segment->getStartPoint(), segment->getEndPoint(),
+					maxParameter, parameter);
+
+		case Type::Circle:
+		{
+			// solve |origin + t * direction - center| = radius
+			const FloatType fx = origin.x - static_cast<FloatType>(circle->getCenter().x);
+			const FloatType fy = origin.y - static_cast<FloatType>(circle->getCenter().y);
+			const FloatType radius = static_cast<FloatType>(circle->getRadius());
+
+			const FloatType c = fx * fx + fy * fy - radius * radius;
+			if (c <= 0) {
+				// origin is inside of the circle
+				*parameter = 0;
+				return true;
+			}
+
+			const FloatType a = direction.x * direction.x + direction.y * direction.y;
+			const FloatType b = fx * direction.x + fy * direction.y;
+			const FloatType discriminant = b * b - a * c;
+			if (a == 0 || discriminant < 0 || b > 0) {
+				// no intersection or circle behind the origin
+				return false;
+			}
+
+			const FloatType t = (-b - std::sqrt(discriminant)) / a;
+			if (t > maxParameter) {
+				return false;
+			}
+			*parameter = (t > 0) ? t : FloatType(0);
+			return true;
+		}
+
+		case Type::Polygon:
+		{
+			const std::size_t n = polygon->getNumberOfPoints();
+			if (n == 0) {
+				break;
+			}
+			if (isInsidePolygon(origin.x, origin.y)) {
+				*parameter = 0;
+				return true;
+			}
+
+			bool found = false;
+			for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+			{
+				FloatType t;
+				if (intersectsSegment(origin, direction,
+						(*polygon)[j], (*polygon)[i], maxParameter, &t))
+				{
+					// further intersections have to be closer
+					maxParameter = t;
+					*parameter = t;
+					found = true;
+				}
+			}
+			return found;
+		}
+
+		case Type::None:
+			break;
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::Shape2D<T>::operator == (const Shape2D& other) const
+{
+	return (type == other.type && segment == other.segment);
+}
+
+template<typename T>
+bool
+xpcc::Shape2D<T>::operator != (const Shape2D& other) const
+{
+	return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+typename xpcc::Shape2D<T>::FloatType
+xpcc::Shape2D<T>::getSegmentDistanceSquared(const Vector<T, 2>& point,
+		const Vector<T, 2>& start, const Vector<T, 2>& end)
+{
+	const FloatType ex = static_cast<FloatType>(end.x) - static_cast<FloatType>(start.x);
+	const FloatType ey = static_cast<FloatType>(end.y) - static_cast<FloatType>(start.y);
+	const FloatType px = static_cast<FloatType>(point.x) - static_cast<FloatType>(start.x);
+	const FloatType py = static_cast<FloatType>(point.y) - static_cast<FloatType>(start.y);
+
+	// parameter of the closest point on the segment
+	FloatType t = 0;
+	const FloatType lengthSquared = ex * ex + ey * ey;
+	if (lengthSquared > 0)
+	{
+		t = (px * ex + py * ey) / lengthSquared;
+		if (t < 0) {
+			t = 0;
+		}
+		else if (t > 1) {
+			t = 1;
+		}
+	}
+
+	const FloatType dx = px - t * ex;
+	const FloatType dy = py - t * ey;
+	return dx * dx + dy * dy;
+}
+
+template<typename T>
+bool
+xpcc::Shape2D<T>::intersectsSegment(const Vector<FloatType, 2>& origin,
+		const Vector<FloatType, 2>& direction,
+		const Vector<T, 2>& start, const Vector<T, 2>& end,
+		FloatType maxParameter, FloatType* parameter)
+{
+	// origin + t * direction = start + s * (end - start)
+	const FloatType ex = static_cast<FloatType>(end.x) - static_cast<FloatType>(start.x);
+	const FloatType ey = static_cast<FloatType>(end.y) - static_cast<FloatType>(start.y);
+	const FloatType wx = static_cast<FloatType>(start.x) - origin.x;
+	const FloatType wy = static_cast<FloatType>(start.y) - origin.y;
+
+	const FloatType denominator = direction.x * ey - direction.y * ex;
+	const FloatType w = wx * direction.y - wy * direction.x;
+	FloatType t;
+	if (denominator == 0)
+	{
+		if (w != 0) {
+			// parallel
+			return false;
+		}
+
+		// collinear, the closest end point (or the origin if it lies
+		// on the segment) is hit first
+		const FloatType lengthSquared = direction.x * direction.x + direction.y * direction.y;
+		if (lengthSquared == 0) {
+			return false;
+		}
+		FloatType t1 = (wx * direction.x + wy * direction.y) / lengthSquared;
+		FloatType t2 = ((wx + ex) * direction.x + (wy + ey) * direction.y) / lengthSquared;
+		if (t1 > t2) {
+			FloatType tmp = t1;
+			t1 = t2;
+			t2 = tmp;
+		}
+		if (t2 < 0) {
+			return false;
+		}
+		t = (t1 > 0) ? t1 : FloatType(0);
+	}
+	else
+	{
+		t = (wx * ey - wy * ex) / denominator;
+		const FloatType s = w / denominator;
+		if (t < 0 || s < 0 || s > 1) {
+			return false;
+		}
+	}
+
+	if (t > maxParameter) {
+		return false;
+	}
+	*parameter = t;
+	return true;
+}
+
+template<typename T>
+bool
+xpcc::Shape2D<T>::isInsidePolygon(FloatType x, FloatType y) const
+{
+	const std::size_t n = polygon->getNumberOfPoints();
+
+	bool inside = false;
+	for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+	{
+		const FloatType xi = static_cast<FloatType>((*polygon)[i].x);
+		const FloatType yi = static_cast<FloatType>((*polygon)[i].y);
+		const FloatType xj = static_cast<FloatType>((*polygon)[j].x);
+		const FloatType yj = static_cast<FloatType>((*polygon)[j].y);
+
+		if ((yi > y) != (yj > y) &&
+			x < (xj - xi) * (y - yi) / (yj - yi) + xi)
+		{
+			inside = !inside;
+		}
+	}
+	return inside;
+}
@@ -0,0 +1,244 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPATIAL_GRID_2D_HPP
+#define XPCC__SPATIAL_GRID_2D_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+#include "bounding_box_2d.hpp"
+#include "shape_2d.hpp"
+#include "ray_2d.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Uniform grid spatial index without dynamic memory
+	 *
+	 * Covers a fixed rectangular area (e.g. the playing field) with
+	 * Columns x Rows square cells. Every shape is registered in all cells
+	 * its bounding box overlaps. Queries then only test the shapes of the
+	 * cells they touch instead of all shapes.
+	 *
+	 * All memory is allocated statically. Shapes are not copied, only
+	 * referenced. After a shape has been moved or resized update() has to
+	 * be called.
+	 *
+	 * The cell size should be in the order of the typical shape size (or
+	 * query radius). Shapes covering many cells use up many entries.
+	 *
+	 * \code
+	 * // 3m x 2m field with 10cm cells, up to 64 obstacles
+	 * xpcc::SpatialGrid2D<int16_t, 30, 20, 64> grid(xpcc::Vector2i(0, 0), 100);
+	 *
+	 * auto handle = grid.insert(opponent);		// xpcc::Circle2D<int16_t>
+	 *
+	 * // check if the path from a to b is free
+	 * decltype(grid)::Hit hit;
+	 * bool blocked = grid.raycast(xpcc::Ray2D<int16_t>(a, b - a), 1.f, &hit);
+	 * \endcode
+	 *
+	 * \tparam	T			Coordinate type
+	 * \tparam	Columns		Number of cells in x-direction
+	 * \tparam	Rows		Number of cells in y-direction
+	 * \tparam	Capacity	Maximum number of shapes
+	 * \tparam	Entries		Maximum number of (shape, cell) pairs
+	 *
+	 * \see		AabbTree2D
+	 * \ingroup	geometry
+	 */
+	template <typename T,
+			  uint8_t Columns, uint8_t Rows,
+			  uint16_t Capacity, uint16_t Entries = 4 * Capacity>
+	class SpatialGrid2D
+	{
+	public:
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+		typedef uint16_t Handle;
+
+		/// Returned if a shape could not be inserted
+		static constexpr Handle Invalid = 0xffff;
+
+		struct Hit
+		{
+			Handle handle;
+
+			/// Distance from the ray origin or the query point
+			FloatType distance;
+		};
+
+	public:
+		/**
+		 * \param	origin		Lower left corner of the covered area
+		 * \param	cellSize	Edge length of the cells
+		 */
+		SpatialGrid2D(const Vector<T, 2>& origin, T cellSize);
+
+		/**
+		 * \brief	Add a shape to the index
+		 *
+		 * \return	Handle to the shape or \c Invalid if the shape is not
+		 * 			completely inside of the covered area or no space
+		 * 			is left.
+		 */
+		Handle
+		insert(const Shape2D<T>& shape);
+
+		void
+		remove(Handle handle);
+
+		/**
+		 * \brief	Notify the index that a shape has been changed
+		 *
+		 * \return	\c false if the shape has left the covered area or
+		 * 			no space is left. The shape is removed in this case.
+		 */
+		bool
+		update(Handle handle);
+
+		/// Remove all shapes
+		void
+		removeAll();
+
+		inline const Shape2D<T>&
+		getShape(Handle handle) const
+		{
+			return objects[handle].shape;
+		}
+
+		inline std::size_t
+		getNumberOfShapes() const
+		{
+			return numberOfShapes;
+		}
+
+		/// Number of unused (shape, cell) pairs
+		inline std::size_t
+		getNumberOfFreeEntries() const
+		{
+			return numberOfFreeEntries;
+		}
+
+		/// Area covered by the grid
+		BoundingBox2D<T>
+		getBoundingBox() const;
+
+		/**
+		 * \brief	All shapes whose bounding box overlaps the area
+		 *
+		 * \param[out]	result		Handles of the shapes found
+		 * \param		maxResults	Size of \p result
+		 * \return	Number of shapes found, at most \p maxResults
+		 */
+		std::size_t
+		query(const BoundingBox2D<T>& area,
+				Handle* result, std::size_t maxResults) const;
+
+		/**
+		 * \brief	All shapes closer than \p radius to \p center
+		 *
+		 * Exact test, not only the bounding boxes are compared.
+		 */
+		std::size_t
+		query(const Vector<T, 2>& center, T radius,
+				Handle* result, std::size_t maxResults) const;
+
+		/**
+		 * \brief	Find the first shape hit by a ray
+		 *
+		 * \param	ray			Start point and direction
+		 * \param	maxLength	Maximum length in multiples of the
+		 * 						direction vector. With 1 the ray becomes
+		 * 						the line segment from the start point to
+		 * 						start + direction.
+		 */
+		bool
+		raycast(const Ray2D<T>& ray, FloatType maxLength, Hit* hit) const;
+
+		/**
+		 * \brief	Find the shape closest to a point
+		 *
+		 * \param	maxDistance		Shapes further away are ignored
+		 */
+		bool
+		getNearest(const Vector<T, 2>& point, FloatType maxDistance,
+				Hit* hit) const;
+
+	protected:
+		typedef uint16_t EntryIndex;
+
+		struct Object
+		{
+			Shape2D<T> shape;
+			BoundingBox2D<T> box;
+
+			// cells covered by the shape
+			uint8_t minColumn;
+			uint8_t minRow;
+			uint8_t maxColumn;
+			uint8_t maxRow;
+			Handle nextFree;
+		};
+
+		struct Entry
+		{
+			Handle object;
+			EntryIndex next;
+		};
+
+		/// Register the object in all cells it covers
+		bool
+		link(Handle handle);
+
+		void
+		unlink(Handle handle);
+
+		/// Cell containing the coordinate, clamped to the grid
+		uint8_t
+		getCell(FloatType coordinate, FloatType origin, uint8_t cells) const;
+
+		/// Shapes of the cells overlapping the area accepted by the filter
+		template<typename Filter>
+		std::size_t
+		queryArea(const BoundingBox2D<T>& area,
+				Handle* result, std::size_t maxResults, Filter filter) const;
+
+		/// Test all shapes of one cell against the ray
+		void
+		raycastCell(uint_fast16_t cell,
+				const Vector<FloatType, 2>& start,
+				const Vector<FloatType, 2>& direction,
+				FloatType* best, Handle* handle) const;
+
+	protected:
+		const Vector<T, 2> origin;
+		const T cellSize;
+
+		Object objects[Capacity];
+		Entry entries[Entries];
+
+		/// First entry for every cell
+		EntryIndex cells[Columns * Rows];
+
+		Handle freeObject;
+		EntryIndex freeEntry;
+
+		uint16_t numberOfShapes;
+		uint16_t numberOfFreeEntries;
+	};
+}
+
+#include "spatial_grid_2d_impl.hpp"
+
+#endif // XPCC__SPATIAL_GRID_2D_HPP
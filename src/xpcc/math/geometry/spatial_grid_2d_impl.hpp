@@ -0,0 +1,497 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPATIAL_GRID_2D_HPP
+	#error	"Don't include this file directly, use 'spatial_grid_2d.hpp' instead!"
+#endif
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+constexpr typename xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::Handle
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::Invalid;
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::SpatialGrid2D(
+		const Vector<T, 2>& origin, T cellSize) :
+	origin(origin), cellSize(cellSize)
+{
+	static_assert(Columns > 0 && Rows > 0, "The grid needs at least one cell!");
+	static_assert(Capacity > 0 && Capacity < Invalid, "Capacity must be between 1 and 65534!");
+	static_assert(Entries >= Capacity && Entries < 0xffff, "Entries must be between Capacity and 65534!");
+
+	removeAll();
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+void
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::removeAll()
+{
+	for (uint_fast16_t i = 0; i < Columns * Rows; ++i) {
+		cells[i] = 0xffff;
+	}
+
+	for (uint_fast16_t i = 0; i < Capacity; ++i) {
+		objects[i].shape = Shape2D<T>();
+		objects[i].nextFree = i + 1;
+	}
+	objects[Capacity - 1].nextFree = Invalid;
+	freeObject = 0;
+
+	for (uint_fast16_t i = 0; i < Entries; ++i) {
+		entries[i].next = i + 1;
+	}
+	entries[Entries - 1].next = 0xffff;
+	freeEntry = 0;
+
+	numberOfShapes = 0;
+	numberOfFreeEntries = Entries;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+typename xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::Handle
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::insert(const Shape2D<T>& shape)
+{
+	const Handle handle = freeObject;
+	if (handle == Invalid) {
+		return Invalid;
+	}
+
+	Object& object = objects[handle];
+	object.shape = shape;
+	object.box = shape.getBoundingBox();
+	if (!link(handle)) {
+		object.shape = Shape2D<T>();
+		return Invalid;
+	}
+
+	freeObject = object.nextFree;
+	++numberOfShapes;
+	return handle;
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+void
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::remove(Handle handle)
+{
+	unlink(handle);
+
+	Object& object = objects[handle];
+	object.shape = Shape2D<T>();
+	object.nextFree = freeObject;
+	freeObject = handle;
+	--numberOfShapes;
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+bool
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::update(Handle handle)
+{
+	Object& object = objects[handle];
+	const BoundingBox2D<T> box = object.shape.getBoundingBox();
+	if (box == object.box) {
+		return true;
+	}
+
+	unlink(handle);
+	object.box = box;
+	if (!link(handle))
+	{
+		object.shape = Shape2D<T>();
+		object.nextFree = freeObject;
+		freeObject = handle;
+		--numberOfShapes;
+		return false;
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+xpcc::BoundingBox2D<T>
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::getBoundingBox() const
+{
+	return BoundingBox2D<T>(origin,
+			Vector<T, 2>(origin.x + cellSize * Columns, origin.y + cellSize * Rows));
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+uint8_t
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::getCell(
+		FloatType coordinate, FloatType origin, uint8_t cells) const
+{
+	const FloatType cell = std::floor((coordinate - origin) / static_cast<FloatType>(cellSize));
+	if (cell < 0) {
+		return 0;
+	}
+	if (cell >= cells) {
+		return cells - 1;
+	}
+	return static_cast<uint8_t>(cell);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+bool
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::link(Handle handle)
+{
+	Object& object = objects[handle];
+	if (!getBoundingBox().contains(object.box)) {
+		return false;
+	}
+
+	object.minColumn = getCell(object.box.getMin().x, origin.x, Columns);
+	object.minRow = getCell(object.box.getMin().y, origin.y, Rows);
+	object.maxColumn = getCell(object.box.getMax().x, origin.x, Columns);
+	object.maxRow = getCell(object.box.getMax().y, origin.y, Rows);
+
+	const uint_fast16_t count =
+			(object.maxColumn - object.minColumn + 1) *
+			(object.maxRow - object.minRow + 1);
+	if (count > numberOfFreeEntries) {
+		return false;
+	}
+	numberOfFreeEntries -= count;
+
+	for (uint_fast8_t row = object.minRow; row <= object.maxRow; ++row)
+	{
+		for (uint_fast8_t column = object.minColumn; column <= object.maxColumn; ++column)
+		{
+			const EntryIndex index = freeEntry;
+			Entry& entry = entries[index];
+			freeEntry = entry.next;
+
+			EntryIndex& cell = cells[row * Columns + column];
+			entry.object = handle;
+			entry.next = cell;
+			cell = index;
+		}
+	}
+	return true;
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+void
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::unlink(Handle handle)
+{
+	const Object& object = objects[handle];
+	for (uint_fast8_t row = object.minRow; row <= object.maxRow; ++row)
+	{
+		for (uint_fast8_t column = object.minColumn; column <= object.maxColumn; ++column)
+		{
+			EntryIndex* previous = &cells[row * Columns + column];
+			while (*previous != 0xffff)
+			{
+				const EntryIndex index = *previous;
+				Entry& entry = entries[index];
+				if (entry.object == handle)
+				{
+					*previous = entry.next;
+					entry.next = freeEntry;
+					freeEntry = index;
+					++numberOfFreeEntries;
+					break;
+				}
+				previous = &entry.next;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+std::size_t
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::query(
+		const BoundingBox2D<T>& area, Handle* result, std::size_t maxResults) const
+{
+	return queryArea(area, result, maxResults,
+			[](const Object&) { return true; });
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+std::size_t
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::query(
+		const Vector<T, 2>& center, T radius,
+		Handle* result, std::size_t maxResults) const
+{
+	BoundingBox2D<T> area(center, center);
+	area.inflate(radius);
+
+	return queryArea(area, result, maxResults,
+			[&center, radius](const Object& object) {
+				return (object.shape.getDistanceTo(center) <= radius);
+			});
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+template<typename Filter>
+std::size_t
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::queryArea(
+		const BoundingBox2D<T>& area, Handle* result, std::size_t maxResults,
+		Filter filter) const
+{
+	if (!getBoundingBox().intersects(area)) {
+		return 0;
+	}
+
+	const uint8_t minColumn = getCell(area.getMin().x, origin.x, Columns);
+	const uint8_t minRow = getCell(area.getMin().y, origin.y, Rows);
+	const uint8_t maxColumn = getCell(area.getMax().x, origin.x, Columns);
+	const uint8_t maxRow = getCell(area.getMax().y, origin.y, Rows);
+
+	std::size_t count = 0;
+	for (uint_fast8_t row = minRow; row <= maxRow; ++row)
+	{
+		for (uint_fast8_t column = minColumn; column <= maxColumn; ++column)
+		{
+			EntryIndex index = cells[row * Columns + column];
+			while (index != 0xffff)
+			{
+				const Entry& entry = entries[index];
+				index = entry.next;
+
+				// A shape covering multiple cells is only reported in the
+				// first cell covered by both the shape and the area.
+				const Object& object = objects[entry.object];
+				if (column != ((object.minColumn > minColumn) ? object.minColumn : minColumn) ||
+					row != ((object.minRow > minRow) ? object.minRow : minRow)) {
+					continue;
+				}
+
+				if (object.box.intersects(area) && filter(object))
+				{
+					if (count >= maxResults) {
+						return count;
+					}
+					result[count++] = entry.object;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+bool
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::raycast(
+		const Ray2D<T>& ray, FloatType maxLength, Hit* hit) const
+{
+	const Vector<FloatType, 2> start(
+			static_cast<FloatType>(ray.getStartPoint().x),
+			static_cast<FloatType>(ray.getStartPoint().y));
+	const Vector<FloatType, 2> direction(
+			static_cast<FloatType>(ray.getDirectionVector().x),
+			static_cast<FloatType>(ray.getDirectionVector().y));
+	if (direction.x == 0 && direction.y == 0) {
+		return false;
+	}
+
+	// part of the ray inside of the grid
+	FloatType entry;
+	FloatType exit;
+	if (!getBoundingBox().intersects(start, direction, maxLength, &entry, &exit)) {
+		return false;
+	}
+
+	// Walk along the cells hit by the ray (Amanatides & Woo). A shape hit
+	// inside of the current cell can't be beaten by shapes in later cells.
+	int_fast16_t column = getCell(start.x + entry * direction.x, origin.x, Columns);
+	int_fast16_t row = getCell(start.y + entry * direction.y, origin.y, Rows);
+
+	const FloatType size = static_cast<FloatType>(cellSize);
+	const FloatType infinity = static_cast<FloatType>(INFINITY);
+
+	int_fast8_t stepColumn = 0;
+	FloatType nextColumn = infinity;
+	FloatType deltaColumn = infinity;
+	if (direction.x != 0)
+	{
+		stepColumn = (direction.x > 0) ? 1 : -1;
+		nextColumn = (static_cast<FloatType>(origin.x) +
+				(column + (stepColumn > 0)) * size - start.x) / direction.x;
+		deltaColumn = size / std::abs(direction.x);
+	}
+
+	int_fast8_t stepRow = 0;
+	FloatType nextRow = infinity;
+	FloatType deltaRow = infinity;
+	if (direction.y != 0)
+	{
+		stepRow = (direction.y > 0) ? 1 : -1;
+		nextRow = (static_cast<FloatType>(origin.y) +
+				(row + (stepRow > 0)) * size - start.y) / direction.y;
+		deltaRow = size / std::abs(direction.y);
+	}
+
+	FloatType best = maxLength;
+	Handle handle = Invalid;
+	while (true)
+	{
+		raycastCell(row * Columns + column, start, direction, &best, &handle);
+
+		const FloatType cellExit = (nextColumn < nextRow) ? nextColumn : nextRow;
+		if ((handle != Invalid && best <= cellExit) || cellExit > exit) {
+			break;
+		}
+
+		if (nextColumn < nextRow)
+		{
+			column += stepColumn;
+			nextColumn += deltaColumn;
+			if (column < 0 || column >= Columns) {
+				break;
+			}
+		}
+		else
+		{
+			row += stepRow;
+			nextRow += deltaRow;
+			if (row < 0 || row >= Rows) {
+				break;
+			}
+		}
+	}
+
+	if (handle == Invalid) {
+		return false;
+	}
+
+	hit->handle = handle;
+	hit->distance = best * std::sqrt(direction.x * direction.x + direction.y * direction.y);
+	return true;
+}
+
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+void
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::raycastCell(
+		uint_fast16_t cell,
+		const Vector<FloatType, 2>& start,
+		const Vector<FloatType, 2>& direction,
+		FloatType* best, Handle* handle) const
+{
+	EntryIndex index = cells[cell];
+	while (index != 0xffff)
+	{
+		const Entry& entry = entries[index];
+		index = entry.next;
+
+		const Object& object = objects[entry.object];
+		FloatType t;
+		if (object.box.intersects(start, direction, *best) &&
+			object.shape.intersects(start, direction, *best, &t) &&
+			(t < *best || *handle == Invalid))
+		{
+			*best = t;
+			*handle = entry.object;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t Columns, uint8_t Rows, uint16_t Capacity, uint16_t Entries>
+bool
+xpcc::SpatialGrid2D<T, Columns, Rows, Capacity, Entries>::getNearest(
+		const Vector<T, 2>& point, FloatType maxDistance, Hit* hit) const
+{
+	const FloatType x = static_cast<FloatType>(point.x);
+	const FloatType y = static_cast<FloatType>(point.y);
+	const FloatType size = static_cast<FloatType>(cellSize);
+	const FloatType originX = static_cast<FloatType>(origin.x);
+	const FloatType originY = static_cast<FloatType>(origin.y);
+
+	const int_fast16_t centerColumn = getCell(x, originX, Columns);
+	const int_fast16_t centerRow = getCell(y, originY, Rows);
+
+	FloatType best = maxDistance;
+	Handle handle = Invalid;
+
+	// Search the cells in rings of growing size around the cell of the
+	// point until the remaining cells are further away than the best
+	// shape found so far.
+	for (int_fast16_t ring = 0; ; ++ring)
+	{
+		const int_fast16_t minColumn = centerColumn - ring;
+		const int_fast16_t maxColumn = centerColumn + ring;
+		const int_fast16_t minRow = centerRow - ring;
+		const int_fast16_t maxRow = centerRow + ring;
+
+		for (int_fast16_t row = minRow; row <= maxRow; ++row)
+		{
+			if (row < 0 || row >= Rows) {
+				continue;
+			}
+
+			// only the border of the ring, the inside has been searched before
+			const int_fast16_t step = (row == minRow || row == maxRow) ? 1 : (maxColumn - minColumn);
+			for (int_fast16_t column = minColumn; column <= maxColumn; column += (step > 0) ? step : 1)
+			{
+				if (column < 0 || column >= Columns) {
+					continue;
+				}
+
+				const BoundingBox2D<T> cellBox(
+						Vector<T, 2>(origin.x + cellSize * column, origin.y + cellSize * row),
+						Vector<T, 2>(origin.x + cellSize * (column + 1), origin.y + cellSize * (row + 1)));
+				if (cellBox.getDistanceSquaredTo(point) > best * best) {
+					continue;
+				}
+
+				EntryIndex index = cells[row * Columns + column];
+				while (index != 0xffff)
+				{
+					const Entry& entry = entries[index];
+					index = entry.next;
+
+					const Object& object = objects[entry.object];
+					if (object.box.getDistanceSquaredTo(point) > best * best) {
+						continue;
+					}
+
+					const FloatType distance = object.shape.getDistanceTo(point);
+					if (distance < best || (handle == Invalid && distance <= best))
+					{
+						best = distance;
+						handle = entry.object;
+					}
+				}
+			}
+		}
+
+		if (minColumn <= 0 && maxColumn >= Columns - 1 &&
+			minRow <= 0 && maxRow >= Rows - 1) {
+			// all cells searched
+			break;
+		}
+
+		// distance from the point to the cells outside of the ring
+		FloatType bound = x - (originX + minColumn * size);
+		FloatType d = originX + (maxColumn + 1) * size - x;
+		if (d < bound) { bound = d; }
+		d = y - (originY + minRow * size);
+		if (d < bound) { bound = d; }
+		d = originY + (maxRow + 1) * size - y;
+		if (d < bound) { bound = d; }
+
+		if (bound > best) {
+			break;
+		}
+	}
+
+	if (handle == Invalid) {
+		return false;
+	}
+
+	hit->handle = handle;
+	hit->distance = best;
+	return true;
+}
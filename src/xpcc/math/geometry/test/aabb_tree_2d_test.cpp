@@ -0,0 +1,377 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/aabb_tree_2d.hpp>
+
+#include "aabb_tree_2d_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 1;
+
+	float
+	random(float min, float max)
+	{
+		seed = seed * 1103515245 + 12345;
+		return min + (max - min) * float((seed >> 8) & 0xffff) / 65535.f;
+	}
+
+	typedef xpcc::AabbTree2D<float> Tree;
+
+	/// Random obstacles on a 3000 x 2000 field
+	struct Scene
+	{
+		static constexpr uint16_t Circles = 200;
+		static constexpr uint16_t Segments = 200;
+		static constexpr uint16_t Polygons = 100;
+		static constexpr uint16_t Shapes = Circles + Segments + Polygons;
+
+		Scene() :
+			polygons(Polygons, xpcc::Polygon2D<float>(3))
+		{
+			for (uint16_t i = 0; i < Circles; ++i)
+			{
+				circles[i] = xpcc::Circle2D<float>(
+						xpcc::Vector2f(random(0, 3000), random(0, 2000)),
+						random(5, 80));
+				shapes[i] = circles[i];
+			}
+
+			for (uint16_t i = 0; i < Segments; ++i)
+			{
+				xpcc::Vector2f start(random(0, 3000), random(0, 2000));
+				xpcc::Vector2f end(start.x + random(-200, 200), start.y + random(-200, 200));
+				segments[i] = xpcc::LineSegment2D<float>(start, end);
+				shapes[Circles + i] = segments[i];
+			}
+
+			for (uint16_t i = 0; i < Polygons; ++i)
+			{
+				xpcc::Vector2f center(random(0, 3000), random(0, 2000));
+				polygons[i] << xpcc::Vector2f(center.x - random(10, 100), center.y - random(10, 100))
+							<< xpcc::Vector2f(center.x + random(10, 100), center.y - random(10, 100))
+							<< xpcc::Vector2f(center.x + random(-50, 50), center.y + random(10, 100));
+				shapes[Circles + Segments + i] = polygons[i];
+			}
+		}
+
+		xpcc::Circle2D<float> circles[Circles];
+		xpcc::LineSegment2D<float> segments[Segments];
+		xpcc::DynamicArray< xpcc::Polygon2D<float> > polygons;
+
+		xpcc::Shape2D<float> shapes[Shapes];
+	};
+
+	constexpr uint16_t Scene::Circles;
+	constexpr uint16_t Scene::Segments;
+	constexpr uint16_t Scene::Polygons;
+	constexpr uint16_t Scene::Shapes;
+
+	/**
+	 * Compare the results of all query types with a brute force search
+	 * over the shapes marked as active.
+	 */
+	class Checker
+	{
+	public:
+		Checker(const Tree& tree, const Scene& scene, const bool* active) :
+			tree(tree), scene(scene), active(active)
+		{
+		}
+
+		bool
+		checkArea(const xpcc::BoundingBox2D<float>& area)
+		{
+			for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+				expected[i] = active[i] && scene.shapes[i].getBoundingBox().intersects(area);
+			}
+			return compare(tree.query(area, result, Scene::Shapes));
+		}
+
+		bool
+		checkRadius(const xpcc::Vector2f& center, float radius)
+		{
+			for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+				expected[i] = active[i] && (scene.shapes[i].getDistanceTo(center) <= radius);
+			}
+			return compare(tree.query(center, radius, result, Scene::Shapes));
+		}
+
+		bool
+		checkRaycast(const xpcc::Ray2D<float>& ray, float maxLength)
+		{
+			bool found = false;
+			float best = maxLength;
+			for (uint16_t i = 0; i < Scene::Shapes; ++i)
+			{
+				float t;
+				if (active[i] && scene.shapes[i].intersects(ray.getStartPoint(),
+						ray.getDirectionVector(), best, &t)) {
+					found = true;
+					best = t;
+				}
+			}
+
+			Tree::Hit hit;
+			if (tree.raycast(ray, maxLength, &hit) != found) {
+				return false;
+			}
+			return (!found || std::abs(hit.distance - best * ray.getDirectionVector().getLength()) < 1e-2f);
+		}
+
+		bool
+		checkNearest(const xpcc::Vector2f& point, float maxDistance)
+		{
+			bool found = false;
+			float best = maxDistance;
+			for (uint16_t i = 0; i < Scene::Shapes; ++i)
+			{
+				float distance = scene.shapes[i].getDistanceTo(point);
+				if (active[i] && distance <= best) {
+					found = true;
+					best = distance;
+				}
+			}
+
+			Tree::Hit hit;
+			if (tree.getNearest(point, maxDistance, &hit) != found) {
+				return false;
+			}
+			return (!found || (hit.distance == best &&
+					tree.getShape(hit.handle).getDistanceTo(point) == best));
+		}
+
+		/// Run all checks with random parameters
+		void
+		checkAll(uint8_t iterations)
+		{
+			for (uint8_t n = 0; n < iterations; ++n)
+			{
+				xpcc::Vector2f min(random(-200, 3000), random(-200, 2000));
+				TEST_ASSERT_TRUE(checkArea(xpcc::BoundingBox2D<float>(min,
+						xpcc::Vector2f(min.x + random(0, 500), min.y + random(0, 500)))));
+
+				TEST_ASSERT_TRUE(checkRadius(
+						xpcc::Vector2f(random(-100, 3100), random(-100, 2100)),
+						random(0, 300)));
+
+				TEST_ASSERT_TRUE(checkRaycast(xpcc::Ray2D<float>(
+						xpcc::Vector2f(random(-500, 3500), random(-500, 2500)),
+						xpcc::Vector2f(random(-100, 100), random(-100, 100))),
+						random(0, 40)));
+
+				TEST_ASSERT_TRUE(checkNearest(
+						xpcc::Vector2f(random(-500, 3500), random(-500, 2500)),
+						random(0, 1000)));
+			}
+		}
+
+	protected:
+		bool
+		compare(std::size_t count)
+		{
+			std::size_t expectedCount = 0;
+			for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+				expectedCount += expected[i];
+			}
+			if (count != expectedCount) {
+				return false;
+			}
+
+			for (std::size_t k = 0; k < count; ++k)
+			{
+				bool found = false;
+				for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+					if (expected[i] && tree.getShape(result[k]) == scene.shapes[i]) {
+						found = true;
+					}
+				}
+				if (!found) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const Tree& tree;
+		const Scene& scene;
+		const bool* active;
+
+		bool expected[Scene::Shapes];
+		Tree::Handle result[Scene::Shapes];
+	};
+}
+
+void
+AabbTree2DTest::testInsertRemove()
+{
+	Tree tree;
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 0U);
+	TEST_ASSERT_EQUALS(tree.getHeight(), 0U);
+
+	Tree::Hit hit;
+	Tree::Handle result[4];
+	TEST_ASSERT_FALSE(tree.getNearest(xpcc::Vector2f(0, 0), 100.f, &hit));
+	TEST_ASSERT_EQUALS(tree.query(xpcc::Vector2f(0, 0), 100.f, result, 4), 0U);
+
+	xpcc::Circle2D<float> a(xpcc::Vector2f(0, 0), 10);
+	xpcc::Circle2D<float> b(xpcc::Vector2f(100, 0), 10);
+	auto handleA = tree.insert(a);
+	auto handleB = tree.insert(b);
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 2U);
+	TEST_ASSERT_EQUALS(tree.getHeight(), 2U);
+	TEST_ASSERT_TRUE(tree.getShape(handleA).getCircle() == &a);
+
+	TEST_ASSERT_TRUE(tree.getNearest(xpcc::Vector2f(80, 0), 100.f, &hit));
+	TEST_ASSERT_EQUALS(hit.handle, handleB);
+	TEST_ASSERT_EQUALS_FLOAT(hit.distance, 10.f);
+
+	TEST_ASSERT_TRUE(tree.raycast(xpcc::Ray2D<float>(xpcc::Vector2f(-50, 0),
+			xpcc::Vector2f(2, 0)), 100.f, &hit));
+	TEST_ASSERT_EQUALS(hit.handle, handleA);
+	TEST_ASSERT_EQUALS_FLOAT(hit.distance, 40.f);
+
+	tree.remove(handleA);
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 1U);
+	TEST_ASSERT_EQUALS(tree.getHeight(), 1U);
+
+	TEST_ASSERT_TRUE(tree.raycast(xpcc::Ray2D<float>(xpcc::Vector2f(-50, 0),
+			xpcc::Vector2f(2, 0)), 100.f, &hit));
+	TEST_ASSERT_EQUALS(hit.handle, handleB);
+	TEST_ASSERT_EQUALS_FLOAT(hit.distance, 140.f);
+
+	// nodes are reused
+	auto handleC = tree.insert(a);
+	TEST_ASSERT_TRUE(handleC == handleA || handleC < 3);
+
+	tree.removeAll();
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 0U);
+	TEST_ASSERT_FALSE(tree.getNearest(xpcc::Vector2f(80, 0), 100.f, &hit));
+}
+
+void
+AabbTree2DTest::testBalance()
+{
+	// sorted insertion would degenerate to a list without rotations
+	xpcc::DynamicArray< xpcc::Circle2D<float> > circles(1024);
+	for (uint16_t i = 0; i < 1024; ++i) {
+		circles.append(xpcc::Circle2D<float>(xpcc::Vector2f(i * 10, 0), 2));
+	}
+
+	Tree tree;
+	for (uint16_t i = 0; i < 1024; ++i) {
+		tree.insert(circles[i]);
+	}
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 1024U);
+	TEST_ASSERT_TRUE(tree.getHeight() <= 16U);
+
+	xpcc::DynamicArray< xpcc::Shape2D<float> > shapes(1024);
+	for (uint16_t i = 0; i < 1024; ++i) {
+		shapes.append(circles[i]);
+	}
+	tree.build(&shapes[0], 1024, nullptr);
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), 1024U);
+	TEST_ASSERT_EQUALS(tree.getHeight(), 11U);
+
+	Tree::Hit hit;
+	TEST_ASSERT_TRUE(tree.getNearest(xpcc::Vector2f(5000, 5), 100.f, &hit));
+	TEST_ASSERT_TRUE(tree.getShape(hit.handle).getCircle() == &circles[500]);
+	TEST_ASSERT_EQUALS_FLOAT(hit.distance, 3.f);
+}
+
+void
+AabbTree2DTest::testIncremental()
+{
+	Scene scene;
+	bool active[Scene::Shapes];
+	Tree::Handle handles[Scene::Shapes];
+
+	Tree tree;
+	for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+		handles[i] = tree.insert(scene.shapes[i]);
+		active[i] = true;
+	}
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), Scene::Shapes);
+
+	Checker checker(tree, scene, active);
+	checker.checkAll(50);
+
+	// remove every second shape
+	for (uint16_t i = 0; i < Scene::Shapes; i += 2) {
+		tree.remove(handles[i]);
+		active[i] = false;
+	}
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), Scene::Shapes / 2U);
+	checker.checkAll(50);
+}
+
+void
+AabbTree2DTest::testBuild()
+{
+	Scene scene;
+	bool active[Scene::Shapes];
+	Tree::Handle handles[Scene::Shapes];
+	for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+		active[i] = true;
+	}
+
+	Tree tree;
+	tree.build(scene.shapes, Scene::Shapes, handles);
+	TEST_ASSERT_EQUALS(tree.getNumberOfShapes(), Scene::Shapes);
+	TEST_ASSERT_EQUALS(tree.getHeight(), 10U);
+	for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+		TEST_ASSERT_TRUE(tree.getShape(handles[i]) == scene.shapes[i]);
+	}
+
+	Checker checker(tree, scene, active);
+	checker.checkAll(50);
+
+	// a built tree can be modified afterwards
+	for (uint16_t i = 0; i < Scene::Shapes; i += 3) {
+		tree.remove(handles[i]);
+		active[i] = false;
+	}
+	checker.checkAll(50);
+}
+
+void
+AabbTree2DTest::testUpdate()
+{
+	Scene scene;
+	bool active[Scene::Shapes];
+	Tree::Handle handles[Scene::Shapes];
+
+	Tree tree(20);
+	for (uint16_t i = 0; i < Scene::Shapes; ++i) {
+		handles[i] = tree.insert(scene.shapes[i]);
+		active[i] = true;
+	}
+
+	Checker checker(tree, scene, active);
+
+	// small movements stay inside of the enlarged boxes
+	uint16_t moved = 0;
+	for (uint16_t i = 0; i < Scene::Circles; ++i)
+	{
+		xpcc::Vector2f center = scene.circles[i].getCenter();
+		scene.circles[i].setCenter(xpcc::Vector2f(center.x + 5, center.y - 5));
+		moved += tree.update(handles[i]);
+	}
+	TEST_ASSERT_EQUALS(moved, 0U);
+	checker.checkAll(20);
+
+	for (uint16_t i = 0; i < Scene::Circles; ++i)
+	{
+		scene.circles[i].setCenter(xpcc::Vector2f(random(0, 3000), random(0, 2000)));
+		moved += tree.update(handles[i]);
+	}
+	TEST_ASSERT_TRUE(moved > Scene::Circles / 2);
+	checker.checkAll(50);
+}
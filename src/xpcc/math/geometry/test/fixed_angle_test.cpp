@@ -0,0 +1,357 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include <xpcc/math/geometry/fixed_angle.hpp>
+#include <xpcc/math/geometry/vector2.hpp>
+#include <xpcc/math/geometry/location_2d.hpp>
+
+#include "fixed_angle_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 1;
+
+	int32_t
+	randomValue()
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t high = seed & 0xffff0000;
+		seed = seed * 1103515245 + 12345;
+		return static_cast<int32_t>(high | (seed >> 16));
+	}
+
+	/// Difference of the result to the exact angle in steps of FixedAngle
+	double
+	getAngleError(xpcc::FixedAngle angle, int32_t y, int32_t x)
+	{
+		double exact = std::atan2(double(y), double(x)) * (32768.0 / M_PI);
+		double error = std::fabs(angle.getSigned() - exact);
+		if (error > 32768) {
+			// -Pi and Pi are the same angle
+			error = 65536 - error;
+		}
+		return error;
+	}
+
+	/// Difference of the result to the exact length relative to the allowed error
+	double
+	getLengthError(uint32_t length, int32_t x, int32_t y)
+	{
+		double exact = std::sqrt(double(x) * double(x) + double(y) * double(y));
+		return std::fabs(length - exact) / (1.0 + exact * std::ldexp(1.0, -24));
+	}
+}
+
+void
+FixedAngleTest::testConversion()
+{
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromRadian(0).getRaw(), 0);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromRadian(M_PI_2).getRaw(), 0x4000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromRadian(-M_PI_2).getRaw(), 0xc000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromRadian(M_PI).getRaw(), 0x8000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromRadian(-M_PI).getRaw(), 0x8000);
+
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromDegree(45).getRaw(), 0x2000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromDegree(-90).getSigned(), -16384);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::fromDegree(270).getSigned(), -16384);
+
+	TEST_ASSERT_EQUALS_FLOAT(xpcc::FixedAngle(0x4000).toRadian(), M_PI_2);
+	TEST_ASSERT_EQUALS_FLOAT(xpcc::FixedAngle(0xc000).toRadian(), -M_PI_2);
+	TEST_ASSERT_EQUALS_FLOAT(xpcc::FixedAngle(0x8000).toRadian(), -M_PI);
+	TEST_ASSERT_EQUALS_FLOAT(xpcc::FixedAngle(0x2000).toDegree(), 45.f);
+
+	// round trip
+	for (int32_t i = -180; i < 180; i += 7)
+	{
+		float radian = xpcc::toRadian(i);
+		TEST_ASSERT_EQUALS_DELTA(xpcc::FixedAngle::fromRadian(radian).toRadian(),
+				radian, 0.0001f);
+	}
+}
+
+void
+FixedAngleTest::testWrapAround()
+{
+	xpcc::FixedAngle a = xpcc::FixedAngle::fromDegree(135);
+	xpcc::FixedAngle b = xpcc::FixedAngle::fromDegree(90);
+
+	TEST_ASSERT_EQUALS((a + b), xpcc::FixedAngle::fromDegree(-135));
+	TEST_ASSERT_EQUALS((b - a), xpcc::FixedAngle::fromDegree(-45));
+	TEST_ASSERT_EQUALS(-a, xpcc::FixedAngle::fromDegree(-135));
+	TEST_ASSERT_EQUALS(-xpcc::FixedAngle(0x8000), xpcc::FixedAngle(0x8000));
+
+	a += b;
+	TEST_ASSERT_EQUALS(a, xpcc::FixedAngle::fromDegree(225));
+	a -= b;
+	TEST_ASSERT_EQUALS(a, xpcc::FixedAngle::fromDegree(135));
+	TEST_ASSERT_TRUE(a != b);
+}
+
+void
+FixedAngleTest::testSineSweep()
+{
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0).sin(), 0);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0x4000).sin(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0x8000).sin(), 0);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0xc000).sin(), -32767);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0).cos(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle(0x8000).cos(), -32767);
+
+	double maxSineError = 0;
+	double maxCosineError = 0;
+	bool consistent = true;
+	for (uint32_t raw = 0; raw < 65536; ++raw)
+	{
+		xpcc::FixedAngle angle(static_cast<uint16_t>(raw));
+		double phi = raw * (M_PI / 32768.0);
+
+		double error = std::fabs(angle.sin() - 32768.0 * std::sin(phi));
+		if (error > maxSineError) {
+			maxSineError = error;
+		}
+
+		error = std::fabs(angle.cos() - 32768.0 * std::cos(phi));
+		if (error > maxCosineError) {
+			maxCosineError = error;
+		}
+
+		int16_t s, c;
+		angle.sinCos(&s, &c);
+		if (s != angle.sin() || c != angle.cos()) {
+			consistent = false;
+		}
+	}
+
+	TEST_ASSERT_EQUALS_RANGE(maxSineError, 0.0, 2.0);
+	TEST_ASSERT_EQUALS_RANGE(maxCosineError, 0.0, 2.0);
+	TEST_ASSERT_TRUE(consistent);
+}
+
+void
+FixedAngleTest::testAtan2Sweep()
+{
+	double maxError = 0;
+
+	// small values, where the quantization of the input dominates
+	for (int32_t y = -300; y <= 300; y += 3)
+	{
+		for (int32_t x = -300; x <= 300; x += 5)
+		{
+			if (x == 0 && y == 0) {
+				continue;
+			}
+			double error = getAngleError(xpcc::FixedAngle::atan2(y, x), y, x);
+			if (error > maxError) {
+				maxError = error;
+			}
+		}
+	}
+
+	// full circle with different radii
+	const double radii[] = { 100.0, 30000.0, 2e6, 2e9 };
+	for (uint32_t raw = 0; raw < 65536; raw += 3)
+	{
+		double phi = raw * (M_PI / 32768.0);
+		for (double radius : radii)
+		{
+			int32_t x = static_cast<int32_t>(std::lround(radius * std::cos(phi)));
+			int32_t y = static_cast<int32_t>(std::lround(radius * std::sin(phi)));
+			double error = getAngleError(xpcc::FixedAngle::atan2(y, x), y, x);
+			if (error > maxError) {
+				maxError = error;
+			}
+		}
+	}
+
+	// random values of all magnitudes
+	for (uint32_t i = 0; i < 100000; ++i)
+	{
+		int32_t x = randomValue() >> (i % 31);
+		int32_t y = randomValue() >> ((i / 31) % 31);
+		if (x == 0 && y == 0) {
+			continue;
+		}
+		double error = getAngleError(xpcc::FixedAngle::atan2(y, x), y, x);
+		if (error > maxError) {
+			maxError = error;
+		}
+	}
+
+	TEST_ASSERT_EQUALS_RANGE(maxError, 0.0, 1.0);
+}
+
+void
+FixedAngleTest::testAtan2Special()
+{
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(0, 0).getRaw(), 0);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(0, 1).getRaw(), 0);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(1, 0).getRaw(), 0x4000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(0, -1).getRaw(), 0x8000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(-1, 0).getRaw(), 0xc000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(5, 5).getRaw(), 0x2000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(-7, -7).getRaw(), 0xa000);
+
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(INT32_MIN, 0).getRaw(), 0xc000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(0, INT32_MIN).getRaw(), 0x8000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(INT32_MIN, INT32_MIN).getRaw(), 0xa000);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::atan2(INT32_MAX, INT32_MAX).getRaw(), 0x2000);
+}
+
+void
+FixedAngleTest::testHypotSweep()
+{
+	double maxError = 0;
+
+	for (int32_t y = -300; y <= 300; y += 3)
+	{
+		for (int32_t x = -300; x <= 300; x += 5)
+		{
+			double error = getLengthError(xpcc::FixedAngle::hypot(x, y), x, y);
+			if (error > maxError) {
+				maxError = error;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < 100000; ++i)
+	{
+		int32_t x = randomValue() >> (i % 31);
+		int32_t y = randomValue() >> ((i / 31) % 31);
+		uint32_t length;
+		xpcc::FixedAngle angle = xpcc::FixedAngle::toPolar(x, y, &length);
+
+		double error = getLengthError(length, x, y);
+		if (error > maxError) {
+			maxError = error;
+		}
+		TEST_ASSERT_EQUALS(length, xpcc::FixedAngle::hypot(x, y));
+		TEST_ASSERT_EQUALS(angle, xpcc::FixedAngle::atan2(y, x));
+	}
+
+	// relative to the allowed error 1 + length * 2^-24
+	TEST_ASSERT_EQUALS_RANGE(maxError, 0.0, 1.0);
+}
+
+void
+FixedAngleTest::testHypotSpecial()
+{
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::hypot(0, 0), 0U);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::hypot(1, 0), 1U);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::hypot(0, -1), 1U);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::hypot(3, 4), 5U);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::hypot(-30000, 40000), 50000U);
+
+	// would overflow with x*x + y*y in 32 bit
+	TEST_ASSERT_EQUALS_DELTA(xpcc::FixedAngle::hypot(INT32_MIN, INT32_MIN),
+			3037000500U, 200U);
+	TEST_ASSERT_EQUALS_DELTA(xpcc::FixedAngle::hypot(INT32_MAX, 0),
+			2147483647U, 128U);
+}
+
+void
+FixedAngleTest::testMultiply()
+{
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiply<int16_t>(1000, 16384), 500);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiply<int16_t>(-1000, 16384), -500);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiply<int16_t>(32767, 32767), 32766);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiply<int32_t>(1000000000, -16384), -500000000);
+	TEST_ASSERT_EQUALS_FLOAT(xpcc::FixedAngle::multiply<float>(3.f, 16384), 1.5f);
+
+	// no overflow for the largest values
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiplyAdd<int16_t>(23170, 23170, 23170, 23170), 32767);
+	TEST_ASSERT_EQUALS(xpcc::FixedAngle::multiplyAdd<int16_t>(-32767, 32767, 0, 32767), -32766);
+}
+
+void
+FixedAngleTest::testVectorRotate()
+{
+	xpcc::Vector2i a(100, 0);
+	a.rotate(xpcc::FixedAngle::fromDegree(30));
+	TEST_ASSERT_EQUALS(a, xpcc::Vector2i(87, 50));
+
+	a.rotate(xpcc::FixedAngle::fromDegree(60));
+	TEST_ASSERT_EQUALS(a, xpcc::Vector2i(0, 100));
+
+	// sin(90 degree) is saturated to 32767, so the result might be one
+	// less than expected for large values
+	xpcc::Vector2i b(-20000, 15000);
+	b.rotate(xpcc::FixedAngle::fromDegree(-90));
+	TEST_ASSERT_EQUALS_DELTA(b.x, 15000, 1);
+	TEST_ASSERT_EQUALS_DELTA(b.y, 20000, 1);
+
+	// compare with the floating point version
+	for (uint32_t raw = 0; raw < 65536; raw += 97)
+	{
+		xpcc::FixedAngle angle(static_cast<uint16_t>(raw));
+
+		xpcc::Vector2i v(12345, -6789);
+		xpcc::Vector2i reference(v);
+		v.rotate(angle);
+		reference.rotate(angle.toRadian());
+
+		TEST_ASSERT_EQUALS_DELTA(v.x, reference.x, 1);
+		TEST_ASSERT_EQUALS_DELTA(v.y, reference.y, 1);
+
+		xpcc::Vector2f f(1.f, 0.f);
+		f.rotate(angle);
+		TEST_ASSERT_EQUALS_DELTA(f.x, std::cos(angle.toRadian()), 0.0001f);
+		TEST_ASSERT_EQUALS_DELTA(f.y, std::sin(angle.toRadian()), 0.0001f);
+	}
+}
+
+void
+FixedAngleTest::testVectorAngle()
+{
+	TEST_ASSERT_EQUALS(xpcc::Vector2i(100, 100).getFixedAngle(),
+			xpcc::FixedAngle::fromDegree(45));
+	TEST_ASSERT_EQUALS(xpcc::Vector2i(-100, 0).getFixedAngle(),
+			xpcc::FixedAngle::fromDegree(180));
+
+	xpcc::Vector2i v(-3000, 1234);
+	TEST_ASSERT_EQUALS_DELTA(v.getFixedAngle().toRadian(), v.getAngle(), 0.0001f);
+}
+
+void
+FixedAngleTest::testLocationMove()
+{
+	xpcc::Location2D<int16_t> location(xpcc::Vector2i(-200, 100), M_PI_2);
+
+	location.move(100, xpcc::FixedAngle::fromDegree(-90));
+	TEST_ASSERT_EQUALS(location.getPosition(), xpcc::Vector2i(-200, 200));
+	TEST_ASSERT_EQUALS_FLOAT(location.getOrientation(), 0.f);
+
+	location.move(50, xpcc::FixedAngle::fromDegree(45));
+	TEST_ASSERT_EQUALS(location.getPosition(), xpcc::Vector2i(-150, 200));
+	TEST_ASSERT_EQUALS_FLOAT(location.getOrientation(), M_PI_4);
+
+	// odometry: many small steps give the same result as the float version
+	xpcc::Location2D<float> fixed;
+	xpcc::Location2D<float> reference;
+	for (uint16_t i = 0; i < 1000; ++i)
+	{
+		fixed.move(2.f, xpcc::FixedAngle::fromRadian(0.01f));
+		reference.move(2.f, xpcc::FixedAngle::fromRadian(0.01f).toRadian());
+	}
+	TEST_ASSERT_EQUALS_DELTA(fixed.getX(), reference.getX(), 0.5f);
+	TEST_ASSERT_EQUALS_DELTA(fixed.getY(), reference.getY(), 0.5f);
+	TEST_ASSERT_EQUALS_DELTA(fixed.getOrientation(), reference.getOrientation(), 1e-4f);
+
+	// the fixed point orientation is summed up without rounding errors
+	const xpcc::FixedAngle sum(static_cast<uint16_t>(
+			1000 * xpcc::FixedAngle::fromRadian(0.01f).getRaw()));
+	TEST_ASSERT_EQUALS_FLOAT(fixed.getOrientation(), sum.toRadian());
+
+	// and is kept in sync with the float orientation
+	fixed.setOrientation(M_PI_2);
+	fixed.move(10.f, xpcc::FixedAngle());
+	TEST_ASSERT_EQUALS_DELTA(fixed.getY(), reference.getY() + 10.f, 0.5f);
+}
@@ -0,0 +1,48 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class FixedAngleTest : public unittest::TestSuite
+{
+public:
+	void
+	testConversion();
+
+	void
+	testWrapAround();
+
+	/// Compare sin() and cos() for all 65536 angles with libm
+	void
+	testSineSweep();
+
+	void
+	testAtan2Sweep();
+
+	void
+	testAtan2Special();
+
+	void
+	testHypotSweep();
+
+	void
+	testHypotSpecial();
+
+	void
+	testMultiply();
+
+	void
+	testVectorRotate();
+
+	void
+	testVectorAngle();
+
+	void
+	testLocationMove();
+};
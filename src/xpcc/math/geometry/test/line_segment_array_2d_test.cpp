@@ -0,0 +1,150 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/line_segment_array_2d.hpp>
+
+#include "line_segment_array_2d_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 7;
+
+	int16_t
+	random(int16_t range)
+	{
+		seed = seed * 1103515245 + 12345;
+		return int16_t((seed >> 16) % (2 * range + 1)) - range;
+	}
+
+	template <typename T, std::size_t N>
+	void
+	fill(xpcc::LineSegmentArray2D<T, N>& segments, int16_t range)
+	{
+		while (!segments.isFull())
+		{
+			xpcc::Vector<T, 2> start(random(range), random(range));
+			// short segments, some of them degenerated to a point
+			xpcc::Vector<T, 2> end(start.x + random(30), start.y + random(30));
+			segments.append(xpcc::LineSegment2D<T>(start, end));
+		}
+	}
+}
+
+void
+LineSegmentArray2DTest::testAppendAndAccess()
+{
+	xpcc::LineSegmentArray2D<int16_t, 2> segments;
+	TEST_ASSERT_EQUALS(segments.getNumberOfSegments(), 0U);
+
+	xpcc::LineSegment2D<int16_t> a(xpcc::Vector2i(1, 2), xpcc::Vector2i(3, 4));
+	xpcc::LineSegment2D<int16_t> b(xpcc::Vector2i(5, 6), xpcc::Vector2i(7, 8));
+
+	TEST_ASSERT_TRUE(segments.append(a));
+	TEST_ASSERT_TRUE(segments.append(b));
+	TEST_ASSERT_FALSE(segments.append(a));
+	TEST_ASSERT_EQUALS(segments.getNumberOfSegments(), 2U);
+
+	TEST_ASSERT_TRUE(segments[0] == a);
+	TEST_ASSERT_TRUE(segments[1] == b);
+
+	segments.set(1, a);
+	TEST_ASSERT_TRUE(segments[1] == a);
+
+	segments.removeAll();
+	TEST_ASSERT_EQUALS(segments.getNumberOfSegments(), 0U);
+}
+
+void
+LineSegmentArray2DTest::testIntersectionLineSegment()
+{
+	xpcc::LineSegmentArray2D<int16_t, 200> segments;
+	fill(segments, 60);
+
+	// includes collinear and touching cases
+	xpcc::LineSegment2D<int16_t> lines[3] = {
+		xpcc::LineSegment2D<int16_t>(xpcc::Vector2i(-50, -50), xpcc::Vector2i(50, 50)),
+		xpcc::LineSegment2D<int16_t>(xpcc::Vector2i(0, -60), xpcc::Vector2i(0, 60)),
+		xpcc::LineSegment2D<int16_t>(xpcc::Vector2i(5, 5), xpcc::Vector2i(5, 5)),
+	};
+
+	bool result[200];
+	for (const auto& line : lines)
+	{
+		std::size_t count = segments.intersects(line, result);
+		std::size_t expected = 0;
+		for (std::size_t i = 0; i < segments.getNumberOfSegments(); ++i)
+		{
+			bool r = segments[i].intersects(line);
+			expected += r;
+			TEST_ASSERT_EQUALS(result[i], r);
+		}
+		TEST_ASSERT_EQUALS(count, expected);
+	}
+}
+
+void
+LineSegmentArray2DTest::testIntersectionPolygon()
+{
+	xpcc::Polygon2D<int16_t> polygon {
+		xpcc::Vector2i(-50, -40), xpcc::Vector2i(40, -50),
+		xpcc::Vector2i(50, 30), xpcc::Vector2i(-20, 45) };
+	xpcc::Polygon2D<float> polygonF {
+		xpcc::Vector2f(-50, -40), xpcc::Vector2f(40, -50),
+		xpcc::Vector2f(50, 30), xpcc::Vector2f(-20, 45) };
+
+	xpcc::LineSegmentArray2D<int16_t, 300> segments;
+	fill(segments, 80);
+
+	xpcc::LineSegmentArray2D<float, 300> segmentsF;
+	for (std::size_t i = 0; i < segments.getNumberOfSegments(); ++i)
+	{
+		xpcc::LineSegment2D<int16_t> s = segments[i];
+		segmentsF.append(xpcc::LineSegment2D<float>(
+				xpcc::Vector2f(s.getStartPoint().x, s.getStartPoint().y),
+				xpcc::Vector2f(s.getEndPoint().x, s.getEndPoint().y)));
+	}
+
+	bool result[300];
+	bool resultF[300];
+	std::size_t count = segments.intersects(polygon, result);
+	std::size_t countF = segmentsF.intersects(polygonF, resultF);
+
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < segments.getNumberOfSegments(); ++i)
+	{
+		bool r = polygon.intersects(segments[i]);
+		expected += r;
+		TEST_ASSERT_EQUALS(result[i], r);
+		TEST_ASSERT_EQUALS(resultF[i], polygonF.intersects(segmentsF[i]));
+	}
+	TEST_ASSERT_TRUE(expected > 0);
+	TEST_ASSERT_EQUALS(count, expected);
+	TEST_ASSERT_EQUALS(countF, expected);
+}
+
+void
+LineSegmentArray2DTest::testIntersectionCircle()
+{
+	xpcc::LineSegmentArray2D<float, 4> segments;
+	// crossing, completely inside, outside, touching
+	segments.append(xpcc::LineSegment2D<float>(xpcc::Vector2f(-20, 0), xpcc::Vector2f(20, 0)));
+	segments.append(xpcc::LineSegment2D<float>(xpcc::Vector2f(-1, 1), xpcc::Vector2f(1, 1)));
+	segments.append(xpcc::LineSegment2D<float>(xpcc::Vector2f(20, 20), xpcc::Vector2f(30, 0)));
+	segments.append(xpcc::LineSegment2D<float>(xpcc::Vector2f(-10, 10), xpcc::Vector2f(10, 10)));
+
+	xpcc::Circle2D<float> circle(xpcc::Vector2f(0, 0), 10);
+
+	bool result[4];
+	TEST_ASSERT_EQUALS(segments.intersects(circle, result), 3U);
+	TEST_ASSERT_TRUE(result[0]);
+	TEST_ASSERT_TRUE(result[1]);
+	TEST_ASSERT_FALSE(result[2]);
+	TEST_ASSERT_TRUE(result[3]);
+}
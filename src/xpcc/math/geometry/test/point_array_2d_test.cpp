@@ -0,0 +1,154 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/point_array_2d.hpp>
+
+#include "point_array_2d_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 1;
+
+	int16_t
+	random(int16_t range)
+	{
+		seed = seed * 1103515245 + 12345;
+		return int16_t((seed >> 16) % (2 * range + 1)) - range;
+	}
+}
+
+void
+PointArray2DTest::testAppendAndAccess()
+{
+	xpcc::PointArray2D<int16_t, 2> points;
+
+	TEST_ASSERT_EQUALS(points.getNumberOfPoints(), 0U);
+	TEST_ASSERT_EQUALS(points.getCapacity(), 2U);
+
+	TEST_ASSERT_TRUE(points.append(xpcc::Vector2i(10, 20)));
+	TEST_ASSERT_TRUE(points.append(xpcc::Vector2i(30, 40)));
+	TEST_ASSERT_TRUE(points.isFull());
+	TEST_ASSERT_FALSE(points.append(xpcc::Vector2i(50, 60)));
+
+	TEST_ASSERT_EQUALS(points.getNumberOfPoints(), 2U);
+	TEST_ASSERT_EQUALS(points[0], xpcc::Vector2i(10, 20));
+	TEST_ASSERT_EQUALS(points[1], xpcc::Vector2i(30, 40));
+	TEST_ASSERT_EQUALS(points.getX()[1], 30);
+	TEST_ASSERT_EQUALS(points.getY()[1], 40);
+
+	points.set(0, xpcc::Vector2i(-1, -2));
+	TEST_ASSERT_EQUALS(points[0], xpcc::Vector2i(-1, -2));
+
+	points.removeAll();
+	TEST_ASSERT_EQUALS(points.getNumberOfPoints(), 0U);
+}
+
+void
+PointArray2DTest::testIsInside()
+{
+	xpcc::Polygon2D<int16_t> polygon {
+		xpcc::Vector2i(0, 0), xpcc::Vector2i(100, 0),
+		xpcc::Vector2i(100, 100), xpcc::Vector2i(0, 100) };
+
+	xpcc::PointArray2D<int16_t, 8> points;
+	points.append(xpcc::Vector2i(50, 50));
+	points.append(xpcc::Vector2i(0, 0));
+	points.append(xpcc::Vector2i(100, 50));
+	points.append(xpcc::Vector2i(101, 50));
+	points.append(xpcc::Vector2i(-10, -10));
+
+	bool result[8];
+	TEST_ASSERT_EQUALS(points.isInside(polygon, result), 3U);
+	TEST_ASSERT_TRUE(result[0]);
+	TEST_ASSERT_TRUE(result[1]);
+	TEST_ASSERT_TRUE(result[2]);
+	TEST_ASSERT_FALSE(result[3]);
+	TEST_ASSERT_FALSE(result[4]);
+}
+
+void
+PointArray2DTest::testIsInsideMatchesPolygon()
+{
+	xpcc::Polygon2D<int16_t> polygon {
+		xpcc::Vector2i(-50, -80), xpcc::Vector2i(70, -60),
+		xpcc::Vector2i(90, 40), xpcc::Vector2i(0, 95), xpcc::Vector2i(-85, 10) };
+	xpcc::Polygon2D<float> polygonF {
+		xpcc::Vector2f(-50, -80), xpcc::Vector2f(70, -60),
+		xpcc::Vector2f(90, 40), xpcc::Vector2f(0, 95), xpcc::Vector2f(-85, 10) };
+
+	// more points than one block to cover the block handling
+	xpcc::PointArray2D<int16_t, 150> points;
+	xpcc::PointArray2D<float, 150> pointsF;
+	while (!points.isFull())
+	{
+		xpcc::Vector2i p(random(120), random(120));
+		points.append(p);
+		pointsF.append(xpcc::Vector2f(p.x, p.y));
+	}
+
+	bool result[150];
+	bool resultF[150];
+	std::size_t count = points.isInside(polygon, result);
+	std::size_t countF = pointsF.isInside(polygonF, resultF);
+
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < points.getNumberOfPoints(); ++i)
+	{
+		bool inside = polygon.isInside(points[i]);
+		expected += inside;
+		TEST_ASSERT_EQUALS(result[i], inside);
+		TEST_ASSERT_EQUALS(resultF[i], polygonF.isInside(pointsF[i]));
+	}
+	TEST_ASSERT_EQUALS(count, expected);
+	TEST_ASSERT_EQUALS(countF, expected);
+}
+
+void
+PointArray2DTest::testClosestPolylinePoint()
+{
+	xpcc::PointArray2D<float, 100> polyline;
+
+	std::size_t segment = 42;
+	TEST_ASSERT_EQUALS(polyline.getClosestPolylinePointTo(xpcc::Vector2f(1, 1), &segment),
+			xpcc::Vector2f(0, 0));
+
+	polyline.append(xpcc::Vector2f(5, 5));
+	TEST_ASSERT_EQUALS(polyline.getClosestPolylinePointTo(xpcc::Vector2f(1, 1), &segment),
+			xpcc::Vector2f(5, 5));
+	TEST_ASSERT_EQUALS(segment, 0U);
+
+	polyline.removeAll();
+	for (uint_fast8_t i = 0; i < 100; ++i) {
+		polyline.append(xpcc::Vector2f(random(500), random(500)));
+	}
+
+	for (uint_fast8_t k = 0; k < 20; ++k)
+	{
+		xpcc::Vector2f point(random(600), random(600));
+
+		// brute force reference
+		float bestDistance = 1e30f;
+		xpcc::Vector2f bestPoint;
+		for (std::size_t i = 0; i < polyline.getNumberOfPoints() - 1; ++i)
+		{
+			xpcc::LineSegment2D<float> line(polyline[i], polyline[i + 1]);
+			float distance = line.getDistanceTo(point);
+			if (distance < bestDistance) {
+				bestDistance = distance;
+				bestPoint = line.getClosestPointTo(point);
+			}
+		}
+
+		xpcc::Vector2f result = polyline.getClosestPolylinePointTo(point, &segment);
+		TEST_ASSERT_EQUALS_DELTA(result.x, bestPoint.x, 1e-3f);
+		TEST_ASSERT_EQUALS_DELTA(result.y, bestPoint.y, 1e-3f);
+		TEST_ASSERT_TRUE(segment < polyline.getNumberOfPoints() - 1);
+	}
+}
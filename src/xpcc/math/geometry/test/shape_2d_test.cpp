@@ -0,0 +1,158 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/shape_2d.hpp>
+
+#include "shape_2d_test.hpp"
+
+void
+Shape2DTest::testBoundingBox()
+{
+	xpcc::BoundingBox2D<int16_t> box(xpcc::Vector2i(0, 0), xpcc::Vector2i(10, 20));
+
+	TEST_ASSERT_TRUE(box.contains(xpcc::Vector2i(10, 20)));
+	TEST_ASSERT_FALSE(box.contains(xpcc::Vector2i(11, 5)));
+	TEST_ASSERT_EQUALS(box.getPerimeter(), 60);
+
+	box.extend(xpcc::Vector2i(-5, 5));
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(-5, 0));
+
+	xpcc::BoundingBox2D<int16_t> other(xpcc::Vector2i(10, 20), xpcc::Vector2i(30, 30));
+	TEST_ASSERT_TRUE(box.intersects(other));
+	TEST_ASSERT_FALSE(box.contains(other));
+
+	other.inflate(1);
+	TEST_ASSERT_EQUALS(other.getMin(), xpcc::Vector2i(9, 19));
+	TEST_ASSERT_EQUALS(xpcc::BoundingBox2D<int16_t>::merge(box, other),
+			xpcc::BoundingBox2D<int16_t>(xpcc::Vector2i(-5, 0), xpcc::Vector2i(31, 31)));
+
+	TEST_ASSERT_EQUALS_FLOAT(box.getDistanceSquaredTo(xpcc::Vector2i(5, 5)), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(box.getDistanceSquaredTo(xpcc::Vector2i(13, 24)), 25.f);
+}
+
+void
+Shape2DTest::testBoundingBoxRay()
+{
+	xpcc::BoundingBox2D<int16_t> box(xpcc::Vector2i(10, 10), xpcc::Vector2i(20, 20));
+
+	float entry;
+	float exit;
+	TEST_ASSERT_TRUE(box.intersects(xpcc::Vector2f(0, 15), xpcc::Vector2f(1, 0), 100.f, &entry, &exit));
+	TEST_ASSERT_EQUALS_FLOAT(entry, 10.f);
+	TEST_ASSERT_EQUALS_FLOAT(exit, 20.f);
+
+	// too short
+	TEST_ASSERT_FALSE(box.intersects(xpcc::Vector2f(0, 15), xpcc::Vector2f(1, 0), 9.f));
+
+	// parallel to the box and outside
+	TEST_ASSERT_FALSE(box.intersects(xpcc::Vector2f(0, 25), xpcc::Vector2f(1, 0), 100.f));
+
+	// pointing away
+	TEST_ASSERT_FALSE(box.intersects(xpcc::Vector2f(0, 0), xpcc::Vector2f(-1, -1), 100.f));
+
+	// starting inside
+	TEST_ASSERT_TRUE(box.intersects(xpcc::Vector2f(15, 15), xpcc::Vector2f(0, -2), 100.f, &entry, &exit));
+	TEST_ASSERT_EQUALS_FLOAT(entry, 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(exit, 2.5f);
+}
+
+void
+Shape2DTest::testLineSegment()
+{
+	xpcc::LineSegment2D<int16_t> segment(xpcc::Vector2i(10, 0), xpcc::Vector2i(10, 20));
+	xpcc::Shape2D<int16_t> shape(segment);
+
+	TEST_ASSERT_TRUE(shape.getType() == xpcc::Shape2D<int16_t>::Type::LineSegment);
+	TEST_ASSERT_TRUE(shape.getLineSegment() == &segment);
+	TEST_ASSERT_TRUE(shape.getCircle() == nullptr);
+	TEST_ASSERT_EQUALS(shape.getBoundingBox(),
+			xpcc::BoundingBox2D<int16_t>(xpcc::Vector2i(10, 0), xpcc::Vector2i(10, 20)));
+
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(0, 10)), 10.f);
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(13, 24)), 5.f);
+
+	float t;
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(0, 10), xpcc::Vector2f(2, 0), 10.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 5.f);
+
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(0, 10), xpcc::Vector2f(2, 0), 4.f, &t));
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(0, 30), xpcc::Vector2f(2, 0), 10.f, &t));
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(0, 10), xpcc::Vector2f(-2, 0), 10.f, &t));
+
+	// collinear, the end point is hit first
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(10, 30), xpcc::Vector2f(0, -1), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 10.f);
+
+	// parallel
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(11, 30), xpcc::Vector2f(0, -1), 100.f, &t));
+}
+
+void
+Shape2DTest::testCircle()
+{
+	xpcc::Circle2D<int16_t> circle(xpcc::Vector2i(0, 0), 10);
+	xpcc::Shape2D<int16_t> shape(circle);
+
+	TEST_ASSERT_TRUE(shape.getCircle() == &circle);
+	TEST_ASSERT_EQUALS(shape.getBoundingBox(),
+			xpcc::BoundingBox2D<int16_t>(xpcc::Vector2i(-10, -10), xpcc::Vector2i(10, 10)));
+
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(0, 5)), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(30, 40)), 40.f);
+
+	float t;
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(-30, 0), xpcc::Vector2f(1, 0), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 20.f);
+
+	// inside
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(1, 1), xpcc::Vector2f(1, 0), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 0.f);
+
+	// behind the start point and passing by
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(30, 0), xpcc::Vector2f(1, 0), 100.f, &t));
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(-30, 11), xpcc::Vector2f(1, 0), 100.f, &t));
+}
+
+void
+Shape2DTest::testPolygon()
+{
+	// non convex "U" shape
+	xpcc::Polygon2D<int16_t> polygon {
+		xpcc::Vector2i(0, 0),
+		xpcc::Vector2i(30, 0),
+		xpcc::Vector2i(30, 30),
+		xpcc::Vector2i(20, 30),
+		xpcc::Vector2i(20, 10),
+		xpcc::Vector2i(10, 10),
+		xpcc::Vector2i(10, 30),
+		xpcc::Vector2i(0, 30),
+	};
+	xpcc::Shape2D<int16_t> shape(polygon);
+
+	TEST_ASSERT_TRUE(shape.getPolygon() == &polygon);
+	TEST_ASSERT_EQUALS(shape.getBoundingBox(),
+			xpcc::BoundingBox2D<int16_t>(xpcc::Vector2i(0, 0), xpcc::Vector2i(30, 30)));
+
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(5, 20)), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(15, 25)), 5.f);
+	TEST_ASSERT_EQUALS_FLOAT(shape.getDistanceTo(xpcc::Vector2i(-3, -4)), 5.f);
+
+	float t;
+	// through the gap of the "U"
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(15, 50), xpcc::Vector2f(0, -1), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 40.f);
+
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(-10, 20), xpcc::Vector2f(1, 0), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 10.f);
+
+	TEST_ASSERT_TRUE(shape.intersects(xpcc::Vector2f(5, 5), xpcc::Vector2f(1, 0), 100.f, &t));
+	TEST_ASSERT_EQUALS_FLOAT(t, 0.f);
+
+	TEST_ASSERT_FALSE(shape.intersects(xpcc::Vector2f(-10, 20), xpcc::Vector2f(-1, 0), 100.f, &t));
+}
@@ -0,0 +1,300 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/spatial_grid_2d.hpp>
+
+#include "spatial_grid_2d_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 1;
+
+	int16_t
+	random(int16_t min, int16_t max)
+	{
+		seed = seed * 1103515245 + 12345;
+		return min + int16_t((seed >> 16) % (max - min + 1));
+	}
+
+	typedef xpcc::SpatialGrid2D<int16_t, 30, 20, 128, 4096> Grid;
+
+	/// Random obstacles on a 3000 x 2000 field
+	struct Scene
+	{
+		static constexpr uint8_t Circles = 40;
+		static constexpr uint8_t Segments = 40;
+		static constexpr uint8_t Polygons = 20;
+		static constexpr uint8_t Shapes = Circles + Segments + Polygons;
+
+		Scene()
+		{
+			for (uint8_t i = 0; i < Circles; ++i)
+			{
+				circles[i] = xpcc::Circle2D<int16_t>(
+						xpcc::Vector2i(random(200, 2800), random(200, 1800)),
+						random(20, 150));
+				shapes[i] = circles[i];
+			}
+
+			for (uint8_t i = 0; i < Segments; ++i)
+			{
+				xpcc::Vector2i start(random(400, 2600), random(400, 1600));
+				xpcc::Vector2i end(start.x + random(-300, 300), start.y + random(-300, 300));
+				segments[i] = xpcc::LineSegment2D<int16_t>(start, end);
+				shapes[Circles + i] = segments[i];
+			}
+
+			for (uint8_t i = 0; i < Polygons; ++i)
+			{
+				xpcc::Vector2i center(random(300, 2700), random(300, 1700));
+				polygons[i] << xpcc::Vector2i(center.x - random(30, 200), center.y - random(30, 200))
+							<< xpcc::Vector2i(center.x + random(30, 200), center.y - random(30, 200))
+							<< xpcc::Vector2i(center.x + random(30, 200), center.y + random(30, 200))
+							<< xpcc::Vector2i(center.x - random(30, 200), center.y + random(30, 200));
+				shapes[Circles + Segments + i] = polygons[i];
+			}
+		}
+
+		xpcc::Circle2D<int16_t> circles[Circles];
+		xpcc::LineSegment2D<int16_t> segments[Segments];
+		xpcc::Polygon2D<int16_t> polygons[Polygons] = {
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+			xpcc::Polygon2D<int16_t>(4), xpcc::Polygon2D<int16_t>(4),
+		};
+
+		xpcc::Shape2D<int16_t> shapes[Shapes];
+	};
+
+	/// Check that the handles found are exactly the shapes marked as expected
+	bool
+	compare(const Grid& grid, const Grid::Handle* result, std::size_t count,
+			const Scene& scene, const bool* expected)
+	{
+		std::size_t expectedCount = 0;
+		for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+			expectedCount += expected[i];
+		}
+		if (count != expectedCount) {
+			return false;
+		}
+
+		for (std::size_t k = 0; k < count; ++k)
+		{
+			bool found = false;
+			for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+				if (expected[i] && grid.getShape(result[k]) == scene.shapes[i]) {
+					found = true;
+				}
+			}
+			if (!found) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void
+SpatialGrid2DTest::testInsertRemove()
+{
+	xpcc::SpatialGrid2D<int16_t, 10, 10, 3, 8> grid(xpcc::Vector2i(-500, -500), 100);
+
+	TEST_ASSERT_EQUALS(grid.getBoundingBox(),
+			xpcc::BoundingBox2D<int16_t>(xpcc::Vector2i(-500, -500), xpcc::Vector2i(500, 500)));
+
+	// covers 2 x 2 cells
+	xpcc::Circle2D<int16_t> circle(xpcc::Vector2i(0, 0), 50);
+	auto a = grid.insert(circle);
+	TEST_ASSERT_TRUE(a != grid.Invalid);
+	TEST_ASSERT_EQUALS(grid.getNumberOfShapes(), 1U);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 4U);
+
+	// not inside of the covered area
+	xpcc::Circle2D<int16_t> outside(xpcc::Vector2i(480, 0), 50);
+	TEST_ASSERT_TRUE(grid.insert(outside) == grid.Invalid);
+
+	// needs 5 entries, but only 4 are left
+	xpcc::LineSegment2D<int16_t> segment(xpcc::Vector2i(-250, 10), xpcc::Vector2i(250, 10));
+	TEST_ASSERT_TRUE(grid.insert(segment) == grid.Invalid);
+	TEST_ASSERT_EQUALS(grid.getNumberOfShapes(), 1U);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 4U);
+
+	grid.remove(a);
+	TEST_ASSERT_EQUALS(grid.getNumberOfShapes(), 0U);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 8U);
+
+	auto b = grid.insert(segment);
+	TEST_ASSERT_TRUE(b != grid.Invalid);
+	TEST_ASSERT_TRUE(grid.getShape(b).getLineSegment() == &segment);
+
+	// the capacity is exhausted
+	xpcc::Circle2D<int16_t> small(xpcc::Vector2i(-420, -420), 10);
+	TEST_ASSERT_TRUE(grid.insert(small) != grid.Invalid);
+	TEST_ASSERT_TRUE(grid.insert(small) != grid.Invalid);
+	TEST_ASSERT_TRUE(grid.insert(small) == grid.Invalid);
+
+	grid.removeAll();
+	TEST_ASSERT_EQUALS(grid.getNumberOfShapes(), 0U);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 8U);
+}
+
+void
+SpatialGrid2DTest::testUpdate()
+{
+	Grid grid(xpcc::Vector2i(0, 0), 100);
+
+	xpcc::Circle2D<int16_t> robot(xpcc::Vector2i(150, 150), 40);
+	auto handle = grid.insert(robot);
+
+	Grid::Handle result[4];
+	TEST_ASSERT_EQUALS(grid.query(xpcc::Vector2i(150, 100), 10, result, 4), 1U);
+	TEST_ASSERT_EQUALS(grid.query(xpcc::Vector2i(1550, 1500), 10, result, 4), 0U);
+
+	robot.setCenter(xpcc::Vector2i(1500, 1500));
+	TEST_ASSERT_TRUE(grid.update(handle));
+
+	TEST_ASSERT_EQUALS(grid.query(xpcc::Vector2i(150, 100), 10, result, 4), 0U);
+	TEST_ASSERT_EQUALS(grid.query(xpcc::Vector2i(1550, 1500), 10, result, 4), 1U);
+	TEST_ASSERT_EQUALS(result[0], handle);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 4096U - 4U);
+
+	// leaving the field removes the shape
+	robot.setCenter(xpcc::Vector2i(-100, 1550));
+	TEST_ASSERT_FALSE(grid.update(handle));
+	TEST_ASSERT_EQUALS(grid.getNumberOfShapes(), 0U);
+	TEST_ASSERT_EQUALS(grid.getNumberOfFreeEntries(), 4096U);
+}
+
+void
+SpatialGrid2DTest::testQuery()
+{
+	Scene scene;
+	Grid grid(xpcc::Vector2i(0, 0), 100);
+	for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+		TEST_ASSERT_TRUE(grid.insert(scene.shapes[i]) != grid.Invalid);
+	}
+
+	bool expected[Scene::Shapes];
+	Grid::Handle result[Scene::Shapes];
+	for (uint8_t n = 0; n < 50; ++n)
+	{
+		// areas partially outside of the grid are allowed
+		xpcc::Vector2i min(random(-200, 2900), random(-200, 1900));
+		xpcc::BoundingBox2D<int16_t> area(min,
+				xpcc::Vector2i(min.x + random(0, 600), min.y + random(0, 600)));
+		for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+			expected[i] = scene.shapes[i].getBoundingBox().intersects(area);
+		}
+		std::size_t count = grid.query(area, result, Scene::Shapes);
+		TEST_ASSERT_TRUE(compare(grid, result, count, scene, expected));
+
+		xpcc::Vector2i center(random(-100, 3100), random(-100, 2100));
+		int16_t radius = random(0, 400);
+		for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+			expected[i] = (scene.shapes[i].getDistanceTo(center) <= radius);
+		}
+		count = grid.query(center, radius, result, Scene::Shapes);
+		TEST_ASSERT_TRUE(compare(grid, result, count, scene, expected));
+	}
+
+	// the result is truncated
+	TEST_ASSERT_EQUALS(grid.query(grid.getBoundingBox(), result, 5), 5U);
+}
+
+void
+SpatialGrid2DTest::testRaycast()
+{
+	Scene scene;
+	Grid grid(xpcc::Vector2i(0, 0), 100);
+	for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+		grid.insert(scene.shapes[i]);
+	}
+
+	for (uint8_t n = 0; n < 100; ++n)
+	{
+		// rays may start outside of the grid
+		xpcc::Ray2D<int16_t> ray(
+				xpcc::Vector2i(random(-500, 3500), random(-500, 2500)),
+				xpcc::Vector2i(random(-100, 100), random(-100, 100)));
+		float maxLength = random(1, 40);
+
+		const xpcc::Vector2f start(ray.getStartPoint().x, ray.getStartPoint().y);
+		const xpcc::Vector2f direction(ray.getDirectionVector().x, ray.getDirectionVector().y);
+
+		bool expected = false;
+		float best = maxLength;
+		for (uint8_t i = 0; i < Scene::Shapes; ++i)
+		{
+			float t;
+			if (scene.shapes[i].intersects(start, direction, best, &t)) {
+				expected = true;
+				best = t;
+			}
+		}
+
+		Grid::Hit hit;
+		bool found = grid.raycast(ray, maxLength, &hit);
+		TEST_ASSERT_EQUALS(found, expected);
+		if (found && expected)
+		{
+			TEST_ASSERT_EQUALS_DELTA(hit.distance, best * direction.getLength(), 1e-2f);
+
+			float t;
+			TEST_ASSERT_TRUE(grid.getShape(hit.handle).intersects(start, direction, maxLength, &t));
+			TEST_ASSERT_EQUALS_DELTA(t, best, 1e-4f);
+		}
+	}
+
+	// zero length direction
+	Grid::Hit hit;
+	TEST_ASSERT_FALSE(grid.raycast(xpcc::Ray2D<int16_t>(xpcc::Vector2i(100, 100),
+			xpcc::Vector2i(0, 0)), 10.f, &hit));
+}
+
+void
+SpatialGrid2DTest::testNearest()
+{
+	Scene scene;
+	Grid grid(xpcc::Vector2i(0, 0), 100);
+	for (uint8_t i = 0; i < Scene::Shapes; ++i) {
+		grid.insert(scene.shapes[i]);
+	}
+
+	for (uint8_t n = 0; n < 100; ++n)
+	{
+		xpcc::Vector2i point(random(-500, 3500), random(-500, 2500));
+		float maxDistance = random(0, 1000);
+
+		bool expected = false;
+		float best = maxDistance;
+		for (uint8_t i = 0; i < Scene::Shapes; ++i)
+		{
+			float distance = scene.shapes[i].getDistanceTo(point);
+			if (distance <= best) {
+				expected = true;
+				best = distance;
+			}
+		}
+
+		Grid::Hit hit;
+		bool found = grid.getNearest(point, maxDistance, &hit);
+		TEST_ASSERT_EQUALS(found, expected);
+		if (found && expected)
+		{
+			TEST_ASSERT_EQUALS_FLOAT(hit.distance, best);
+			TEST_ASSERT_EQUALS_FLOAT(grid.getShape(hit.handle).getDistanceTo(point), best);
+		}
+	}
+}
@@ -37,6 +37,7 @@
 
 #include "geometric_traits.hpp"
 #include "angle.hpp"
+#include "fixed_angle.hpp"
 #include "vector.hpp"
 
 namespace xpcc
@@ -92,7 +93,7 @@ namespace xpcc
 		Vector(const Vector<T, 1> &inX, const T &inY);
 		explicit Vector(T inVal);
 		Vector(const Matrix<T, 2, 1> &rhs);
-		Vector(const Vector &rhs);
+		Vector(const Vector &rhs) = default;
 		
 		inline void
 		setX(const T& value);
@@ -137,6 +138,18 @@ namespace xpcc
 		float
 		getAngle() const;
 		
+		/**
+		 * \brief	Calculate the absolute angle without floating point operations
+		 * 
+		 * Uses FixedAngle::atan2(), the error is at most one step of
+		 * the FixedAngle (about 0.0055 degree).
+		 * 
+		 * \warning	This method is only useful if T is an integer type.
+		 * 			Floating point values are truncated!
+		 */
+		FixedAngle
+		getFixedAngle() const;
+		
 		/**
 		 * \brief	Normalize length to 1
 		 * 
@@ -162,6 +175,16 @@ namespace xpcc
 		Vector&
 		rotate(float phi);
 		
+		/**
+		 * \brief	Rotate with the table based sine and cosine of FixedAngle
+		 * 
+		 * Needs no floating point operations for integer types and is
+		 * therefore much faster than rotate(float) on controllers
+		 * without an FPU.
+		 */
+		Vector&
+		rotate(FixedAngle phi);
+		
 		/**
 		 * \brief	Move the point in x and y direction
 		 */
@@ -247,7 +270,7 @@ namespace xpcc
 		static int_fast8_t
 		ccw(const Vector& a, const Vector& b, const Vector& c);
 		
-		Vector& operator = (const Vector &rhs);
+		Vector& operator = (const Vector &rhs) = default;
 		Vector& operator = (const Matrix<T, 2, 1> &rhs);
 		
 		bool operator == (const Vector &rhs) const;
@@ -92,14 +92,6 @@ xpcc::Vector<T, 2>::Vector(const xpcc::Matrix<T, 2, 1> &rhs) :
 {
 }
 
-// ----------------------------------------------------------------------------
-template<typename T>
-xpcc::Vector<T, 2>::Vector(const Vector &rhs) :
-	x(rhs.x),
-	y(rhs.y)
-{
-}
-
 // ----------------------------------------------------------------------------
 template<typename T>
 void
@@ -169,6 +161,14 @@ xpcc::Vector<T, 2>::getAngle() const
 	return std::atan2(this->y, this->x);
 }
 
+template<typename T>
+xpcc::FixedAngle
+xpcc::Vector<T, 2>::getFixedAngle() const
+{
+	return FixedAngle::atan2(static_cast<int32_t>(this->y),
+							 static_cast<int32_t>(this->x));
+}
+
 // ----------------------------------------------------------------------------
 template<typename T>
 xpcc::Vector<T, 2>&
@@ -231,6 +231,21 @@ xpcc::Vector<T, 2>::rotate(float phi)
 	return *this;
 }
 
+template<typename T>
+xpcc::Vector<T, 2>&
+xpcc::Vector<T, 2>::rotate(FixedAngle phi)
+{
+	int16_t s;
+	int16_t c;
+	phi.sinCos(&s, &c);
+	
+	T tx =    FixedAngle::multiplyAdd<T>(this->x, c, this->y, -s);
+	this->y = FixedAngle::multiplyAdd<T>(this->x, s, this->y, c);
+	this->x = tx;
+	
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T>
 xpcc::Vector<T, 2>&
@@ -337,15 +352,6 @@ xpcc::Vector<T, 2>::ccw(const Vector& a, const Vector& b,
 	}
 }
 
-// ----------------------------------------------------------------------------
-template<typename T>
-xpcc::Vector<T, 2>& xpcc::Vector<T, 2>::operator = (const xpcc::Vector<T, 2> &rhs)
-{
-	x = rhs.x;
-	y = rhs.y;
-	return *this;
-}
-
 // ----------------------------------------------------------------------------
 template<typename T>
 xpcc::Vector<T, 2>& xpcc::Vector<T, 2>::operator = (const xpcc::Matrix<T, 2, 1> &rhs)
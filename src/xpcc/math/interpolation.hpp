@@ -48,6 +48,9 @@ namespace xpcc
 }
 
 #include "interpolation/linear.hpp"
+#include "interpolation/indexed_linear.hpp"
+#include "interpolation/uniform.hpp"
+#include "interpolation/table.hpp"
 #include "interpolation/lagrange.hpp"
 
 #endif	// XPCC__INTERPOLATION_HPP
@@ -0,0 +1,130 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__INDEXED_LINEAR_HPP
+#define	XPCC_INTERPOLATION__INDEXED_LINEAR_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/container/pair.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+#include "uniform.hpp"
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Linear interpolation with an index for fast lookup
+		 *
+		 * Gives exactly the same results as Linear, but instead of walking
+		 * through all supporting points on every call the range of the
+		 * input values is divided into \p Buckets equally sized buckets.
+		 * For every bucket the first supporting point inside of it is
+		 * stored in RAM when the object is created. A call then only
+		 * calculates the bucket and checks the few supporting points of
+		 * this bucket.
+		 *
+		 * For integer input types the bucket size is rounded up to the next
+		 * power of two, so no division is needed.
+		 *
+		 * Use Uniform if the supporting points are equidistant.
+		 *
+		 * Example:
+		 * \code
+		 * typedef xpcc::Pair<uint16_t, int16_t> Point;
+		 *
+		 * FLASH_STORAGE(Point supportingPoints[40]) =
+		 * {
+		 *     { 30, -200 },
+		 *     ...
+		 * };
+		 *
+		 * xpcc::interpolation::IndexedLinear<Point, 16, xpcc::accessor::Flash>
+		 *         value(xpcc::accessor::asFlash(supportingPoints), 40);
+		 *
+		 * int16_t b = value.interpolate(a);
+		 * \endcode
+		 *
+		 * \tparam	T			Any specialization of xpcc::Pair<>
+		 * \tparam	Buckets		Number of buckets, needs one byte of RAM each
+		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
+		 * 						xpcc::accessor::Flash or any self defined
+		 * 						accessor class.
+		 * 						Default is xpcc::accessor::Ram.
+		 *
+		 * \see		Linear
+		 * \ingroup	interpolation
+		 */
+		template <typename T, uint8_t Buckets = 16,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class IndexedLinear
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+
+			typedef typename ArithmeticTraits< OutputType >::SignedType OutputSignedType;
+			typedef typename ArithmeticTraits< OutputSignedType >::WideType WideType;
+
+			typedef typename ArithmeticTraits< InputType >::UnsignedType OffsetType;
+
+		public:
+			/**
+			 * \brief	Constructor
+			 *
+			 * Reads all supporting points once to build the index.
+			 *
+			 * \param	supportingPoints	Supporting points of the curve.
+			 * 								Needs to be an Array of xpcc::Pair<>
+			 * 								sorted by the input value.
+			 * \param	numberOfPoints		length of \p supportingPoints
+			 */
+			IndexedLinear(Accessor<T> supportingPoints, uint8_t numberOfPoints);
+
+			/**
+			 * \brief	Perform a linear interpolation
+			 *
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType
+			interpolate(const InputType& value) const;
+
+			/**
+			 * \brief	Interpolate a whole array of input values
+			 *
+			 * \param	input	Input values
+			 * \param	output	Interpolated values
+			 * \param	count	Length of \p input and \p output
+			 */
+			void
+			interpolate(const InputType* input, OutputType* output,
+					std::size_t count) const;
+
+		private:
+			const Accessor<T> supportingPoints;
+			const uint8_t numberOfPoints;
+
+			const InputType first;
+			const InputType last;
+			const detail::UniformStep<OffsetType> bucketSize;
+
+			/// First supporting point with an input value inside of the bucket
+			uint8_t bucketStart[Buckets];
+		};
+	}
+}
+
+#include "indexed_linear_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__INDEXED_LINEAR_HPP
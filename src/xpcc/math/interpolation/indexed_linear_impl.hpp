@@ -0,0 +1,110 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__INDEXED_LINEAR_HPP
+   #error "Don't include this file directly. Use 'xpcc/math/interpolation/indexed_linear.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, uint8_t Buckets,
+		  template <typename> class Accessor>
+xpcc::interpolation::IndexedLinear<T, Buckets, Accessor>::IndexedLinear(
+		Accessor<T> supportingPoints, uint8_t numberOfPoints) :
+	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints),
+	first(supportingPoints[0].getFirst()),
+	last(supportingPoints[numberOfPoints - 1].getFirst()),
+	bucketSize(detail::UniformStep<OffsetType>::getStepForRange(
+			static_cast<OffsetType>(static_cast<OffsetType>(last) -
+									static_cast<OffsetType>(first)),
+			Buckets))
+{
+	// Use the same calculation for the bucket as interpolate(), then
+	// rounding errors of floating point types can not cause a mismatch.
+	uint8_t bucket = 0;
+	for (uint8_t i = 0; i < numberOfPoints; ++i)
+	{
+		OffsetType position;
+		uint16_t index = bucketSize.getIndex(
+				static_cast<OffsetType>(
+						static_cast<OffsetType>(supportingPoints[i].getFirst()) -
+						static_cast<OffsetType>(first)),
+				&position);
+		if (index >= Buckets) {
+			index = Buckets - 1;
+		}
+
+		while (bucket <= index) {
+			bucketStart[bucket++] = i;
+		}
+	}
+
+	// buckets behind the last point, never used
+	while (bucket < Buckets) {
+		bucketStart[bucket++] = numberOfPoints - 1;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, uint8_t Buckets,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::IndexedLinear<T, Buckets, Accessor>::OutputType
+xpcc::interpolation::IndexedLinear<T, Buckets, Accessor>::interpolate(
+		const InputType& value) const
+{
+	if (value <= first) {
+		return this->supportingPoints[0].getSecond();
+	}
+	if (value > last) {
+		return this->supportingPoints[numberOfPoints - 1].getSecond();
+	}
+
+	OffsetType position;
+	uint16_t bucket = bucketSize.getIndex(
+			static_cast<OffsetType>(static_cast<OffsetType>(value) -
+									static_cast<OffsetType>(first)),
+			&position);
+	if (bucket >= Buckets) {
+		bucket = Buckets - 1;
+	}
+
+	// Search the first point with an input value greater or equal to
+	// value, like Linear does. This terminates at the last point at the
+	// latest and is never the first point, because value > first.
+	uint8_t i = bucketStart[bucket];
+	T current(this->supportingPoints[i]);
+	while (value > current.getFirst()) {
+		current = this->supportingPoints[++i];
+	}
+	const T previous(this->supportingPoints[i - 1]);
+
+	// same calculation as in Linear
+	InputType x1_in = previous.getFirst();
+	InputType x2_in = current.getFirst();
+
+	OutputType x1_out = previous.getSecond();
+	OutputType x2_out = current.getSecond();
+
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) -
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
+
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
+}
+
+template <typename T, uint8_t Buckets,
+		  template <typename> class Accessor>
+void
+xpcc::interpolation::IndexedLinear<T, Buckets, Accessor>::interpolate(
+		const InputType* input, OutputType* output, std::size_t count) const
+{
+	for (std::size_t i = 0; i < count; ++i) {
+		output[i] = interpolate(input[i]);
+	}
+}
@@ -0,0 +1,109 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__TABLE_HPP
+#define	XPCC_INTERPOLATION__TABLE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Array of values which can be calculated at compile time
+		 *
+		 * Plain aggregate, so it can be stored in flash with FLASH_STORAGE.
+		 * As the macro does not accept template arguments with commas a
+		 * typedef is necessary.
+		 *
+		 * \see		generateTable()
+		 * \ingroup	interpolation
+		 */
+		template <typename T, std::size_t N>
+		struct Table
+		{
+			typedef T ValueType;
+
+			static constexpr std::size_t
+			getSize()
+			{
+				return N;
+			}
+
+			T values[N];
+		};
+
+		/// \internal
+		namespace detail
+		{
+			template <typename T, typename U>
+			constexpr T
+			roundTo(U value)
+			{
+				// Round to the nearest integer when converting from floating
+				// point to integer types, truncating would add a bias.
+				return (ArithmeticTraits<T>::isInteger && ArithmeticTraits<U>::isFloatingPoint) ?
+						static_cast<T>(value + ((value < U(0)) ? U(-0.5) : U(0.5))) :
+						static_cast<T>(value);
+			}
+		}
+
+		/**
+		 * \brief	Sample a function at equidistant points at compile time
+		 *
+		 * Entry i of the result is \c function(start + i * step). The
+		 * function needs to be a \c constexpr function or an object with
+		 * a \c constexpr call operator (lambdas are not \c constexpr before
+		 * C++17). Results are rounded if \p T is an integer type.
+		 *
+		 * Together with FLASH_STORAGE the table is calculated by the
+		 * compiler and placed in flash, nothing is done at runtime:
+		 * \code
+		 * // linearization curve of the sensor
+		 * constexpr float
+		 * distance(float voltage)
+		 * {
+		 *     return 27.86f / (voltage - 0.1f);
+		 * }
+		 *
+		 * typedef xpcc::interpolation::Table<uint16_t, 33> DistanceTable;
+		 *
+		 * // 33 values for the ADC range 0.5V .. 2.9V
+		 * FLASH_STORAGE(DistanceTable distanceTable) =
+		 *     xpcc::interpolation::generateTable<uint16_t, 33>(distance, 0.5f, 0.075f);
+		 *
+		 * xpcc::interpolation::Uniform<float, uint16_t, xpcc::accessor::Flash>
+		 *     sensor(xpcc::accessor::asFlash(distanceTable.values), 33, 0.5f, 0.075f);
+		 * \endcode
+		 *
+		 * \tparam	T	Type of the table entries
+		 * \tparam	N	Number of entries
+		 *
+		 * \see		Uniform
+		 * \ingroup	interpolation
+		 */
+		template <typename T, std::size_t N, typename InputType, typename Function>
+		constexpr Table<T, N>
+		generateTable(Function function, InputType start, InputType step)
+		{
+			Table<T, N> table {};
+			for (std::size_t i = 0; i < N; ++i) {
+				table.values[i] = detail::roundTo<T>(
+						function(start + static_cast<InputType>(i) * step));
+			}
+			return table;
+		}
+	}
+}
+
+#endif	// XPCC_INTERPOLATION__TABLE_HPP
@@ -0,0 +1,169 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/interpolation/indexed_linear.hpp>
+#include <xpcc/math/interpolation/linear.hpp>
+
+#include "indexed_linear_interpolation_test.hpp"
+
+namespace
+{
+	// deterministic pseudo random numbers
+	uint32_t seed = 1;
+
+	uint16_t
+	randomValue()
+	{
+		seed = seed * 1103515245 + 12345;
+		return seed >> 16;
+	}
+
+	typedef xpcc::Pair<uint8_t, int16_t> FlashPoint;
+
+	FLASH_STORAGE(FlashPoint flashValues[6]) =
+	{
+		{ 30, -200 },
+		{ 50, 0 },
+		{ 90, 50 },
+		{ 150, 2050 },
+		{ 200, 3000 },
+		{ 220, 20000 }
+	};
+}
+
+void
+IndexedLinearInterpolationTest::testInterpolationRam()
+{
+	typedef xpcc::Pair<int16_t, uint16_t> Point;
+
+	Point points[3] =
+	{
+		{ -10, 50 },
+		{  50, 10 },
+		{ 100,  0 }
+	};
+
+	xpcc::interpolation::IndexedLinear<Point, 4> value(points, 3);
+
+	TEST_ASSERT_EQUALS(value.interpolate(-20), 50U);
+	TEST_ASSERT_EQUALS(value.interpolate( 10), 37U);
+	TEST_ASSERT_EQUALS(value.interpolate( 30), 24U);
+	TEST_ASSERT_EQUALS(value.interpolate( 50), 10U);
+	TEST_ASSERT_EQUALS(value.interpolate(150),  0U);
+}
+
+void
+IndexedLinearInterpolationTest::testInterpolationFlash()
+{
+	// same values as for Linear
+	xpcc::interpolation::IndexedLinear<FlashPoint, 8, xpcc::accessor::Flash>
+		value(xpcc::accessor::asFlash(flashValues), 6);
+
+	TEST_ASSERT_EQUALS(value.interpolate(  0),  -200);
+	TEST_ASSERT_EQUALS(value.interpolate( 30),  -200);
+	TEST_ASSERT_EQUALS(value.interpolate( 32),  -180);
+	TEST_ASSERT_EQUALS(value.interpolate( 40),  -100);
+	TEST_ASSERT_EQUALS(value.interpolate( 90),    50);
+	TEST_ASSERT_EQUALS(value.interpolate(100),   383);
+	TEST_ASSERT_EQUALS(value.interpolate(140),  1716);
+	TEST_ASSERT_EQUALS(value.interpolate(150),  2050);
+	TEST_ASSERT_EQUALS(value.interpolate(200),  3000);
+	TEST_ASSERT_EQUALS(value.interpolate(201),  3850);
+	TEST_ASSERT_EQUALS(value.interpolate(219), 19150);
+	TEST_ASSERT_EQUALS(value.interpolate(220), 20000);
+	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
+}
+
+void
+IndexedLinearInterpolationTest::testCompareWithLinear()
+{
+	typedef xpcc::Pair<int16_t, int16_t> Point;
+
+	for (uint8_t run = 0; run < 20; ++run)
+	{
+		// random curves with clusters of points and duplicated inputs
+		const uint8_t count = 2 + randomValue() % 60;
+		Point points[64];
+		int16_t x = -1000 + randomValue() % 500;
+		for (uint8_t i = 0; i < count; ++i)
+		{
+			points[i].first = x;
+			points[i].second = randomValue() % 4000 - 2000;
+			x += (randomValue() % 4 == 0) ? (randomValue() % 200) : (randomValue() % 5);
+		}
+
+		xpcc::interpolation::Linear<Point> linear(points, count);
+		xpcc::interpolation::IndexedLinear<Point, 16> indexed(points, count);
+		xpcc::interpolation::IndexedLinear<Point, 3> small(points, count);
+
+		bool equal = true;
+		for (int16_t value = -1100; value < x + 100; ++value)
+		{
+			const int16_t expected = linear.interpolate(value);
+			if (indexed.interpolate(value) != expected ||
+				small.interpolate(value) != expected) {
+				equal = false;
+			}
+		}
+		TEST_ASSERT_TRUE(equal);
+	}
+}
+
+void
+IndexedLinearInterpolationTest::testFloat()
+{
+	typedef xpcc::Pair<float, float> Point;
+
+	Point points[7] =
+	{
+		{ 0.1f,   0.f },
+		{ 0.2f,  10.f },
+		{ 0.25f, 15.f },
+		{ 0.3f,  30.f },
+		{ 0.7f,  40.f },
+		{ 0.7f,  50.f },
+		{ 1.3f, 100.f }
+	};
+
+	xpcc::interpolation::Linear<Point> linear(points, 7);
+	xpcc::interpolation::IndexedLinear<Point, 10> indexed(points, 7);
+
+	for (float value = 0.f; value < 1.5f; value += 0.0123f) {
+		TEST_ASSERT_EQUALS_FLOAT(indexed.interpolate(value), linear.interpolate(value));
+	}
+	for (uint8_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(indexed.interpolate(points[i].first),
+				linear.interpolate(points[i].first));
+	}
+}
+
+void
+IndexedLinearInterpolationTest::testBatch()
+{
+	typedef xpcc::Pair<uint16_t, uint16_t> Point;
+
+	Point points[3] =
+	{
+		{ 1000,    0 },
+		{ 1100, 1000 },
+		{ 1200, 3000 }
+	};
+	xpcc::interpolation::IndexedLinear<Point> value(points, 3);
+
+	uint16_t input[6] = { 0, 1000, 1050, 1100, 1175, 5000 };
+	uint16_t output[6];
+	value.interpolate(input, output, 6);
+
+	TEST_ASSERT_EQUALS(output[0], 0U);
+	TEST_ASSERT_EQUALS(output[1], 0U);
+	TEST_ASSERT_EQUALS(output[2], 500U);
+	TEST_ASSERT_EQUALS(output[3], 1000U);
+	TEST_ASSERT_EQUALS(output[4], 2500U);
+	TEST_ASSERT_EQUALS(output[5], 3000U);
+}
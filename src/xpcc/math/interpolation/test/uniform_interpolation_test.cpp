@@ -0,0 +1,193 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/interpolation/uniform.hpp>
+#include <xpcc/math/interpolation/linear.hpp>
+#include <xpcc/math/interpolation/table.hpp>
+
+#include "uniform_interpolation_test.hpp"
+
+namespace
+{
+	constexpr float
+	square(float x)
+	{
+		return x * x;
+	}
+
+	struct Polynomial
+	{
+		constexpr int32_t
+		operator () (int32_t x) const
+		{
+			return 3 * x * x - 20 * x + 7;
+		}
+	};
+
+	typedef xpcc::interpolation::Table<int16_t, 9> SquareTable;
+
+	FLASH_STORAGE(SquareTable squareTable) =
+			xpcc::interpolation::generateTable<int16_t, 9>(square, -2.f, 0.5f);
+
+	FLASH_STORAGE(uint16_t flashValues[5]) =
+	{
+		100, 200, 150, 150, 1000
+	};
+}
+
+void
+UniformInterpolationTest::testInterpolationRam()
+{
+	int16_t values[4] = { 50, 10, 0, -30 };
+
+	// supporting points at -10, 20, 50, 80
+	xpcc::interpolation::Uniform<int16_t, int16_t> value(values, 4, -10, 30);
+
+	TEST_ASSERT_EQUALS(value.getStart(), -10);
+	TEST_ASSERT_EQUALS(value.getEnd(), 80);
+
+	TEST_ASSERT_EQUALS(value.interpolate(-20), 50);
+	TEST_ASSERT_EQUALS(value.interpolate(-10), 50);
+	TEST_ASSERT_EQUALS(value.interpolate(  5), 30);
+	TEST_ASSERT_EQUALS(value.interpolate( 20), 10);
+	TEST_ASSERT_EQUALS(value.interpolate( 35),  5);
+	TEST_ASSERT_EQUALS(value.interpolate( 79), -29);
+	TEST_ASSERT_EQUALS(value.interpolate( 80), -30);
+	TEST_ASSERT_EQUALS(value.interpolate(150), -30);
+}
+
+void
+UniformInterpolationTest::testInterpolationFlash()
+{
+	xpcc::interpolation::Uniform<uint8_t, uint16_t, xpcc::accessor::Flash>
+			value(xpcc::accessor::asFlash(flashValues), 5, 0, 64);
+
+	TEST_ASSERT_EQUALS(value.getEnd(), 0);	// 256 does not fit into uint8_t
+
+	xpcc::interpolation::Uniform<uint16_t, uint16_t, xpcc::accessor::Flash>
+			wide(xpcc::accessor::asFlash(flashValues), 5, 0, 64);
+
+	TEST_ASSERT_EQUALS(wide.interpolate(  0),  100U);
+	TEST_ASSERT_EQUALS(wide.interpolate( 16),  125U);
+	TEST_ASSERT_EQUALS(wide.interpolate( 64),  200U);
+	TEST_ASSERT_EQUALS(wide.interpolate( 96),  175U);
+	TEST_ASSERT_EQUALS(wide.interpolate(150),  150U);
+	TEST_ASSERT_EQUALS(wide.interpolate(160),  150U);
+	TEST_ASSERT_EQUALS(wide.interpolate(255),  986U);
+	TEST_ASSERT_EQUALS(wide.interpolate(256), 1000U);
+	TEST_ASSERT_EQUALS(wide.interpolate(999), 1000U);
+}
+
+void
+UniformInterpolationTest::testCompareWithLinear()
+{
+	typedef xpcc::Pair<int16_t, int16_t> Point;
+
+	int16_t values[8] = { -500, 300, 310, 200, -1000, -1000, 2000, 1999 };
+
+	// one step size which is a power of two and one which is not
+	const int16_t steps[2] = { 32, 37 };
+	for (int16_t step : steps)
+	{
+		Point points[8];
+		for (uint8_t i = 0; i < 8; ++i) {
+			points[i].first = 100 + i * step;
+			points[i].second = values[i];
+		}
+
+		xpcc::interpolation::Linear<Point> linear(points, 8);
+		xpcc::interpolation::Uniform<int16_t, int16_t> uniform(values, 8, 100, step);
+
+		for (int16_t x = 50; x < 450; ++x) {
+			TEST_ASSERT_EQUALS(uniform.interpolate(x), linear.interpolate(x));
+		}
+	}
+}
+
+void
+UniformInterpolationTest::testSignedInput()
+{
+	// the distance from start to end does not fit into int8_t
+	int8_t values[3] = { -100, 0, 100 };
+	xpcc::interpolation::Uniform<int8_t, int8_t> value(values, 3, -100, 100);
+
+	TEST_ASSERT_EQUALS(value.interpolate(-128), -100);
+	TEST_ASSERT_EQUALS(value.interpolate( -50),  -50);
+	TEST_ASSERT_EQUALS(value.interpolate(   0),    0);
+	TEST_ASSERT_EQUALS(value.interpolate(  99),   99);
+	TEST_ASSERT_EQUALS(value.interpolate( 127),  100);
+}
+
+void
+UniformInterpolationTest::testFloat()
+{
+	float values[5] = { 0.f, 1.f, 4.f, 9.f, 16.f };
+	xpcc::interpolation::Uniform<float, float> value(values, 5, 0.f, 0.25f);
+
+	TEST_ASSERT_EQUALS_FLOAT(value.getEnd(), 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(-1.f), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.125f), 0.5f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.5f), 4.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.7f), 8.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(0.99f), 15.72f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.f), 16.f);
+
+	// integer output with floating point input
+	int16_t steps[3] = { 0, 1000, -1000 };
+	xpcc::interpolation::Uniform<float, int16_t> mixed(steps, 3, 1.f, 2.f);
+	TEST_ASSERT_EQUALS(mixed.interpolate(1.5f), 250);
+	TEST_ASSERT_EQUALS(mixed.interpolate(4.5f), -500);
+}
+
+void
+UniformInterpolationTest::testBatch()
+{
+	uint16_t values[3] = { 0, 1000, 3000 };
+	xpcc::interpolation::Uniform<uint16_t, uint16_t> value(values, 3, 1000, 100);
+
+	uint16_t data[6] = { 0, 1000, 1050, 1100, 1175, 5000 };
+	value.interpolate(data, data, 6);
+
+	TEST_ASSERT_EQUALS(data[0], 0U);
+	TEST_ASSERT_EQUALS(data[1], 0U);
+	TEST_ASSERT_EQUALS(data[2], 500U);
+	TEST_ASSERT_EQUALS(data[3], 1000U);
+	TEST_ASSERT_EQUALS(data[4], 2500U);
+	TEST_ASSERT_EQUALS(data[5], 3000U);
+}
+
+void
+UniformInterpolationTest::testGenerateTable()
+{
+	// calculated by the compiler
+	constexpr auto polynomial =
+			xpcc::interpolation::generateTable<int32_t, 4>(Polynomial(), -1, 2);
+	static_assert(polynomial.getSize() == 4, "wrong size");
+	static_assert(polynomial.values[0] == 30, "wrong value");
+	static_assert(polynomial.values[3] == -18, "wrong value");
+
+	TEST_ASSERT_EQUALS(polynomial.values[1], -10);
+	TEST_ASSERT_EQUALS(polynomial.values[2], -26);
+
+	// rounded, not truncated
+	constexpr auto rounded =
+			xpcc::interpolation::generateTable<int8_t, 3>(square, -1.3f, 1.2f);
+	TEST_ASSERT_EQUALS(rounded.values[0], 2);	// 1.69
+	TEST_ASSERT_EQUALS(rounded.values[1], 0);	// 0.01
+	TEST_ASSERT_EQUALS(rounded.values[2], 1);	// 1.21
+
+	xpcc::interpolation::Uniform<float, int16_t, xpcc::accessor::Flash>
+			value(xpcc::accessor::asFlash(squareTable.values), 9, -2.f, 0.5f);
+
+	TEST_ASSERT_EQUALS(value.interpolate(-2.f), 4);
+	TEST_ASSERT_EQUALS(value.interpolate(-1.5f), 2);	// 2.25
+	TEST_ASSERT_EQUALS(value.interpolate(0.f), 0);
+	TEST_ASSERT_EQUALS(value.interpolate(1.75f), 3);	// (2 + 4) / 2
+	TEST_ASSERT_EQUALS(value.interpolate(2.f), 4);
+}
@@ -0,0 +1,35 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+struct UniformInterpolationTest : public unittest::TestSuite
+{
+	void
+	testInterpolationRam();
+
+	void
+	testInterpolationFlash();
+
+	/// Shift and division need to give the same results as Linear
+	void
+	testCompareWithLinear();
+
+	void
+	testSignedInput();
+
+	void
+	testFloat();
+
+	void
+	testBatch();
+
+	void
+	testGenerateTable();
+};
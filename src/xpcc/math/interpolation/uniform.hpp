@@ -0,0 +1,211 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__UNIFORM_HPP
+#define	XPCC_INTERPOLATION__UNIFORM_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/// \internal
+		namespace detail
+		{
+			/**
+			 * Splits an offset into the index of the interval and the
+			 * position inside the interval.
+			 *
+			 * For integer types the position is the remainder of the
+			 * division. If the step is a power of two shifts are used
+			 * instead of divisions.
+			 */
+			template <typename T,
+					  bool isFloatingPoint = ArithmeticTraits<T>::isFloatingPoint>
+			class UniformStep
+			{
+			public:
+				UniformStep(T step);
+
+				/**
+				 * Smallest power of two which divides \p range into less
+				 * than \p count intervals.
+				 */
+				static T
+				getStepForRange(T range, uint8_t count);
+
+				inline T
+				getStep() const
+				{
+					return step;
+				}
+
+				/// \param	offset	needs to be positive
+				uint16_t
+				getIndex(T offset, T* position) const;
+
+				/// Calculates difference * position / step, rounded towards zero
+				template <typename W>
+				W
+				scale(W difference, T position) const;
+
+			private:
+				static constexpr uint8_t noShift = 0xff;
+
+				T step;
+				uint8_t shift;
+			};
+
+			/// For floating point types the position is in the range [0, 1)
+			template <typename T>
+			class UniformStep<T, true>
+			{
+			public:
+				UniformStep(T step);
+
+				/// Divides \p range into \p count intervals
+				static T
+				getStepForRange(T range, uint8_t count);
+
+				inline T
+				getStep() const
+				{
+					return step;
+				}
+
+				uint16_t
+				getIndex(T offset, T* position) const;
+
+				template <typename W>
+				W
+				scale(W difference, T position) const;
+
+			private:
+				T step;
+				T inverse;
+			};
+		}
+
+		/**
+		 * \brief	Linear interpolation in a table with equidistant supporting points
+		 *
+		 * Only the output values are stored, the supporting point i is
+		 * located at \c start + i * \c step. The interval containing the
+		 * input value is calculated directly instead of searching through
+		 * the table like Linear does, so every call needs the same (short)
+		 * time independent of the size of the table.
+		 *
+		 * For integer input types a power of two as \p step is recommended,
+		 * the division is then replaced by a shift.
+		 *
+		 * Values outside of the table are clamped to the first respectively
+		 * last value.
+		 *
+		 * Example:
+		 * \code
+		 * // NTC resistor, temperature in 0.1 degree for every 64th ADC value
+		 * FLASH_STORAGE(int16_t temperature[17]) =
+		 * {
+		 *     1500, 1120, 890, ...
+		 * };
+		 *
+		 * xpcc::interpolation::Uniform<uint16_t, int16_t, xpcc::accessor::Flash>
+		 *         ntc(xpcc::accessor::asFlash(temperature), 17, 0, 64);
+		 *
+		 * int16_t t = ntc.interpolate(adcValue);
+		 * \endcode
+		 *
+		 * Use generateTable() to calculate the table at compile time.
+		 *
+		 * \tparam	InputType	Type of the input values
+		 * \tparam	OutputType	Type of the table entries
+		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
+		 * 						xpcc::accessor::Flash or any self defined
+		 * 						accessor class.
+		 * 						Default is xpcc::accessor::Ram.
+		 *
+		 * \see		Table
+		 * \ingroup	interpolation
+		 */
+		template <typename InputType, typename OutputType,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class Uniform
+		{
+		public:
+			typedef typename ArithmeticTraits< OutputType >::SignedType OutputSignedType;
+			typedef typename ArithmeticTraits< OutputSignedType >::WideType WideType;
+
+			/// Distance from the start, unsigned to cover the full input range
+			typedef typename ArithmeticTraits< InputType >::UnsignedType OffsetType;
+
+		public:
+			/**
+			 * \brief	Constructor
+			 *
+			 * \param	values			Output values at the supporting points
+			 * \param	numberOfPoints	Length of \p values, at least 2
+			 * \param	start			Input value of the first entry
+			 * \param	step			Distance between two supporting points,
+			 * 							needs to be positive
+			 */
+			Uniform(Accessor<OutputType> values, uint16_t numberOfPoints,
+					InputType start, InputType step);
+
+			/**
+			 * \brief	Perform a linear interpolation
+			 *
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType
+			interpolate(const InputType& value) const;
+
+			/**
+			 * \brief	Interpolate a whole array of input values
+			 *
+			 * \param	input	Input values
+			 * \param	output	Interpolated values, may be the same array
+			 * 					as \p input if the types are equal
+			 * \param	count	Length of \p input and \p output
+			 */
+			void
+			interpolate(const InputType* input, OutputType* output,
+					std::size_t count) const;
+
+			inline InputType
+			getStart() const
+			{
+				return start;
+			}
+
+			/// Input value of the last entry
+			inline InputType
+			getEnd() const
+			{
+				return end;
+			}
+
+		private:
+			const Accessor<OutputType> values;
+			const uint16_t numberOfPoints;
+			const InputType start;
+			const InputType end;
+			const detail::UniformStep<OffsetType> step;
+		};
+	}
+}
+
+#include "uniform_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__UNIFORM_HPP
@@ -0,0 +1,166 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__UNIFORM_HPP
+   #error "Don't include this file directly. Use 'xpcc/math/interpolation/uniform.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, bool isFloatingPoint>
+constexpr uint8_t xpcc::interpolation::detail::UniformStep<T, isFloatingPoint>::noShift;
+
+template <typename T, bool isFloatingPoint>
+xpcc::interpolation::detail::UniformStep<T, isFloatingPoint>::UniformStep(T step) :
+	step(step), shift(noShift)
+{
+	if ((step & (step - 1)) == 0)
+	{
+		shift = 0;
+		while ((T(1) << shift) != step) {
+			++shift;
+		}
+	}
+}
+
+template <typename T, bool isFloatingPoint>
+T
+xpcc::interpolation::detail::UniformStep<T, isFloatingPoint>::getStepForRange(
+		T range, uint8_t count)
+{
+	T step = 1;
+	while ((range / step) >= count) {
+		step <<= 1;
+	}
+	return step;
+}
+
+template <typename T, bool isFloatingPoint>
+uint16_t
+xpcc::interpolation::detail::UniformStep<T, isFloatingPoint>::getIndex(
+		T offset, T* position) const
+{
+	if (shift != noShift)
+	{
+		*position = offset & (step - 1);
+		return offset >> shift;
+	}
+
+	const T index = offset / step;
+	*position = offset - index * step;
+	return index;
+}
+
+template <typename T, bool isFloatingPoint> template <typename W>
+W
+xpcc::interpolation::detail::UniformStep<T, isFloatingPoint>::scale(
+		W difference, T position) const
+{
+	const W product = difference * static_cast<W>(position);
+	if (shift != noShift)
+	{
+		// a shift of a negative value would round towards minus infinity
+		if (product < 0) {
+			return -((-product) >> shift);
+		}
+		return product >> shift;
+	}
+	return product / static_cast<W>(step);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+xpcc::interpolation::detail::UniformStep<T, true>::UniformStep(T step) :
+	step(step), inverse(T(1) / step)
+{
+}
+
+template <typename T>
+T
+xpcc::interpolation::detail::UniformStep<T, true>::getStepForRange(
+		T range, uint8_t count)
+{
+	if (range <= T(0)) {
+		return T(1);
+	}
+	return range / static_cast<T>(count);
+}
+
+template <typename T>
+uint16_t
+xpcc::interpolation::detail::UniformStep<T, true>::getIndex(
+		T offset, T* position) const
+{
+	const T scaled = offset * inverse;
+	const uint16_t index = static_cast<uint16_t>(scaled);
+	*position = scaled - static_cast<T>(index);
+	return index;
+}
+
+template <typename T> template <typename W>
+W
+xpcc::interpolation::detail::UniformStep<T, true>::scale(
+		W difference, T position) const
+{
+	return static_cast<W>(static_cast<T>(difference) * position);
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+xpcc::interpolation::Uniform<InputType, OutputType, Accessor>::Uniform(
+		Accessor<OutputType> values, uint16_t numberOfPoints,
+		InputType start, InputType step) :
+	values(values), numberOfPoints(numberOfPoints),
+	start(start), end(start + step * static_cast<InputType>(numberOfPoints - 1)),
+	step(static_cast<OffsetType>(step))
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+OutputType
+xpcc::interpolation::Uniform<InputType, OutputType, Accessor>::interpolate(
+		const InputType& value) const
+{
+	if (value <= start) {
+		return values[0];
+	}
+	if (value >= end) {
+		return values[numberOfPoints - 1];
+	}
+
+	OffsetType position;
+	const uint16_t index = step.getIndex(
+			static_cast<OffsetType>(static_cast<OffsetType>(value) -
+									static_cast<OffsetType>(start)),
+			&position);
+
+	// rounding errors of floating point types might give the last index
+	if (index >= numberOfPoints - 1) {
+		return values[numberOfPoints - 1];
+	}
+
+	const OutputType y1 = values[index];
+	const OutputType y2 = values[index + 1];
+	const WideType difference = static_cast<WideType>(y2) - static_cast<WideType>(y1);
+
+	return static_cast<OutputType>(y1 + step.scale(difference, position));
+}
+
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+void
+xpcc::interpolation::Uniform<InputType, OutputType, Accessor>::interpolate(
+		const InputType* input, OutputType* output, std::size_t count) const
+{
+	for (std::size_t i = 0; i < count; ++i) {
+		output[i] = interpolate(input[i]);
+	}
+}
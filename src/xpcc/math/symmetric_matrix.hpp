@@ -0,0 +1,138 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SYMMETRIC_MATRIX_HPP
+#define XPCC__SYMMETRIC_MATRIX_HPP
+
+#include <stdint.h>
+#include <string.h>		// for memcmp()
+
+#include "matrix.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Square symmetric matrix with packed storage
+	 *
+	 * Only the lower triangle (including the diagonal) is stored, row
+	 * by row. A NxN matrix therefore needs N*(N+1)/2 instead of N*N
+	 * elements, which roughly halves the memory and the number of
+	 * operations for algorithms working on covariance matrices.
+	 *
+	 * Element (row, column) and (column, row) always refer to the same
+	 * storage location.
+	 *
+	 * \code
+	 * xpcc::SymmetricMatrix<float, 3> p = xpcc::SymmetricMatrix<float, 3>::identityMatrix();
+	 * p(2, 0) = 0.5f;		// also sets p(0, 2)
+	 * \endcode
+	 *
+	 * \tparam	T	Element type
+	 * \tparam	N	Number of rows and columns
+	 *
+	 * \ingroup	matrix
+	 */
+	template<typename T, uint8_t N>
+	class SymmetricMatrix
+	{
+	public:
+		/// Number of stored elements
+		static constexpr uint16_t NumberOfElements = uint16_t(N) * (N + 1) / 2;
+
+	public:
+		/// Creates a matrix with uninitialized elements
+		SymmetricMatrix()
+		{
+		}
+
+		/**
+		 * \brief	Create from a full matrix
+		 *
+		 * Only the lower triangle of \p m is used.
+		 */
+		explicit
+		SymmetricMatrix(const Matrix<T, N, N> &m);
+
+		static SymmetricMatrix
+		zeroMatrix();
+
+		static SymmetricMatrix
+		identityMatrix();
+
+		/// Diagonal matrix with all diagonal elements set to \p value
+		static SymmetricMatrix
+		diagonalMatrix(const T& value);
+
+		/// Index of element (row, column) in the packed storage
+		static inline uint16_t
+		getIndex(uint8_t row, uint8_t column)
+		{
+			return (row >= column) ?
+					(uint16_t(row) * (row + 1) / 2 + column) :
+					(uint16_t(column) * (column + 1) / 2 + row);
+		}
+
+		inline const T&
+		operator () (uint8_t row, uint8_t column) const
+		{
+			return element[getIndex(row, column)];
+		}
+
+		inline T&
+		operator () (uint8_t row, uint8_t column)
+		{
+			return element[getIndex(row, column)];
+		}
+
+		bool
+		operator == (const SymmetricMatrix &m) const
+		{
+			return memcmp(element, m.element, sizeof(element)) == 0;
+		}
+
+		bool
+		operator != (const SymmetricMatrix &m) const
+		{
+			return !(*this == m);
+		}
+
+		SymmetricMatrix&
+		operator += (const SymmetricMatrix &rhs);
+
+		SymmetricMatrix&
+		operator -= (const SymmetricMatrix &rhs);
+
+		/// Expand into a full matrix
+		Matrix<T, N, N>
+		asMatrix() const;
+
+		inline uint8_t
+		getNumberOfRows() const
+		{
+			return N;
+		}
+
+		inline uint8_t
+		getNumberOfColumns() const
+		{
+			return N;
+		}
+
+	public:
+		T element[NumberOfElements];
+	};
+
+	template<typename T, uint8_t N>
+	IOStream&
+	operator << (IOStream&, const SymmetricMatrix<T, N>&);
+}
+
+#include "symmetric_matrix_impl.hpp"
+
+#endif	// XPCC__SYMMETRIC_MATRIX_HPP
@@ -0,0 +1,104 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SYMMETRIC_MATRIX_HPP
+#	error	"Don't include this file directly, use 'symmetric_matrix.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+constexpr uint16_t xpcc::SymmetricMatrix<T, N>::NumberOfElements;
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>::SymmetricMatrix(const Matrix<T, N, N> &m)
+{
+	uint_fast16_t k = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j <= i; ++j) {
+			element[k++] = m[i][j];
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>
+xpcc::SymmetricMatrix<T, N>::zeroMatrix()
+{
+	return diagonalMatrix(T());
+}
+
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>
+xpcc::SymmetricMatrix<T, N>::identityMatrix()
+{
+	return diagonalMatrix(T(1));
+}
+
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>
+xpcc::SymmetricMatrix<T, N>::diagonalMatrix(const T& value)
+{
+	SymmetricMatrix m;
+	uint_fast16_t k = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j < i; ++j) {
+			m.element[k++] = T();
+		}
+		m.element[k++] = value;
+	}
+	return m;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>&
+xpcc::SymmetricMatrix<T, N>::operator += (const SymmetricMatrix &rhs)
+{
+	for (uint_fast16_t i = 0; i < NumberOfElements; ++i) {
+		element[i] += rhs.element[i];
+	}
+	return *this;
+}
+
+template<typename T, uint8_t N>
+xpcc::SymmetricMatrix<T, N>&
+xpcc::SymmetricMatrix<T, N>::operator -= (const SymmetricMatrix &rhs)
+{
+	for (uint_fast16_t i = 0; i < NumberOfElements; ++i) {
+		element[i] -= rhs.element[i];
+	}
+	return *this;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::Matrix<T, N, N>
+xpcc::SymmetricMatrix<T, N>::asMatrix() const
+{
+	Matrix<T, N, N> m;
+	uint_fast16_t k = 0;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j <= i; ++j) {
+			m[i][j] = element[k];
+			m[j][i] = element[k];
+			++k;
+		}
+	}
+	return m;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+xpcc::IOStream&
+xpcc::operator << (xpcc::IOStream& os, const xpcc::SymmetricMatrix<T, N> &m)
+{
+	return os << m.asMatrix();
+}
@@ -23,5 +23,6 @@
 
 #include "processing/task.hpp"
 #include "processing/scheduler/scheduler.hpp"
+#include "processing/scheduler/realtime_scheduler.hpp"
 
 #endif	// XPCC_PROCESSING_HPP
@@ -65,3 +65,4 @@
 
 #include "protothread/protothread.hpp"
 #include "protothread/semaphore.hpp"
+#include "protothread/event.hpp"
@@ -0,0 +1,181 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "event.hpp"
+
+#if defined(XPCC__CPU_AVR)
+#	include <avr/sleep.h>
+#endif
+
+xpcc::pt::EventLoop::Task* xpcc::pt::EventLoop::current = nullptr;
+
+// ----------------------------------------------------------------------------
+xpcc::pt::EventLoop::Task::Task() :
+	loop(nullptr), state(STOPPED)
+{
+}
+
+// ----------------------------------------------------------------------------
+xpcc::pt::EventLoop::EventLoop()
+{
+}
+
+xpcc::pt::EventLoop::~EventLoop()
+{
+	atomic::Lock lock;
+	while (!this->ready.isEmpty())
+	{
+		Task& task = this->ready.getFront();
+		task.unlink();
+		task.state = Task::STOPPED;
+		task.loop = nullptr;
+	}
+}
+
+void
+xpcc::pt::EventLoop::add(Task& task)
+{
+	atomic::Lock lock;
+	task.loop = this;
+	this->schedule(task);
+}
+
+void
+xpcc::pt::EventLoop::remove(Task& task)
+{
+	atomic::Lock lock;
+	// also removes the task from the event it is waiting for
+	task.unlink();
+	task.state = Task::STOPPED;
+	task.loop = nullptr;
+}
+
+bool
+xpcc::pt::EventLoop::update()
+{
+	// The tasks which are ready now, the others (and the ones which are
+	// run again) are added to the ready list meanwhile.
+	IntrusiveDoublyLinkedList<Task> batch;
+	{
+		atomic::Lock lock;
+		batch.splice(this->ready);
+	}
+
+	bool executed = false;
+	while (true)
+	{
+		Task* task;
+		{
+			atomic::Lock lock;
+			if (batch.isEmpty()) {
+				break;
+			}
+			task = &batch.getFront();
+			task->unlink();
+			task->state = Task::RUNNING;
+		}
+
+		current = task;
+		const bool running = task->run();
+		current = nullptr;
+		executed = true;
+
+		atomic::Lock lock;
+		if (task->state == Task::RUNNING)
+		{
+			if (running) {
+				// did not wait for an event
+				this->schedule(*task);
+			}
+			else {
+				task->state = Task::STOPPED;
+				task->loop = nullptr;
+			}
+		}
+		else if (!running && task->state != Task::STOPPED) {
+			// finished after calling Event::wait()
+			this->remove(*task);
+		}
+	}
+	return executed;
+}
+
+bool
+xpcc::pt::EventLoop::isReady() const
+{
+	atomic::Lock lock;
+	return !this->ready.isEmpty();
+}
+
+void
+xpcc::pt::EventLoop::sleep()
+{
+	atomic::Lock lock;
+	if (!this->ready.isEmpty()) {
+		return;
+	}
+
+#if defined(XPCC__CPU_AVR)
+	// sei() takes effect after the next instruction, so no interrupt can
+	// occur between enabling the interrupts and going to sleep
+	sleep_enable();
+	sei();
+	sleep_cpu();
+	sleep_disable();
+#elif defined(XPCC__CPU_ARM)
+	// wakes up on a pending interrupt even if the interrupts are disabled,
+	// the handler is then executed when the lock is released
+	asm volatile ("wfi" ::: "memory");
+#endif
+}
+
+// ----------------------------------------------------------------------------
+xpcc::pt::Event::Event() :
+	pending(false)
+{
+}
+
+void
+xpcc::pt::Event::signal()
+{
+	atomic::Lock lock;
+	if (this->waiting.isEmpty())
+	{
+		this->pending = true;
+		return;
+	}
+
+	while (!this->waiting.isEmpty())
+	{
+		EventLoop::Task& task = this->waiting.getFront();
+		task.loop->schedule(task);
+	}
+}
+
+bool
+xpcc::pt::Event::wait()
+{
+	EventLoop::Task* task = EventLoop::getCurrentTask();
+	if (task == nullptr) {
+		// not run by an EventLoop, the caller polls
+		return true;
+	}
+
+	atomic::Lock lock;
+	if (this->pending)
+	{
+		// signaled before, the task is run again on the next update()
+		this->pending = false;
+		return true;
+	}
+
+	task->state = EventLoop::Task::WAITING;
+	this->waiting.append(*task);
+	return true;
+}
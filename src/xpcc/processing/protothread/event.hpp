@@ -0,0 +1,256 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PT__EVENT_HPP
+#define XPCC_PT__EVENT_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
+
+namespace xpcc
+{
+	namespace pt
+	{
+		class Event;
+
+		/**
+		 * \brief	Runs only the protothreads which are ready
+		 *
+		 * In a plain super-loop every protothread is run on every pass and
+		 * re-evaluates the condition it waits for, even if nothing has
+		 * changed. A task of an EventLoop instead parks on an Event with
+		 * PT_WAIT_EVENT_UNTIL() or RF_WAIT_EVENT_UNTIL() and is not run
+		 * again until the event is signaled. Only tasks which are ready are
+		 * kept in the queue, so waiting tasks cost nothing.
+		 *
+		 * \code
+		 * xpcc::pt::Event dataReady;
+		 *
+		 * class Reader : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+		 * {
+		 * public:
+		 *     bool
+		 *     run()
+		 *     {
+		 *         PT_BEGIN();
+		 *         while (true)
+		 *         {
+		 *             // parks until dataReady is signaled
+		 *             PT_WAIT_EVENT_UNTIL(dataReady, buffer.isNotEmpty());
+		 *             ...
+		 *         }
+		 *         PT_END();
+		 *     }
+		 * };
+		 *
+		 * // in the interrupt
+		 * buffer.push(data);
+		 * dataReady.signal();
+		 *
+		 * // main
+		 * xpcc::pt::EventLoop loop;
+		 * loop.add(reader);
+		 *
+		 * while (true)
+		 * {
+		 *     loop.update();
+		 *     loop.sleep();
+		 * }
+		 * \endcode
+		 *
+		 * Tasks which return from run() without waiting for an event (e.g.
+		 * with PT_YIELD() or PT_WAIT_UNTIL()) are run again on the next
+		 * update(), like in a super-loop. Timeouts can be turned into events
+		 * with a xpcc::GenericTimerWheel, whose handler signals the event.
+		 *
+		 * \warning	Only one EventLoop may run at the same time.
+		 *
+		 * \ingroup	protothread
+		 */
+		class EventLoop
+		{
+		public:
+			/**
+			 * \brief	Task of an EventLoop
+			 *
+			 * Usually combined with a Protothread, whose run() method
+			 * implements this interface.
+			 */
+			class Task : public IntrusiveDoublyLinkedListHook<>
+			{
+			public:
+				Task();
+
+				/// \return	\c false if the task has finished
+				virtual bool
+				run() = 0;
+
+				/// \c true if the task is waiting for an event
+				inline bool
+				isWaiting() const
+				{
+					return (this->state == WAITING);
+				}
+
+				/// \c true if the task belongs to an EventLoop
+				inline bool
+				isScheduled() const
+				{
+					return (this->state != STOPPED);
+				}
+
+			private:
+				friend class EventLoop;
+				friend class Event;
+
+				enum
+				State : uint8_t
+				{
+					STOPPED,
+					READY,
+					RUNNING,
+					WAITING,
+				};
+
+				EventLoop* loop;
+				volatile State state;
+			};
+
+		public:
+			EventLoop();
+
+			/// Removes the ready tasks, waiting tasks have to be removed before
+			~EventLoop();
+
+			/// Start running \p task, it is run on the next update()
+			void
+			add(Task& task);
+
+			/**
+			 * \brief	Stop running \p task
+			 *
+			 * May be called from inside of a task, even for the running
+			 * task.
+			 */
+			void
+			remove(Task& task);
+
+			/**
+			 * \brief	Run every task once, which is ready
+			 *
+			 * Tasks which become ready while running the others (e.g. from
+			 * an interrupt) are run by the next call.
+			 *
+			 * \return	\c true if a task has been run
+			 */
+			bool
+			update();
+
+			/// \c true if there are tasks to run
+			bool
+			isReady() const;
+
+			/**
+			 * \brief	Sleep until the next interrupt, if no task is ready
+			 *
+			 * Uses \c WFI on ARM Cortex-M and the sleep mode on AVR. Checking
+			 * for ready tasks and going to sleep happens with interrupts
+			 * disabled, so no signal from an interrupt gets lost. Returns
+			 * immediately on the hosted targets.
+			 */
+			void
+			sleep();
+
+			/// Task which is run right now, \c nullptr outside of update()
+			static inline Task*
+			getCurrentTask()
+			{
+				return current;
+			}
+
+		private:
+			friend class Event;
+
+			/// Must be called with interrupts disabled
+			inline void
+			schedule(Task& task)
+			{
+				task.state = Task::READY;
+				this->ready.append(task);
+			}
+
+			IntrusiveDoublyLinkedList<Task> ready;
+
+			static Task* current;
+
+		private:
+			EventLoop(const EventLoop& other);
+
+			EventLoop&
+			operator = (const EventLoop& other);
+		};
+
+		/**
+		 * \brief	Event the tasks of an EventLoop can wait for
+		 *
+		 * signal() resumes all tasks waiting for the event. It may be called
+		 * from an interrupt. If no task is waiting, the signal is remembered
+		 * until the next wait(), so that a task can not miss a signal which
+		 * arrives between checking its condition and parking.
+		 *
+		 * Outside of an EventLoop wait() does nothing, the macros then fall
+		 * back to polling the condition.
+		 *
+		 * \ingroup	protothread
+		 */
+		class Event
+		{
+		public:
+			Event();
+
+			/// Resumes the waiting tasks, interrupt safe
+			void
+			signal();
+
+			/**
+			 * \brief	Park the current task of the EventLoop until the
+			 * 			next signal
+			 *
+			 * Use PT_WAIT_EVENT_UNTIL() or RF_WAIT_EVENT_UNTIL() instead of
+			 * calling this method directly. The task has to return from
+			 * run() afterwards.
+			 *
+			 * \return	always \c true, for use in the macros
+			 */
+			bool
+			wait();
+
+			/// \c true if at least one task is waiting
+			inline bool
+			hasWaitingTasks() const
+			{
+				return !this->waiting.isEmpty();
+			}
+
+		private:
+			IntrusiveDoublyLinkedList<EventLoop::Task> waiting;
+			volatile bool pending;
+
+		private:
+			Event(const Event& other);
+
+			Event&
+			operator = (const Event& other);
+		};
+	}
+}
+
+#endif // XPCC_PT__EVENT_HPP
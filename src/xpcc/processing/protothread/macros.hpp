@@ -65,9 +65,13 @@
  */
 #define PT_YIELD() \
     do { \
+		RF_INTERNAL_PROFILE_POINT(Yield) \
+		RF_INTERNAL_PROFILE_START(this->ptProfilerStart) \
 		this->ptState = __LINE__; \
 		return true; \
 		case __LINE__: ; \
+		RF_INTERNAL_PROFILE_HIT() \
+		RF_INTERNAL_PROFILE_PASS(this->ptProfilerStart) \
 	} while (0)
 
 /**
@@ -78,11 +82,15 @@
  */
 #define PT_WAIT_WHILE(condition) \
     do { \
+		RF_INTERNAL_PROFILE_POINT(Wait) \
+		RF_INTERNAL_PROFILE_START(this->ptProfilerStart) \
 		this->ptState = __LINE__; \
 		XPCC_FALLTHROUGH; \
 		case __LINE__: \
+			RF_INTERNAL_PROFILE_HIT() \
 			if (condition) \
 				return true; \
+			RF_INTERNAL_PROFILE_PASS(this->ptProfilerStart) \
     } while (0)
 
 /**
@@ -94,6 +102,35 @@
 #define PT_WAIT_UNTIL(condition) \
 	PT_WAIT_WHILE(!(condition))
 
+/**
+ * Cause protothread to wait until given `condition` is true and park it on
+ * the xpcc::pt::Event `event` meanwhile.
+ *
+ * When run by a xpcc::pt::EventLoop, the protothread is only resumed (and
+ * the condition re-evaluated) after the event was signaled. Otherwise this
+ * is the same as PT_WAIT_UNTIL().
+ *
+ * \ingroup	protothread
+ * \hideinitializer
+ */
+#define PT_WAIT_EVENT_UNTIL(event, condition) \
+	PT_WAIT_WHILE(!(condition) && (event).wait())
+
+/**
+ * Cause protothread to wait for the next signal of the xpcc::pt::Event
+ * `event`.
+ *
+ * Outside of a xpcc::pt::EventLoop this is the same as PT_YIELD().
+ *
+ * \ingroup	protothread
+ * \hideinitializer
+ */
+#define PT_WAIT_EVENT(event) \
+	do { \
+		(event).wait(); \
+		PT_YIELD(); \
+	} while (0)
+
 /**
  * Cause protothread to wait until given child protothread completes.
  *
@@ -124,13 +161,18 @@
  */
 #define PT_CALL(resumable) \
 	({ \
+		RF_INTERNAL_PROFILE_POINT(Call) \
+		RF_INTERNAL_PROFILE_START(this->ptProfilerStart) \
 		this->ptState = __LINE__; \
 		XPCC_FALLTHROUGH; \
 		case __LINE__: \
 			auto rfResult = resumable; \
+			RF_INTERNAL_PROFILE_HIT() \
+			RF_INTERNAL_PROFILE_RESULT(rfResult.getState()) \
 			if (rfResult.getState() > xpcc::rf::NestingError) { \
 				return true; \
 			} \
+			RF_INTERNAL_PROFILE_PASS(this->ptProfilerStart) \
 			rfResult.getResult(); \
 	})
 
@@ -188,6 +188,11 @@ namespace xpcc
 			 * the last PT_WAIT, which is then switched on at the next Run).
 			 */
 			PtState ptState;
+
+#if XPCC_RESUMABLE_PROFILING
+			/// Start of the current wait, see xpcc::rf::Profiler
+			xpcc::rf::ProfilerPoint::Time ptProfilerStart;
+#endif
 			/// @endcond
 		};
 	}
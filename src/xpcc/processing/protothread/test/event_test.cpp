@@ -0,0 +1,271 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/processing/protothread.hpp>
+#include <xpcc/processing/resumable.hpp>
+
+#include "event_test.hpp"
+
+namespace
+{
+	class WaitingTask : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+	{
+	public:
+		WaitingTask(xpcc::pt::Event& event) :
+			event(event), condition(false), runs(0), state(0)
+		{
+		}
+
+		bool
+		run()
+		{
+			runs++;
+			PT_BEGIN();
+
+			state = 1;
+			PT_WAIT_EVENT_UNTIL(event, condition);
+
+			state = 2;
+			PT_WAIT_EVENT(event);
+
+			state = 3;
+			PT_END();
+		}
+
+		xpcc::pt::Event& event;
+		bool condition;
+		uint8_t runs;
+		uint8_t state;
+	};
+
+	class YieldingTask : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+	{
+	public:
+		YieldingTask() :
+			runs(0)
+		{
+		}
+
+		bool
+		run()
+		{
+			runs++;
+			PT_BEGIN();
+
+			while (runs < 3) {
+				PT_YIELD();
+			}
+
+			PT_END();
+		}
+
+		uint8_t runs;
+	};
+
+	class Driver : public xpcc::NestedResumable<2>
+	{
+	public:
+		Driver(xpcc::pt::Event& event) :
+			event(event), ready(false)
+		{
+		}
+
+		xpcc::ResumableResult<uint8_t>
+		read()
+		{
+			RF_BEGIN();
+
+			RF_WAIT_EVENT_UNTIL(event, ready);
+
+			RF_END_RETURN(42);
+		}
+
+		xpcc::pt::Event& event;
+		bool ready;
+	};
+
+	class DriverTask : public xpcc::pt::Protothread, public xpcc::pt::EventLoop::Task
+	{
+	public:
+		DriverTask(Driver& driver) :
+			driver(driver), runs(0), value(0)
+		{
+		}
+
+		bool
+		run()
+		{
+			runs++;
+			PT_BEGIN();
+
+			value = PT_CALL(driver.read());
+
+			PT_END();
+		}
+
+		Driver& driver;
+		uint8_t runs;
+		uint8_t value;
+	};
+}
+
+void
+EventTest::testWaitForEvent()
+{
+	xpcc::pt::Event event;
+	xpcc::pt::EventLoop loop;
+	WaitingTask task(event);
+
+	TEST_ASSERT_FALSE(loop.isReady());
+	TEST_ASSERT_FALSE(loop.update());
+
+	loop.add(task);
+	TEST_ASSERT_TRUE(task.isScheduled());
+	TEST_ASSERT_TRUE(loop.isReady());
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.state, 1);
+	TEST_ASSERT_TRUE(task.isWaiting());
+	TEST_ASSERT_TRUE(event.hasWaitingTasks());
+
+	// the task is not run until the event is signaled
+	TEST_ASSERT_FALSE(loop.update());
+	TEST_ASSERT_FALSE(loop.update());
+	TEST_ASSERT_EQUALS(task.runs, 1);
+
+	// the condition is still false, parks again
+	event.signal();
+	TEST_ASSERT_FALSE(event.hasWaitingTasks());
+	TEST_ASSERT_TRUE(loop.isReady());
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.runs, 2);
+	TEST_ASSERT_EQUALS(task.state, 1);
+	TEST_ASSERT_TRUE(task.isWaiting());
+
+	task.condition = true;
+	event.signal();
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.state, 2);
+	TEST_ASSERT_TRUE(task.isWaiting());
+
+	event.signal();
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.state, 3);
+	TEST_ASSERT_FALSE(task.isRunning());
+	TEST_ASSERT_FALSE(task.isScheduled());
+	TEST_ASSERT_FALSE(loop.update());
+	TEST_ASSERT_EQUALS(task.runs, 4);
+}
+
+void
+EventTest::testPendingSignal()
+{
+	xpcc::pt::Event event;
+	xpcc::pt::EventLoop loop;
+	WaitingTask task(event);
+	loop.add(task);
+
+	// signaled before the task waits, e.g. by an interrupt
+	event.signal();
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.state, 1);
+	TEST_ASSERT_FALSE(task.isWaiting());
+
+	// the signal is consumed
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_TRUE(task.isWaiting());
+	TEST_ASSERT_FALSE(loop.update());
+	TEST_ASSERT_EQUALS(task.runs, 2);
+}
+
+void
+EventTest::testWithoutEventLoop()
+{
+	xpcc::pt::Event event;
+	WaitingTask task(event);
+
+	// polls the condition
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(task.state, 1);
+	TEST_ASSERT_FALSE(event.hasWaitingTasks());
+
+	task.condition = true;
+	TEST_ASSERT_TRUE(task.run());
+	TEST_ASSERT_EQUALS(task.state, 2);
+	TEST_ASSERT_FALSE(task.run());
+	TEST_ASSERT_EQUALS(task.state, 3);
+}
+
+void
+EventTest::testYield()
+{
+	xpcc::pt::EventLoop loop;
+	YieldingTask task;
+	loop.add(task);
+
+	// run on every update, like in a super-loop
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_TRUE(loop.isReady());
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.runs, 3);
+	TEST_ASSERT_FALSE(task.isScheduled());
+	TEST_ASSERT_FALSE(loop.update());
+
+	// the sleep returns immediately on hosted
+	loop.sleep();
+}
+
+void
+EventTest::testRemove()
+{
+	xpcc::pt::Event event;
+	xpcc::pt::EventLoop loop;
+	WaitingTask a(event);
+	WaitingTask b(event);
+	loop.add(a);
+	loop.add(b);
+
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_TRUE(a.isWaiting());
+	TEST_ASSERT_TRUE(b.isWaiting());
+
+	loop.remove(a);
+	TEST_ASSERT_FALSE(a.isScheduled());
+
+	event.signal();
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(a.runs, 1);
+	TEST_ASSERT_EQUALS(b.runs, 2);
+
+	loop.remove(b);
+	TEST_ASSERT_FALSE(event.hasWaitingTasks());
+	TEST_ASSERT_FALSE(loop.update());
+}
+
+void
+EventTest::testResumable()
+{
+	xpcc::pt::Event event;
+	xpcc::pt::EventLoop loop;
+	Driver driver(event);
+	DriverTask task(driver);
+	loop.add(task);
+
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_TRUE(task.isWaiting());
+	TEST_ASSERT_FALSE(loop.update());
+
+	driver.ready = true;
+	event.signal();
+	TEST_ASSERT_TRUE(loop.update());
+	TEST_ASSERT_EQUALS(task.value, 42);
+	TEST_ASSERT_EQUALS(task.runs, 2);
+	TEST_ASSERT_FALSE(task.isScheduled());
+}
@@ -109,6 +109,11 @@
  *
  * For other examples take a look in the `examples` folder in the XPCC
  * root folder. The given example is in `examples/generic/resumable`.
+ *
+ * With C++20 the resumable functions can also be written as coroutines,
+ * which keep their local variables and nest without a fixed depth. See
+ * xpcc::Coroutine in `<xpcc/processing/resumable/coroutine.hpp>`, which is
+ * not included here.
  */
 
 #include "resumable/resumable.hpp"
@@ -0,0 +1,685 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_RF_COROUTINE_HPP
+#define XPCC_RF_COROUTINE_HPP
+
+#ifndef __cpp_impl_coroutine
+#	error "xpcc::Coroutine needs C++20 coroutines, compile with -std=c++20!"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <utility>
+#include <stdint.h>
+
+#include <xpcc/utils/allocator/static.hpp>
+
+#include "resumable.hpp"
+
+namespace xpcc
+{
+
+namespace co
+{
+
+/// Allocates the coroutine frames on the heap.
+/// @ingroup	resumable
+struct HeapFrames
+{
+	static inline void*
+	allocate(std::size_t size) noexcept
+	{
+		return ::operator new(size, std::nothrow);
+	}
+
+	static inline void
+	deallocate(void* frame, std::size_t) noexcept
+	{
+		::operator delete(frame);
+	}
+};
+
+/**
+ * Allocates the coroutine frames from a static pool of `Blocks` blocks of
+ * `BlockSize` bytes, no heap is used.
+ *
+ * A frame occupies as many contiguous blocks as needed. All coroutines
+ * using the same template arguments share the pool. If the pool is
+ * exhausted, the coroutine is not created, like a NestedResumable out of
+ * nesting levels: `resume()` of the outermost coroutine returns
+ * `xpcc::rf::NestingError`, also if the frame of a nested coroutine could
+ * not be allocated. Check getFailed() and getPeak() to size the pool.
+ *
+ * @ingroup	resumable
+ */
+template< std::size_t Blocks, std::size_t BlockSize = 32 >
+class StaticFrames
+{
+	static_assert(BlockSize % alignof(std::max_align_t) == 0,
+			"BlockSize must be a multiple of the maximum alignment!");
+
+	struct alignas(std::max_align_t)
+	Block
+	{
+		uint8_t data[BlockSize];
+	};
+
+	typedef xpcc::allocator::Static<Block, Blocks> Allocator;
+
+public:
+	static inline void*
+	allocate(std::size_t size) noexcept
+	{
+		return Allocator().allocate((size + BlockSize - 1) / BlockSize);
+	}
+
+	static inline void
+	deallocate(void* frame, std::size_t) noexcept
+	{
+		Allocator().deallocate(static_cast<Block*>(frame));
+	}
+
+	/// Bytes currently allocated
+	static inline std::size_t
+	getUsed()
+	{
+		return Allocator().getUsed() * BlockSize;
+	}
+
+	/// Maximum number of bytes allocated at the same time
+	static inline std::size_t
+	getPeak()
+	{
+		return Allocator().getPeak() * BlockSize;
+	}
+
+	/// Number of frames which could not be allocated
+	static inline std::size_t
+	getFailed()
+	{
+		return Allocator().getFailed();
+	}
+};
+
+/// @cond
+namespace detail
+{
+
+struct PromiseBase
+{
+	/// Coroutine awaiting this one
+	std::coroutine_handle<> continuation;
+	/// Promise of the outermost coroutine, which is resumed by the user
+	PromiseBase* root;
+
+	// only used in the root: innermost suspended coroutine and the
+	// condition it waits for
+	std::coroutine_handle<> leaf;
+	bool (*poll)(void*);
+	void* pollContext;
+	// only used in the root: the frame of a nested coroutine could not be
+	// allocated, the coroutine is stopped
+	bool failed;
+
+	struct FinalAwaiter
+	{
+		inline bool
+		await_ready() noexcept
+		{ return false; }
+
+		template< typename Promise >
+		std::coroutine_handle<>
+		await_suspend(std::coroutine_handle<Promise> handle) noexcept
+		{
+			PromiseBase& promise = handle.promise();
+			if (promise.continuation)
+			{
+				// continue with the awaiting coroutine
+				promise.root->leaf = promise.continuation;
+				return promise.continuation;
+			}
+			return std::noop_coroutine();
+		}
+
+		inline void
+		await_resume() noexcept
+		{}
+	};
+
+	inline std::suspend_always
+	initial_suspend() noexcept
+	{ return {}; }
+
+	inline FinalAwaiter
+	final_suspend() noexcept
+	{ return {}; }
+
+	inline void
+	unhandled_exception()
+	{ std::terminate(); }
+};
+
+template< typename T >
+struct Promise : public PromiseBase
+{
+	T value;
+
+	inline void
+	return_value(T result)
+	{ value = result; }
+
+	inline T
+	getValue()
+	{ return value; }
+
+	inline ResumableResult<T>
+	getResult()
+	{ return {rf::Stop, value}; }
+};
+
+template<>
+struct Promise<void> : public PromiseBase
+{
+	inline void
+	return_void()
+	{}
+
+	inline void
+	getValue()
+	{}
+
+	inline ResumableResult<void>
+	getResult()
+	{ return {rf::Stop}; }
+};
+
+/// Awaiter which is resumed after `Derived::check(this)` returned `true`
+template< typename Derived >
+struct PollAwaiter
+{
+	template< typename Promise >
+	inline void
+	await_suspend(std::coroutine_handle<Promise> handle) noexcept
+	{
+		PromiseBase& root = *handle.promise().root;
+		root.poll = &Derived::check;
+		root.pollContext = static_cast<Derived*>(this);
+	}
+};
+
+} // namespace detail
+/// @endcond
+
+} // namespace co
+
+/**
+ * Resumable function implemented as a C++20 coroutine.
+ *
+ * The `switch` based resumable functions can not keep local variables
+ * across a yield, and the nesting depth of a NestedResumable is fixed. A
+ * coroutine keeps its local variables in its frame and can `co_await` other
+ * coroutines to any depth, only limited by the frame allocator:
+ *
+ * @code
+ * xpcc::Coroutine<uint16_t>
+ * Sensor::readAverage()
+ * {
+ *     uint32_t sum = 0;
+ *     for (uint8_t i = 0; i < 8; i++)
+ *     {
+ *         // nested coroutine
+ *         sum += co_await readSample();
+ *         // existing resumable functions can be called as well
+ *         XPCC_CO_CALL(display.update());
+ *     }
+ *     co_return sum / 8;
+ * }
+ *
+ * auto average = sensor.readAverage();
+ * while (average.resume().getState() == xpcc::rf::Running) {
+ *     // do something else
+ * }
+ * @endcode
+ *
+ * Calling the coroutine function only creates the frame. `resume()`
+ * continues the innermost running coroutine until it suspends and returns
+ * a `ResumableResult<T>` with the same states as a resumable function:
+ * `Running` while not finished, then `Stop` with the returned value.
+ * If the frame could not be allocated, `NestingError` is returned. The
+ * same applies if the frame of a nested coroutine could not be allocated,
+ * the coroutine is stopped at this `co_await` then.
+ *
+ * Suspend with `co_await xpcc::co::yield()`, `xpcc::co::waitUntil()` or
+ * `xpcc::co::waitEventUntil()`. Conditions are checked by `resume()`
+ * without resuming the coroutine.
+ *
+ * Use xpcc::co::ResumableAdapter to make a coroutine callable with
+ * `RF_CALL()` from existing resumable functions and protothreads.
+ *
+ * @warning	Needs C++20 (`-std=c++20`), this header is not included by
+ * 			`<xpcc/processing/resumable.hpp>`.
+ *
+ * @tparam	T		Type of the result, `void` for none. Must be default
+ * 					constructible, like for ResumableResult.
+ * @tparam	Frames	Allocator of the coroutine frames, e.g.
+ * 					xpcc::co::StaticFrames for a pool without heap.
+ *
+ * @ingroup	resumable
+ */
+template< typename T, typename Frames = co::HeapFrames >
+class Coroutine
+{
+public:
+	struct promise_type : public co::detail::Promise<T>
+	{
+		inline Coroutine
+		get_return_object() noexcept
+		{
+			this->root = this;
+			this->leaf = Handle::from_promise(*this);
+			this->poll = nullptr;
+			this->failed = false;
+			return Coroutine(Handle::from_promise(*this));
+		}
+
+		static inline Coroutine
+		get_return_object_on_allocation_failure() noexcept
+		{ return Coroutine(); }
+
+		static inline void*
+		operator new(std::size_t size) noexcept
+		{ return Frames::allocate(size); }
+
+		static inline void
+		operator delete(void* frame, std::size_t size) noexcept
+		{ Frames::deallocate(frame, size); }
+	};
+
+	typedef std::coroutine_handle<promise_type> Handle;
+
+private:
+	struct Awaiter
+	{
+		Handle child;
+
+		inline bool
+		await_ready() noexcept
+		{ return false; }
+
+		template< typename Promise >
+		std::coroutine_handle<>
+		await_suspend(std::coroutine_handle<Promise> parent) noexcept
+		{
+			co::detail::PromiseBase& root = *parent.promise().root;
+			if (not child)
+			{
+				// like a NestedResumable out of nesting levels: the
+				// parent is never resumed, resume() returns NestingError
+				root.failed = true;
+				return std::noop_coroutine();
+			}
+			child.promise().continuation = parent;
+			child.promise().root = &root;
+			root.leaf = child;
+			return child;
+		}
+
+		T
+		await_resume()
+		{
+			return child.promise().getValue();
+		}
+	};
+
+public:
+	/// Creates an empty coroutine
+	Coroutine() noexcept :
+		handle(nullptr)
+	{}
+
+	Coroutine(Coroutine&& other) noexcept :
+		handle(other.handle)
+	{
+		other.handle = nullptr;
+	}
+
+	Coroutine&
+	operator = (Coroutine&& other) noexcept
+	{
+		if (this != &other)
+		{
+			this->destroy();
+			this->handle = other.handle;
+			other.handle = nullptr;
+		}
+		return *this;
+	}
+
+	/// Destroys the frame, even if the coroutine has not finished
+	~Coroutine()
+	{
+		this->destroy();
+	}
+
+	/// `false` if empty or the frame could not be allocated
+	inline bool
+	isValid() const
+	{ return bool(handle); }
+
+	/// `true` if the coroutine has returned
+	inline bool
+	isFinished() const
+	{ return handle and handle.done(); }
+
+	/**
+	 * Continue the coroutine until it suspends or returns.
+	 *
+	 * @return	`Running`, `Stop` with the result, or `NestingError` if
+	 * 			the frame of this or of a nested coroutine could not be
+	 * 			allocated
+	 */
+	ResumableResult<T>
+	resume()
+	{
+		if (not handle or handle.promise().failed) {
+			return {rf::NestingError};
+		}
+		promise_type& root = handle.promise();
+		if (not handle.done())
+		{
+			if (root.poll != nullptr)
+			{
+				if (not root.poll(root.pollContext)) {
+					return {rf::Running};
+				}
+				root.poll = nullptr;
+			}
+			root.leaf.resume();
+			if (root.failed) {
+				return {rf::NestingError};
+			}
+			if (not handle.done()) {
+				return {rf::Running};
+			}
+		}
+		return root.getResult();
+	}
+
+	/// Awaiting a coroutine from another coroutine runs it to completion
+	/// and returns its result.
+	inline Awaiter
+	operator co_await() && noexcept
+	{
+		return Awaiter{handle};
+	}
+
+private:
+	explicit Coroutine(Handle handle) noexcept :
+		handle(handle)
+	{}
+
+	inline void
+	destroy()
+	{
+		if (handle) {
+			handle.destroy();
+		}
+		handle = nullptr;
+	}
+
+	Handle handle;
+
+	Coroutine(const Coroutine&) = delete;
+
+	Coroutine&
+	operator = (const Coroutine&) = delete;
+};
+
+namespace co
+{
+
+/// Suspend the coroutine until the next `resume()`.
+/// @ingroup	resumable
+inline std::suspend_always
+yield() noexcept
+{ return {}; }
+
+/// @cond
+template< typename Condition >
+struct WaitUntil : public detail::PollAwaiter< WaitUntil<Condition> >
+{
+	Condition condition;
+
+	WaitUntil(Condition condition) :
+		condition(condition)
+	{}
+
+	inline bool
+	await_ready()
+	{ return condition(); }
+
+	static bool
+	check(void* self)
+	{ return static_cast<WaitUntil*>(self)->condition(); }
+
+	inline void
+	await_resume() noexcept
+	{}
+};
+
+template< typename Event, typename Condition >
+struct WaitEventUntil : public detail::PollAwaiter< WaitEventUntil<Event, Condition> >
+{
+	Event& event;
+	Condition condition;
+
+	WaitEventUntil(Event& event, Condition condition) :
+		event(event), condition(condition)
+	{}
+
+	inline bool
+	await_ready()
+	{ return condition(); }
+
+	template< typename Promise >
+	inline void
+	await_suspend(std::coroutine_handle<Promise> handle) noexcept
+	{
+		detail::PollAwaiter<WaitEventUntil>::await_suspend(handle);
+		event.wait();
+	}
+
+	static bool
+	check(void* self)
+	{
+		WaitEventUntil& awaiter = *static_cast<WaitEventUntil*>(self);
+		if (awaiter.condition()) {
+			return true;
+		}
+		awaiter.event.wait();
+		return false;
+	}
+
+	inline void
+	await_resume() noexcept
+	{}
+};
+
+template< typename Function >
+struct Call : public detail::PollAwaiter< Call<Function> >
+{
+	typedef decltype(std::declval<Function&>()()) Result;
+
+	Function function;
+	Result result;
+
+	Call(Function function) :
+		function(function), result(rf::Running)
+	{}
+
+	inline bool
+	poll()
+	{
+		result = function();
+		return (result.getState() <= rf::NestingError);
+	}
+
+	inline bool
+	await_ready()
+	{ return poll(); }
+
+	static bool
+	check(void* self)
+	{ return static_cast<Call*>(self)->poll(); }
+
+	inline auto
+	await_resume()
+	{ return result.getResult(); }
+};
+/// @endcond
+
+/**
+ * Suspend the coroutine until `condition()` returns `true`.
+ *
+ * The condition is evaluated by `resume()`, the coroutine is only resumed
+ * afterwards.
+ *
+ * @code
+ * co_await xpcc::co::waitUntil([&]() { return timeout.isExpired(); });
+ * @endcode
+ *
+ * @ingroup	resumable
+ */
+template< typename Condition >
+inline WaitUntil<Condition>
+waitUntil(Condition condition)
+{ return WaitUntil<Condition>(condition); }
+
+/**
+ * Suspend the coroutine until `condition()` returns `true` and park the
+ * task of the xpcc::pt::EventLoop which resumes it on `event` meanwhile,
+ * like RF_WAIT_EVENT_UNTIL().
+ *
+ * @ingroup	resumable
+ */
+template< typename Event, typename Condition >
+inline WaitEventUntil<Event, Condition>
+waitEventUntil(Event& event, Condition condition)
+{ return WaitEventUntil<Event, Condition>(event, condition); }
+
+/**
+ * Call the resumable function returned by `function()` until it has
+ * finished, like RF_CALL(). The result of the resumable function is
+ * returned by `co_await`.
+ *
+ * Use this to call the existing `switch` based drivers (e.g.
+ * `I2cDevice::ping()`, `Bme280::readout()` or `Vl53l0::readDistance()`)
+ * from a coroutine without changing them. See also XPCC_CO_CALL().
+ *
+ * @ingroup	resumable
+ */
+template< typename Function >
+inline Call<Function>
+call(Function function)
+{ return Call<Function>(function); }
+
+/**
+ * Makes a coroutine callable like a resumable function.
+ *
+ * Existing code calls resumable functions with `RF_CALL()` or
+ * `PT_CALL()`, which evaluates the call on every pass. The adapter creates
+ * the coroutine on the first call, resumes it on the following calls and
+ * destroys it once it has finished, so the next call starts again. A
+ * driver can thus be ported to coroutines without changing its users:
+ *
+ * @code
+ * class Bme280 : public xpcc::I2cDevice<I2cMaster>
+ * {
+ * public:
+ *     // same interface as before
+ *     xpcc::ResumableResult<bool>
+ *     readout()
+ *     {
+ *         return readoutAdapter.run([this]() { return readoutCoroutine(); });
+ *     }
+ *
+ * private:
+ *     xpcc::Coroutine<bool>
+ *     readoutCoroutine();
+ *
+ *     xpcc::co::ResumableAdapter<bool> readoutAdapter;
+ * };
+ * @endcode
+ *
+ * @ingroup	resumable
+ */
+template< typename T, typename Frames = HeapFrames >
+class ResumableAdapter
+{
+public:
+	ResumableAdapter() :
+		running(false)
+	{}
+
+	/// Start the coroutine returned by `factory()` if not running and resume it
+	template< typename Factory >
+	ResumableResult<T>
+	run(Factory factory)
+	{
+		if (not running)
+		{
+			coroutine = factory();
+			running = true;
+		}
+
+		ResumableResult<T> result = coroutine.resume();
+		if (result.getState() <= rf::NestingError) {
+			stop();
+		}
+		return result;
+	}
+
+	inline bool
+	isRunning() const
+	{ return running; }
+
+	/// Destroy the running coroutine
+	inline void
+	stop()
+	{
+		coroutine = Coroutine<T, Frames>();
+		running = false;
+	}
+
+private:
+	Coroutine<T, Frames> coroutine;
+	bool running;
+};
+
+} // namespace co
+
+} // namespace xpcc
+
+/**
+ * Call a resumable function from a coroutine and return its result.
+ *
+ * @code
+ * bool found = XPCC_CO_CALL(device.ping());
+ * @endcode
+ *
+ * @ingroup	resumable
+ * @hideinitializer
+ */
+#define XPCC_CO_CALL(resumable) \
+	(co_await ::xpcc::co::call([&]() { return (resumable); }))
+
+#endif // XPCC_RF_COROUTINE_HPP
@@ -13,6 +13,8 @@
 #include <xpcc/utils/arithmetic_traits.hpp>
 #include <xpcc/architecture/interface/assert.hpp>
 
+#include "profiler.hpp"
+
 #ifdef __DOXYGEN__
 /**
  * Declare start of resumable function with index.
@@ -86,7 +88,13 @@
  * @hideinitializer
  */
 #define RF_YIELD() \
-			RF_INTERNAL_SET_CASE_YIELD(__COUNTER__)
+		do { \
+			RF_INTERNAL_PROFILE_POINT(Yield) \
+			RF_INTERNAL_PROFILE_START(this->profilerStartRf(rfIndex)) \
+			RF_INTERNAL_SET_CASE_YIELD(__COUNTER__); \
+			RF_INTERNAL_PROFILE_HIT() \
+			RF_INTERNAL_PROFILE_PASS(this->profilerStartRf(rfIndex)) \
+		} while(0)
 
 /**
  * Cause resumable function to wait until given child protothread completes.
@@ -104,11 +112,15 @@
  */
 #define RF_WAIT_WHILE(condition) \
 		do { \
+			RF_INTERNAL_PROFILE_POINT(Wait) \
+			RF_INTERNAL_PROFILE_START(this->profilerStartRf(rfIndex)) \
 			RF_INTERNAL_SET_CASE(__COUNTER__); \
+			RF_INTERNAL_PROFILE_HIT() \
 			if (condition) { \
 				this->popRf(); \
 				return {xpcc::rf::Running}; \
 			} \
+			RF_INTERNAL_PROFILE_PASS(this->profilerStartRf(rfIndex)) \
 		} while(0)
 
 /**
@@ -120,6 +132,20 @@
 #define RF_WAIT_UNTIL(condition) \
 	RF_WAIT_WHILE(!(condition))
 
+/**
+ * Cause resumable function to wait until given `condition` is true and park
+ * the calling task on the xpcc::pt::Event `event` meanwhile.
+ *
+ * When called from a task of a xpcc::pt::EventLoop, the task is only resumed
+ * (and the condition re-evaluated) after the event was signaled. Otherwise
+ * this is the same as RF_WAIT_UNTIL().
+ *
+ * @ingroup	resumable
+ * @hideinitializer
+ */
+#define RF_WAIT_EVENT_UNTIL(event, condition) \
+	RF_WAIT_WHILE(!(condition) && (event).wait())
+
 /**
  * Calls a resumable function and returns its result.
  *
@@ -128,12 +154,17 @@
  */
 #define RF_CALL(resumable) \
 	({ \
+			RF_INTERNAL_PROFILE_POINT(Call) \
+			RF_INTERNAL_PROFILE_START(this->profilerStartRf(rfIndex)) \
 			RF_INTERNAL_SET_CASE(__COUNTER__); \
 			auto rfResult = resumable; \
+			RF_INTERNAL_PROFILE_HIT() \
+			RF_INTERNAL_PROFILE_RESULT(rfResult.getState()) \
 			if (rfResult.getState() > xpcc::rf::NestingError) { \
 				this->popRf(); \
 				return {xpcc::rf::Running}; \
 			} \
+			RF_INTERNAL_PROFILE_PASS(this->profilerStartRf(rfIndex)) \
 			rfResult.getResult(); \
 	})
 
@@ -160,13 +191,18 @@
 */
 #define RF_RETURN_CALL(resumable) \
 		do { \
+			RF_INTERNAL_PROFILE_POINT(Call) \
+			RF_INTERNAL_PROFILE_START(this->profilerStartRf(rfIndex)) \
 			RF_INTERNAL_SET_CASE(__COUNTER__); \
 			{ \
 				auto rfResult = resumable; \
+				RF_INTERNAL_PROFILE_HIT() \
+				RF_INTERNAL_PROFILE_RESULT(rfResult.getState()) \
 				if (rfResult.getState() > xpcc::rf::NestingError) { \
 					this->popRf(); \
 					return {xpcc::rf::Running}; \
 				} \
+				RF_INTERNAL_PROFILE_PASS(this->profilerStartRf(rfIndex)) \
 				RF_RETURN(rfResult.getResult()); \
 			} \
 		} while(0)
@@ -224,12 +260,16 @@
 	constexpr uint16_t rfCounter = __COUNTER__; \
 	this->template checkRfType<true>(); \
 	constexpr uint8_t rfIndex = 0; \
+	RF_INTERNAL_PROFILE_POINT(Begin) \
+	RF_INTERNAL_PROFILE_HIT() \
 	if (!this->nestingOkRf()) { \
+		RF_INTERNAL_PROFILE_BEGIN(-1) \
 		xpcc_assert(false, XPCC_RESUMABLE_MODULE_NAME, "begin", "nesting", this); \
 		return {xpcc::rf::NestingError}; \
 	} \
 	switch (this->pushRf(0)) { \
 		case (::xpcc::rf::Stopped): \
+			RF_INTERNAL_PROFILE_BEGIN(this->getResumableDepth()) \
 			RF_INTERNAL_SET_CASE(__COUNTER__);
 
 /// Beginner structure for conventional resumable functions
@@ -238,8 +278,11 @@
 	this->template checkRfFunctions<index>(); \
 	this->template checkRfType<false>(); \
 	constexpr uint_fast8_t rfIndex = index; \
+	RF_INTERNAL_PROFILE_POINT(Begin) \
+	RF_INTERNAL_PROFILE_HIT() \
 	switch (this->pushRf(index)) { \
 		case (::xpcc::rf::Stopped): \
+			RF_INTERNAL_PROFILE_BEGIN(0) \
 			RF_INTERNAL_SET_CASE(__COUNTER__);
 
 // the following completely unreadable preprocessor macro magic is based on this
@@ -206,6 +206,15 @@ protected:
 		return (rfStateArray[rfLevel] == rf::Stopped);
 	}
 
+#if XPCC_RESUMABLE_PROFILING
+	/// start of the current wait of the parent nesting level
+	inline rf::ProfilerPoint::Time&
+	profilerStartRf(uint8_t /*index*/)
+	{
+		return rfProfilerStart[rfLevel-1];
+	}
+#endif
+
 	/// compatibility with Resumable class
 	template<uint8_t index>
 	static void
@@ -223,6 +232,9 @@ protected:
 private:
 	uint_fast8_t rfLevel;
 	rf::State rfStateArray[Levels];
+#if XPCC_RESUMABLE_PROFILING
+	rf::ProfilerPoint::Time rfProfilerStart[Levels];
+#endif
 };
 
 // ----------------------------------------------------------------------------
@@ -298,6 +310,14 @@ protected:
 		return (rfState == rf::Stopped);
 	}
 
+#if XPCC_RESUMABLE_PROFILING
+	inline rf::ProfilerPoint::Time&
+	profilerStartRf(uint8_t /*index*/)
+	{
+		return rfProfilerStart;
+	}
+#endif
+
 	template<uint8_t index>
 	static void
 	checkRfFunctions()
@@ -313,6 +333,9 @@ protected:
 private:
 	int_fast8_t rfLevel;
 	rf::State rfState;
+#if XPCC_RESUMABLE_PROFILING
+	rf::ProfilerPoint::Time rfProfilerStart;
+#endif
 };
 /// @endcond
 
@@ -0,0 +1,120 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "profiler.hpp"
+#include "resumable.hpp"
+
+#include <xpcc/architecture/driver/clock.hpp>
+#include <xpcc/io/iostream.hpp>
+
+static_assert(sizeof(xpcc::rf::ProfilerPoint::Time) == sizeof(xpcc::Clock::Type),
+		"The profiler must use the type of the Clock!");
+
+xpcc::rf::ProfilerPoint* xpcc::rf::Profiler::first = nullptr;
+xpcc::rf::ProfilerPoint* xpcc::rf::Profiler::last = nullptr;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::rf::ProfilerPoint::pass(Time start)
+{
+	const Time time = Profiler::now() - start;
+	this->passes++;
+	this->totalTime += time;
+	if (time > this->maximumTime) {
+		this->maximumTime = time;
+	}
+}
+
+void
+xpcc::rf::ProfilerPoint::result(uint_fast8_t state)
+{
+	if (state == rf::WrongState) {
+		this->wrongState++;
+	}
+	else if (state == rf::NestingError) {
+		this->nestingErrors++;
+	}
+}
+
+void
+xpcc::rf::ProfilerPoint::begin(int_fast8_t depth)
+{
+	if (depth < 0) {
+		// out of nesting levels
+		this->nestingErrors++;
+		return;
+	}
+	this->passes++;
+	if (uint8_t(depth + 1) > this->maximumDepth) {
+		this->maximumDepth = depth + 1;
+	}
+}
+
+void
+xpcc::rf::ProfilerPoint::add()
+{
+	this->registered = true;
+	if (Profiler::last == nullptr) {
+		Profiler::first = this;
+	}
+	else {
+		Profiler::last->next = this;
+	}
+	Profiler::last = this;
+}
+
+void
+xpcc::rf::ProfilerPoint::reset()
+{
+	this->hits = 0;
+	this->passes = 0;
+	this->totalTime = 0;
+	this->maximumTime = 0;
+	this->wrongState = 0;
+	this->nestingErrors = 0;
+	this->maximumDepth = 0;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::rf::ProfilerPoint::Time
+xpcc::rf::Profiler::now()
+{
+	return xpcc::Clock::now().getTime();
+}
+
+void
+xpcc::rf::Profiler::report(IOStream& stream)
+{
+	static const char* const types[] = { "begin", "yield", "wait", "call" };
+
+	stream << "    hits   passes    total      max  wrong nesting depth  location" << xpcc::endl;
+	for (const ProfilerPoint* point = first; point != nullptr; point = point->next)
+	{
+		stream.printf("%8lu %8lu %8lu %8lu %6lu %7lu ",
+				(unsigned long) point->hits, (unsigned long) point->passes,
+				(unsigned long) point->totalTime, (unsigned long) point->maximumTime,
+				(unsigned long) point->wrongState, (unsigned long) point->nestingErrors);
+		if (point->type == ProfilerPoint::Type::Begin) {
+			stream.printf("%5u", unsigned(point->maximumDepth));
+		}
+		else {
+			stream << "    -";
+		}
+		stream << "  " << point->function << " @ " << point->line << ' '
+			   << types[uint8_t(point->type)] << xpcc::endl;
+	}
+}
+
+void
+xpcc::rf::Profiler::reset()
+{
+	for (ProfilerPoint* point = first; point != nullptr; point = point->next) {
+		point->reset();
+	}
+}
@@ -0,0 +1,299 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_RF_PROFILER_HPP
+#define XPCC_RF_PROFILER_HPP
+
+#include <stdint.h>
+
+#ifdef __DOXYGEN__
+/**
+ * Instrument the resumable function and protothread macros.
+ *
+ * Every `RF_BEGIN()`, `RF_YIELD()`, `RF_WAIT_*()`, `RF_CALL()`,
+ * `PT_YIELD()`, `PT_WAIT_*()` and `PT_CALL()` then records how often it was
+ * reached and how long the function waited there, see xpcc::rf::Profiler.
+ * Disabled by default, the macros then contain no profiling code at all.
+ * Enable it for all resumable functions in your `project.cfg`:
+ *
+@verbatim
+[defines]
+XPCC_RESUMABLE_PROFILING = true
+@endverbatim
+ *
+ * @warning	Adds a timestamp per nesting level to every NestedResumable, per
+ * 			function to every Resumable and to every Protothread.
+ *
+ * @see	xpcc::rf::Profiler
+ * @ingroup	resumable
+ */
+#define XPCC_RESUMABLE_PROFILING	false
+
+#else
+// by default the macros are not instrumented
+#	ifndef	XPCC_RESUMABLE_PROFILING
+#		define XPCC_RESUMABLE_PROFILING	false
+#	endif
+#endif
+
+namespace xpcc
+{
+
+class IOStream;
+
+namespace rf
+{
+
+/**
+ * Statistics of one instrumented macro, which is identified by the
+ * function and the line it is used in.
+ *
+ * The points are static variables created by the macros and are added to
+ * the list of the Profiler when they are reached for the first time.
+ * Points in the same function share the class, so several objects of the
+ * same driver add up in the same points.
+ *
+ * All times are in ticks of xpcc::Clock.
+ *
+ * @ingroup	resumable
+ */
+class ProfilerPoint
+{
+public:
+	enum class
+	Type : uint8_t
+	{
+		Begin,	///< `RF_BEGIN()`
+		Yield,	///< `RF_YIELD()` or `PT_YIELD()`
+		Wait,	///< `RF_WAIT_*()` or `PT_WAIT_*()`
+		Call,	///< `RF_CALL()` or `PT_CALL()`
+	};
+
+	typedef uint32_t Time;
+
+public:
+	constexpr
+	ProfilerPoint(const char* function, uint16_t line, Type type) :
+		function(function), next(nullptr),
+		hits(0), passes(0), totalTime(0), maximumTime(0),
+		wrongState(0), nestingErrors(0),
+		line(line), type(type), maximumDepth(0), registered(false)
+	{
+	}
+
+	/// Signature of the function containing the macro
+	inline const char*
+	getFunction() const
+	{ return function; }
+
+	inline uint16_t
+	getLine() const
+	{ return line; }
+
+	inline Type
+	getType() const
+	{ return type; }
+
+	/**
+	 * Number of times the macro was executed: the number of calls for
+	 * `Begin` and `Call`, and the number of times the condition was checked
+	 * for `Wait`.
+	 */
+	inline uint32_t
+	getHits() const
+	{ return hits; }
+
+	/// Number of times the function continued after the macro (for
+	/// `Begin`: the number of times the function was started)
+	inline uint32_t
+	getPasses() const
+	{ return passes; }
+
+	/// Time spent waiting in the macro, summed over all passes
+	inline Time
+	getTotalTime() const
+	{ return totalTime; }
+
+	/// Longest time of a single pass
+	inline Time
+	getMaximumTime() const
+	{ return maximumTime; }
+
+	/// `Call`: number of times the called function returned `WrongState`
+	inline uint32_t
+	getWrongState() const
+	{ return wrongState; }
+
+	/// `Begin`: calls without nesting levels left, `Call`: number of times
+	/// the called function returned `NestingError`
+	inline uint32_t
+	getNestingErrors() const
+	{ return nestingErrors; }
+
+	/// `Begin`: maximum number of nesting levels used, including this
+	/// function
+	inline uint8_t
+	getMaximumDepth() const
+	{ return maximumDepth; }
+
+	inline const ProfilerPoint*
+	getNext() const
+	{ return next; }
+
+	/// @cond
+	// called by the macros
+	inline void
+	hit()
+	{
+		if (not registered) {
+			add();
+		}
+		hits++;
+	}
+
+	void
+	pass(Time start);
+
+	void
+	result(uint_fast8_t state);
+
+	void
+	begin(int_fast8_t depth);
+	/// @endcond
+
+private:
+	friend class Profiler;
+
+	void
+	add();
+
+	void
+	reset();
+
+	const char* function;
+	ProfilerPoint* next;
+
+	uint32_t hits;
+	uint32_t passes;
+	Time totalTime;
+	Time maximumTime;
+	uint32_t wrongState;
+	uint32_t nestingErrors;
+
+	uint16_t line;
+	Type type;
+	uint8_t maximumDepth;
+	bool registered;
+};
+
+/**
+ * Collects the statistics of all instrumented resumable functions and
+ * protothreads.
+ *
+ * Enable the instrumentation with `XPCC_RESUMABLE_PROFILING = true`, then
+ * print the statistics every now and then:
+ *
+ * @code
+ * xpcc::PeriodicTimer reportTimer(10000);
+ *
+ * while (true)
+ * {
+ *     ...
+ *     if (reportTimer.execute())
+ *     {
+ *         xpcc::rf::Profiler::report(xpcc::log::info);
+ *         xpcc::rf::Profiler::reset();
+ *     }
+ * }
+ * @endcode
+ *
+ * which prints a line per macro which has been reached:
+ *
+@verbatim
+    hits   passes    total      max  wrong nesting depth  location
+      41       41        0        0      0       0     2  xpcc::ResumableResult<bool> Sensor::readout() @ 112 begin
+     345       41       12        1      0       0     -  xpcc::ResumableResult<bool> Sensor::readout() @ 118 wait
+@endverbatim
+ *
+ * The columns are explained in ProfilerPoint. A wait with a large total or
+ * maximum time is where the function spends its time, a call with many
+ * `WrongState` results bounces off another function of the same object.
+ *
+ * The timestamps are taken with xpcc::Clock, so waits shorter than one
+ * tick are counted as zero.
+ *
+ * @ingroup	resumable
+ */
+class Profiler
+{
+public:
+	/// Current time, from xpcc::Clock
+	static ProfilerPoint::Time
+	now();
+
+	/// First point reached since the start of the program
+	static inline const ProfilerPoint*
+	getFirst()
+	{ return first; }
+
+	/// Print the statistics of all points
+	static void
+	report(IOStream& stream);
+
+	/// Clear the statistics of all points
+	static void
+	reset();
+
+private:
+	friend class ProfilerPoint;
+
+	static ProfilerPoint* first;
+	static ProfilerPoint* last;
+};
+
+} // namespace rf
+
+} // namespace xpcc
+
+/// @cond
+#if XPCC_RESUMABLE_PROFILING
+
+/// Declares the static statistics of the macro
+#define RF_INTERNAL_PROFILE_POINT(type) \
+	static ::xpcc::rf::ProfilerPoint rfProfilerPoint(__PRETTY_FUNCTION__, __LINE__, \
+			::xpcc::rf::ProfilerPoint::Type::type);
+
+#define RF_INTERNAL_PROFILE_START(start) \
+	(start) = ::xpcc::rf::Profiler::now();
+
+#define RF_INTERNAL_PROFILE_HIT() \
+	rfProfilerPoint.hit();
+
+#define RF_INTERNAL_PROFILE_PASS(start) \
+	rfProfilerPoint.pass(start);
+
+#define RF_INTERNAL_PROFILE_RESULT(state) \
+	rfProfilerPoint.result(state);
+
+#define RF_INTERNAL_PROFILE_BEGIN(depth) \
+	rfProfilerPoint.begin(depth);
+
+#else
+
+#define RF_INTERNAL_PROFILE_POINT(type)
+#define RF_INTERNAL_PROFILE_START(start)
+#define RF_INTERNAL_PROFILE_HIT()
+#define RF_INTERNAL_PROFILE_PASS(start)
+#define RF_INTERNAL_PROFILE_RESULT(state)
+#define RF_INTERNAL_PROFILE_BEGIN(depth)
+
+#endif
+/// @endcond
+
+#endif // XPCC_RF_PROFILER_HPP
@@ -279,6 +279,15 @@ protected:
 		return (rfStateArray[index] == rf::Stopped);
 	}
 
+#if XPCC_RESUMABLE_PROFILING
+	/// start of the current wait of the resumable function
+	xpcc_always_inline rf::ProfilerPoint::Time&
+	profilerStartRf(uint_fast8_t index)
+	{
+		return rfProfilerStart[index];
+	}
+#endif
+
 	/// asserts the index is not out of bounds.
 	template<uint8_t index>
 	static void
@@ -299,6 +308,9 @@ protected:
 
 private:
 	rf::State rfStateArray[Functions];
+#if XPCC_RESUMABLE_PROFILING
+	rf::ProfilerPoint::Time rfProfilerStart[Functions];
+#endif
 };
 
 } // namespace xpcc
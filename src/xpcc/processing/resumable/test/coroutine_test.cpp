@@ -0,0 +1,284 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/detect.hpp>
+#include <xpcc/processing/resumable.hpp>
+
+#include "coroutine_test.hpp"
+
+// xpcc::Coroutine needs C++20, which the hosted unittests are compiled with
+// (cxxstd in unittest_hosted.cfg). The compilers of the other targets do
+// not support coroutines.
+#ifdef __cpp_impl_coroutine
+
+#include <xpcc/processing/resumable/coroutine.hpp>
+
+namespace
+{
+	uint8_t steps;
+
+	xpcc::Coroutine<uint8_t>
+	leaf(uint8_t value)
+	{
+		co_await xpcc::co::yield();
+		steps++;
+		co_return value;
+	}
+
+	xpcc::Coroutine<uint16_t>
+	middle(uint8_t count)
+	{
+		// kept in the frame across the suspensions
+		uint16_t sum = 0;
+		for (uint8_t i = 1; i <= count; ++i) {
+			sum += co_await leaf(i);
+		}
+		co_return sum;
+	}
+
+	xpcc::Coroutine<uint16_t>
+	outer()
+	{
+		const uint16_t first = co_await middle(3);
+		const uint16_t second = co_await middle(4);
+		co_return first * 100 + second;
+	}
+
+	// the pool holds a single frame
+	typedef xpcc::co::StaticFrames<1, 1024> SingleFrame;
+
+	xpcc::Coroutine<uint8_t, SingleFrame>
+	staticLeaf()
+	{
+		co_return 42;
+	}
+
+	xpcc::Coroutine<uint8_t, SingleFrame>
+	staticRoot()
+	{
+		const uint8_t value = co_await staticLeaf();
+		co_return value + 1;
+	}
+
+	bool ready;
+	uint8_t wakeups;
+
+	xpcc::Coroutine<void>
+	waiting()
+	{
+		co_await xpcc::co::waitUntil([]() { return ready; });
+		wakeups++;
+	}
+
+	class Device : public xpcc::NestedResumable<1>
+	{
+	public:
+		xpcc::ResumableResult<uint8_t>
+		read(uint8_t value)
+		{
+			RF_BEGIN();
+			polls = 0;
+			RF_WAIT_UNTIL(++polls >= 3);
+			RF_END_RETURN(uint8_t(value * 2));
+		}
+
+	private:
+		uint8_t polls;
+	};
+
+	Device device;
+
+	xpcc::Coroutine<uint16_t>
+	calling()
+	{
+		const uint16_t first = XPCC_CO_CALL(device.read(10));
+		const uint16_t second = co_await xpcc::co::call([]() { return device.read(20); });
+		co_return first + second;
+	}
+
+	uint8_t started;
+
+	xpcc::Coroutine<uint8_t>
+	counting()
+	{
+		started++;
+		co_await xpcc::co::yield();
+		co_return started;
+	}
+
+	/// Resumes until the coroutine is not running anymore, returns the
+	/// number of resume() calls which returned Running
+	template< typename T, typename Result >
+	uint8_t
+	runToCompletion(T& coroutine, Result& result)
+	{
+		uint8_t running = 0;
+		while ((result = coroutine.resume()).getState() == xpcc::rf::Running) {
+			if (++running == 0xff) {
+				break;
+			}
+		}
+		return running;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+CoroutineTest::testNesting()
+{
+	steps = 0;
+	xpcc::Coroutine<uint16_t> coroutine = outer();
+	TEST_ASSERT_TRUE(coroutine.isValid());
+	TEST_ASSERT_FALSE(coroutine.isFinished());
+	TEST_ASSERT_EQUALS(steps, 0);
+
+	// every leaf yields once
+	xpcc::ResumableResult<uint16_t> result(xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(runToCompletion(coroutine, result), 7);
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Stop);
+	TEST_ASSERT_EQUALS(result.getResult(), 610);
+	TEST_ASSERT_EQUALS(steps, 7);
+	TEST_ASSERT_TRUE(coroutine.isFinished());
+
+	// the result stays available
+	TEST_ASSERT_EQUALS(coroutine.resume().getResult(), 610);
+}
+
+void
+CoroutineTest::testStaticFramesExhausted()
+{
+	const std::size_t failed = SingleFrame::getFailed();
+	{
+		xpcc::Coroutine<uint8_t, SingleFrame> first = staticLeaf();
+		TEST_ASSERT_TRUE(first.isValid());
+		TEST_ASSERT_EQUALS(SingleFrame::getUsed(), 1024U);
+
+		// no frame left
+		xpcc::Coroutine<uint8_t, SingleFrame> second = staticLeaf();
+		TEST_ASSERT_FALSE(second.isValid());
+		TEST_ASSERT_EQUALS(second.resume().getState(), xpcc::rf::NestingError);
+		TEST_ASSERT_EQUALS(SingleFrame::getFailed(), failed + 1);
+
+		xpcc::ResumableResult<uint8_t> result = first.resume();
+		TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Stop);
+		TEST_ASSERT_EQUALS(result.getResult(), 42);
+	}
+	TEST_ASSERT_EQUALS(SingleFrame::getUsed(), 0U);
+	TEST_ASSERT_EQUALS(SingleFrame::getPeak(), 1024U);
+}
+
+void
+CoroutineTest::testNestedFrameFailure()
+{
+	const std::size_t failed = SingleFrame::getFailed();
+	{
+		// the root uses the only frame, the nested one can not be created
+		xpcc::Coroutine<uint8_t, SingleFrame> coroutine = staticRoot();
+		TEST_ASSERT_TRUE(coroutine.isValid());
+		TEST_ASSERT_EQUALS(coroutine.resume().getState(), xpcc::rf::NestingError);
+		TEST_ASSERT_EQUALS(SingleFrame::getFailed(), failed + 1);
+
+		// stays stopped
+		TEST_ASSERT_EQUALS(coroutine.resume().getState(), xpcc::rf::NestingError);
+		TEST_ASSERT_FALSE(coroutine.isFinished());
+	}
+	TEST_ASSERT_EQUALS(SingleFrame::getUsed(), 0U);
+}
+
+void
+CoroutineTest::testWaitUntil()
+{
+	ready = false;
+	wakeups = 0;
+	xpcc::Coroutine<void> coroutine = waiting();
+
+	// the condition is checked without resuming the coroutine
+	TEST_ASSERT_EQUALS(coroutine.resume().getState(), xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(coroutine.resume().getState(), xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(wakeups, 0);
+
+	ready = true;
+	TEST_ASSERT_EQUALS(coroutine.resume().getState(), xpcc::rf::Stop);
+	TEST_ASSERT_EQUALS(wakeups, 1);
+
+	// does not suspend if the condition is already true
+	xpcc::Coroutine<void> immediate = waiting();
+	TEST_ASSERT_EQUALS(immediate.resume().getState(), xpcc::rf::Stop);
+	TEST_ASSERT_EQUALS(wakeups, 2);
+}
+
+void
+CoroutineTest::testCall()
+{
+	xpcc::Coroutine<uint16_t> coroutine = calling();
+
+	// each resumable function is polled three times
+	xpcc::ResumableResult<uint16_t> result(xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(runToCompletion(coroutine, result), 4);
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Stop);
+	TEST_ASSERT_EQUALS(result.getResult(), 60);
+}
+
+void
+CoroutineTest::testResumableAdapter()
+{
+	started = 0;
+	xpcc::co::ResumableAdapter<uint8_t> adapter;
+	TEST_ASSERT_FALSE(adapter.isRunning());
+
+	xpcc::ResumableResult<uint8_t> result = adapter.run([]() { return counting(); });
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Running);
+	TEST_ASSERT_TRUE(adapter.isRunning());
+	TEST_ASSERT_EQUALS(started, 1);
+
+	result = adapter.run([]() { return counting(); });
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Stop);
+	TEST_ASSERT_EQUALS(result.getResult(), 1);
+	TEST_ASSERT_FALSE(adapter.isRunning());
+
+	// the next call starts the coroutine again
+	result = adapter.run([]() { return counting(); });
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(started, 2);
+	result = adapter.run([]() { return counting(); });
+	TEST_ASSERT_EQUALS(result.getResult(), 2);
+
+	// restart after stop()
+	adapter.run([]() { return counting(); });
+	adapter.stop();
+	TEST_ASSERT_FALSE(adapter.isRunning());
+	result = adapter.run([]() { return counting(); });
+	TEST_ASSERT_EQUALS(result.getState(), xpcc::rf::Running);
+	TEST_ASSERT_EQUALS(started, 4);
+}
+
+#elif defined(XPCC__OS_HOSTED)
+
+void
+CoroutineTest::testNesting()
+{
+	TEST_FAIL("Coroutines are not supported, compile the unittests as C++20");
+}
+
+void CoroutineTest::testStaticFramesExhausted() {}
+void CoroutineTest::testNestedFrameFailure() {}
+void CoroutineTest::testWaitUntil() {}
+void CoroutineTest::testCall() {}
+void CoroutineTest::testResumableAdapter() {}
+
+#else
+
+void CoroutineTest::testNesting() {}
+void CoroutineTest::testStaticFramesExhausted() {}
+void CoroutineTest::testNestedFrameFailure() {}
+void CoroutineTest::testWaitUntil() {}
+void CoroutineTest::testCall() {}
+void CoroutineTest::testResumableAdapter() {}
+
+#endif
@@ -0,0 +1,34 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+// The tests only run if the unittests are compiled as C++20, on hosted
+// targets they fail otherwise
+class CoroutineTest : public unittest::TestSuite
+{
+public:
+	void
+	testNesting();
+
+	void
+	testStaticFramesExhausted();
+
+	void
+	testNestedFrameFailure();
+
+	void
+	testWaitUntil();
+
+	void
+	testCall();
+
+	void
+	testResumableAdapter();
+};
@@ -0,0 +1,190 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/processing/resumable.hpp>
+#include <xpcc/io/iostream.hpp>
+
+#include <string.h>
+
+#include "profiler_test.hpp"
+
+using xpcc::rf::Profiler;
+using xpcc::rf::ProfilerPoint;
+
+namespace
+{
+	class MemoryWriter : public xpcc::IODevice
+	{
+	public:
+		MemoryWriter() :
+			length(0)
+		{
+			buffer[0] = '\0';
+		}
+
+		virtual void
+		write(char c)
+		{
+			if (length < sizeof(buffer) - 1) {
+				buffer[length++] = c;
+				buffer[length] = '\0';
+			}
+		}
+
+		using xpcc::IODevice::write;
+
+		virtual void
+		flush()
+		{
+		}
+
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+
+		char buffer[1024];
+		std::size_t length;
+	};
+
+	bool
+	isRegistered(const ProfilerPoint& point)
+	{
+		for (const ProfilerPoint* p = Profiler::getFirst(); p != nullptr; p = p->getNext()) {
+			if (p == &point) {
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+ProfilerTest::testWait()
+{
+	static ProfilerPoint point("wait()", 10, ProfilerPoint::Type::Wait);
+
+	// condition checked three times, then passed after 5 and 2 ticks
+	point.hit();
+	point.hit();
+	point.hit();
+	point.pass(Profiler::now() - 5);
+	point.hit();
+	point.pass(Profiler::now() - 2);
+
+	TEST_ASSERT_EQUALS(point.getHits(), 4U);
+	TEST_ASSERT_EQUALS(point.getPasses(), 2U);
+	TEST_ASSERT_TRUE(point.getTotalTime() >= 7U);
+	TEST_ASSERT_TRUE(point.getMaximumTime() >= 5U);
+	TEST_ASSERT_TRUE(point.getMaximumTime() < point.getTotalTime());
+	TEST_ASSERT_EQUALS(point.getWrongState(), 0U);
+	TEST_ASSERT_EQUALS(point.getNestingErrors(), 0U);
+}
+
+void
+ProfilerTest::testCall()
+{
+	static ProfilerPoint point("call()", 20, ProfilerPoint::Type::Call);
+
+	point.hit();
+	point.result(xpcc::rf::WrongState);
+	point.hit();
+	point.result(xpcc::rf::Running);
+	point.hit();
+	point.result(xpcc::rf::NestingError);
+	point.hit();
+	point.result(xpcc::rf::WrongState);
+	point.hit();
+	point.result(xpcc::rf::Stop);
+
+	TEST_ASSERT_EQUALS(point.getHits(), 5U);
+	TEST_ASSERT_EQUALS(point.getWrongState(), 2U);
+	TEST_ASSERT_EQUALS(point.getNestingErrors(), 1U);
+}
+
+void
+ProfilerTest::testBegin()
+{
+	static ProfilerPoint point("begin()", 30, ProfilerPoint::Type::Begin);
+
+	point.hit();
+	point.begin(0);
+	point.hit();
+	point.begin(2);
+	point.hit();
+	point.begin(1);
+	point.hit();
+	point.begin(-1);
+
+	TEST_ASSERT_EQUALS(point.getHits(), 4U);
+	TEST_ASSERT_EQUALS(point.getPasses(), 3U);
+	// depth is zero based, the maximum is the number of levels
+	TEST_ASSERT_EQUALS(point.getMaximumDepth(), 3U);
+	TEST_ASSERT_EQUALS(point.getNestingErrors(), 1U);
+}
+
+void
+ProfilerTest::testRegistration()
+{
+	static ProfilerPoint first("first()", 40, ProfilerPoint::Type::Yield);
+	static ProfilerPoint second("second()", 41, ProfilerPoint::Type::Yield);
+
+	TEST_ASSERT_FALSE(isRegistered(first));
+	TEST_ASSERT_FALSE(isRegistered(second));
+
+	first.hit();
+	first.hit();
+	second.hit();
+
+	TEST_ASSERT_TRUE(isRegistered(first));
+	TEST_ASSERT_TRUE(isRegistered(second));
+	TEST_ASSERT_EQUALS(first.getNext(), &second);
+	TEST_ASSERT_EQUALS(second.getNext(), static_cast<const ProfilerPoint*>(nullptr));
+}
+
+void
+ProfilerTest::testReset()
+{
+	static ProfilerPoint point("reset()", 50, ProfilerPoint::Type::Call);
+
+	point.hit();
+	point.result(xpcc::rf::WrongState);
+	point.pass(Profiler::now() - 3);
+
+	Profiler::reset();
+
+	TEST_ASSERT_EQUALS(point.getHits(), 0U);
+	TEST_ASSERT_EQUALS(point.getPasses(), 0U);
+	TEST_ASSERT_EQUALS(point.getTotalTime(), 0U);
+	TEST_ASSERT_EQUALS(point.getMaximumTime(), 0U);
+	TEST_ASSERT_EQUALS(point.getWrongState(), 0U);
+	// stays registered
+	TEST_ASSERT_TRUE(isRegistered(point));
+}
+
+void
+ProfilerTest::testReport()
+{
+	static ProfilerPoint point("Sensor::readout()", 123, ProfilerPoint::Type::Wait);
+
+	Profiler::reset();
+	point.hit();
+	point.hit();
+	point.pass(Profiler::now());
+
+	MemoryWriter writer;
+	xpcc::IOStream stream(writer);
+	Profiler::report(stream);
+
+	TEST_ASSERT_TRUE(strstr(writer.buffer, "hits") != nullptr);
+	TEST_ASSERT_TRUE(strstr(writer.buffer,
+			"       2        1        0        0      0       0     -  Sensor::readout() @ 123 wait\n") != nullptr);
+}
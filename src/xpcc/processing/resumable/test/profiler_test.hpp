@@ -0,0 +1,34 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// The unittests are built without XPCC_RESUMABLE_PROFILING, so the points
+/// are driven directly like the macros would do.
+class ProfilerTest : public unittest::TestSuite
+{
+public:
+	void
+	testWait();
+
+	void
+	testCall();
+
+	void
+	testBegin();
+
+	void
+	testRegistration();
+
+	void
+	testReset();
+
+	void
+	testReport();
+};
@@ -0,0 +1,20 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_RTOS__EXECUTOR_HPP
+#define XPCC_RTOS__EXECUTOR_HPP
+
+#include <xpcc/architecture/utils.hpp>
+
+// only available for the hosted targets
+#ifdef XPCC__OS_HOSTED
+#	include "stdlib/executor.hpp"
+#endif
+
+#endif // XPCC_RTOS__EXECUTOR_HPP
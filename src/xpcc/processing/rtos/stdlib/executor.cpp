@@ -0,0 +1,320 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "../executor.hpp"
+
+constexpr uint8_t xpcc::rtos::Executor::Priorities;
+constexpr std::size_t xpcc::rtos::Executor::Deque::Capacity;
+
+namespace
+{
+	// worker of the calling thread
+	thread_local const xpcc::rtos::Executor* currentExecutor = nullptr;
+	thread_local std::size_t currentWorker = 0;
+
+	class FunctionTask : public xpcc::rtos::Executor::Task
+	{
+	public:
+		FunctionTask(std::function<bool()>&& function) :
+			function(std::move(function))
+		{
+		}
+
+		virtual bool
+		run()
+		{
+			return this->function();
+		}
+
+	private:
+		std::function<bool()> function;
+	};
+}
+
+// ----------------------------------------------------------------------------
+xpcc::rtos::Executor::Task::Task() :
+	priority(Priority::Normal), owned(false)
+{
+}
+
+xpcc::rtos::Executor::Task::~Task()
+{
+}
+
+// ----------------------------------------------------------------------------
+xpcc::rtos::Executor::Deque::Deque() :
+	top(0), bottom(0)
+{
+	for (std::size_t i = 0; i < Capacity; ++i) {
+		this->tasks[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+bool
+xpcc::rtos::Executor::Deque::push(Task* task)
+{
+	const int64_t b = this->bottom.load(std::memory_order_relaxed);
+	const int64_t t = this->top.load(std::memory_order_acquire);
+	if (b - t >= int64_t(Capacity)) {
+		return false;
+	}
+
+	this->tasks[b & (Capacity - 1)].store(task, std::memory_order_relaxed);
+	// publishes the task to the thieves
+	this->bottom.store(b + 1, std::memory_order_release);
+	return true;
+}
+
+xpcc::rtos::Executor::Task*
+xpcc::rtos::Executor::Deque::steal()
+{
+	int64_t t = this->top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const int64_t b = this->bottom.load(std::memory_order_acquire);
+	if (t >= b) {
+		return nullptr;
+	}
+
+	// The slot is only overwritten by the owner after the top has moved
+	// past it, in which case the compare-and-swap fails.
+	Task* task = this->tasks[t & (Capacity - 1)].load(std::memory_order_relaxed);
+	if (!this->top.compare_exchange_strong(t, t + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed)) {
+		return nullptr;
+	}
+	return task;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::rtos::Executor::Executor(std::size_t count) :
+	queued(0), pending(0), stopping(false), parked(0)
+{
+	for (uint8_t i = 0; i < Priorities; ++i) {
+		this->shared[i].size.store(0);
+	}
+
+	if (count == 0) {
+		count = std::max(1U, std::thread::hardware_concurrency());
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		Worker* worker = new Worker();
+		worker->steals.store(0);
+		worker->random = 2654435761U * (i + 1);
+		this->workers.push_back(worker);
+	}
+	// the workers access each other, start them after all were created
+	for (std::size_t i = 0; i < count; ++i) {
+		this->workers[i]->thread = std::thread(&Executor::work, this, i);
+	}
+}
+
+xpcc::rtos::Executor::~Executor()
+{
+	this->stopping.store(true);
+	{
+		std::lock_guard<std::mutex> lock(this->parkMutex);
+		this->wakeUp.notify_all();
+	}
+
+	for (Worker* worker : this->workers) {
+		worker->thread.join();
+	}
+
+	// drop the tasks which were not run
+	for (Worker* worker : this->workers)
+	{
+		for (Deque& deque : worker->deques)
+		{
+			while (Task* task = deque.steal())
+			{
+				if (task->owned) {
+					delete task;
+				}
+			}
+		}
+		delete worker;
+	}
+	for (Shared& queue : this->shared)
+	{
+		for (Task* task : queue.tasks)
+		{
+			if (task->owned) {
+				delete task;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::rtos::Executor::submit(Task& task, Priority priority)
+{
+	task.priority = priority;
+	this->pending.fetch_add(1);
+	this->schedule(&task);
+}
+
+void
+xpcc::rtos::Executor::submit(std::function<bool()> function, Priority priority)
+{
+	FunctionTask* task = new FunctionTask(std::move(function));
+	task->owned = true;
+	this->submit(*task, priority);
+}
+
+void
+xpcc::rtos::Executor::wait()
+{
+	std::unique_lock<std::mutex> lock(this->finishedMutex);
+	this->finished.wait(lock, [this]() { return (this->pending.load() == 0); });
+}
+
+uint64_t
+xpcc::rtos::Executor::getStealCount() const
+{
+	uint64_t steals = 0;
+	for (const Worker* worker : this->workers) {
+		steals += worker->steals.load(std::memory_order_relaxed);
+	}
+	return steals;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::rtos::Executor::schedule(Task* task)
+{
+	// counted before the task is visible, so that the counter never
+	// drops below zero
+	this->queued.fetch_add(1);
+
+	const uint8_t priority = static_cast<uint8_t>(task->priority);
+	if (currentExecutor != this ||
+		!this->workers[currentWorker]->deques[priority].push(task))
+	{
+		Shared& queue = this->shared[priority];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back(task);
+		queue.size.fetch_add(1);
+	}
+
+	// pairs with park(), either the parked worker sees the counter or
+	// this thread sees the parked worker
+	if (this->parked.load() != 0)
+	{
+		std::lock_guard<std::mutex> lock(this->parkMutex);
+		this->wakeUp.notify_one();
+	}
+}
+
+void
+xpcc::rtos::Executor::work(std::size_t index)
+{
+	currentExecutor = this;
+	currentWorker = index;
+
+	uint32_t idle = 0;
+	while (!this->stopping.load(std::memory_order_relaxed))
+	{
+		Task* task = this->find(*this->workers[index]);
+		if (task != nullptr)
+		{
+			idle = 0;
+			this->queued.fetch_sub(1);
+
+			if (task->run()) {
+				this->schedule(task);
+			}
+			else {
+				this->finish(task);
+			}
+		}
+		else if (++idle < 64) {
+			std::this_thread::yield();
+		}
+		else {
+			idle = 0;
+			this->park();
+		}
+	}
+}
+
+xpcc::rtos::Executor::Task*
+xpcc::rtos::Executor::find(Worker& worker)
+{
+	const std::size_t count = this->workers.size();
+	for (uint8_t priority = 0; priority < Priorities; ++priority)
+	{
+		Task* task = worker.deques[priority].steal();
+		if (task != nullptr) {
+			return task;
+		}
+
+		Shared& queue = this->shared[priority];
+		if (queue.size.load() != 0)
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.tasks.empty())
+			{
+				task = queue.tasks.front();
+				queue.tasks.pop_front();
+				queue.size.fetch_sub(1);
+				return task;
+			}
+		}
+
+		// start at a random victim, so that the thieves spread out
+		worker.random ^= worker.random << 13;
+		worker.random ^= worker.random >> 17;
+		worker.random ^= worker.random << 5;
+		const std::size_t start = worker.random % count;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Worker* victim = this->workers[(start + i) % count];
+			if (victim == &worker) {
+				continue;
+			}
+			task = victim->deques[priority].steal();
+			if (task != nullptr)
+			{
+				worker.steals.fetch_add(1, std::memory_order_relaxed);
+				return task;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void
+xpcc::rtos::Executor::park()
+{
+	std::unique_lock<std::mutex> lock(this->parkMutex);
+	this->parked.fetch_add(1);
+	while (this->queued.load() == 0 && !this->stopping.load()) {
+		this->wakeUp.wait(lock);
+	}
+	this->parked.fetch_sub(1);
+}
+
+void
+xpcc::rtos::Executor::finish(Task* task)
+{
+	if (task->owned) {
+		delete task;
+	}
+
+	if (this->pending.fetch_sub(1) == 1)
+	{
+		std::lock_guard<std::mutex> lock(this->finishedMutex);
+		this->finished.notify_all();
+	}
+}
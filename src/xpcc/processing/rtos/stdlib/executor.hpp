@@ -0,0 +1,254 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_BOOST__EXECUTOR_HPP
+#define XPCC_BOOST__EXECUTOR_HPP
+
+#ifndef XPCC_RTOS__EXECUTOR_HPP
+#	error "Don't include this file directly, use <xpcc/processing/rtos/executor.hpp>"
+#endif
+
+#include <stdint.h>
+#include <cstddef>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace xpcc
+{
+	namespace rtos
+	{
+		/**
+		 * \brief	Work-stealing thread pool
+		 * 
+		 * Runs many small tasks on a few worker threads (by default one per
+		 * core) instead of one std::thread per rtos::Thread. Tasks are
+		 * cooperative: run() does a bit of work and returns, like the
+		 * update() method of a component or a resumable function.
+		 * 
+		 * \code
+		 * class Component : public xpcc::rtos::Executor::Task
+		 * {
+		 *     virtual bool
+		 *     run()
+		 *     {
+		 *         // ... do some work
+		 *         return !finished;	// true to run again
+		 *     }
+		 * };
+		 * 
+		 * xpcc::rtos::Executor executor;
+		 * executor.submit(component);
+		 * executor.submit([&]() {
+		 *     // run a resumable function until it has finished
+		 *     return (driver.readSensor().getState() == xpcc::rf::Running);
+		 * }, xpcc::rtos::Executor::Priority::High);
+		 * executor.wait();
+		 * \endcode
+		 * 
+		 * Every worker has a deque per priority. Tasks submitted from inside
+		 * of a task, and tasks which are run again, are added to the deque of
+		 * the current worker, without any locking. Idle workers steal tasks
+		 * from the other workers (lock-free, Chase-Lev deque). Tasks
+		 * submitted from other threads go to a shared queue per priority.
+		 * A worker always runs a task of the highest priority it can find.
+		 * 
+		 * Workers without work spin briefly and are then parked on a
+		 * condition variable, until a new task is submitted.
+		 * 
+		 * \ingroup	stdlib_rtos
+		 */
+		class Executor
+		{
+		public:
+			enum class
+			Priority : uint8_t
+			{
+				High = 0,
+				Normal = 1,
+				Low = 2,
+			};
+			
+			static constexpr uint8_t Priorities = 3;
+			
+			/**
+			 * \brief	Task, owned by the user
+			 * 
+			 * The task must not be destroyed while it is submitted.
+			 */
+			class Task
+			{
+			public:
+				Task();
+				
+				virtual
+				~Task();
+				
+				/**
+				 * \return	\c true if the task wants to run again. It is
+				 * 			then added to the end of the queue, other tasks
+				 * 			run in between.
+				 */
+				virtual bool
+				run() = 0;
+				
+			private:
+				friend class Executor;
+				
+				Priority priority;
+				
+				/// allocated by submit(std::function)
+				bool owned;
+			};
+			
+		public:
+			/**
+			 * \param	workers		Number of threads, zero for one per core
+			 */
+			explicit
+			Executor(std::size_t workers = 0);
+			
+			/**
+			 * Stops the workers after their current task. Tasks which were
+			 * not run are dropped.
+			 */
+			~Executor();
+			
+			void
+			submit(Task& task, Priority priority = Priority::Normal);
+			
+			/**
+			 * Submits a function, which is called until it returns \c false.
+			 * 
+			 * Allocates a task, which is deleted afterwards.
+			 */
+			void
+			submit(std::function<bool()> function, Priority priority = Priority::Normal);
+			
+			/// Blocks until all submitted tasks have finished
+			void
+			wait();
+			
+			inline std::size_t
+			getWorkerCount() const
+			{
+				return this->workers.size();
+			}
+			
+			/// Number of submitted tasks which have not finished yet
+			inline std::size_t
+			getPendingCount() const
+			{
+				return this->pending.load();
+			}
+			
+			/// Number of tasks taken from other workers
+			uint64_t
+			getStealCount() const;
+			
+		private:
+			// disable copy constructor
+			Executor(const Executor& other);
+			
+			// disable assignment operator
+			Executor&
+			operator = (const Executor& other);
+			
+			/**
+			 * Bounded Chase-Lev deque. Only the owning worker pushes,
+			 * every worker (including the owner) takes the oldest task,
+			 * so that tasks which run again do not starve the others.
+			 */
+			class Deque
+			{
+			public:
+				static constexpr std::size_t Capacity = 1024;
+				
+				Deque();
+				
+				/// Only called by the owner. \c false if full
+				bool
+				push(Task* task);
+				
+				/// Oldest task or \c nullptr if empty (or lost a race)
+				Task*
+				steal();
+				
+				inline bool
+				isEmpty() const
+				{
+					return (this->top.load() >= this->bottom.load());
+				}
+				
+			private:
+				// on separate cache lines, the thieves only write the top
+				std::atomic<int64_t> top;
+				uint8_t padding[64];
+				std::atomic<int64_t> bottom;
+				std::atomic<Task*> tasks[Capacity];
+			};
+			
+			struct Worker
+			{
+				Deque deques[Priorities];
+				std::atomic<uint64_t> steals;
+				uint32_t random;
+				std::thread thread;
+			};
+			
+			/// Queue for tasks submitted from outside of the workers
+			struct Shared
+			{
+				std::atomic<std::size_t> size;
+				std::mutex mutex;
+				std::deque<Task*> tasks;
+			};
+			
+			void
+			work(std::size_t index);
+			
+			/// Adds a task to the queues and wakes a parked worker
+			void
+			schedule(Task* task);
+			
+			Task*
+			find(Worker& worker);
+			
+			void
+			park();
+			
+			void
+			finish(Task* task);
+			
+			std::vector<Worker*> workers;
+			Shared shared[Priorities];
+			
+			/// Tasks in the queues (not running)
+			std::atomic<std::size_t> queued;
+			
+			/// Submitted and not finished
+			std::atomic<std::size_t> pending;
+			
+			std::atomic<bool> stopping;
+			
+			std::atomic<uint32_t> parked;
+			std::mutex parkMutex;
+			std::condition_variable wakeUp;
+			
+			std::mutex finishedMutex;
+			std::condition_variable finished;
+		};
+	}
+}
+
+#endif // XPCC_BOOST__EXECUTOR_HPP
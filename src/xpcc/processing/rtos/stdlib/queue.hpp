@@ -36,10 +36,11 @@
 #endif
 
 #include <stdint.h>
+#include <cstddef>
+#include <atomic>
 #include <deque>
-
 #include <mutex>
-#include <xpcc/container/deque.hpp>
+#include <condition_variable>
 
 namespace xpcc
 {
@@ -48,6 +49,25 @@ namespace xpcc
 		/**
 		 * Thread-safe Queue.
 		 * 
+		 * Lock-free bounded multi-producer/multi-consumer queue. Every slot
+		 * of the ring buffer carries a sequence number, which tells producers
+		 * and consumers whether the slot is free or holds an item for the
+		 * current round. append() and get() only need a compare-and-swap
+		 * on the write or read position and never block each other.
+		 * 
+		 * A thread only blocks if it has to wait for room or for an item
+		 * (timeout > 0). Only then a mutex and condition variable are used,
+		 * which the other side notifies when there are waiting threads.
+		 * 
+		 * prepend() can not be implemented with the ring buffer: the items
+		 * are kept in a separate list with a mutex, which get() checks first.
+		 * peek() copies the first item without removing it. If other
+		 * consumers call get() at the same time, the item may already be
+		 * gone when peek() returns, and T must be trivially copyable.
+		 * 
+		 * \warning	The capacity is rounded up to the next power of two,
+		 * 			but at least two.
+		 * 
 		 * \ingroup	rtos_boost
 		 */
 		template<typename T>
@@ -66,10 +86,15 @@ namespace xpcc
 			
 			/**
 			 * Get the number of items stored in the queue
+			 * 
+			 * Only a snapshot if other threads access the queue.
 			 */
 			std::size_t
 			getSize() const;
 			
+			/**
+			 * \param	timeout		in milliseconds, -1 waits forever
+			 */
 			bool
 			append(const T& item, uint32_t timeout = -1);
 			
@@ -78,7 +103,7 @@ namespace xpcc
 			
 			
 			bool
-			peek(T& item, uint32_t timeout = -1) const;
+			peek(T& item, uint32_t timeout = -1);
 			
 			bool
 			get(T& item, uint32_t timeout = -1);
@@ -101,12 +126,57 @@ namespace xpcc
 			Queue&
 			operator = (const Queue& other);
 			
-			mutable std::timed_mutex mutex;
+			struct Cell
+			{
+				std::atomic<std::size_t> sequence;
+				alignas(T) uint8_t storage[sizeof(T)];
+			};
+			
+			bool
+			tryAppend(const T& item);
+			
+			bool
+			tryPrepend(const T& item);
 			
-			uint32_t maxSize;
-			std::deque<T> deque;
+			bool
+			tryPeek(T& item);
+			
+			bool
+			tryGet(T& item);
+			
+			/// Retries \p operation until it succeeds or the timeout expires
+			template<typename Operation>
+			bool
+			wait(Operation operation, uint32_t timeout);
+			
+			/// Wakes the threads waiting for room or an item, after a
+			/// successful operation
+			void
+			notify();
+			
+			Cell* cells;
+			std::size_t mask;
+			
+			// separate cache lines, producers and consumers do not
+			// invalidate each others position (padding instead of alignas,
+			// which new does not respect before C++17)
+			uint8_t padding0[64];
+			std::atomic<std::size_t> writePosition;
+			uint8_t padding1[64];
+			std::atomic<std::size_t> readPosition;
+			uint8_t padding2[64];
+			
+			std::atomic<std::size_t> frontSize;
+			std::mutex frontMutex;
+			std::deque<T> front;
+			
+			std::atomic<uint32_t> waiting;
+			std::mutex waitMutex;
+			std::condition_variable changed;
 		};
 	}
 }
 
+#include "queue_impl.hpp"
+
 #endif // XPCC_BOOST__QUEUE_HPP
@@ -32,117 +32,299 @@
 #	error "Don't use this file directly, use 'queue.hpp' instead!"
 #endif
 
+#include <new>
 #include <chrono>
 
 template <typename T>
 xpcc::rtos::Queue<T>::Queue(uint32_t length) :
-	maxSize(length)
+	writePosition(0), readPosition(0), frontSize(0), waiting(0)
 {
+	// a single cell can not tell a full from an empty queue
+	std::size_t capacity = 2;
+	while (capacity < length) {
+		capacity <<= 1;
+	}
+	this->mask = capacity - 1;
+	
+	this->cells = new Cell[capacity];
+	for (std::size_t i = 0; i < capacity; ++i) {
+		this->cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
 }
 
 template <typename T>
 xpcc::rtos::Queue<T>::~Queue()
 {
+	T item;
+	while (this->tryGet(item)) {
+	}
+	delete[] this->cells;
 }
 
 template <typename T>
 std::size_t
 xpcc::rtos::Queue<T>::getSize() const
 {
-	std::lock_guard<std::timed_mutex> lock(mutex);
-	deque.size();
+	const std::size_t read = this->readPosition.load(std::memory_order_relaxed);
+	const std::size_t write = this->writePosition.load(std::memory_order_relaxed);
+	const std::size_t size = (write > read) ? (write - read) : 0;
+	return size + this->frontSize.load(std::memory_order_relaxed);
 }
 
+// ----------------------------------------------------------------------------
 template <typename T>
 bool
-xpcc::rtos::Queue<T>::append(const T& item, uint32_t timeout = -1)
+xpcc::rtos::Queue<T>::append(const T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout)) ||
-			deque.size() >= maxSize) {
-		return false;
+	if (this->wait([this, &item]() { return this->tryAppend(item); }, timeout))
+	{
+		this->notify();
+		return true;
 	}
-	
-	deque.push_back(item);
-	mutex.unlock();
+	return false;
 }
 
 template <typename T>
 bool
-xpcc::rtos::Queue<T>::prepend(const T& item, uint32_t timeout = -1)
+xpcc::rtos::Queue<T>::prepend(const T& item, uint32_t timeout)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
+	if (this->wait([this, &item]() { return this->tryPrepend(item); }, timeout))
+	{
+		this->notify();
+		return true;
 	}
-	
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
+	return false;
+}
+
+template <typename T>
+bool
+xpcc::rtos::Queue<T>::peek(T& item, uint32_t timeout)
+{
+	// nothing changes, no need to notify other threads
+	return this->wait([this, &item]() { return this->tryPeek(item); }, timeout);
+}
+
+template <typename T>
+bool
+xpcc::rtos::Queue<T>::get(T& item, uint32_t timeout)
+{
+	if (this->wait([this, &item]() { return this->tryGet(item); }, timeout))
+	{
+		this->notify();
+		return true;
 	}
-	
-	deque.push_front(item);
-	mutex.unlock();
-	
 	return false;
 }
 
+// ----------------------------------------------------------------------------
+template <typename T>
+inline bool
+xpcc::rtos::Queue<T>::appendFromInterrupt(const T& item)
+{
+	return append(item, 0);
+}
+
+template <typename T>
+inline bool
+xpcc::rtos::Queue<T>::prependFromInterrupt(const T& item)
+{
+	return prepend(item, 0);
+}
+
+template <typename T>
+inline bool
+xpcc::rtos::Queue<T>::getFromInterrupt(T& item)
+{
+	return get(item, 0);
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 bool
-xpcc::rtos::Queue<T>::peek(T& item, uint32_t timeout = -1) const
+xpcc::rtos::Queue<T>::tryAppend(const T& item)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
+	std::size_t position = this->writePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Cell& cell = this->cells[position & this->mask];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t difference = std::ptrdiff_t(sequence - position);
+		
+		if (difference == 0)
+		{
+			// the cell is free, try to claim it
+			if (this->writePosition.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed))
+			{
+				new (cell.storage) T(item);
+				cell.sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+			// position was updated by compare_exchange_weak()
+		}
+		else if (difference < 0)
+		{
+			// still holds the item of the previous round
+			return false;
+		}
+		else {
+			// another producer was faster
+			position = this->writePosition.load(std::memory_order_relaxed);
+		}
 	}
-	
-	if (deque.empty()) {
-		mutex.unlock();
+}
+
+template <typename T>
+bool
+xpcc::rtos::Queue<T>::tryPrepend(const T& item)
+{
+	if (this->getSize() > this->mask) {
 		return false;
 	}
-	
-	item = deque.front();
-	
-	mutex.unlock();
+	{
+		std::lock_guard<std::mutex> lock(this->frontMutex);
+		this->front.push_front(item);
+		this->frontSize.fetch_add(1);
+	}
 	return true;
 }
 
 template <typename T>
 bool
-xpcc::rtos::Queue<T>::get(T& item, uint32_t timeout = -1)
+xpcc::rtos::Queue<T>::tryPeek(T& item)
 {
-	if (!mutex.try_lock_for(std::chrono::milliseconds(timeout))) {
-		return false;
+	if (this->frontSize.load() != 0)
+	{
+		std::lock_guard<std::mutex> lock(this->frontMutex);
+		if (!this->front.empty())
+		{
+			item = this->front.front();
+			return true;
+		}
 	}
 	
-	if (deque.empty()) {
-		mutex.unlock();
-		return false;
+	std::size_t position = this->readPosition.load(std::memory_order_acquire);
+	while (true)
+	{
+		Cell& cell = this->cells[position & this->mask];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t difference = std::ptrdiff_t(sequence - (position + 1));
+		
+		if (difference < 0) {
+			// empty
+			return false;
+		}
+		if (difference == 0)
+		{
+			item = *reinterpret_cast<const T*>(cell.storage);
+			
+			// valid if no consumer has taken the item while copying
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (this->readPosition.load(std::memory_order_relaxed) == position) {
+				return true;
+			}
+		}
+		position = this->readPosition.load(std::memory_order_acquire);
 	}
-	
-	item = deque.front();
-	deque.pop_front();
-	
-	mutex.unlock();
-	return true;
 }
 
-// ----------------------------------------------------------------------------
 template <typename T>
-inline bool
-xpcc::rtos::Queue<T>::appendFromInterrupt(const T& item)
+bool
+xpcc::rtos::Queue<T>::tryGet(T& item)
 {
-	return append(item);
+	if (this->frontSize.load() != 0)
+	{
+		std::lock_guard<std::mutex> lock(this->frontMutex);
+		if (!this->front.empty())
+		{
+			item = this->front.front();
+			this->front.pop_front();
+			this->frontSize.fetch_sub(1);
+			return true;
+		}
+	}
+	
+	std::size_t position = this->readPosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Cell& cell = this->cells[position & this->mask];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t difference = std::ptrdiff_t(sequence - (position + 1));
+		
+		if (difference == 0)
+		{
+			if (this->readPosition.compare_exchange_weak(position, position + 1,
+					std::memory_order_relaxed))
+			{
+				T* value = reinterpret_cast<T*>(cell.storage);
+				item = *value;
+				value->~T();
+				
+				// free for the producers of the next round
+				cell.sequence.store(position + this->mask + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (difference < 0)
+		{
+			// empty
+			return false;
+		}
+		else {
+			position = this->readPosition.load(std::memory_order_relaxed);
+		}
+	}
 }
 
+// ----------------------------------------------------------------------------
 template <typename T>
-inline bool
-xpcc::rtos::Queue<T>::prependFromInterrupt(const T& item)
+template <typename Operation>
+bool
+xpcc::rtos::Queue<T>::wait(Operation operation, uint32_t timeout)
 {
-	return prepend(item);
+	if (operation()) {
+		return true;
+	}
+	if (timeout == 0) {
+		return false;
+	}
+	
+	const auto deadline = std::chrono::steady_clock::now() +
+			std::chrono::milliseconds(timeout);
+	
+	std::unique_lock<std::mutex> lock(this->waitMutex);
+	this->waiting.fetch_add(1);
+	
+	// Retry while holding the mutex after announcing the waiting thread.
+	// Either the retry sees the change of the other thread, or the other
+	// thread sees the waiting thread and notifies it (after the mutex was
+	// released by the wait).
+	bool success;
+	while (!(success = operation()))
+	{
+		if (timeout == uint32_t(-1)) {
+			this->changed.wait(lock);
+		}
+		else if (this->changed.wait_until(lock, deadline) == std::cv_status::timeout) {
+			success = operation();
+			break;
+		}
+	}
+	
+	this->waiting.fetch_sub(1);
+	return success;
 }
 
 template <typename T>
-inline bool
-xpcc::rtos::Queue<T>::getFromInterrupt(T& item)
+void
+xpcc::rtos::Queue<T>::notify()
 {
-	return get(item);
+	// orders the preceding change before reading the number of waiting
+	// threads, see wait()
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (this->waiting.load(std::memory_order_relaxed) != 0)
+	{
+		std::lock_guard<std::mutex> lock(this->waitMutex);
+		this->changed.notify_all();
+	}
 }
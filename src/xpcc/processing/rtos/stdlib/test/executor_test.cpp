@@ -0,0 +1,151 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <vector>
+
+#include <xpcc/processing/rtos/executor.hpp>
+
+#include "executor_test.hpp"
+
+namespace
+{
+	class CountingTask : public xpcc::rtos::Executor::Task
+	{
+	public:
+		CountingTask(uint32_t runs) :
+			runs(runs), count(0)
+		{
+		}
+
+		virtual bool
+		run()
+		{
+			return (++count < runs);
+		}
+
+		const uint32_t runs;
+		std::atomic<uint32_t> count;
+	};
+}
+
+void
+ExecutorTest::testRun()
+{
+	xpcc::rtos::Executor executor(2);
+	TEST_ASSERT_EQUALS(executor.getWorkerCount(), 2U);
+
+	CountingTask task(1);
+	std::atomic<uint32_t> calls(0);
+	executor.submit(task);
+	executor.submit([&calls]() { calls++; return false; });
+	executor.wait();
+
+	TEST_ASSERT_EQUALS(task.count.load(), 1U);
+	TEST_ASSERT_EQUALS(calls.load(), 1U);
+	TEST_ASSERT_EQUALS(executor.getPendingCount(), 0U);
+
+	// the executor can be reused
+	executor.submit(task);
+	executor.wait();
+	TEST_ASSERT_EQUALS(task.count.load(), 2U);
+}
+
+void
+ExecutorTest::testRunAgain()
+{
+	xpcc::rtos::Executor executor(1);
+
+	CountingTask a(10);
+	CountingTask b(20);
+	executor.submit(a);
+	executor.submit(b);
+
+	std::atomic<uint32_t> calls(0);
+	executor.submit([&calls]() { return (++calls < 5); });
+	executor.wait();
+
+	TEST_ASSERT_EQUALS(a.count.load(), 10U);
+	TEST_ASSERT_EQUALS(b.count.load(), 20U);
+	TEST_ASSERT_EQUALS(calls.load(), 5U);
+}
+
+void
+ExecutorTest::testPriority()
+{
+	typedef xpcc::rtos::Executor::Priority Priority;
+
+	std::vector<int> order;
+	std::atomic<bool> blocked(true);
+	{
+		// the only worker is blocked, so that all tasks are queued
+		// before the first one runs
+		xpcc::rtos::Executor executor(1);
+		executor.submit([&blocked]() { while (blocked) { std::this_thread::yield(); } return false; });
+
+		executor.submit([&order]() { order.push_back(3); return false; }, Priority::Low);
+		executor.submit([&order]() { order.push_back(1); return false; }, Priority::Normal);
+		executor.submit([&order]() { order.push_back(0); return false; }, Priority::High);
+		executor.submit([&order]() { order.push_back(2); return false; }, Priority::Normal);
+
+		blocked = false;
+		executor.wait();
+	}
+
+	TEST_ASSERT_EQUALS(order.size(), 4U);
+	for (std::size_t i = 0; i < order.size(); ++i) {
+		TEST_ASSERT_EQUALS(order[i], int(i));
+	}
+}
+
+void
+ExecutorTest::testSubmitFromTask()
+{
+	xpcc::rtos::Executor executor(2);
+
+	std::atomic<uint32_t> leaves(0);
+	executor.submit([&]()
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			executor.submit([&]()
+			{
+				for (int k = 0; k < 10; ++k) {
+					executor.submit([&leaves]() { leaves++; return false; });
+				}
+				return false;
+			});
+		}
+		return false;
+	});
+	executor.wait();
+
+	TEST_ASSERT_EQUALS(leaves.load(), 1000U);
+}
+
+void
+ExecutorTest::testManyWorkers()
+{
+	std::vector<CountingTask*> tasks;
+	{
+		xpcc::rtos::Executor executor(4);
+		for (uint32_t i = 0; i < 200; ++i)
+		{
+			tasks.push_back(new CountingTask(100 + i));
+			executor.submit(*tasks.back());
+		}
+		executor.wait();
+	}
+
+	for (uint32_t i = 0; i < tasks.size(); ++i)
+	{
+		TEST_ASSERT_EQUALS(tasks[i]->count.load(), 100 + i);
+		delete tasks[i];
+	}
+}
@@ -0,0 +1,202 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <xpcc/processing/rtos/queue.hpp>
+
+#include "queue_test.hpp"
+
+void
+QueueTest::testFifo()
+{
+	xpcc::rtos::Queue<int> queue(4);
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+
+	TEST_ASSERT_TRUE(queue.append(1, 0));
+	TEST_ASSERT_TRUE(queue.append(2, 0));
+	TEST_ASSERT_TRUE(queue.append(3, 0));
+	TEST_ASSERT_EQUALS(queue.getSize(), 3U);
+
+	int item = 0;
+	TEST_ASSERT_TRUE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(item, 1);
+	TEST_ASSERT_TRUE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(item, 2);
+	TEST_ASSERT_TRUE(queue.getFromInterrupt(item));
+	TEST_ASSERT_EQUALS(item, 3);
+
+	TEST_ASSERT_FALSE(queue.get(item, 0));
+	TEST_ASSERT_EQUALS(queue.getSize(), 0U);
+}
+
+void
+QueueTest::testCapacity()
+{
+	// rounded up to 8
+	xpcc::rtos::Queue<int> queue(5);
+	for (int i = 0; i < 8; ++i) {
+		TEST_ASSERT_TRUE(queue.appendFromInterrupt(i));
+	}
+	TEST_ASSERT_FALSE(queue.appendFromInterrupt(8));
+	TEST_ASSERT_FALSE(queue.prependFromInterrupt(8));
+
+	// wraps around several times
+	int item;
+	for (int i = 0; i < 100; ++i)
+	{
+		TEST_ASSERT_TRUE(queue.get(item, 0));
+		TEST_ASSERT_EQUALS(item, i);
+		TEST_ASSERT_TRUE(queue.append(i + 8, 0));
+	}
+	TEST_ASSERT_EQUALS(queue.getSize(), 8U);
+}
+
+void
+QueueTest::testPrependAndPeek()
+{
+	xpcc::rtos::Queue<int> queue(4);
+	TEST_ASSERT_TRUE(queue.append(2, 0));
+	TEST_ASSERT_TRUE(queue.append(3, 0));
+	TEST_ASSERT_TRUE(queue.prepend(1, 0));
+	TEST_ASSERT_TRUE(queue.prepend(0, 0));
+	TEST_ASSERT_EQUALS(queue.getSize(), 4U);
+	TEST_ASSERT_FALSE(queue.prepend(-1, 0));
+
+	int item = -1;
+	TEST_ASSERT_TRUE(queue.peek(item, 0));
+	TEST_ASSERT_EQUALS(item, 0);
+	TEST_ASSERT_EQUALS(queue.getSize(), 4U);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		TEST_ASSERT_TRUE(queue.get(item, 0));
+		TEST_ASSERT_EQUALS(item, i);
+	}
+	TEST_ASSERT_FALSE(queue.peek(item, 0));
+}
+
+void
+QueueTest::testPeekFullQueue()
+{
+	xpcc::rtos::Queue<int> queue(2);
+	TEST_ASSERT_TRUE(queue.append(1, 0));
+	TEST_ASSERT_TRUE(queue.append(2, 0));
+
+	std::atomic<bool> appended(false);
+	std::thread producer([&queue, &appended]()
+	{
+		queue.append(3);
+		appended = true;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	// the blocked producer never gets the slot of the peeked item
+	int item = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		TEST_ASSERT_TRUE(queue.peek(item, 10));
+		TEST_ASSERT_EQUALS(item, 1);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	TEST_ASSERT_TRUE(queue.peek(item));
+	TEST_ASSERT_EQUALS(item, 1);
+	TEST_ASSERT_FALSE(appended.load());
+	TEST_ASSERT_EQUALS(queue.getSize(), 2U);
+
+	for (int i = 1; i <= 3; ++i)
+	{
+		TEST_ASSERT_TRUE(queue.get(item, 1000));
+		TEST_ASSERT_EQUALS(item, i);
+	}
+	producer.join();
+	TEST_ASSERT_TRUE(appended.load());
+}
+
+void
+QueueTest::testTimeout()
+{
+	xpcc::rtos::Queue<int> queue(2);
+	int item;
+
+	auto start = std::chrono::steady_clock::now();
+	TEST_ASSERT_FALSE(queue.get(item, 20));
+	TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+	TEST_ASSERT_TRUE(queue.append(1, 20));
+	TEST_ASSERT_TRUE(queue.append(2, 20));
+	start = std::chrono::steady_clock::now();
+	TEST_ASSERT_FALSE(queue.append(3, 20));
+	TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+}
+
+void
+QueueTest::testBlockingGet()
+{
+	xpcc::rtos::Queue<int> queue(2);
+
+	std::thread producer([&queue]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		queue.append(42);
+	});
+
+	int item = 0;
+	TEST_ASSERT_TRUE(queue.get(item));
+	TEST_ASSERT_EQUALS(item, 42);
+	producer.join();
+}
+
+void
+QueueTest::testProducerConsumer()
+{
+	// small queue, the threads have to wait for each other
+	xpcc::rtos::Queue<uint32_t> queue(16);
+	const uint32_t items = 10000;
+
+	std::vector<std::thread> producers;
+	for (uint32_t p = 0; p < 3; ++p)
+	{
+		producers.emplace_back([&queue, p, items]()
+		{
+			for (uint32_t i = 1; i <= items; ++i) {
+				queue.append(p * items + i);
+			}
+		});
+	}
+
+	std::atomic<uint64_t> sum(0);
+	std::atomic<uint32_t> count(0);
+	std::vector<std::thread> consumers;
+	for (uint32_t c = 0; c < 2; ++c)
+	{
+		consumers.emplace_back([&]()
+		{
+			uint32_t item;
+			while (queue.get(item, 100))
+			{
+				sum += item;
+				count++;
+			}
+		});
+	}
+
+	for (std::thread& thread : producers) {
+		thread.join();
+	}
+	for (std::thread& thread : consumers) {
+		thread.join();
+	}
+
+	const uint64_t n = 3 * items;
+	TEST_ASSERT_EQUALS(count.load(), uint32_t(n));
+	TEST_ASSERT_EQUALS(sum.load(), n * (n + 1) / 2);
+}
@@ -0,0 +1,318 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__REALTIME_SCHEDULER_HPP
+#define XPCC__REALTIME_SCHEDULER_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/clock.hpp>
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/container/heap.hpp>
+#include <xpcc/processing/timer/timestamp.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \ingroup	processing
+	 * \brief	Types shared by all RealtimeScheduler instances
+	 */
+	class RealtimeSchedulerBase
+	{
+	public:
+		/// Higher values are more urgent
+		typedef uint8_t Priority;
+		typedef uint8_t Handle;
+
+		/// Returned by addTask() if there is no room for another task
+		static constexpr Handle invalidHandle = 0xff;
+
+		enum class
+		Policy : uint8_t
+		{
+			EarliestDeadlineFirst,
+			FixedPriority,
+		};
+
+		/**
+		 * \brief	%Scheduler task
+		 */
+		class Task
+		{
+		public:
+			virtual void
+			run() = 0;
+
+			/// Called after a job missed its deadline, does nothing by default
+			virtual void
+			deadlineMissed()
+			{
+			}
+		};
+	};
+
+	/**
+	 * \ingroup	processing
+	 * \brief	Periodic task scheduler with earliest deadline first or fixed
+	 * 			priority dispatching
+	 *
+	 * Every task is released once per period. A released job is due at its
+	 * release time plus the relative deadline of the task (by default the
+	 * period). The jobs which are ready are kept in a heap, so that
+	 * schedule() can dispatch the next job in O(log n) instead of scanning
+	 * all tasks like xpcc::Scheduler:
+	 *
+	 * - \c EarliestDeadlineFirst runs the job with the earliest absolute
+	 *   deadline, the priority only decides between equal deadlines.
+	 * - \c FixedPriority runs the job of the task with the highest priority,
+	 *   the deadline only decides between equal priorities.
+	 *
+	 * The tasks waiting for their next release are kept in a second heap
+	 * ordered by their release time. No memory is allocated, the scheduler
+	 * has room for \p N tasks.
+	 *
+	 * \code
+	 * xpcc::RealtimeScheduler<16> scheduler;
+	 *
+	 * // every 10ms, has to finish within 5ms after its release
+	 * auto control = scheduler.addTask(controlTask, 10, 127, 5);
+	 * scheduler.addTask(displayTask, 100);
+	 *
+	 * while (1)
+	 * {
+	 *     scheduler.schedule();
+	 * }
+	 *
+	 * // later on
+	 * const auto& statistics = scheduler.getStatistics(control);
+	 * XPCC_LOG_INFO << statistics.maximumExecutionTime << xpcc::endl;
+	 * \endcode
+	 *
+	 * schedule() may also be called from a timer interrupt. A job is run
+	 * with interrupts enabled, so the next interrupt may preempt it with a
+	 * job which is more urgent.
+	 *
+	 * A job which has not finished at its deadline is an overrun: the
+	 * counter in the Statistics of the task is incremented and
+	 * Task::deadlineMissed() is called. If the job has not even been started
+	 * at its next release, this release is skipped (and counted as an
+	 * overrun as well), so a task never has more than one pending job.
+	 *
+	 * All times are in the unit of \p Clock. The execution times are
+	 * measured with \p Clock as well, use a clock with a finer resolution
+	 * than the periods to get meaningful statistics.
+	 *
+	 * \tparam	N				Maximum number of tasks (< 255)
+	 * \tparam	Clock			Used clock which inherits from xpcc::Clock
+	 * \tparam	TimestampType	Used timestamp which is compatible with the
+	 * 							chosen Clock
+	 *
+	 * \see		Scheduler
+	 */
+	template <std::size_t N,
+			  class Clock = ::xpcc::Clock,
+			  class TimestampType = ::xpcc::Timestamp>
+	class RealtimeScheduler : public RealtimeSchedulerBase
+	{
+		static_assert(N > 0, "N = 0 is not allowed");
+		static_assert(N < 255, "N is too large");
+
+		typedef typename TimestampType::Type Type;
+		typedef typename TimestampType::SignedType SignedType;
+
+	public:
+		/// Collected for every task since it was added or the statistics were reset
+		struct Statistics
+		{
+			/// Number of finished jobs
+			uint32_t executions;
+
+			/// Number of jobs which finished late or were skipped
+			uint32_t overruns;
+
+			Type minimumExecutionTime;
+			Type maximumExecutionTime;
+
+			/// Sum of all execution times, overflows eventually
+			uint32_t totalExecutionTime;
+
+			/// Longest time from the release until a job was started
+			Type maximumLatency;
+
+			/// Longest time from the release until a job was finished
+			Type maximumResponseTime;
+
+			inline Type
+			getAverageExecutionTime() const
+			{
+				return (executions == 0) ? 0 : (totalExecutionTime / executions);
+			}
+		};
+
+	public:
+		RealtimeScheduler(Policy policy = Policy::EarliestDeadlineFirst);
+
+		/**
+		 * \brief	Add a periodic task
+		 *
+		 * The first job is released after one \p period.
+		 *
+		 * \param	deadline	Relative to the release of a job, zero means
+		 * 						the end of the period
+		 *
+		 * \return	Handle for the task or \c invalidHandle if the scheduler
+		 * 			is full
+		 */
+		Handle
+		addTask(Task& task,
+				TimestampType period,
+				Priority priority = 127,
+				TimestampType deadline = TimestampType(0));
+
+		/**
+		 * \brief	Remove a task
+		 *
+		 * May be called from inside of a task, even for the running task.
+		 * The handle may be returned again by a following addTask().
+		 *
+		 * \return	\c false if \p handle does not belong to a task
+		 */
+		bool
+		removeTask(Handle handle);
+
+		/// \c true if \p handle belongs to a task
+		bool
+		contains(Handle handle) const;
+
+		/// Number of tasks
+		std::size_t
+		getSize() const;
+
+		inline Policy
+		getPolicy() const
+		{
+			return this->policy;
+		}
+
+		/// Handle has to belong to a task
+		inline const Statistics&
+		getStatistics(Handle handle) const
+		{
+			return this->entries[handle].statistics;
+		}
+
+		void
+		resetStatistics(Handle handle);
+
+		/**
+		 * \brief	Release the due jobs and run the ready ones
+		 *
+		 * Returns when there are no ready jobs left, which are more urgent
+		 * than the job this call has preempted (if any).
+		 *
+		 * \warning	Jobs released while running the others are run by the
+		 * 			same call. If the tasks need more time than available,
+		 * 			this method does not return.
+		 */
+		void
+		schedule();
+
+	private:
+		enum
+		State : uint8_t
+		{
+			FREE,
+			WAITING,	///< for the next release
+			READY,
+			RUNNING,
+			REMOVED,	///< while running
+		};
+
+		struct Entry
+		{
+			Task* task;
+
+			Type period;
+			Type deadline;
+			Type absoluteDeadline;	///< of the current job
+
+			Statistics statistics;
+
+			uint8_t waitingHandle;
+			uint8_t readyHandle;
+			Priority priority;
+			State state;
+		};
+
+		/// Next release of a task, ordered by the time
+		struct Release
+		{
+			Type time;
+			uint8_t index;
+		};
+
+		struct ReleaseOrder
+		{
+			inline bool
+			operator () (const Release& a, const Release& b) const
+			{
+				return (SignedType(a.time - b.time) < 0);
+			}
+		};
+
+		/// Ready or running job, ordered by the policy of the scheduler
+		struct Job
+		{
+			Type deadline;
+			Priority priority;
+			uint8_t index;
+		};
+
+		struct DispatchOrder
+		{
+			Policy policy;
+
+			bool
+			operator () (const Job& a, const Job& b) const;
+		};
+
+		/// Moves the jobs released until \p now to the ready heap
+		void
+		release(Type now);
+
+		void
+		run(uint8_t index);
+
+		void
+		addOverrun(Entry& entry);
+
+		Entry entries[N];
+
+		// the keys are stored inside of the heaps, the comparisons do not
+		// need to access the entries
+		BoundedHeap<Release, N, ReleaseOrder> waiting;
+		BoundedHeap<Job, N, DispatchOrder> ready;
+
+		Policy policy;
+
+		/// Job which has been started last and has not finished yet
+		Job running;
+
+	private:
+		RealtimeScheduler(const RealtimeScheduler& other);
+
+		RealtimeScheduler&
+		operator = (const RealtimeScheduler& other);
+	};
+}
+
+#include "realtime_scheduler_impl.hpp"
+
+#endif	// XPCC__REALTIME_SCHEDULER_HPP
@@ -0,0 +1,254 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__REALTIME_SCHEDULER_HPP
+	#error	"Don't include this file directly, use 'realtime_scheduler.hpp' instead!"
+#endif
+
+template <std::size_t N, class Clock, class TimestampType>
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::RealtimeScheduler(Policy policy) :
+	waiting(ReleaseOrder()),
+	ready(DispatchOrder { policy }),
+	policy(policy)
+{
+	this->running.index = invalidHandle;
+	for (std::size_t i = 0; i < N; ++i) {
+		this->entries[i].task = 0;
+		this->entries[i].state = FREE;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <std::size_t N, class Clock, class TimestampType>
+typename xpcc::RealtimeScheduler<N, Clock, TimestampType>::Handle
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::addTask(Task& task,
+		TimestampType period, Priority priority, TimestampType deadline)
+{
+	atomic::Lock lock;
+
+	for (uint8_t index = 0; index < N; ++index)
+	{
+		Entry& entry = this->entries[index];
+		if (entry.state != FREE) {
+			continue;
+		}
+
+		entry.task = &task;
+		entry.period = period.getTime();
+		entry.deadline = (deadline.getTime() == 0) ? entry.period : deadline.getTime();
+		entry.absoluteDeadline = 0;
+		entry.priority = priority;
+		entry.state = WAITING;
+		this->resetStatistics(index);
+
+		const Release release = {
+				(Clock::template now<TimestampType>() + period).getTime(), index };
+		entry.waitingHandle = this->waiting.push(release);
+		return index;
+	}
+	return invalidHandle;
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+bool
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::removeTask(Handle handle)
+{
+	atomic::Lock lock;
+
+	if (!this->contains(handle)) {
+		return false;
+	}
+
+	Entry& entry = this->entries[handle];
+	this->waiting.remove(entry.waitingHandle);
+
+	switch (entry.state)
+	{
+		case READY:
+			this->ready.remove(entry.readyHandle);
+			entry.state = FREE;
+			break;
+		case RUNNING:
+			// the slot is freed when the job returns
+			entry.state = REMOVED;
+			break;
+		default:
+			entry.state = FREE;
+			break;
+	}
+	return true;
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+bool
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::contains(Handle handle) const
+{
+	return (handle < N &&
+			this->entries[handle].state != FREE &&
+			this->entries[handle].state != REMOVED);
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+std::size_t
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::getSize() const
+{
+	// every task waits for its next release
+	return this->waiting.getSize();
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+void
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::resetStatistics(Handle handle)
+{
+	Statistics& statistics = this->entries[handle].statistics;
+	statistics.executions = 0;
+	statistics.overruns = 0;
+	statistics.minimumExecutionTime = static_cast<Type>(-1);
+	statistics.maximumExecutionTime = 0;
+	statistics.totalExecutionTime = 0;
+	statistics.maximumLatency = 0;
+	statistics.maximumResponseTime = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <std::size_t N, class Clock, class TimestampType>
+void
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::schedule()
+{
+	atomic::Lock lock;
+
+	this->release(Clock::template now<TimestampType>().getTime());
+
+	const Job preempted = this->running;
+	const DispatchOrder isMoreUrgent = { this->policy };
+	while (!this->ready.isEmpty() &&
+		   (preempted.index == invalidHandle || isMoreUrgent(this->ready.getTop(), preempted)))
+	{
+		this->running = this->ready.getTop();
+		this->ready.pop();
+
+		this->run(this->running.index);
+		this->running = preempted;
+
+		// jobs may have been released while this one was running
+		this->release(Clock::template now<TimestampType>().getTime());
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <std::size_t N, class Clock, class TimestampType>
+bool
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::DispatchOrder::operator () (
+		const Job& a, const Job& b) const
+{
+	const SignedType difference = SignedType(a.deadline - b.deadline);
+	if (this->policy == Policy::EarliestDeadlineFirst)
+	{
+		if (difference != 0) {
+			return (difference < 0);
+		}
+		return (a.priority > b.priority);
+	}
+	else
+	{
+		if (a.priority != b.priority) {
+			return (a.priority > b.priority);
+		}
+		return (difference < 0);
+	}
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+void
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::release(Type now)
+{
+	while (!this->waiting.isEmpty())
+	{
+		Release release = this->waiting.getTop();
+		if (SignedType(release.time - now) > 0) {
+			break;
+		}
+
+		Entry& entry = this->entries[release.index];
+		const bool skipped = (entry.state != WAITING);
+		if (!skipped)
+		{
+			entry.absoluteDeadline = release.time + entry.deadline;
+			entry.state = READY;
+
+			const Job job = { entry.absoluteDeadline, entry.priority, release.index };
+			entry.readyHandle = this->ready.push(job);
+		}
+
+		// the release times do not drift, even if schedule() is called late
+		release.time += entry.period;
+		this->waiting.update(entry.waitingHandle, release);
+
+		if (skipped) {
+			// the previous job has not finished yet
+			this->addOverrun(entry);
+		}
+	}
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+void
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::run(uint8_t index)
+{
+	Entry& entry = this->entries[index];
+	entry.state = RUNNING;
+
+	// release time of this job
+	const Type released = entry.absoluteDeadline - entry.deadline;
+	const Type start = Clock::template now<TimestampType>().getTime();
+	{
+		// the actual execution of the task happens with interrupts enabled
+		atomic::Unlock unlock;
+		entry.task->run();
+	}
+	const Type end = Clock::template now<TimestampType>().getTime();
+
+	if (entry.state == REMOVED)
+	{
+		entry.state = FREE;
+		return;
+	}
+	entry.state = WAITING;
+
+	Statistics& statistics = entry.statistics;
+	const Type time = end - start;
+	statistics.executions++;
+	statistics.totalExecutionTime += time;
+	if (time < statistics.minimumExecutionTime) {
+		statistics.minimumExecutionTime = time;
+	}
+	if (time > statistics.maximumExecutionTime) {
+		statistics.maximumExecutionTime = time;
+	}
+	if (Type(start - released) > statistics.maximumLatency) {
+		statistics.maximumLatency = start - released;
+	}
+	if (Type(end - released) > statistics.maximumResponseTime) {
+		statistics.maximumResponseTime = end - released;
+	}
+
+	if (SignedType(end - entry.absoluteDeadline) > 0) {
+		this->addOverrun(entry);
+	}
+}
+
+template <std::size_t N, class Clock, class TimestampType>
+void
+xpcc::RealtimeScheduler<N, Clock, TimestampType>::addOverrun(Entry& entry)
+{
+	entry.statistics.overruns++;
+
+	atomic::Unlock unlock;
+	entry.task->deadlineMissed();
+}
@@ -0,0 +1,352 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/processing/scheduler/realtime_scheduler.hpp>
+#include <xpcc/architecture/driver/clock_dummy.hpp>
+
+#include "realtime_scheduler_test.hpp"
+
+// ----------------------------------------------------------------------------
+typedef xpcc::RealtimeScheduler<8, xpcc::ClockDummy> Scheduler;
+typedef Scheduler::Policy Policy;
+
+namespace
+{
+	uint8_t log[16];
+	uint8_t logSize;
+
+	class TestTask : public Scheduler::Task
+	{
+	public:
+		TestTask(uint8_t id, uint32_t executionTime = 0) :
+			id(id), executionTime(executionTime), misses(0),
+			scheduler(0), removeHandle(Scheduler::invalidHandle)
+		{
+		}
+
+		virtual void
+		run()
+		{
+			if (logSize < sizeof(log)) {
+				log[logSize++] = id;
+			}
+			xpcc::ClockDummy::setTime(xpcc::ClockDummy::now().getTime() + executionTime);
+
+			if (scheduler != 0)
+			{
+				if (removeHandle != Scheduler::invalidHandle) {
+					scheduler->removeTask(removeHandle);
+				}
+				else {
+					// like a timer interrupt
+					scheduler->schedule();
+				}
+			}
+		}
+
+		virtual void
+		deadlineMissed()
+		{
+			misses++;
+		}
+
+		uint8_t id;
+		uint32_t executionTime;
+		uint8_t misses;
+
+		Scheduler* scheduler;
+		Scheduler::Handle removeHandle;
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+RealtimeSchedulerTest::setUp()
+{
+	xpcc::ClockDummy::setTime(1000);
+	logSize = 0;
+}
+
+void
+RealtimeSchedulerTest::testEarliestDeadlineFirst()
+{
+	Scheduler scheduler;
+	TEST_ASSERT_TRUE(scheduler.getPolicy() == Policy::EarliestDeadlineFirst);
+
+	TestTask task1(1);
+	TestTask task2(2);
+	TestTask task3(3);
+
+	// the priority only decides between equal deadlines
+	scheduler.addTask(task1, 10, 200);
+	scheduler.addTask(task2, 20, 10, 5);
+	scheduler.addTask(task3, 10, 100, 8);
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 3U);
+
+	xpcc::ClockDummy::setTime(1009);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 0);
+
+	xpcc::ClockDummy::setTime(1010);
+	scheduler.schedule();
+	uint8_t expected1[] = { 3, 1 };
+	TEST_ASSERT_EQUALS(logSize, 2);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected1, 2);
+
+	logSize = 0;
+	xpcc::ClockDummy::setTime(1020);
+	scheduler.schedule();
+	uint8_t expected2[] = { 2, 3, 1 };
+	TEST_ASSERT_EQUALS(logSize, 3);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected2, 3);
+
+	// nothing released since
+	logSize = 0;
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 0);
+}
+
+void
+RealtimeSchedulerTest::testFixedPriority()
+{
+	Scheduler scheduler(Policy::FixedPriority);
+
+	TestTask task1(1);
+	TestTask task2(2);
+	TestTask task3(3);
+	TestTask task4(4);
+
+	// same as in the test of xpcc::Scheduler
+	scheduler.addTask(task1, 3, 10);
+	scheduler.addTask(task2, 3);
+	scheduler.addTask(task3, 3, 20);
+	scheduler.addTask(task4, 3, 200);
+
+	xpcc::ClockDummy::setTime(1003);
+	scheduler.schedule();
+	uint8_t expected[] = { 4, 2, 3, 1 };
+	TEST_ASSERT_EQUALS(logSize, 4);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected, 4);
+
+	// equal priorities are ordered by their deadline
+	Scheduler other(Policy::FixedPriority);
+	TestTask task5(5);
+	other.addTask(task1, 10, 50);
+	other.addTask(task5, 10, 50, 2);
+
+	logSize = 0;
+	xpcc::ClockDummy::setTime(1013);
+	other.schedule();
+	uint8_t expected2[] = { 5, 1 };
+	TEST_ASSERT_EQUALS(logSize, 2);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected2, 2);
+}
+
+void
+RealtimeSchedulerTest::testRemove()
+{
+	Scheduler scheduler;
+
+	TestTask task1(1);
+	TestTask task2(2);
+	TestTask task3(3);
+
+	Scheduler::Handle handle1 = scheduler.addTask(task1, 10);
+	Scheduler::Handle handle2 = scheduler.addTask(task2, 10);
+	Scheduler::Handle handle3 = scheduler.addTask(task3, 10);
+	TEST_ASSERT_TRUE(scheduler.contains(handle2));
+
+	TEST_ASSERT_TRUE(scheduler.removeTask(handle2));
+	TEST_ASSERT_FALSE(scheduler.contains(handle2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(handle2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(Scheduler::invalidHandle));
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 2U);
+
+	xpcc::ClockDummy::setTime(1010);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 2);
+	TEST_ASSERT_EQUALS(log[0] + log[1], 4);
+
+	// the free slot is used again
+	TEST_ASSERT_EQUALS(scheduler.addTask(task2, 5), handle2);
+
+	TEST_ASSERT_TRUE(scheduler.removeTask(handle1));
+	TEST_ASSERT_TRUE(scheduler.removeTask(handle3));
+
+	logSize = 0;
+	xpcc::ClockDummy::setTime(1100);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 1);
+	TEST_ASSERT_EQUALS(log[0], 2);
+}
+
+void
+RealtimeSchedulerTest::testRemoveFromTask()
+{
+	Scheduler scheduler;
+
+	TestTask task1(1);
+	TestTask task2(2);
+	TestTask task3(3);
+
+	Scheduler::Handle handle1 = scheduler.addTask(task1, 10, 127, 2);
+	Scheduler::Handle handle2 = scheduler.addTask(task2, 10, 127, 5);
+	scheduler.addTask(task3, 10, 127, 8);
+
+	// task 1 removes the ready task 2, task 3 removes the running task 3
+	task1.scheduler = &scheduler;
+	task1.removeHandle = handle2;
+	task3.scheduler = &scheduler;
+	task3.removeHandle = 2;
+
+	xpcc::ClockDummy::setTime(1010);
+	scheduler.schedule();
+	uint8_t expected[] = { 1, 3 };
+	TEST_ASSERT_EQUALS(logSize, 2);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected, 2);
+	TEST_ASSERT_EQUALS(scheduler.getSize(), 1U);
+	TEST_ASSERT_TRUE(scheduler.contains(handle1));
+
+	logSize = 0;
+	task1.scheduler = 0;
+	xpcc::ClockDummy::setTime(1020);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 1);
+	TEST_ASSERT_EQUALS(log[0], 1);
+}
+
+void
+RealtimeSchedulerTest::testCapacity()
+{
+	xpcc::RealtimeScheduler<2, xpcc::ClockDummy> scheduler;
+
+	TestTask task(1);
+	TEST_ASSERT_EQUALS(scheduler.addTask(task, 10), 0);
+	TEST_ASSERT_EQUALS(scheduler.addTask(task, 20), 1);
+	TEST_ASSERT_EQUALS(scheduler.addTask(task, 30), Scheduler::invalidHandle);
+
+	TEST_ASSERT_TRUE(scheduler.removeTask(0));
+	TEST_ASSERT_EQUALS(scheduler.addTask(task, 30), 0);
+}
+
+void
+RealtimeSchedulerTest::testOverrun()
+{
+	Scheduler scheduler(Policy::FixedPriority);
+
+	TestTask task1(1, 4);
+	TestTask task2(2, 1);
+
+	Scheduler::Handle handle1 = scheduler.addTask(task1, 10, 200, 5);
+	Scheduler::Handle handle2 = scheduler.addTask(task2, 10, 100, 4);
+
+	// task 2 has to wait for task 1 and finishes at 1015, one after its
+	// deadline
+	xpcc::ClockDummy::setTime(1010);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 2);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle1).overruns, 0U);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).overruns, 1U);
+	TEST_ASSERT_EQUALS(task1.misses, 0);
+	TEST_ASSERT_EQUALS(task2.misses, 1);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).executions, 1U);
+
+	scheduler.resetStatistics(handle2);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).overruns, 0U);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).executions, 0U);
+}
+
+void
+RealtimeSchedulerTest::testSkippedRelease()
+{
+	Scheduler scheduler;
+
+	TestTask task1(1);
+	TestTask task2(2, 25);
+	Scheduler::Handle handle1 = scheduler.addTask(task1, 10);
+	Scheduler::Handle handle2 = scheduler.addTask(task2, 30);
+
+	// Scheduled late: the releases of task 1 at 1020 and 1030 are skipped
+	// and the job released at 1010 finishes late. Task 2 runs until 1060
+	// and 1085, so task 1 skips the releases at 1050, 1060 and 1080 and its
+	// jobs released at 1040 and 1070 finish late as well.
+	xpcc::ClockDummy::setTime(1035);
+	scheduler.schedule();
+	uint8_t expected[] = { 1, 2, 1, 2, 1 };
+	TEST_ASSERT_EQUALS(logSize, 5);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected, 5);
+
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle1).executions, 3U);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle1).overruns, 8U);
+	TEST_ASSERT_EQUALS(task1.misses, 8);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).executions, 2U);
+	TEST_ASSERT_EQUALS(scheduler.getStatistics(handle2).overruns, 0U);
+
+	// no drift of the release times
+	task2.executionTime = 0;
+	logSize = 0;
+	xpcc::ClockDummy::setTime(1089);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 0);
+	xpcc::ClockDummy::setTime(1090);
+	scheduler.schedule();
+	TEST_ASSERT_EQUALS(logSize, 2);
+}
+
+void
+RealtimeSchedulerTest::testStatistics()
+{
+	Scheduler scheduler;
+
+	TestTask task1(1, 2);
+	TestTask task2(2, 3);
+	scheduler.addTask(task1, 10, 200);
+	Scheduler::Handle handle = scheduler.addTask(task2, 10, 100);
+
+	xpcc::ClockDummy::setTime(1011);
+	scheduler.schedule();
+
+	task2.executionTime = 5;
+	xpcc::ClockDummy::setTime(1020);
+	scheduler.schedule();
+
+	const Scheduler::Statistics& statistics = scheduler.getStatistics(handle);
+	TEST_ASSERT_EQUALS(statistics.executions, 2U);
+	TEST_ASSERT_EQUALS(statistics.overruns, 0U);
+	TEST_ASSERT_EQUALS(statistics.minimumExecutionTime, 3U);
+	TEST_ASSERT_EQUALS(statistics.maximumExecutionTime, 5U);
+	TEST_ASSERT_EQUALS(statistics.totalExecutionTime, 8U);
+	TEST_ASSERT_EQUALS(statistics.getAverageExecutionTime(), 4U);
+	// released at 1010, started at 1013 after task 1
+	TEST_ASSERT_EQUALS(statistics.maximumLatency, 3U);
+	TEST_ASSERT_EQUALS(statistics.maximumResponseTime, 7U);
+}
+
+void
+RealtimeSchedulerTest::testPreemption()
+{
+	Scheduler scheduler;
+
+	// task 1 calls schedule() while running, like a timer interrupt would
+	TestTask task1(1, 10);
+	TestTask task2(2);
+	TestTask task3(3);
+	task1.scheduler = &scheduler;
+
+	scheduler.addTask(task1, 100, 127, 50);
+	scheduler.addTask(task2, 105, 127, 2);
+	scheduler.addTask(task3, 105, 127, 80);
+
+	// task 2 preempts task 1, task 3 has to wait until task 1 is finished
+	xpcc::ClockDummy::setTime(1100);
+	scheduler.schedule();
+	uint8_t expected[] = { 1, 2, 3 };
+	TEST_ASSERT_EQUALS(logSize, 3);
+	TEST_ASSERT_EQUALS_ARRAY(log, expected, 3);
+}
@@ -0,0 +1,45 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class RealtimeSchedulerTest : public unittest::TestSuite
+{
+public:
+	virtual void
+	setUp();
+
+
+	void
+	testEarliestDeadlineFirst();
+
+	void
+	testFixedPriority();
+
+	void
+	testRemove();
+
+	void
+	testRemoveFromTask();
+
+	void
+	testCapacity();
+
+	void
+	testOverrun();
+
+	void
+	testSkippedRelease();
+
+	void
+	testStatistics();
+
+	void
+	testPreemption();
+};
@@ -0,0 +1,324 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/processing/timer.hpp>
+#include <xpcc/architecture/driver/clock_dummy.hpp>
+#include <xpcc/architecture/driver/test/testing_clock.hpp>
+
+#include "timer_wheel_test.hpp"
+
+namespace
+{
+	/// Like ClockDummy, but with 64 bit
+	struct RandomClock
+	{
+		template< typename TimestampType >
+		static TimestampType
+		now()
+		{
+			return TimestampType(time);
+		}
+
+		static uint64_t time;
+	};
+
+	uint64_t RandomClock::time = 0;
+
+	typedef xpcc::GenericTimerWheel<xpcc::ClockDummy, xpcc::Timestamp> Wheel;
+	typedef Wheel::Timer Timer;
+
+	void
+	count(void* context)
+	{
+		(*static_cast<uint16_t*>(context))++;
+	}
+
+	struct Restart
+	{
+		Wheel* wheel;
+		Timer* timer;
+		uint8_t count;
+	};
+
+	void
+	restart(void* context)
+	{
+		Restart* data = static_cast<Restart*>(context);
+		if (++data->count < 3) {
+			data->wheel->start(*data->timer, 5);
+		}
+	}
+
+	/**
+	 * Starts timers with random delays (up to `maxDelay`) and advances the
+	 * time in random steps. Every timer has to expire at the first update()
+	 * after its expiration time.
+	 */
+	template< class TimestampType >
+	uint32_t
+	checkRandom(uint64_t start, uint32_t maxDelay)
+	{
+		typedef xpcc::GenericTimerWheel<RandomClock, TimestampType> RandomWheel;
+		typedef typename TimestampType::Type Type;
+		static constexpr uint8_t Timers = 32;
+
+		uint64_t& time = RandomClock::time;
+		time = start;
+		RandomWheel wheel;
+		typename RandomWheel::Timer timers[Timers];
+		Type expiration[Timers];
+
+		uint32_t random = 42;
+		uint32_t errors = 0;
+		for (uint16_t step = 0; step < 5000; ++step)
+		{
+			random = random * 1103515245 + 12345;
+			const uint8_t index = (random >> 8) % Timers;
+			if (!timers[index].isArmed())
+			{
+				const Type delay = (random >> 4) % maxDelay;
+				wheel.start(timers[index], delay);
+				expiration[index] = Type(time + ((delay == 0) ? 1 : delay));
+			}
+
+			random = random * 1103515245 + 12345;
+			const Type previous = Type(time);
+			time += ((random >> 8) % 4 == 0) ? ((random >> 12) % (maxDelay / 8 + 1)) : ((random >> 12) % 3);
+			wheel.update();
+
+			for (uint8_t i = 0; i < Timers; ++i)
+			{
+				if (timers[i].execute())
+				{
+					// expired in this update, not before
+					const Type now = Type(time);
+					if (typename TimestampType::SignedType(expiration[i] - previous) <= 0 ||
+						typename TimestampType::SignedType(expiration[i] - now) > 0) {
+						errors++;
+					}
+				}
+				else if (timers[i].isArmed())
+				{
+					if (typename TimestampType::SignedType(expiration[i] - Type(time)) <= 0) {
+						errors++;
+					}
+				}
+			}
+		}
+		return errors;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+TimerWheelTest::setUp()
+{
+	xpcc::ClockDummy::setTime(0);
+}
+
+void
+TimerWheelTest::testDefaultConstructor()
+{
+	Timer timer;
+
+	TEST_ASSERT_FALSE(timer.isArmed());
+	TEST_ASSERT_FALSE(timer.isExpired());
+	TEST_ASSERT_FALSE(timer.isPeriodic());
+	TEST_ASSERT_FALSE(timer.execute());
+
+	xpcc::ClockDummy::setTime(1234);
+	Wheel wheel;
+	TEST_ASSERT_EQUALS(wheel.getTime(), xpcc::Timestamp(1234));
+	TEST_ASSERT_EQUALS(Wheel::Levels, 6);
+}
+
+void
+TimerWheelTest::testExpire()
+{
+	Wheel wheel;
+	Timer timer;
+	Timer immediate;
+
+	wheel.start(timer, 10);
+	wheel.start(immediate, 0);
+	TEST_ASSERT_TRUE(timer.isArmed());
+	TEST_ASSERT_EQUALS(timer.getExpiration(), xpcc::Timestamp(10));
+
+	for (uint32_t i = 1; i < 10; ++i)
+	{
+		xpcc::ClockDummy::setTime(i);
+		wheel.update();
+		TEST_ASSERT_FALSE(timer.isExpired());
+		TEST_ASSERT_FALSE(timer.execute());
+		TEST_ASSERT_TRUE(timer.isArmed());
+	}
+	TEST_ASSERT_TRUE(immediate.execute());
+
+	xpcc::ClockDummy::setTime(10);
+	wheel.update();
+	TEST_ASSERT_TRUE(timer.isExpired());
+	TEST_ASSERT_FALSE(timer.isArmed());
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_TRUE(timer.isExpired());
+
+	// restarting clears the expired state
+	wheel.start(timer, 100000);
+	TEST_ASSERT_FALSE(timer.isExpired());
+	xpcc::ClockDummy::setTime(100009);
+	wheel.update();
+	TEST_ASSERT_FALSE(timer.isExpired());
+	xpcc::ClockDummy::setTime(100010);
+	wheel.update();
+	TEST_ASSERT_TRUE(timer.execute());
+}
+
+void
+TimerWheelTest::testHandler()
+{
+	Wheel wheel;
+	uint16_t counter = 0;
+	Timer timers[] = {
+		Timer(&count, &counter), Timer(&count, &counter), Timer(&count, &counter) };
+
+	wheel.start(timers[0], 5);
+	wheel.start(timers[1], 5);
+	wheel.start(timers[2], 70);
+
+	// several ticks in one update
+	xpcc::ClockDummy::setTime(20);
+	wheel.update();
+	TEST_ASSERT_EQUALS(counter, 2);
+	TEST_ASSERT_EQUALS(wheel.getTime(), xpcc::Timestamp(20));
+
+	xpcc::ClockDummy::setTime(80);
+	wheel.update();
+	TEST_ASSERT_EQUALS(counter, 3);
+}
+
+void
+TimerWheelTest::testPeriodic()
+{
+	Wheel wheel;
+	uint16_t counter = 0;
+	Timer timer(&count, &counter);
+
+	wheel.startPeriodic(timer, 10);
+	TEST_ASSERT_TRUE(timer.isPeriodic());
+
+	for (uint32_t i = 1; i <= 100; ++i) {
+		xpcc::ClockDummy::setTime(i);
+		wheel.update();
+	}
+	TEST_ASSERT_EQUALS(counter, 10);
+	TEST_ASSERT_TRUE(timer.isArmed());
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getExpiration(), xpcc::Timestamp(110));
+
+	// missed periods are skipped
+	xpcc::ClockDummy::setTime(155);
+	wheel.update();
+	TEST_ASSERT_EQUALS(counter, 11);
+	TEST_ASSERT_EQUALS(timer.getExpiration(), xpcc::Timestamp(160));
+	TEST_ASSERT_TRUE(timer.execute());
+}
+
+void
+TimerWheelTest::testStop()
+{
+	Wheel wheel;
+	uint16_t counter = 0;
+	Timer timer(&count, &counter);
+
+	wheel.startPeriodic(timer, 10);
+	timer.stop();
+	TEST_ASSERT_FALSE(timer.isArmed());
+
+	xpcc::ClockDummy::setTime(100);
+	wheel.update();
+	TEST_ASSERT_EQUALS(counter, 0);
+	TEST_ASSERT_FALSE(timer.execute());
+
+	{
+		// destroying an armed timer removes it from the wheel
+		Timer temporary(&count, &counter);
+		wheel.start(temporary, 10);
+	}
+	xpcc::ClockDummy::setTime(200);
+	wheel.update();
+	TEST_ASSERT_EQUALS(counter, 0);
+}
+
+void
+TimerWheelTest::testRestartFromHandler()
+{
+	Wheel wheel;
+	Timer timer;
+	Restart data = { &wheel, &timer, 0 };
+	timer = Timer(&restart, &data);
+
+	wheel.start(timer, 5);
+	for (uint32_t i = 1; i <= 100; ++i) {
+		xpcc::ClockDummy::setTime(i);
+		wheel.update();
+	}
+
+	TEST_ASSERT_EQUALS(data.count, 3);
+	TEST_ASSERT_FALSE(timer.isArmed());
+}
+
+void
+TimerWheelTest::testRandomShort()
+{
+	// includes the overflow of the 16 bit time
+	TEST_ASSERT_EQUALS(checkRandom<xpcc::ShortTimestamp>(60000, 30000), 0U);
+}
+
+void
+TimerWheelTest::testRandom()
+{
+	TEST_ASSERT_EQUALS(checkRandom<xpcc::Timestamp>(0xffff0000, 1000000), 0U);
+}
+
+void
+TimerWheelTest::testRandomLong()
+{
+	TEST_ASSERT_EQUALS(checkRandom<xpcc::LongTimestamp>(0x0123456789000000ULL, 5000000), 0U);
+}
+
+void
+TimerWheelTest::testClock()
+{
+	TestingClock::time = 500;
+	xpcc::TimerWheel wheel;
+	xpcc::WheelTimer timer;
+
+	wheel.start(timer, 20);
+	TestingClock::time = 519;
+	wheel.update();
+	TEST_ASSERT_FALSE(timer.execute());
+
+	TestingClock::time = 520;
+	wheel.update();
+	TEST_ASSERT_TRUE(timer.execute());
+}
+
+void
+TimerWheelTest::testLongClock()
+{
+	TestingClock::time = 0xfffffff0;
+	const xpcc::LongTimestamp before = xpcc::Clock::now<xpcc::LongTimestamp>();
+	TEST_ASSERT_EQUALS(uint32_t(before.getTime()), 0xfffffff0U);
+
+	// the overflow of the 32 bit time is counted
+	TestingClock::time = 0x10;
+	const xpcc::LongTimestamp after = xpcc::Clock::now<xpcc::LongTimestamp>();
+	TEST_ASSERT_EQUALS(after.getTime() - before.getTime(), 0x20U);
+}
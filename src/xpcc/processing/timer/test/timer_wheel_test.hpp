@@ -0,0 +1,54 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class TimerWheelTest : public unittest::TestSuite
+{
+public:
+	virtual void
+	setUp();
+
+
+	void
+	testDefaultConstructor();
+
+	void
+	testExpire();
+
+	void
+	testHandler();
+
+	void
+	testPeriodic();
+
+	void
+	testStop();
+
+	void
+	testRestartFromHandler();
+
+	// random timers compared with the expected expiration times
+	void
+	testRandomShort();
+
+	void
+	testRandom();
+
+	void
+	testRandomLong();
+
+	// xpcc::Clock in XPCC__CLOCK_TESTMODE
+	void
+	testClock();
+
+	// 64 bit time extended from the 32 bit time of xpcc::Clock
+	void
+	testLongClock();
+};
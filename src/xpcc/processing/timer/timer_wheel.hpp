@@ -0,0 +1,241 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_TIMER_WHEEL_HPP
+#define XPCC_TIMER_WHEEL_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/clock.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
+
+#include "timestamp.hpp"
+
+namespace xpcc
+{
+
+/**
+ * Software timer registered with a GenericTimerWheel.
+ *
+ * The timer is owned by the user and only linked into the wheel while it is
+ * armed, so no memory is allocated. Destroying an armed timer removes it
+ * from its wheel.
+ *
+ * When the timer expires, the optional handler is called from
+ * GenericTimerWheel::update() and the timer is marked as expired, which can
+ * be polled with `execute()` like a Timeout.
+ *
+ * @see		GenericTimerWheel
+ * @ingroup	software_timer
+ */
+template< class TimestampType >
+class GenericWheelTimer : public IntrusiveDoublyLinkedListHook<>
+{
+public:
+	typedef void (*Handler)(void* context);
+
+public:
+	/// Creates a stopped timer which calls `handler(context)` on expiration
+	GenericWheelTimer(Handler handler = nullptr, void* context = nullptr);
+
+	/// Stops the timer, isArmed() and isExpired() are `false` afterwards.
+	inline void
+	stop();
+
+	/// @return `true` exactly once, after the timer expired
+	bool
+	execute();
+
+	/// @return `true` if the timer is registered with a wheel and will expire
+	inline bool
+	isArmed() const;
+
+	/// @return `true` if the timer has expired and was not restarted since
+	inline bool
+	isExpired() const;
+
+	/// @return `true` if the timer restarts itself after each expiration
+	inline bool
+	isPeriodic() const;
+
+	/// @return the time of the (next) expiration
+	inline TimestampType
+	getExpiration() const;
+
+private:
+	template< class Clock, class T, uint8_t SlotBits >
+	friend class GenericTimerWheel;
+
+	enum
+	InternalState : uint8_t
+	{
+		STOPPED  = 0b000,
+		EXECUTED = 0b001,
+		EXPIRED  = 0b010,
+	};
+
+	typename TimestampType::Type expiration;
+	typename TimestampType::Type period;
+
+	Handler handler;
+	void* context;
+	uint8_t state;
+};
+
+/**
+ * Timer service using a hierarchical timing wheel.
+ *
+ * Polling many Timeouts costs one clock access and comparison per timeout
+ * and loop. The wheel instead keeps all armed timers sorted into buckets by
+ * their expiration time and only looks at the timers which expire in the
+ * current tick. Starting, stopping and expiring a timer is O(1), a tick
+ * without expiring timers costs (nearly) nothing.
+ *
+ * Every level of the wheel has `2^SlotBits` slots, each covering `2^SlotBits`
+ * times the range of a slot in the level below. Timers far in the future
+ * are kept in the upper levels and moved down when their time comes closer.
+ * Enough levels are used to cover the whole range of `TimestampType`.
+ *
+ * @code
+ * xpcc::TimerWheel wheel;
+ *
+ * xpcc::WheelTimer blink(&toggleLed);
+ * xpcc::WheelTimer timeout;
+ *
+ * wheel.startPeriodic(blink, 500);
+ * wheel.start(timeout, 100);
+ *
+ * while (1)
+ * {
+ *     // calls the handlers of all timers which expired since the last call
+ *     wheel.update();
+ *
+ *     if (timeout.execute()) {
+ *         // once after 100ms
+ *     }
+ * }
+ * @endcode
+ *
+ * The wheel ticks once per time unit of `Clock`. update() processes all
+ * ticks since its last call, the handlers are called in order of the
+ * expiration times (the order is undefined for equal times). Timers may be
+ * started and stopped from inside of a handler, the time is then relative to
+ * the current time of `Clock` as well.
+ *
+ * Memory: `Levels * 2^SlotBits` list heads of two pointers each, e.g. three
+ * levels of 64 slots for a ShortTimestamp. Use fewer `SlotBits` to reduce
+ * this on small targets, at the cost of more levels.
+ *
+ * @warning	Not interrupt safe. Start, stop and update the timers from the
+ * 			same context.
+ *
+ * @tparam	Clock
+ * 		Used clock which inherits from xpcc::Clock, may have a variable timebase.
+ * @tparam	TimestampType
+ * 		Used timestamp which is compatible with the chosen Clock.
+ * @tparam	SlotBits
+ * 		Every level has `2^SlotBits` slots.
+ *
+ * @ingroup	software_timer
+ */
+template< class Clock, class TimestampType = xpcc::Timestamp, uint8_t SlotBits = 6 >
+class GenericTimerWheel
+{
+	static_assert(SlotBits > 0 && SlotBits < 8, "SlotBits must be between 1 and 7");
+
+public:
+	typedef GenericWheelTimer<TimestampType> Timer;
+
+	static constexpr uint8_t Slots = (1 << SlotBits);
+	static constexpr uint8_t Levels = (sizeof(typename TimestampType::Type) * 8 + SlotBits - 1) / SlotBits;
+
+public:
+	/// Starts at the current time of `Clock`
+	GenericTimerWheel();
+
+	/// Stops all registered timers
+	~GenericTimerWheel();
+
+	/**
+	 * Start (or restart) `timer`, which expires once after `time`.
+	 *
+	 * A time of zero expires on the next call of update().
+	 */
+	void
+	start(Timer& timer, TimestampType time);
+
+	/**
+	 * Start (or restart) `timer`, which expires every `period`.
+	 *
+	 * Periods missed because update() was not called in time are skipped,
+	 * like with a PeriodicTimer. The period must not be zero.
+	 */
+	void
+	startPeriodic(Timer& timer, TimestampType period);
+
+	/// Process all ticks up to the current time of `Clock`
+	void
+	update();
+
+	/// @return the time up to which all timers have been processed
+	inline TimestampType
+	getTime() const;
+
+private:
+	typedef typename TimestampType::Type Type;
+	typedef typename TimestampType::SignedType SignedType;
+	typedef IntrusiveDoublyLinkedList<Timer> Slot;
+
+	/// Sorts `timer` into the slot of its expiration time
+	void
+	insert(Timer& timer);
+
+	/// Moves all timers of a slot into the lower levels
+	void
+	cascade(uint8_t level);
+
+	/// Advance by one tick towards `now` and expire the timers of this tick
+	void
+	tick(Type now);
+
+	void
+	expire(Timer& timer, Type now);
+
+	Type current;
+	Slot slots[Levels][Slots];
+
+	GenericTimerWheel(const GenericTimerWheel& other);
+
+	GenericTimerWheel&
+	operator = (const GenericTimerWheel& other);
+};
+
+/// Timer wheel for timers up to 32 seconds with millisecond resolution.
+/// @ingroup	software_timer
+using ShortTimerWheel = GenericTimerWheel< ::xpcc::Clock, ShortTimestamp>;
+/// @ingroup	software_timer
+using ShortWheelTimer = ShortTimerWheel::Timer;
+
+/// Timer wheel for timers up to 24 days with millisecond resolution.
+/// @ingroup	software_timer
+using TimerWheel = GenericTimerWheel< ::xpcc::Clock, Timestamp>;
+/// @ingroup	software_timer
+using WheelTimer = TimerWheel::Timer;
+
+/// Timer wheel with 64 bit timestamps.
+/// @ingroup	software_timer
+using LongTimerWheel = GenericTimerWheel< ::xpcc::Clock, LongTimestamp>;
+/// @ingroup	software_timer
+using LongWheelTimer = LongTimerWheel::Timer;
+
+}	// namespace xpcc
+
+#include "timer_wheel_impl.hpp"
+
+#endif // XPCC_TIMER_WHEEL_HPP
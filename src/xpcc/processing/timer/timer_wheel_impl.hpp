@@ -0,0 +1,213 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_TIMER_WHEEL_HPP
+#	error	"Don't include this file directly, use 'timer_wheel.hpp' instead!"
+#endif
+
+template< class TimestampType >
+xpcc::GenericWheelTimer<TimestampType>::GenericWheelTimer(Handler handler, void* context) :
+	expiration(0), period(0), handler(handler), context(context), state(STOPPED)
+{
+}
+
+template< class TimestampType >
+void
+xpcc::GenericWheelTimer<TimestampType>::stop()
+{
+	this->unlink();
+	state = STOPPED;
+}
+
+template< class TimestampType >
+bool
+xpcc::GenericWheelTimer<TimestampType>::execute()
+{
+	if (state == EXPIRED)
+	{
+		state = EXPIRED | EXECUTED;
+		return true;
+	}
+	return false;
+}
+
+template< class TimestampType >
+bool
+xpcc::GenericWheelTimer<TimestampType>::isArmed() const
+{
+	return this->isLinked();
+}
+
+template< class TimestampType >
+bool
+xpcc::GenericWheelTimer<TimestampType>::isExpired() const
+{
+	return (state & EXPIRED);
+}
+
+template< class TimestampType >
+bool
+xpcc::GenericWheelTimer<TimestampType>::isPeriodic() const
+{
+	return (period != 0);
+}
+
+template< class TimestampType >
+TimestampType
+xpcc::GenericWheelTimer<TimestampType>::getExpiration() const
+{
+	return TimestampType(expiration);
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, class TimestampType, uint8_t SlotBits >
+constexpr uint8_t xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::Slots;
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+constexpr uint8_t xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::Levels;
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::GenericTimerWheel() :
+	current(Clock::template now<TimestampType>().getTime())
+{
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::~GenericTimerWheel()
+{
+	for (uint8_t level = 0; level < Levels; ++level)
+	{
+		for (uint8_t index = 0; index < Slots; ++index)
+		{
+			Slot& slot = slots[level][index];
+			while (!slot.isEmpty()) {
+				slot.getFront().stop();
+			}
+		}
+	}
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+TimestampType
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::getTime() const
+{
+	return TimestampType(current);
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::start(Timer& timer, TimestampType time)
+{
+	timer.unlink();
+	timer.period = 0;
+	timer.state = Timer::STOPPED;
+	timer.expiration = (Clock::template now<TimestampType>() + time).getTime();
+	if (SignedType(timer.expiration - current) <= 0) {
+		// the slot of the current tick has already been processed
+		timer.expiration = current + 1;
+	}
+	insert(timer);
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::startPeriodic(Timer& timer, TimestampType period)
+{
+	start(timer, period);
+	timer.period = period.getTime();
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::update()
+{
+	const Type now = Clock::template now<TimestampType>().getTime();
+	while (current != now) {
+		tick(now);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::insert(Timer& timer)
+{
+	// The lowest level on which the expiration and the current time only
+	// differ in the bits of the slot index. The timer is moved down when
+	// the wheel reaches this slot.
+	Type difference = (timer.expiration ^ current) >> SlotBits;
+	uint8_t level = 0;
+	while (difference != 0) {
+		difference >>= SlotBits;
+		level++;
+	}
+
+	const uint8_t index = (timer.expiration >> (level * SlotBits)) & (Slots - 1);
+	slots[level][index].append(timer);
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::cascade(uint8_t level)
+{
+	Slot& slot = slots[level][(current >> (level * SlotBits)) & (Slots - 1)];
+	while (!slot.isEmpty())
+	{
+		Timer& timer = slot.getFront();
+		timer.unlink();
+		insert(timer);
+	}
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::tick(Type now)
+{
+	current++;
+
+	// Each time the index of a level wraps around, the next slot of the
+	// level above is due. Start with the highest level, its timers may
+	// end up in the slots of the lower levels which are due now as well.
+	uint8_t level = 0;
+	while ((level + 1) < Levels &&
+		   ((current >> ((level + 1) * SlotBits)) << ((level + 1) * SlotBits)) == current) {
+		level++;
+	}
+	for (; level > 0; --level) {
+		cascade(level);
+	}
+
+	Slot& slot = slots[0][current & (Slots - 1)];
+	while (!slot.isEmpty()) {
+		expire(slot.getFront(), now);
+	}
+}
+
+template< class Clock, class TimestampType, uint8_t SlotBits >
+void
+xpcc::GenericTimerWheel<Clock, TimestampType, SlotBits>::expire(Timer& timer, Type now)
+{
+	timer.unlink();
+	timer.state = Timer::EXPIRED;
+
+	if (timer.period != 0)
+	{
+		// skip the periods missed since the last call of update()
+		do {
+			timer.expiration += timer.period;
+		}
+		while (SignedType(timer.expiration - now) <= 0);
+		insert(timer);
+	}
+
+	if (timer.handler != nullptr) {
+		timer.handler(timer.context);
+	}
+}
@@ -110,6 +110,11 @@ using ShortTimestamp = GenericTimestamp<uint16_t>;
 /// @ingroup	software_timer
 using Timestamp      = GenericTimestamp<uint32_t>;
 
+/// 64bit timestamp, which does not overflow at millisecond resolution.
+/// Only hosted targets provide a clock with more than 32bit.
+/// @ingroup	software_timer
+using LongTimestamp  = GenericTimestamp<uint64_t>;
+
 // ------------------------------------------------------------------------
 template< typename T >
 inline IOStream&
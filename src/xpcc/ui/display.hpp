@@ -40,3 +40,4 @@
 #include "display/character_display.hpp"
 #include "display/graphic_display.hpp"
 #include "display/buffered_graphic_display.hpp"
+#include "display/buffered_color_display.hpp"
@@ -0,0 +1,275 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_BUFFERED_COLOR_DISPLAY_HPP
+#define XPCC_BUFFERED_COLOR_DISPLAY_HPP
+
+#include "graphic_display.hpp"
+#include "color_format.hpp"
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Accelerator of a BufferedColorDisplay, drawing with the CPU
+		 *
+		 * An accelerator (e.g. the DMA2D of the STM32F4/F7) implements
+		 * the same static functions. Every function returns \c false if it
+		 * can not handle the request, the display then draws with the CPU.
+		 * The operations may run in the background, the display calls
+		 * wait() before it accesses the frame buffer itself.
+		 *
+		 * All sizes and strides are in pixels.
+		 *
+		 * \ingroup	graphics
+		 */
+		struct NoAccelerator
+		{
+			/// Set an area of \p destination to \p pixel
+			template< typename Pixel >
+			static inline bool
+			fill(Pixel* /* destination */, uint16_t /* stride */,
+					uint16_t /* width */, uint16_t /* height */,
+					Pixel /* pixel */)
+			{
+				return false;
+			}
+
+			/// Copy an area of \p source to \p destination
+			template< typename Pixel >
+			static inline bool
+			copy(Pixel* /* destination */, uint16_t /* destinationStride */,
+					const Pixel* /* source */, uint16_t /* sourceStride */,
+					uint16_t /* width */, uint16_t /* height */)
+			{
+				return false;
+			}
+
+			/**
+			 * Draw an area of \p source in ARGB8888 over \p destination,
+			 * the alpha channel of the source is multiplied with \p alpha.
+			 */
+			template< typename Pixel >
+			static inline bool
+			blend(Pixel* /* destination */, uint16_t /* destinationStride */,
+					const uint32_t* /* source */, uint16_t /* sourceStride */,
+					uint16_t /* width */, uint16_t /* height */,
+					uint8_t /* alpha */)
+			{
+				return false;
+			}
+
+			/// Wait until all operations have finished
+			static inline void
+			wait()
+			{
+			}
+		};
+	}
+
+	/**
+	 * \brief	Base class for color displays with a frame buffer in memory
+	 *
+	 * The counterpart of BufferedGraphicDisplay for color displays. All
+	 * drawing operations work on a frame buffer of \p Width x \p Height
+	 * pixels in the pixel format \p Format (glcd::Rgb565 or
+	 * glcd::Argb8888), row by row. Areas and spans are filled directly in
+	 * memory instead of pixel by pixel.
+	 *
+	 * The frame buffer is not part of the class, so that it can be placed
+	 * into external memory or the memory read by the display controller.
+	 *
+	 * Set an opacity with setAlpha() to blend all following drawing
+	 * operations over the content of the frame buffer. blit() copies
+	 * images in the format of the frame buffer, blend() draws images in
+	 * ARGB8888 with an alpha channel.
+	 *
+	 * \code
+	 * class Display : public xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, 320, 240>
+	 * {
+	 * public:
+	 *     Display() : BufferedColorDisplay(frameBuffer) {}
+	 *
+	 *     virtual void
+	 *     update()
+	 *     {
+	 *         // transfer the frame buffer to the display
+	 *     }
+	 *
+	 * private:
+	 *     uint16_t frameBuffer[320 * 240];
+	 * };
+	 * \endcode
+	 *
+	 * \tparam	Format		Pixel format of the frame buffer
+	 * \tparam	Width		Width of the display
+	 * \tparam	Height		Height of the display
+	 * \tparam	Accelerator	Hardware which fills, copies and blends areas,
+	 * 						see glcd::NoAccelerator
+	 *
+	 * \ingroup	graphics
+	 */
+	template <typename Format, uint16_t Width, uint16_t Height,
+			typename Accelerator = glcd::NoAccelerator>
+	class BufferedColorDisplay : public GraphicDisplay
+	{
+	public:
+		typedef typename Format::Pixel Pixel;
+
+	public:
+		/// \param	buffer	Frame buffer of Width * Height pixels
+		BufferedColorDisplay(Pixel* buffer);
+
+		virtual
+		~BufferedColorDisplay()
+		{
+		}
+
+		virtual inline uint16_t
+		getWidth() const
+		{
+			return Width;
+		}
+
+		virtual inline uint16_t
+		getHeight() const
+		{
+			return Height;
+		}
+
+		/// Fill the complete screen with the background color
+		virtual void
+		clear();
+
+		/**
+		 * \brief	Set the opacity of the following drawing operations
+		 *
+		 * \param	alpha	0 for transparent (nothing is drawn) to 255
+		 * 					for opaque (default)
+		 */
+		inline void
+		setAlpha(uint8_t alpha)
+		{
+			this->alpha = alpha;
+		}
+
+		inline uint8_t
+		getAlpha() const
+		{
+			return this->alpha;
+		}
+
+		/**
+		 * \brief	Copy an image in the pixel format of the frame buffer
+		 *
+		 * Ignores the opacity set with setAlpha().
+		 *
+		 * \warning	An accelerator may still read \p data after the
+		 * 			return. It must stay valid and unchanged until
+		 * 			waitForAccelerator(), so do not pass buffers on the
+		 * 			stack or temporaries without waiting.
+		 *
+		 * \param	stride	Number of pixels between the rows of \p data
+		 */
+		void
+		blit(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				const Pixel* data, uint16_t stride);
+
+		inline void
+		blit(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				const Pixel* data)
+		{
+			this->blit(upperLeft, width, height, data, width);
+		}
+
+		/**
+		 * \brief	Draw an image in ARGB8888 with alpha channel
+		 *
+		 * The alpha channel of every pixel is multiplied with the
+		 * opacity set with setAlpha().
+		 *
+		 * \warning	Like blit(), \p data must stay valid and unchanged
+		 * 			until waitForAccelerator().
+		 *
+		 * \param	stride	Number of pixels between the rows of \p data
+		 */
+		void
+		blend(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				const uint32_t* data, uint16_t stride);
+
+		inline void
+		blend(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				const uint32_t* data)
+		{
+			this->blend(upperLeft, width, height, data, width);
+		}
+
+		/// Wait until the accelerator has finished drawing into the buffer
+		/// and reading the images passed to blit() and blend()
+		inline void
+		waitForAccelerator()
+		{
+			Accelerator::wait();
+		}
+
+		inline Pixel*
+		getBuffer()
+		{
+			return this->buffer;
+		}
+
+		inline const Pixel*
+		getBuffer() const
+		{
+			return this->buffer;
+		}
+
+	protected:
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+		virtual void
+		setPixel(int16_t x, int16_t y);
+
+		virtual void
+		clearPixel(int16_t x, int16_t y);
+
+		/// \c true if the pixel differs from the background color
+		virtual bool
+		getPixel(int16_t x, int16_t y);
+
+		/// Fills or blends \p count pixels, depending on the opacity
+		void
+		paint(Pixel* pixels, uint16_t count, const glcd::Color& color);
+
+		/**
+		 * Clips the image to the display and the clipping window.
+		 *
+		 * \return	\c false if nothing is visible, else the offset of the
+		 * 			first visible pixel in the image and the visible size.
+		 */
+		bool
+		clip(glcd::Point& upperLeft, uint16_t& width, uint16_t& height,
+				uint16_t stride, uint32_t& offset) const;
+
+		Pixel* const buffer;
+		uint8_t alpha;
+	};
+}
+
+#include "buffered_color_display_impl.hpp"
+
+#endif // XPCC_BUFFERED_COLOR_DISPLAY_HPP
@@ -0,0 +1,229 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_BUFFERED_COLOR_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'buffered_color_display.hpp' instead!"
+#endif
+
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::BufferedColorDisplay(Pixel* buffer) :
+	buffer(buffer), alpha(0xff)
+{
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::clear()
+{
+	const Pixel background = Format::fromColor(this->backgroundColor);
+	if (!Accelerator::fill(this->buffer, Width, Width, Height, background))
+	{
+		Accelerator::wait();
+		Format::fill(this->buffer, uint32_t(Width) * Height, background);
+	}
+
+	// reset the cursor
+	this->cursor = glcd::Point(0, 0);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::blit(
+		glcd::Point upperLeft, uint16_t width, uint16_t height,
+		const Pixel* data, uint16_t stride)
+{
+	uint32_t offset;
+	if (!this->clip(upperLeft, width, height, stride, offset)) {
+		return;
+	}
+	data += offset;
+
+	Pixel* destination = &this->buffer[uint32_t(upperLeft.getY()) * Width + upperLeft.getX()];
+	if (Accelerator::copy(destination, Width, data, stride, width, height)) {
+		return;
+	}
+
+	Accelerator::wait();
+	for (uint_fast16_t row = 0; row < height; ++row)
+	{
+		memcpy(destination, data, width * sizeof(Pixel));
+		destination += Width;
+		data += stride;
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::blend(
+		glcd::Point upperLeft, uint16_t width, uint16_t height,
+		const uint32_t* data, uint16_t stride)
+{
+	uint32_t offset;
+	if (this->alpha == 0 || !this->clip(upperLeft, width, height, stride, offset)) {
+		return;
+	}
+	data += offset;
+
+	Pixel* destination = &this->buffer[uint32_t(upperLeft.getY()) * Width + upperLeft.getX()];
+	if (Accelerator::blend(destination, Width, data, stride, width, height, this->alpha)) {
+		return;
+	}
+
+	Accelerator::wait();
+	for (uint_fast16_t row = 0; row < height; ++row)
+	{
+		Format::blend(destination, data, width, this->alpha);
+		destination += Width;
+		data += stride;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::fillSpan(
+		int16_t x0, int16_t x1, int16_t y)
+{
+	Accelerator::wait();
+	this->paint(&this->buffer[uint32_t(y) * Width + x0], x1 - x0 + 1, this->foregroundColor);
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::clearSpan(
+		int16_t x0, int16_t x1, int16_t y)
+{
+	Accelerator::wait();
+	this->paint(&this->buffer[uint32_t(y) * Width + x0], x1 - x0 + 1, this->backgroundColor);
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::fillArea(
+		int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	Pixel* destination = &this->buffer[uint32_t(y0) * Width + x0];
+	const uint16_t width = x1 - x0 + 1;
+	const uint16_t height = y1 - y0 + 1;
+
+	if (this->alpha == 0xff &&
+		Accelerator::fill(destination, Width, width, height,
+				Format::fromColor(this->foregroundColor))) {
+		return;
+	}
+
+	Accelerator::wait();
+	for (uint_fast16_t row = 0; row < height; ++row)
+	{
+		this->paint(destination, width, this->foregroundColor);
+		destination += Width;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::setPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height)
+	{
+		Accelerator::wait();
+		this->paint(&this->buffer[uint32_t(y) * Width + x], 1, this->foregroundColor);
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::clearPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height)
+	{
+		Accelerator::wait();
+		this->paint(&this->buffer[uint32_t(y) * Width + x], 1, this->backgroundColor);
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+bool
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::getPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height)
+	{
+		Accelerator::wait();
+		return (this->buffer[uint32_t(y) * Width + x] != Format::fromColor(this->backgroundColor));
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+void
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::paint(
+		Pixel* pixels, uint16_t count, const glcd::Color& color)
+{
+	if (this->alpha == 0xff)
+	{
+		const Pixel pixel = Format::fromColor(color);
+		if (count == 1) {
+			*pixels = pixel;
+		}
+		else {
+			Format::fill(pixels, count, pixel);
+		}
+	}
+	else {
+		const uint32_t argb = (uint32_t(this->alpha) << 24) |
+				(glcd::Rgb565::toArgb(color.getValue()) & 0x00ffffff);
+		Format::blend(pixels, count, argb);
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height, typename Accelerator>
+bool
+xpcc::BufferedColorDisplay<Format, Width, Height, Accelerator>::clip(
+		glcd::Point& upperLeft, uint16_t& width, uint16_t& height,
+		uint16_t stride, uint32_t& offset) const
+{
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	int_fast16_t x = upperLeft.getX();
+	int_fast16_t y = upperLeft.getY();
+	int_fast16_t w = width;
+	int_fast16_t h = height;
+
+	offset = 0;
+	if (x < clipStart.getX()) {
+		offset += clipStart.getX() - x;
+		w -= clipStart.getX() - x;
+		x = clipStart.getX();
+	}
+	if (y < clipStart.getY()) {
+		offset += uint32_t(clipStart.getY() - y) * stride;
+		h -= clipStart.getY() - y;
+		y = clipStart.getY();
+	}
+	if (x + w > clipEnd.getX()) {
+		w = clipEnd.getX() - x;
+	}
+	if (y + h > clipEnd.getY()) {
+		h = clipEnd.getY() - y;
+	}
+	if (w <= 0 || h <= 0) {
+		return false;
+	}
+
+	upperLeft = glcd::Point(x, y);
+	width = w;
+	height = h;
+	return true;
+}
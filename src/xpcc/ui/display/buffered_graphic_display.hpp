@@ -42,6 +42,11 @@ namespace xpcc
 	 * Every operation works on the internal RAM buffer, therefore the content
 	 * of the real display is not changed until a call of update().
 	 *
+	 * The buffer remembers which columns of every page (eight rows of
+	 * pixels) have been changed since the last update(), so that the
+	 * drivers only need to transfer these. Call invalidate() after writing
+	 * to the buffer directly, or to transfer the whole screen again.
+	 *
 	 * \tparam	Width	Width of the display.
 	 * \tparam	Height	Height of the display. Must be a multiple of 8!
 	 *
@@ -59,6 +64,8 @@ namespace xpcc
 		static constexpr uint16_t DisplayBufferHeight = Height / 8;
 
 	public:
+		BufferedGraphicDisplay();
+
 		virtual
 		~BufferedGraphicDisplay()
 		{
@@ -84,6 +91,28 @@ namespace xpcc
 		virtual void
 		clear();
 
+		/// Transfer the whole screen with the next update()
+		void
+		invalidate();
+
+		/// \c true if the buffer has been changed since the last update()
+		bool
+		isDirty() const;
+
+		/// Number of bytes of the buffer transferred by the last update()
+		inline uint32_t
+		getUpdateBytes() const
+		{
+			return this->updateBytes;
+		}
+
+		/// Number of bytes of the buffer transferred by all updates
+		inline uint32_t
+		getTotalUpdateBytes() const
+		{
+			return this->totalUpdateBytes;
+		}
+
 		// Faster version adapted for the RAM buffer
 		virtual void
 		drawImageRaw(glcd::Point upperLeft,
@@ -99,6 +128,16 @@ namespace xpcc
 		//virtual void
 		//drawVerticalLine(glcd::Point start, uint8_t length);
 
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
+		// Fills eight rows at once
+		virtual void
+		fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
 		virtual void
 		setPixel(int16_t x, int16_t y);
 
@@ -108,7 +147,69 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 
+		/// Mark the columns \p x0 to \p x1 (both inclusive) of \p page as changed
+		inline void
+		markDirty(uint16_t x0, uint16_t x1, uint16_t page)
+		{
+			if (x0 < this->dirtyBegin[page]) {
+				this->dirtyBegin[page] = x0;
+			}
+			if (x1 >= this->dirtyEnd[page]) {
+				this->dirtyEnd[page] = x1 + 1;
+			}
+		}
+
+		inline bool
+		isDirty(uint16_t page) const
+		{
+			return (this->dirtyBegin[page] < this->dirtyEnd[page]);
+		}
+
+		/// First changed column of \p page
+		inline uint16_t
+		getDirtyBegin(uint16_t page) const
+		{
+			return this->dirtyBegin[page];
+		}
+
+		/// Column after the last changed column of \p page
+		inline uint16_t
+		getDirtyEnd(uint16_t page) const
+		{
+			return this->dirtyEnd[page];
+		}
+
+		/**
+		 * \brief	Window containing all changes
+		 *
+		 * For displays which write column by column across all pages.
+		 *
+		 * \return	\c false if nothing has changed
+		 */
+		bool
+		getDirtyWindow(uint16_t& columnBegin, uint16_t& columnEnd,
+				uint16_t& pageBegin, uint16_t& pageEnd) const;
+
+		/**
+		 * \brief	Mark the buffer as transferred
+		 *
+		 * Called by update() before (or while) transferring the changes.
+		 * Drawing afterwards marks the buffer as changed again.
+		 *
+		 * \param	bytes	Number of bytes of the buffer transferred
+		 */
+		void
+		markClean(uint32_t bytes);
+
 		uint8_t display_buffer[DisplayBufferWidth][DisplayBufferHeight];
+
+	private:
+		// changed columns of every page, empty if begin >= end
+		uint16_t dirtyBegin[DisplayBufferHeight];
+		uint16_t dirtyEnd[DisplayBufferHeight];
+
+		uint32_t updateBytes;
+		uint32_t totalUpdateBytes;
 	};
 }
 
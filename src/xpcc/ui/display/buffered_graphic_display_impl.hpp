@@ -32,6 +32,15 @@
 	#error	"Don't include this file directly, use 'buffered_graphic_display.hpp' instead!"
 #endif
 
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::BufferedGraphicDisplay<Width, Height>::BufferedGraphicDisplay() :
+	updateBytes(0), totalUpdateBytes(0)
+{
+	// the content of the display is unknown
+	this->invalidate();
+}
+
 // ----------------------------------------------------------------------------
 template <uint16_t Width, uint16_t Height>
 void
@@ -42,11 +51,77 @@ xpcc::BufferedGraphicDisplay<Width, Height>::clear()
 			this->display_buffer[x][y] = 0;
 		}
 	}
+	this->invalidate();
 
 	// reset the cursor
 	this->cursor = glcd::Point(0, 0);
 }
 
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::invalidate()
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		this->dirtyBegin[page] = 0;
+		this->dirtyEnd[page] = Width;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedGraphicDisplay<Width, Height>::isDirty() const
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		if (this->isDirty(page)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyWindow(
+		uint16_t& columnBegin, uint16_t& columnEnd,
+		uint16_t& pageBegin, uint16_t& pageEnd) const
+{
+	columnBegin = Width;
+	columnEnd = 0;
+	pageBegin = Height / 8;
+	pageEnd = 0;
+	for (uint_fast16_t page = 0; page < Height / 8; ++page)
+	{
+		if (this->isDirty(page))
+		{
+			if (page < pageBegin) {
+				pageBegin = page;
+			}
+			pageEnd = page + 1;
+
+			if (this->dirtyBegin[page] < columnBegin) {
+				columnBegin = this->dirtyBegin[page];
+			}
+			if (this->dirtyEnd[page] > columnEnd) {
+				columnEnd = this->dirtyEnd[page];
+			}
+		}
+	}
+	return (pageBegin < pageEnd);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markClean(uint32_t bytes)
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		this->dirtyBegin[page] = Width;
+		this->dirtyEnd[page] = 0;
+	}
+	this->updateBytes = bytes;
+	this->totalUpdateBytes += bytes;
+}
+
 // ----------------------------------------------------------------------------
 template <uint16_t Width, uint16_t Height>
 void
@@ -54,25 +129,91 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawHorizontalLine(
 		glcd::Point start,
 		uint16_t length)
 {
-	const uint16_t y = start.getY() / 8;
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	if (length == 0 ||
+		start.getY() < clipStart.getY() || start.getY() >= clipEnd.getY()) {
+		return;
+	}
 
+	// visible pixels [x0, x1)
+	const int16_t x0 = (start.getX() < clipStart.getX()) ? clipStart.getX() : start.getX();
+	const int16_t x1 = (start.getX() + length > clipEnd.getX()) ?
+			clipEnd.getX() : start.getX() + length;
+	if (x0 >= x1) {
+		return;
+	}
+
+	const uint16_t y = start.getY() / 8;
 	if (this->foregroundColor == glcd::Color::black())
 	{
 		const uint8_t mask = 1 << (start.getY() & 0x07);
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->display_buffer[x][y] |= mask;
-			}
+		for (int_fast16_t x = x0; x < x1; ++x) {
+			this->display_buffer[x][y] |= mask;
 		}
 	}
 	else {
 		const uint8_t mask = ~(1 << (start.getY() & 0x07));
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->display_buffer[x][y] &= mask;
+		for (int_fast16_t x = x0; x < x1; ++x) {
+			this->display_buffer[x][y] &= mask;
+		}
+	}
+	this->markDirty(x0, x1 - 1, y);
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	const uint8_t mask = 1 << (y & 0x07);
+	const uint16_t row = y / 8;
+	for (uint_fast16_t x = x0; x <= static_cast<uint16_t>(x1); ++x) {
+		this->display_buffer[x][row] |= mask;
+	}
+	this->markDirty(x0, x1, row);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::clearSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	const uint8_t mask = ~(1 << (y & 0x07));
+	const uint16_t row = y / 8;
+	for (uint_fast16_t x = x0; x <= static_cast<uint16_t>(x1); ++x) {
+		this->display_buffer[x][row] &= mask;
+	}
+	this->markDirty(x0, x1, row);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillArea(
+		int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	const uint16_t firstRow = y0 / 8;
+	const uint16_t lastRow = y1 / 8;
+	uint8_t firstMask = 0xff << (y0 & 0x07);
+	const uint8_t lastMask = 0xff >> (7 - (y1 & 0x07));
+	if (firstRow == lastRow) {
+		firstMask &= lastMask;
+	}
+
+	for (uint_fast16_t x = x0; x <= static_cast<uint16_t>(x1); ++x)
+	{
+		uint8_t* column = this->display_buffer[x];
+		column[firstRow] |= firstMask;
+		if (firstRow != lastRow)
+		{
+			for (uint_fast16_t row = firstRow + 1; row < lastRow; ++row) {
+				column[row] = 0xff;
 			}
+			column[lastRow] |= lastMask;
 		}
 	}
+	for (uint_fast16_t row = firstRow; row <= lastRow; ++row) {
+		this->markDirty(x0, x1, row);
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -82,7 +223,8 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height,
 		xpcc::accessor::Flash<uint8_t> data)
 {
-	if ((upperLeft.getY() & 0x07) == 0)
+	// the pages are copied directly, which can't be clipped to a window
+	if ((upperLeft.getY() & 0x07) == 0 && !this->clipping)
 	{
 		uint16_t row = upperLeft.getY() / 8;
 		uint16_t rowCount = (height + 7) / 8;	// always round up
@@ -96,8 +238,9 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
 					uint16_t x = upperLeft.getX() + i;
 					uint16_t y = k + row;
 
-					if( x < Width && y < Height ) {
+					if( x < Width && y < Height / 8 ) {
 						this->display_buffer[x][y] = data[i + k * width];
+						this->markDirty(x, x, y);
 					}
 				}
 			}
@@ -115,6 +258,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::setPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->display_buffer[x][y / 8] |= (1 << (y & 0x07));
+		this->markDirty(x, x, y / 8);
 	}
 }
 
@@ -124,6 +268,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->display_buffer[x][y / 8] &= ~(1 << (y & 0x07));
+		this->markDirty(x, x, y / 8);
 	}
 }
 
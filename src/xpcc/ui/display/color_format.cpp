@@ -0,0 +1,215 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "color_format.hpp"
+
+#include <string.h>
+#include <xpcc/architecture/detect.hpp>
+
+// On the hosted targets the blending works on four pixels at once, using
+// the vector extensions of GCC and Clang (SSE2 on x86, NEON on ARM). The
+// library is usually built with -Os, which does not vectorize by itself.
+#if defined(XPCC__OS_HOSTED) && (defined(__clang__) || (__GNUC__ >= 9))
+#	define XPCC_GLCD_VECTORIZE 1
+#else
+#	define XPCC_GLCD_VECTORIZE 0
+#endif
+
+namespace
+{
+	// x / 255, rounded, for x <= 255 * 255
+	template< typename T >
+	inline T
+	div255(T x)
+	{
+		x += 128;
+		return (x + (x >> 8)) >> 8;
+	}
+
+	// The kernels blend one pixel per lane: the destination pixel, the
+	// source in ARGB8888 and its opacity in [0..255].
+	struct BlendRgb565
+	{
+		template< typename T >
+		static inline T
+		apply(T destination, T source, T alpha)
+		{
+			const T inverse = 255 - alpha;
+
+			T red = (destination >> 11) & 0x1f;
+			T green = (destination >> 5) & 0x3f;
+			T blue = destination & 0x1f;
+			red = (red << 3) | (red >> 2);
+			green = (green << 2) | (green >> 4);
+			blue = (blue << 3) | (blue >> 2);
+
+			red = div255(((source >> 16) & 0xff) * alpha + red * inverse);
+			green = div255(((source >> 8) & 0xff) * alpha + green * inverse);
+			blue = div255((source & 0xff) * alpha + blue * inverse);
+
+			return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+		}
+	};
+
+	struct BlendArgb8888
+	{
+		template< typename T >
+		static inline T
+		apply(T destination, T source, T alpha)
+		{
+			const T inverse = 255 - alpha;
+
+			const T red = div255(((source >> 16) & 0xff) * alpha +
+					((destination >> 16) & 0xff) * inverse);
+			const T green = div255(((source >> 8) & 0xff) * alpha +
+					((destination >> 8) & 0xff) * inverse);
+			const T blue = div255((source & 0xff) * alpha +
+					(destination & 0xff) * inverse);
+			// source over destination
+			const T opacity = alpha + div255((destination >> 24) * inverse);
+
+			return (opacity << 24) | (red << 16) | (green << 8) | blue;
+		}
+	};
+
+#if XPCC_GLCD_VECTORIZE
+	static constexpr uint32_t Lanes = 4;
+
+	typedef uint32_t Vector __attribute__((vector_size(16)));
+	typedef uint16_t Vector16 __attribute__((vector_size(8)));
+
+	inline Vector
+	load(const uint16_t* pixels)
+	{
+		Vector16 vector;
+		memcpy(&vector, pixels, sizeof(vector));
+		return __builtin_convertvector(vector, Vector);
+	}
+
+	inline Vector
+	load(const uint32_t* pixels)
+	{
+		Vector vector;
+		memcpy(&vector, pixels, sizeof(vector));
+		return vector;
+	}
+
+	inline void
+	store(uint16_t* pixels, Vector vector)
+	{
+		const Vector16 narrow = __builtin_convertvector(vector, Vector16);
+		memcpy(pixels, &narrow, sizeof(narrow));
+	}
+
+	inline void
+	store(uint32_t* pixels, Vector vector)
+	{
+		memcpy(pixels, &vector, sizeof(vector));
+	}
+#endif
+
+	template< typename Pixel, typename Kernel >
+	void
+	blendColor(Pixel* destination, uint32_t count, uint32_t argb)
+	{
+		const uint32_t alpha = argb >> 24;
+		if (alpha == 0) {
+			return;
+		}
+
+#if XPCC_GLCD_VECTORIZE
+		const Vector source = Vector{} + argb;
+		const Vector opacity = Vector{} + alpha;
+		for (; count >= Lanes; count -= Lanes, destination += Lanes) {
+			store(destination, Kernel::apply(load(destination), source, opacity));
+		}
+#endif
+		for (; count > 0; --count, ++destination) {
+			*destination = static_cast<Pixel>(
+					Kernel::apply(uint32_t(*destination), argb, alpha));
+		}
+	}
+
+	template< typename Pixel, typename Kernel >
+	void
+	blendImage(Pixel* destination, const uint32_t* source, uint32_t count,
+			uint8_t alpha)
+	{
+		const uint32_t global = alpha;
+
+#if XPCC_GLCD_VECTORIZE
+		for (; count >= Lanes; count -= Lanes, destination += Lanes, source += Lanes)
+		{
+			const Vector argb = load(source);
+			const Vector opacity = div255((argb >> 24) * global);
+			store(destination, Kernel::apply(load(destination), argb, opacity));
+		}
+#endif
+		for (; count > 0; --count, ++destination, ++source)
+		{
+			const uint32_t opacity = div255((*source >> 24) * global);
+			*destination = static_cast<Pixel>(
+					Kernel::apply(uint32_t(*destination), *source, opacity));
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::glcd::Rgb565::fill(Pixel* destination, uint32_t count, Pixel pixel)
+{
+	// writes two pixels at once, memcpy() compiles to an aligned word store
+	if ((uintptr_t(destination) & 0x02) and count)
+	{
+		*destination++ = pixel;
+		count--;
+	}
+	const uint32_t pair = (uint32_t(pixel) << 16) | pixel;
+	for (; count >= 2; count -= 2, destination += 2) {
+		memcpy(destination, &pair, sizeof(pair));
+	}
+	if (count) {
+		*destination = pixel;
+	}
+}
+
+void
+xpcc::glcd::Rgb565::blend(Pixel* destination, uint32_t count, uint32_t argb)
+{
+	blendColor<Pixel, BlendRgb565>(destination, count, argb);
+}
+
+void
+xpcc::glcd::Rgb565::blend(Pixel* destination, const uint32_t* source,
+		uint32_t count, uint8_t alpha)
+{
+	blendImage<Pixel, BlendRgb565>(destination, source, count, alpha);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::glcd::Argb8888::fill(Pixel* destination, uint32_t count, Pixel pixel)
+{
+	for (; count > 0; --count) {
+		*destination++ = pixel;
+	}
+}
+
+void
+xpcc::glcd::Argb8888::blend(Pixel* destination, uint32_t count, uint32_t argb)
+{
+	blendColor<Pixel, BlendArgb8888>(destination, count, argb);
+}
+
+void
+xpcc::glcd::Argb8888::blend(Pixel* destination, const uint32_t* source,
+		uint32_t count, uint8_t alpha)
+{
+	blendImage<Pixel, BlendArgb8888>(destination, source, count, alpha);
+}
@@ -0,0 +1,125 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_GLCD_COLOR_FORMAT_HPP
+#define XPCC_GLCD_COLOR_FORMAT_HPP
+
+#include <stdint.h>
+#include "graphic_display.hpp"
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	16 bit per pixel: 5 bit red, 6 bit green, 5 bit blue
+		 *
+		 * The format of glcd::Color and of most color TFT controllers.
+		 *
+		 * The blending functions take colors in the ARGB8888 format
+		 * (`0xAARRGGBB`), the alpha channel is the opacity.
+		 *
+		 * \ingroup	graphics
+		 */
+		struct Rgb565
+		{
+			typedef uint16_t Pixel;
+
+			static inline Pixel
+			fromColor(const Color& color)
+			{
+				return color.getValue();
+			}
+
+			static inline Pixel
+			fromArgb(uint32_t argb)
+			{
+				return (((argb >> 8) & 0xf800) |
+						((argb >> 5) & 0x07e0) |
+						((argb >> 3) & 0x001f));
+			}
+
+			/// Opaque color, the lower bits are filled with the upper ones
+			static inline uint32_t
+			toArgb(Pixel pixel)
+			{
+				const uint32_t red = (pixel >> 11) & 0x1f;
+				const uint32_t green = (pixel >> 5) & 0x3f;
+				const uint32_t blue = pixel & 0x1f;
+				return (0xff000000 |
+						(((red << 3) | (red >> 2)) << 16) |
+						(((green << 2) | (green >> 4)) << 8) |
+						((blue << 3) | (blue >> 2)));
+			}
+
+			/// Set \p count pixels to \p pixel
+			static void
+			fill(Pixel* destination, uint32_t count, Pixel pixel);
+
+			/// Draw \p argb over \p count pixels
+			static void
+			blend(Pixel* destination, uint32_t count, uint32_t argb);
+
+			/**
+			 * \brief	Draw \p source over \p count pixels
+			 *
+			 * The alpha channel of every source pixel is multiplied with
+			 * \p alpha.
+			 */
+			static void
+			blend(Pixel* destination, const uint32_t* source, uint32_t count,
+					uint8_t alpha = 0xff);
+		};
+
+		/**
+		 * \brief	32 bit per pixel: 8 bit each for alpha, red, green and blue
+		 *
+		 * Blending keeps the alpha channel of the frame buffer, so that it
+		 * can be used as a layer which is composed by the display
+		 * controller.
+		 *
+		 * \see		Rgb565
+		 * \ingroup	graphics
+		 */
+		struct Argb8888
+		{
+			typedef uint32_t Pixel;
+
+			static inline Pixel
+			fromColor(const Color& color)
+			{
+				return Rgb565::toArgb(color.getValue());
+			}
+
+			static inline Pixel
+			fromArgb(uint32_t argb)
+			{
+				return argb;
+			}
+
+			static inline uint32_t
+			toArgb(Pixel pixel)
+			{
+				return pixel;
+			}
+
+			static void
+			fill(Pixel* destination, uint32_t count, Pixel pixel);
+
+			static void
+			blend(Pixel* destination, uint32_t count, uint32_t argb);
+
+			static void
+			blend(Pixel* destination, const uint32_t* source, uint32_t count,
+					uint8_t alpha = 0xff);
+		};
+	}
+}
+
+#endif // XPCC_GLCD_COLOR_FORMAT_HPP
@@ -33,6 +33,9 @@
  *
  * Various fonts for graphical displays.
  * The fonts are created with the "FontCreator 3.0", see \c tools/font_creator.
+ * Large fonts are run-length encoded (`FONT_ENCODING='rle'` in
+ * \c font/SConscript.generate), which needs less flash and draws faster
+ * without a xpcc::glcd::TextCache.
  */
 
 #include "font/scripto_narrow.hpp"
@@ -37,8 +37,8 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Numbers40x57[]) =
 		{
-			0x02, 0x0B, // total size of this array
-			40,	// width (may vary)
+			0x82, 0x05, // total size of this array
+			0,	// run-length encoded
 			56,	// height
 			4,	// hspace
 			0, 	// vspace
@@ -49,18 +49,30 @@ namespace xpcc
 			// for each character the separate width in pixels
 			40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
 			
+			// offset of every glyph in the font data (little endian)
+			0x00, 0x00, // 48
+			0xB9, 0x00, // 49
+			0x34, 0x01, // 50
+			0xAF, 0x01, // 51
+			0x2B, 0x02, // 52
+			0xB4, 0x02, // 53
+			0x29, 0x03, // 54
+			0xBC, 0x03, // 55
+			0x2C, 0x04, // 56
+			0xD3, 0x04, // 57
+			
 			// font data
 			// bit field of all characters
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 48
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 49
-			0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xC7, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, // 50
-			0x00, 0x00, 0x20, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x07, 0x00, 0x00, 0x18, 0x3F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, // 51
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, // 52
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x18, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // 53
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE3, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // 54
-			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0xE3, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 55
-			0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE3, 0xE7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, // 56
-			0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x87, 0xC7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 57
+			0x0E, 0x48, 0x1B, 0x4E, 0x16, 0x52, 0x13, 0x54, 0x11, 0x56, 0x0F, 0x58, 0x0D, 0x5A, 0x0B, 0x5C, 0x0A, 0x5D, 0x08, 0x5E, 0x07, 0x4B, 0xE0, 0x4D, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x4B, 0x08, 0x4A, 0xC0, 0x4B, 0x0A, 0x49, 0xE0, 0x4B, 0x0A, 0x49, 0xE0, 0x4B, 0x0A, 0x48, 0xF0, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4A, 0x0D, 0xBF, 0xFC, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0E, 0xFF, 0xFC, 0x4A, 0x0E, 0xFF, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0B, 0x49, 0xE0, 0x4B, 0x0A, 0x49, 0xE0, 0x4B, 0x0A, 0x49, 0xE0, 0x4C, 0x08, 0x4B, 0xC0, 0x4C, 0x80, 0x4C, 0x80, 0x4B, 0xE0, 0x4D, 0x07, 0x5E, 0x08, 0x5E, 0x09, 0x5C, 0x0B, 0x5A, 0x0D, 0x58, 0x0F, 0x56, 0x11, 0x54, 0x13, 0x52, 0x16, 0x4E, 0x1B, 0x48, 0x0F, // 48
+			0x17, 0x48, 0x1D, 0x49, 0x1C, 0x4A, 0x1B, 0x4B, 0x19, 0x4D, 0x18, 0x4E, 0x16, 0x50, 0x15, 0x51, 0x13, 0x53, 0x11, 0x55, 0x0F, 0x57, 0x0D, 0x59, 0x0C, 0x5A, 0x0D, 0x59, 0x0D, 0x59, 0x0E, 0x58, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xF8, 0x4B, 0x0D, 0x9F, 0xE0, 0x4B, 0x0D, 0x9F, 0x80, 0x4B, 0x0A, 0x81, 0x09, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x80, // 49
+			0x0D, 0x49, 0x1A, 0x50, 0x13, 0x55, 0x0F, 0x59, 0x0C, 0x5B, 0x09, 0x5E, 0x07, 0x5F, 0xC0, 0x61, 0x80, 0x60, 0xC0, 0x61, 0x80, 0x4A, 0xC0, 0x4E, 0x07, 0x48, 0x09, 0x4D, 0x80, 0xBF, 0x0C, 0x4A, 0xE0, 0x8F, 0x0F, 0x48, 0xF0, 0x83, 0x10, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1A, 0x4C, 0x19, 0x4C, 0x1A, 0x4C, 0x19, 0x4C, 0x19, 0x4D, 0x18, 0x4D, 0x18, 0x4D, 0x18, 0x4E, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x16, 0x4F, 0x17, 0x4E, 0x17, 0x4E, 0x17, 0x4E, 0x17, 0x4E, 0x18, 0x4E, 0x17, 0x4E, 0x18, 0x4D, 0x18, 0x4D, 0x19, 0x4D, 0x19, 0x5F, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xF8, 0x5E, 0xFE, // 50
+			0x0C, 0x4A, 0x18, 0x51, 0x13, 0x56, 0x0D, 0x5A, 0x0B, 0x5D, 0x08, 0x5F, 0x08, 0x5E, 0x08, 0x5F, 0x08, 0x5E, 0x08, 0x5F, 0x08, 0x47, 0x07, 0x4E, 0x80, 0x9F, 0x0C, 0x4A, 0xF0, 0x83, 0x0F, 0x4C, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1A, 0x4C, 0x17, 0x4E, 0x0F, 0x57, 0x0F, 0x56, 0x10, 0x55, 0x11, 0x54, 0x12, 0x52, 0x14, 0x54, 0x12, 0x56, 0x10, 0x57, 0x0F, 0x58, 0x0E, 0x59, 0x17, 0x4F, 0x19, 0x4E, 0x1A, 0x4C, 0x1B, 0x4B, 0x1B, 0x4C, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4A, 0xE1, 0x14, 0x47, 0xFC, 0x8F, 0x10, 0x4B, 0xE0, 0x47, 0x09, 0x4E, 0xE0, 0x5F, 0xE0, 0x60, 0xE0, 0x60, 0xC0, 0x60, 0x80, 0x5F, 0x80, 0x5F, 0x07, 0x5E, 0x09, 0x5B, 0x0F, 0x55, 0x16, 0x4B, 0x10, // 51
+			0x16, 0x4B, 0x1A, 0x4C, 0x19, 0x4D, 0x18, 0x4E, 0x17, 0x4F, 0x16, 0x50, 0x16, 0x50, 0x15, 0x51, 0x14, 0x52, 0x13, 0x53, 0x13, 0x53, 0x12, 0x54, 0x11, 0x55, 0x10, 0x56, 0x10, 0x56, 0x0D, 0x9F, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFC, 0x4B, 0x0D, 0xFF, 0xF8, 0x4B, 0x0C, 0x47, 0xF0, 0x4B, 0x0C, 0x47, 0xF0, 0x4B, 0x0B, 0x48, 0xE0, 0x4B, 0x0A, 0x49, 0xC0, 0x4B, 0x0A, 0x49, 0xC0, 0x4B, 0x09, 0x4A, 0x80, 0x4B, 0x09, 0x49, 0x07, 0x4B, 0x08, 0x4A, 0x07, 0x4B, 0x07, 0x4A, 0x08, 0x4B, 0x07, 0x4A, 0x08, 0x4B, 0x80, 0x4A, 0x09, 0x4B, 0x80, 0x4A, 0x09, 0x4A, 0xC0, 0x4A, 0x0A, 0x4A, 0xC0, 0x4A, 0x0A, 0x49, 0xE0, 0x4F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x16, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x49, 0xE0, // 52
+			0x81, 0x5C, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x09, 0x5D, 0x08, 0x5E, 0x08, 0x4A, 0x1C, 0x4A, 0x1C, 0x4A, 0x1C, 0x4A, 0x1C, 0x4A, 0x1C, 0x4A, 0x1C, 0x4A, 0x1C, 0x49, 0x1D, 0x49, 0x1D, 0x49, 0x1D, 0x4E, 0x18, 0x52, 0x14, 0x55, 0x11, 0x58, 0x0D, 0x5A, 0x0C, 0x5C, 0x0A, 0x5D, 0x09, 0x5D, 0x09, 0x5E, 0x08, 0x5F, 0x11, 0x55, 0x16, 0x51, 0x18, 0x4E, 0x19, 0x4D, 0x1A, 0x4D, 0x1A, 0x4C, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4C, 0x19, 0x47, 0xFC, 0x87, 0x10, 0x4C, 0xC0, 0xFF, 0x09, 0x4E, 0xE0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x80, 0x5F, 0x07, 0x5E, 0x07, 0x5E, 0x08, 0x5D, 0x0A, 0x5A, 0x0F, 0x54, 0x17, 0x4B, 0x11, // 53
+			0x1A, 0xBF, 0x1C, 0x4A, 0x18, 0x4F, 0x15, 0x51, 0x13, 0x53, 0x11, 0x55, 0x10, 0x56, 0x0E, 0x58, 0x0D, 0x59, 0x0C, 0x5A, 0x0B, 0x55, 0x11, 0x51, 0x14, 0x4F, 0x16, 0x4E, 0x17, 0x4E, 0x18, 0x4C, 0x19, 0x4C, 0x1A, 0x4C, 0x19, 0x4C, 0x1A, 0x4B, 0x1B, 0xFF, 0xFC, 0x49, 0x0E, 0x5B, 0x0B, 0x5D, 0x09, 0x5F, 0x07, 0x60, 0x80, 0x5F, 0xE0, 0x60, 0xF0, 0x60, 0xF8, 0x60, 0xF8, 0x60, 0xFC, 0x4D, 0x07, 0x4A, 0xFC, 0x4B, 0x0B, 0x48, 0xFC, 0x4B, 0x0C, 0x47, 0xFC, 0x4B, 0x0D, 0xFF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0E, 0xFF, 0xFC, 0x4B, 0x0D, 0xFF, 0xFC, 0x4B, 0x0D, 0xFF, 0xFC, 0x4B, 0x0C, 0x47, 0xFC, 0x4C, 0x0B, 0x48, 0xF0, 0x4B, 0x0A, 0x49, 0xF0, 0x4C, 0x08, 0x4A, 0xF0, 0x4D, 0xC0, 0x4C, 0xC0, 0x60, 0xC0, 0x60, 0x07, 0x5E, 0x09, 0x5D, 0x0A, 0x5B, 0x0C, 0x59, 0x0E, 0x56, 0x11, 0x54, 0x15, 0x4F, 0x1A, 0x49, 0x0E, // 54
+			0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x60, 0xFE, 0x66, 0x18, 0x4D, 0x19, 0x4C, 0x19, 0x4D, 0x18, 0x4D, 0x19, 0x4C, 0x19, 0x4C, 0x1A, 0x4C, 0x19, 0x4C, 0x19, 0x4D, 0x19, 0x4C, 0x19, 0x4C, 0x1A, 0x4C, 0x19, 0x4C, 0x1A, 0x4C, 0x1A, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x1A, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1A, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x1B, 0x4B, 0x13, // 55
+			0x0E, 0x49, 0x19, 0x50, 0x14, 0x54, 0x11, 0x57, 0x0D, 0x5A, 0x0B, 0x5C, 0x09, 0x5E, 0x08, 0x5F, 0x80, 0x60, 0x80, 0x5F, 0xE0, 0x4C, 0xE0, 0x4C, 0xE0, 0x4C, 0x08, 0x49, 0xF8, 0x4C, 0x0A, 0x48, 0xF8, 0x4C, 0x0A, 0x48, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4B, 0x0C, 0x47, 0xF8, 0x4C, 0x0B, 0x47, 0xF8, 0x4C, 0x0A, 0x49, 0xE0, 0x4C, 0x09, 0x49, 0xE0, 0x4D, 0x07, 0x4A, 0xC0, 0x4D, 0xC0, 0x4C, 0x80, 0x4B, 0xF8, 0x4C, 0x08, 0x5D, 0x09, 0x5C, 0x0B, 0x5A, 0x0D, 0x58, 0x10, 0x57, 0x0E, 0x5A, 0x0A, 0x5D, 0x08, 0x5F, 0x80, 0x60, 0xC0, 0x49, 0xF0, 0x4E, 0xE0, 0x4C, 0x80, 0x4B, 0xF8, 0x4C, 0x09, 0x49, 0xF8, 0x4B, 0x0B, 0x48, 0xF8, 0x4B, 0x0C, 0xFF, 0xFE, 0x4B, 0x0D, 0xFF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4C, 0x0C, 0xFF, 0xFE, 0x4C, 0x0C, 0x47, 0xFC, 0x4C, 0x0A, 0x48, 0xF8, 0x4E, 0x80, 0x4A, 0xF8, 0x61, 0xF0, 0x60, 0xE0, 0x61, 0xC0, 0x60, 0x07, 0x5E, 0x09, 0x5C, 0x0B, 0x5A, 0x0E, 0x56, 0x12, 0x52, 0x18, 0x4A, 0x0E, // 56
+			0x0D, 0x49, 0x1A, 0x50, 0x14, 0x54, 0x11, 0x57, 0x0D, 0x5A, 0x0B, 0x5C, 0x09, 0x5E, 0x08, 0x5F, 0x80, 0x5F, 0xC0, 0x60, 0xE0, 0x4C, 0xE0, 0x4B, 0xF0, 0x4D, 0x08, 0x49, 0xF8, 0x4C, 0x0A, 0x48, 0xF8, 0x4B, 0x0C, 0xFF, 0xFE, 0x4C, 0x0C, 0xFF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0D, 0xBF, 0xFE, 0x4B, 0x0F, 0x57, 0x0F, 0x57, 0x0F, 0x57, 0x0F, 0x58, 0x0E, 0x59, 0x0C, 0xBF, 0xFE, 0x4D, 0x0B, 0xBF, 0xFE, 0x4F, 0x08, 0x47, 0xFE, 0x61, 0xFC, 0x60, 0xFC, 0x61, 0xF8, 0x61, 0xF0, 0x61, 0xE0, 0x61, 0x80, 0x60, 0x08, 0x5E, 0x0A, 0x5C, 0x0D, 0xBF, 0xF8, 0x4B, 0x1A, 0x4B, 0x1B, 0x4B, 0x1A, 0x4C, 0x19, 0x4C, 0x19, 0x4D, 0x18, 0x4D, 0x18, 0x4E, 0x16, 0x4F, 0x15, 0x51, 0x10, 0x55, 0x09, 0x5C, 0x0B, 0x5A, 0x0C, 0x59, 0x0D, 0x58, 0x0E, 0x56, 0x10, 0x54, 0x12, 0x52, 0x14, 0x50, 0x16, 0x4C, 0x1A, 0x47, 0x1A, // 57
 		};
 	}
 }
@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 48
 		 * - last char       : 58
 		 * - number of chars : 10
-		 * - size in bytes   : 2818
+		 * - size in bytes   : 1410 (run-length encoded, 2818 raw)
 		 * 
 		 * \ingroup	font
 		 */
@@ -37,8 +37,8 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Numbers46x64[]) =
 		{
-			0x72, 0x0E, // total size of this array
-			46,	// width (may vary)
+			0x33, 0x06, // total size of this array
+			0,	// run-length encoded
 			64,	// height
 			4,	// hspace
 			4, 	// vspace
@@ -49,18 +49,30 @@ namespace xpcc
 			// for each character the separate width in pixels
 			46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
 			
+			// offset of every glyph in the font data (little endian)
+			0x00, 0x00, // 48
+			0xB7, 0x00, // 49
+			0x44, 0x01, // 50
+			0xD1, 0x01, // 51
+			0x60, 0x02, // 52
+			0xFC, 0x02, // 53
+			0x82, 0x03, // 54
+			0x1E, 0x04, // 55
+			0x9F, 0x04, // 56
+			0x62, 0x05, // 57
+			
 			// font data
 			// bit field of all characters
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 48
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x3F, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 49
-			0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, // 50
-			0x00, 0x00, 0x60, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0x8F, 0x87, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 51
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xC7, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 52
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 53
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x0F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // 54
-			0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0xE7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 55
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x1F, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, // 56
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0xC0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 57
+			0x11, 0x49, 0x20, 0x50, 0x1A, 0x54, 0x16, 0x57, 0x14, 0x5A, 0x11, 0x5C, 0x0F, 0x5E, 0x0D, 0x5F, 0x0C, 0x61, 0x0A, 0x63, 0x09, 0x63, 0x08, 0x4E, 0xC0, 0x4F, 0x07, 0x4D, 0x09, 0x4D, 0x80, 0x4D, 0x0B, 0x4C, 0xC0, 0x4C, 0x0D, 0x4A, 0xE0, 0x4D, 0x0D, 0x4A, 0xF0, 0x4C, 0x0F, 0x49, 0xF0, 0x4C, 0x0F, 0x49, 0xF0, 0x4C, 0x0F, 0x48, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4B, 0x12, 0xBF, 0xFE, 0x4C, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0xFF, 0xFE, 0x4B, 0x13, 0xFF, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x10, 0x49, 0xF8, 0x4C, 0x0F, 0x49, 0xF0, 0x4C, 0x0F, 0x49, 0xF0, 0x4D, 0x0D, 0x4B, 0xE0, 0x4C, 0x0D, 0x4B, 0xC0, 0x4D, 0x0B, 0x4C, 0xC0, 0x4E, 0x09, 0x4D, 0x07, 0x4E, 0xC0, 0x4F, 0x08, 0x63, 0x09, 0x63, 0x0A, 0x61, 0x0C, 0x5F, 0x0D, 0x5F, 0x0E, 0x5D, 0x10, 0x5B, 0x13, 0x57, 0x16, 0x55, 0x19, 0x51, 0x1F, 0x49, 0x11, // 48
+			0x1C, 0x48, 0x22, 0x4A, 0x21, 0x4B, 0x20, 0x4C, 0x1F, 0x4D, 0x1D, 0x4F, 0x1C, 0x50, 0x1A, 0x52, 0x18, 0x54, 0x17, 0x55, 0x15, 0x57, 0x12, 0x5A, 0x10, 0x5C, 0x0F, 0x5D, 0x0F, 0x5D, 0x10, 0x5C, 0x10, 0x5C, 0x11, 0x47, 0xFE, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x12, 0xFF, 0xF0, 0x4C, 0x12, 0xFF, 0x80, 0x4C, 0x10, 0x9F, 0x08, 0x4C, 0x0D, 0x81, 0x0B, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x07, // 49
+			0x0F, 0x4A, 0x1E, 0x52, 0x18, 0x57, 0x13, 0x5A, 0x10, 0x5E, 0x0D, 0x60, 0x0A, 0x63, 0x08, 0x64, 0x07, 0x66, 0x07, 0x65, 0x08, 0x65, 0x07, 0x4D, 0x80, 0x50, 0x08, 0x4A, 0x0B, 0x4D, 0x09, 0x47, 0x0E, 0x4D, 0x07, 0x9F, 0x10, 0x4D, 0x80, 0x8F, 0x12, 0x4B, 0xC0, 0x83, 0x13, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x1F, 0x4D, 0x1E, 0x4E, 0x1E, 0x4D, 0x1E, 0x4E, 0x1D, 0x4E, 0x1D, 0x4F, 0x1C, 0x4F, 0x1C, 0x4F, 0x1C, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1B, 0x50, 0x1C, 0x4F, 0x1C, 0x50, 0x1B, 0x50, 0x1C, 0x4F, 0x1C, 0x4F, 0x1D, 0x4E, 0x1D, 0x4F, 0x1D, 0x4E, 0x1E, 0x65, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x66, 0xE0, 0x63, 0xFC, // 50
+			0x0E, 0x4A, 0x1E, 0x52, 0x17, 0x57, 0x13, 0x5B, 0x0F, 0x5E, 0x0C, 0x62, 0x0A, 0x62, 0x0B, 0x62, 0x0A, 0x63, 0x0A, 0x62, 0x0A, 0x63, 0x0A, 0x49, 0x07, 0x50, 0x0A, 0xFF, 0x0C, 0x4E, 0x08, 0x8F, 0x0F, 0x4D, 0xC0, 0x83, 0x12, 0x4D, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x1F, 0x4D, 0x1E, 0x4D, 0x1C, 0x50, 0x12, 0x59, 0x13, 0x58, 0x14, 0x57, 0x15, 0x56, 0x16, 0x54, 0x18, 0x56, 0x16, 0x58, 0x14, 0x59, 0x13, 0x5B, 0x11, 0x5B, 0x11, 0x5C, 0x1B, 0x52, 0x1D, 0x4F, 0x1F, 0x4E, 0x1F, 0x4D, 0x20, 0x4D, 0x1F, 0x4D, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4D, 0x1E, 0x47, 0xFE, 0x81, 0x16, 0x4B, 0xF0, 0x9F, 0x12, 0x4E, 0xC0, 0x48, 0x0B, 0x51, 0x80, 0x66, 0x80, 0x65, 0x80, 0x66, 0x80, 0x65, 0x07, 0x64, 0x08, 0x63, 0x08, 0x63, 0x09, 0x61, 0x0D, 0x5D, 0x13, 0x56, 0x1C, 0x4C, 0x13, // 51
+			0x1A, 0x4B, 0x20, 0x4C, 0x1F, 0x4D, 0x1E, 0x4E, 0x1D, 0x4F, 0x1C, 0x50, 0x1B, 0x51, 0x1B, 0x51, 0x1A, 0x52, 0x19, 0x53, 0x18, 0x54, 0x17, 0x55, 0x17, 0x55, 0x16, 0x56, 0x15, 0x57, 0x14, 0x58, 0x14, 0x58, 0x13, 0x59, 0x12, 0xFF, 0xFE, 0x4C, 0x12, 0xFF, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x10, 0x48, 0xF8, 0x4C, 0x10, 0x48, 0xF0, 0x4C, 0x0F, 0x49, 0xF0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4C, 0x0E, 0x4A, 0xC0, 0x4C, 0x0D, 0x4B, 0x80, 0x4C, 0x0C, 0x4C, 0x80, 0x4C, 0x0C, 0x4B, 0x07, 0x4C, 0x0B, 0x4B, 0x08, 0x4C, 0x0B, 0x4B, 0x08, 0x4C, 0x0A, 0x4B, 0x09, 0x4C, 0x09, 0x4C, 0x09, 0x4C, 0x09, 0x4B, 0x0A, 0x4C, 0x08, 0x4C, 0x0A, 0x4C, 0x08, 0x4B, 0x0B, 0x4C, 0x07, 0x4C, 0x0B, 0x4C, 0x07, 0x4B, 0x0C, 0x4C, 0x80, 0x79, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x19, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x80, // 52
+			0x07, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0B, 0x61, 0x0A, 0x62, 0x0A, 0x62, 0x0A, 0x62, 0x0A, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4A, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x4B, 0x21, 0x50, 0x1C, 0x55, 0x17, 0x58, 0x14, 0x5B, 0x11, 0x5C, 0x10, 0x5E, 0x0E, 0x5F, 0x0C, 0x61, 0x0B, 0x62, 0x0A, 0x63, 0x09, 0x64, 0x13, 0x59, 0x19, 0x54, 0x1B, 0x51, 0x1D, 0x4F, 0x1F, 0x4D, 0x20, 0x4D, 0x1F, 0x4D, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1E, 0x4D, 0x81, 0x17, 0x4A, 0xF8, 0x8F, 0x13, 0x4E, 0xC0, 0x48, 0x0B, 0x51, 0x80, 0x65, 0xC0, 0x66, 0x80, 0x65, 0x07, 0x65, 0x07, 0x64, 0x08, 0x63, 0x08, 0x62, 0x0A, 0x61, 0x0D, 0x5D, 0x13, 0x56, 0x1B, 0x4D, 0x13, // 53
+			0x0E, 0x3F, 0xFF, 0x20, 0x4C, 0x1D, 0x4F, 0x1A, 0x52, 0x18, 0x55, 0x15, 0x57, 0x13, 0x59, 0x12, 0x5A, 0x10, 0x5C, 0x0F, 0x5D, 0x0E, 0x5E, 0x0D, 0x58, 0x13, 0x54, 0x17, 0x52, 0x19, 0x51, 0x1B, 0x4F, 0x1C, 0x4F, 0x1D, 0x4E, 0x1D, 0x4D, 0x1F, 0x4D, 0x1E, 0x4D, 0x1F, 0x4C, 0x1F, 0x4D, 0x1F, 0x48, 0xF8, 0x4B, 0x11, 0x5F, 0x0C, 0x62, 0x0A, 0x64, 0x08, 0x65, 0x07, 0x66, 0xC0, 0x65, 0xF0, 0x66, 0xF0, 0x66, 0xF8, 0x66, 0xFC, 0x66, 0xFC, 0x4F, 0x0A, 0x4B, 0xFE, 0x4C, 0x0F, 0x49, 0xFE, 0x4C, 0x11, 0x47, 0xFE, 0x4C, 0x12, 0x5A, 0x12, 0x5A, 0x13, 0x59, 0x13, 0x59, 0x13, 0x59, 0x13, 0xFF, 0xFE, 0x4C, 0x12, 0xFF, 0xFE, 0x4C, 0x12, 0xFF, 0xFE, 0x4C, 0x12, 0xFF, 0xFE, 0x4C, 0x11, 0x47, 0xFE, 0x4D, 0x10, 0x48, 0xF8, 0x4D, 0x0E, 0x49, 0xF8, 0x4D, 0x0D, 0x4A, 0xF8, 0x4F, 0x0A, 0x4C, 0xE0, 0x50, 0x80, 0x4E, 0xE0, 0x67, 0x80, 0x66, 0x07, 0x64, 0x08, 0x63, 0x0A, 0x61, 0x0C, 0x5F, 0x0E, 0x5D, 0x11, 0x5A, 0x13, 0x57, 0x18, 0x52, 0x1D, 0x4B, 0x10, // 54
+			0xBF, 0x60, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x66, 0xF8, 0x69, 0x1E, 0x4D, 0x1E, 0x4E, 0x1D, 0x4E, 0x1E, 0x4D, 0x1E, 0x4E, 0x1D, 0x4E, 0x1E, 0x4D, 0x1E, 0x4E, 0x1E, 0x4D, 0x1E, 0x4D, 0x1F, 0x4D, 0x1E, 0x4D, 0x1F, 0x4D, 0x1E, 0x4D, 0x1F, 0x4D, 0x1E, 0x4D, 0x1F, 0x4D, 0x1F, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x20, 0x4C, 0x1F, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1F, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x1F, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x20, 0x4C, 0x16, // 55
+			0x11, 0x49, 0x1F, 0x51, 0x19, 0x55, 0x15, 0x59, 0x12, 0x5B, 0x0F, 0x5E, 0x0D, 0x60, 0x0C, 0x61, 0x0A, 0x63, 0x08, 0x64, 0x08, 0x65, 0x80, 0x4E, 0xE0, 0x50, 0x80, 0x4E, 0x08, 0x4E, 0x80, 0x4D, 0x0A, 0x4C, 0xE0, 0x4D, 0x0C, 0x4B, 0xE0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4C, 0x0E, 0x4A, 0xE0, 0x4D, 0x0D, 0x4A, 0xE0, 0x4D, 0x0C, 0x4C, 0x80, 0x4D, 0x0B, 0x4C, 0x80, 0x4E, 0x09, 0x4C, 0x07, 0x4F, 0x07, 0x4D, 0x08, 0x4E, 0xE0, 0x4D, 0x09, 0x4D, 0xFC, 0x4D, 0x0B, 0x61, 0x0C, 0x5F, 0x0E, 0x5C, 0x11, 0x5A, 0x13, 0x5A, 0x12, 0x5C, 0x0E, 0x5F, 0x0C, 0x61, 0x0A, 0x63, 0x08, 0x49, 0xFC, 0x54, 0x07, 0x4C, 0xC0, 0x51, 0xC0, 0x4D, 0x08, 0x4E, 0xE0, 0x4D, 0x0B, 0x4C, 0xF0, 0x4D, 0x0C, 0x4B, 0xF0, 0x4C, 0x0E, 0x49, 0xF8, 0x4D, 0x0F, 0x48, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4D, 0x0F, 0x48, 0xFC, 0x4D, 0x0F, 0x48, 0xFC, 0x4E, 0x0D, 0x4A, 0xF0, 0x4E, 0x0B, 0x4B, 0xF0, 0x50, 0x07, 0x4E, 0xE0, 0x66, 0xC0, 0x67, 0x80, 0x65, 0x07, 0x65, 0x08, 0x63, 0x0A, 0x61, 0x0C, 0x5F, 0x0F, 0x5B, 0x13, 0x57, 0x17, 0x53, 0x1D, 0x4B, 0x10, // 56
+			0x10, 0x4A, 0x1F, 0x50, 0x1A, 0x55, 0x15, 0x58, 0x13, 0x5B, 0x0F, 0x5E, 0x0D, 0x60, 0x0C, 0x61, 0x0A, 0x62, 0x09, 0x64, 0x08, 0x64, 0x07, 0x4F, 0x80, 0x4F, 0x80, 0x4E, 0x08, 0x4D, 0xC0, 0x4D, 0x0C, 0x4B, 0xE0, 0x4D, 0x0C, 0x4B, 0xE0, 0x4C, 0x0E, 0x49, 0xF8, 0x4D, 0x0E, 0x49, 0xF8, 0x4C, 0x10, 0x48, 0xF8, 0x4C, 0x10, 0x48, 0xF8, 0x4C, 0x10, 0x48, 0xF8, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4C, 0x11, 0x47, 0xFC, 0x4D, 0x10, 0x47, 0xFC, 0x4D, 0x10, 0x48, 0xF8, 0x4D, 0x0F, 0x48, 0xF8, 0x4E, 0x0E, 0x48, 0xF8, 0x51, 0x08, 0x4C, 0xF0, 0x66, 0xF0, 0x67, 0xE0, 0x66, 0xE0, 0x67, 0xC0, 0x67, 0x80, 0x66, 0x07, 0x64, 0x09, 0x63, 0x0B, 0x61, 0x0D, 0x4B, 0xFE, 0x4C, 0x11, 0xFF, 0xF8, 0x4D, 0x1F, 0x4C, 0x20, 0x4C, 0x1F, 0x4D, 0x1E, 0x4D, 0x1F, 0x4D, 0x1E, 0x4E, 0x1D, 0x4E, 0x1C, 0x50, 0x1B, 0x50, 0x1A, 0x51, 0x18, 0x54, 0x13, 0x58, 0x0C, 0x5F, 0x0D, 0x5E, 0x0F, 0x5C, 0x10, 0x5B, 0x11, 0x59, 0x13, 0x58, 0x14, 0x56, 0x16, 0x54, 0x18, 0x51, 0x1B, 0x4D, 0x1F, 0x47, 0x1F, // 57
 		};
 	}
 }
@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 48
 		 * - last char       : 58
 		 * - number of chars : 10
-		 * - size in bytes   : 3698
+		 * - size in bytes   : 1587 (run-length encoded, 3698 raw)
 		 * 
 		 * \ingroup	font
 		 */
@@ -37,8 +37,8 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Ubuntu_36[]) =
 		{
-			0xDD, 0x1C, // total size of this array
-			16,	// width (may vary)
+			0xA8, 0x12, // total size of this array
+			0,	// run-length encoded
 			35,	// height
 			1,	// hspace
 			0, 	// vspace
@@ -58,104 +58,202 @@ namespace xpcc
 			16, 16, 11, 13, 10, 15, 17, 27, 16, 17, 
 			15, 10,  3, 10, 17, 14, 
 			
+			// offset of every glyph in the font data (little endian)
+			0x00, 0x00, // 32
+			0x05, 0x00, // 33
+			0x17, 0x00, // 34
+			0x27, 0x00, // 35
+			0x62, 0x00, // 36
+			0xA3, 0x00, // 37
+			0x01, 0x01, // 38
+			0x49, 0x01, // 39
+			0x4D, 0x01, // 40
+			0x75, 0x01, // 41
+			0x9D, 0x01, // 42
+			0xC0, 0x01, // 43
+			0xE3, 0x01, // 44
+			0xEC, 0x01, // 45
+			0xF3, 0x01, // 46
+			0xF9, 0x01, // 47
+			0x3C, 0x02, // 48
+			0x73, 0x02, // 49
+			0x98, 0x02, // 50
+			0xC9, 0x02, // 51
+			0xFD, 0x02, // 52
+			0x31, 0x03, // 53
+			0x63, 0x03, // 54
+			0x99, 0x03, // 55
+			0xC9, 0x03, // 56
+			0x00, 0x04, // 57
+			0x36, 0x04, // 58
+			0x3F, 0x04, // 59
+			0x4C, 0x04, // 60
+			0x73, 0x04, // 61
+			0x7D, 0x04, // 62
+			0xA4, 0x04, // 63
+			0xCE, 0x04, // 64
+			0x36, 0x05, // 65
+			0x7D, 0x05, // 66
+			0xB6, 0x05, // 67
+			0xED, 0x05, // 68
+			0x2A, 0x06, // 69
+			0x58, 0x06, // 70
+			0x85, 0x06, // 71
+			0xBF, 0x06, // 72
+			0xF0, 0x06, // 73
+			0xF4, 0x06, // 74
+			0x27, 0x07, // 75
+			0x70, 0x07, // 76
+			0xA0, 0x07, // 77
+			0xFC, 0x07, // 78
+			0x3E, 0x08, // 79
+			0x80, 0x08, // 80
+			0xB7, 0x08, // 81
+			0x04, 0x09, // 82
+			0x45, 0x09, // 83
+			0x78, 0x09, // 84
+			0xA9, 0x09, // 85
+			0xE1, 0x09, // 86
+			0x2A, 0x0A, // 87
+			0x97, 0x0A, // 88
+			0xDF, 0x0A, // 89
+			0x1F, 0x0B, // 90
+			0x50, 0x0B, // 91
+			0x77, 0x0B, // 92
+			0xBC, 0x0B, // 93
+			0xE3, 0x0B, // 94
+			0x09, 0x0C, // 95
+			0x13, 0x0C, // 96
+			0x1C, 0x0C, // 97
+			0x43, 0x0C, // 98
+			0x7E, 0x0C, // 99
+			0xA7, 0x0C, // 100
+			0xE2, 0x0C, // 101
+			0x07, 0x0D, // 102
+			0x33, 0x0D, // 103
+			0x6B, 0x0D, // 104
+			0xA6, 0x0D, // 105
+			0xAB, 0x0D, // 106
+			0xC6, 0x0D, // 107
+			0x03, 0x0E, // 108
+			0x1C, 0x0E, // 109
+			0x64, 0x0E, // 110
+			0x8F, 0x0E, // 111
+			0xBB, 0x0E, // 112
+			0xF3, 0x0E, // 113
+			0x2B, 0x0F, // 114
+			0x47, 0x0F, // 115
+			0x6D, 0x0F, // 116
+			0x94, 0x0F, // 117
+			0xBF, 0x0F, // 118
+			0xEF, 0x0F, // 119
+			0x3F, 0x10, // 120
+			0x6F, 0x10, // 121
+			0xAC, 0x10, // 122
+			0xD2, 0x10, // 123
+			0x04, 0x11, // 124
+			0x06, 0x11, // 125
+			0x38, 0x11, // 126
+			0x4E, 0x11, // 127
+			
 			// font data
 			// bit field of all characters
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 32
-			0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x83, 0x8F, 0x83, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, // 33
-			0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 34
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0x18, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x9C, 0xFC, 0xFF, 0x7F, 0x1F, 0x1C, 0x1C, 0x1C, 0x9C, 0xFC, 0xFF, 0x7F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFF, 0xFF, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFF, 0xFF, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 35
-			0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x7F, 0x7F, 0x7F, 0x70, 0x70, 0x70, 0xE0, 0x60, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0xF1, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x8F, 0xFE, 0xFC, 0xF0, 0x06, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0xFE, 0xFE, 0xFE, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 36
-			0xC0, 0xE0, 0xF0, 0x78, 0x18, 0x18, 0x18, 0x18, 0x78, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0x78, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x78, 0x60, 0x60, 0x60, 0x60, 0x78, 0x3F, 0x1F, 0x0F, 0x80, 0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0x3F, 0x0F, 0x03, 0x00, 0xF8, 0xFC, 0xFE, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x0F, 0xFE, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 37
-			0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xBF, 0xFF, 0xF8, 0xE0, 0xE0, 0xF0, 0x70, 0x3C, 0x1F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0xFF, 0x87, 0x03, 0x01, 0x01, 0x01, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0xF8, 0xF0, 0xF0, 0xF8, 0x3E, 0x0F, 0x03, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x07, 0x07, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 38
-			0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 39
-			0x00, 0x00, 0xC0, 0xF0, 0xFC, 0x3E, 0x0F, 0x02, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x02, // 40
-			0x02, 0x0F, 0x3E, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0xE0, 0xF8, 0x7F, 0x1F, 0x07, 0x00, 0x02, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, // 41
-			0x80, 0xC0, 0x80, 0x80, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x80, 0x00, 0x01, 0xC1, 0xE3, 0xF3, 0x7B, 0x1E, 0x07, 0x1E, 0x7B, 0xF3, 0xE3, 0xC1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 42
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 43
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x01, 0x03, 0x00, 0x00, // 44
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 45
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, // 46
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFE, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFE, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFE, 0x7F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0x7F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 47
-			0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 48
-			0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0x01, 0x07, 0x03, 0x03, 0x03, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 49
-			0x40, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 50
-			0x20, 0x70, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0x9F, 0x8F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x87, 0xFF, 0xFF, 0x7C, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 51
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x7C, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0x3F, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 52
-			0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x70, 0x7F, 0x7F, 0x7F, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xFF, 0xFF, 0x7E, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 53
-			0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x70, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0xFF, 0x63, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 54
-			0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xB8, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 55
-			0x00, 0x80, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0x7F, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0x7F, 0x3F, 0x0F, 0x00, 0xF8, 0xFC, 0xFE, 0x87, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x8F, 0xFF, 0xFE, 0xF8, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 56
-			0x00, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0x80, 0x00, 0x3F, 0x7F, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x83, 0xC3, 0xF1, 0xFD, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 57
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x3E, 0x1C, 0x00, 0x80, 0x80, 0x80, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, // 58
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, // 59
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0C, 0x07, 0x07, 0x0F, 0x0F, 0x1D, 0x1D, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 60
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 61
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x70, 0x38, 0x38, 0x1D, 0x1D, 0x0F, 0x0F, 0x07, 0x07, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 62
-			0x30, 0x70, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x38, 0x3F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x8F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 63
-			0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0x3F, 0x0F, 0x03, 0x01, 0x80, 0xE0, 0xF0, 0xF8, 0x38, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xF8, 0x00, 0x01, 0x03, 0x07, 0x1F, 0xFE, 0xFC, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0xFF, 0xF0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xC0, 0xF0, 0xFF, 0x7F, 0x0F, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x3C, 0x78, 0x70, 0xF0, 0xE0, 0xE1, 0xE1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC1, 0xC1, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 64
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0x78, 0xF8, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFE, 0x7F, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3F, 0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0x3F, 0x3F, 0x39, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x3F, 0x7F, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x08, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 65
-			0xF0, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xBF, 0x9F, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0xC3, 0xFF, 0xFF, 0x7C, 0x07, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 66
-			0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0x30, 0xF0, 0xFE, 0xFF, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 67
-			0xF0, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0xF0, 0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0xFF, 0xFE, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x7F, 0x3F, 0x07, 0x07, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 68
-			0xF8, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 69
-			0xF8, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 70
-			0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0x70, 0x30, 0xF8, 0xFE, 0xFF, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 71
-			0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 72
-			0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, // 73
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x02, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 74
-			0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x38, 0x18, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0xB8, 0xBC, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 75
-			0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 76
-			0x00, 0x80, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x1F, 0x7F, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0x7F, 0x1F, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0xFE, 0xF0, 0xC0, 0xF0, 0xFE, 0x3F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 77
-			0xF8, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x03, 0x07, 0x0F, 0x3E, 0x7C, 0xF8, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x3C, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 78
-			0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0xF0, 0xFE, 0xFF, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0xFF, 0xFE, 0xF8, 0x07, 0x3F, 0xFF, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0xFF, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 79
-			0xF0, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xE1, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 80
-			0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0xF0, 0xFE, 0xFF, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0xFF, 0xFE, 0xF8, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x7F, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x3E, 0x7E, 0xFE, 0xEE, 0xC7, 0x87, 0x87, 0x83, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x07, 0x07, 0x01, 0x00, 0x00, // 81
-			0xF0, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0x7D, 0xF9, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 82
-			0x00, 0x80, 0xE0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0x30, 0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x78, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x8F, 0xFE, 0xFE, 0xF8, 0x02, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 83
-			0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xF8, 0xF8, 0xF8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 84
-			0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 85
-			0x08, 0x78, 0xF8, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xF8, 0x78, 0x08, 0x00, 0x00, 0x03, 0x1F, 0x7F, 0xFE, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFE, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF8, 0xFE, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 86
-			0x38, 0xF8, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0x38, 0x00, 0x03, 0x7F, 0xFF, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0x3F, 0x07, 0x3F, 0xFF, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3F, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0xF8, 0xFF, 0x3F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 87
-			0x08, 0x18, 0x78, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0x78, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x3E, 0xFC, 0xF0, 0xF0, 0xF8, 0x3E, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0x7C, 0x3E, 0x0F, 0x07, 0x03, 0x07, 0x1F, 0x3E, 0x78, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x0F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x0F, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 88
-			0x08, 0x38, 0x78, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x78, 0x38, 0x08, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x3E, 0xFC, 0xF0, 0xE0, 0x80, 0xE0, 0xF0, 0xFC, 0x3E, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 89
-			0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xB8, 0xF8, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x78, 0x3C, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0x7C, 0x3E, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 90
-			0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, // 91
-			0x0F, 0x7F, 0xFE, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x7F, 0xFE, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x7F, 0xFE, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x7F, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, // 92
-			0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, // 93
-			0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0x38, 0xF8, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 94
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, // 95
-			0x06, 0x0F, 0x1E, 0x3C, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 96
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xFC, 0xF8, 0xE0, 0xF8, 0xFC, 0xFE, 0x0E, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 97
-			0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0x7C, 0xF8, 0xE0, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0x3F, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 98
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0x78, 0x3C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x0C, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 99
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0xF8, 0x7C, 0x3C, 0x1E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 100
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x78, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x3C, 0xF8, 0xF0, 0xC0, 0x3F, 0xFF, 0xFF, 0xE7, 0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 101
-			0xF0, 0xFC, 0xFE, 0x1E, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 102
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x78, 0x3C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xFE, 0xFC, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x81, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x83, 0xE3, 0xFF, 0xFF, 0x3F, 0x00, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, // 103
-			0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 104
-			0x1E, 0x1E, 0x1E, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, // 105
-			0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, // 106
-			0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0E, 0x06, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0x1F, 0x3D, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 107
-			0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 108
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFE, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xFC, 0xF8, 0xDC, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xFC, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 109
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFE, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3C, 0xFC, 0xF0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 110
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0x78, 0x3C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x3C, 0x78, 0xF8, 0xE0, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 111
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFE, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x3C, 0xF8, 0xF0, 0xE0, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 112
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x3C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xFE, 0xFC, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, // 113
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFE, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 114
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0x9C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x0C, 0x00, 0x00, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0E, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0x06, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 115
-			0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 116
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 117
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3E, 0xFE, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0x3E, 0x06, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xF8, 0xE0, 0x80, 0xE0, 0xF8, 0xFF, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 118
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7E, 0xFE, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFE, 0x7E, 0xFE, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0x7E, 0x06, 0x00, 0x00, 0x03, 0x1F, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0xFC, 0xFF, 0x3F, 0x03, 0x00, 0x07, 0x3F, 0xFF, 0xFC, 0xE0, 0x00, 0xE0, 0xFC, 0xFF, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 119
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x1E, 0x3E, 0xF8, 0xF0, 0xC0, 0x80, 0xC0, 0xF0, 0xF8, 0x7E, 0x1E, 0x06, 0x02, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xFB, 0x7F, 0x1F, 0x3F, 0x7F, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x0F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x0F, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 120
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1E, 0xFE, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFE, 0x3E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xF8, 0xC0, 0x00, 0xF0, 0xFE, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xEF, 0xFF, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 121
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x8E, 0xCE, 0xEE, 0xFE, 0x7E, 0x3E, 0x1E, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x78, 0x3E, 0x1F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 122
-			0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFE, 0x0F, 0x07, 0x07, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0F, 0xFF, 0xFD, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, // 123
-			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, // 124
-			0x07, 0x07, 0x07, 0x0F, 0xFE, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFD, 0xFF, 0x0F, 0x07, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, // 125
-			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x80, 0x04, 0x0F, 0x0F, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0E, 0x0E, 0x0E, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 126
-			0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 127
+			0x17, 0x3F, 0x3F, 0x3F, 0x3F, // 32
+			0x0D, 0x9C, 0xF3, 0xCE, 0xB9, 0xE7, 0x9C, 0xF3, 0xCE, 0xB9, 0xE7, 0x9C, 0xA1, 0x0E, 0x8E, 0x4B, 0xF7, 0x23, // 33
+			0xF1, 0xFC, 0xBF, 0x8F, 0xE3, 0xF8, 0xFE, 0x9F, 0xC7, 0xF1, 0xE8, 0x90, 0x26, 0x3F, 0x3F, 0x3F, // 34
+			0x3F, 0x8E, 0x87, 0x07, 0xB8, 0x9C, 0x81, 0xF0, 0xF0, 0x83, 0xC1, 0xE0, 0x87, 0x83, 0xC0, 0x8E, 0x87, 0x08, 0xF0, 0xB8, 0x75, 0xFE, 0x87, 0x83, 0xC0, 0x8E, 0x87, 0x07, 0xF0, 0xB8, 0x81, 0xE0, 0xF0, 0x83, 0xC1, 0xE0, 0x79, 0xE3, 0xC1, 0xE0, 0x87, 0x83, 0xC0, 0x8E, 0x87, 0x08, 0xF0, 0xB8, 0x83, 0xE1, 0xE0, 0x87, 0x83, 0xC0, 0x8E, 0x87, 0x12, 0x3F, 0x3F, // 35
+			0x80, 0xF0, 0x80, 0x9C, 0x80, 0x87, 0x08, 0x87, 0x0A, 0xFF, 0xC0, 0x47, 0xF8, 0xFF, 0xFE, 0x9E, 0x81, 0x8F, 0x07, 0x87, 0x08, 0x87, 0x08, 0x87, 0x09, 0x8F, 0x0A, 0x9F, 0x0A, 0xBF, 0x0A, 0xFF, 0x0A, 0xBF, 0x09, 0x9F, 0x09, 0x8F, 0x08, 0x87, 0x09, 0x87, 0x08, 0x87, 0x08, 0x87, 0x0B, 0xFB, 0x07, 0x4D, 0xFE, 0x4B, 0xE0, 0x48, 0x80, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x25, // 36
+			0x10, 0x3F, 0x8F, 0xE0, 0x83, 0xC0, 0xBF, 0xE0, 0x8E, 0x81, 0xE1, 0xE0, 0x9C, 0x87, 0xC3, 0xE0, 0xF0, 0x8E, 0x83, 0xC3, 0xC0, 0x9C, 0x87, 0x87, 0x07, 0xF0, 0x9C, 0xB8, 0x81, 0xE0, 0xB8, 0xF0, 0x83, 0xE1, 0xF3, 0xC0, 0x83, 0xC3, 0xC7, 0x0B, 0xFF, 0xC7, 0x0C, 0xBF, 0x87, 0x12, 0x87, 0x15, 0xB8, 0xBF, 0x0C, 0xB8, 0xFF, 0xC0, 0x81, 0xE3, 0xC3, 0xC0, 0x83, 0xCF, 0x87, 0xC0, 0x8E, 0x9C, 0x87, 0x08, 0xF1, 0xE0, 0xB8, 0x83, 0xC3, 0xC0, 0xF0, 0x87, 0x87, 0x81, 0xE0, 0x9C, 0x8F, 0x87, 0xC0, 0xF0, 0x8E, 0x8E, 0x81, 0xE0, 0x8F, 0xF8, 0x87, 0x08, 0xBF, 0x3F, 0x3F, 0x3F, // 37
+			0x80, 0x3C, 0x9F, 0x0D, 0x47, 0x0B, 0x48, 0xC0, 0x87, 0xC3, 0xE0, 0x87, 0x81, 0xE0, 0x87, 0x81, 0xE0, 0x87, 0x81, 0xE0, 0x87, 0x83, 0xE0, 0x87, 0xC3, 0xC0, 0x83, 0xCF, 0x0B, 0x47, 0x0C, 0xBF, 0x0C, 0xBF, 0x0C, 0xFF, 0xE0, 0x99, 0xF1, 0xF0, 0xB9, 0xE0, 0xF8, 0xB3, 0xC0, 0xBC, 0xF3, 0xC0, 0x9F, 0xE3, 0xC0, 0x8F, 0xE3, 0xC0, 0x87, 0xC3, 0xE0, 0x87, 0xC1, 0xF0, 0x8F, 0xF0, 0x4E, 0xF0, 0x4A, 0x9E, 0x83, 0xF8, 0x8F, 0x12, 0x3F, 0x3F, // 38
+			0x52, 0xFD, 0x0E, 0x3F, // 39
+			0x81, 0x81, 0xE1, 0xE0, 0xF0, 0xF0, 0xB8, 0xB8, 0x9C, 0x9C, 0x8E, 0x87, 0x83, 0xC3, 0xC1, 0xE0, 0xF0, 0xB8, 0x9C, 0x8E, 0x87, 0x83, 0xC1, 0xE0, 0xF0, 0xB8, 0x8E, 0x87, 0x83, 0xC1, 0xE0, 0xB8, 0x9C, 0x87, 0x83, 0xC0, 0xF0, 0xB8, 0x8E, 0x82, // 40
+			0xA0, 0xB8, 0x8E, 0x87, 0x81, 0xE0, 0xF0, 0x9C, 0x8E, 0x83, 0xC1, 0xE0, 0xF0, 0xB8, 0x8E, 0x87, 0x83, 0xC1, 0xE0, 0xF0, 0xB8, 0x9C, 0x8E, 0x87, 0x83, 0xC1, 0xE1, 0xE0, 0xF0, 0xB8, 0x9C, 0x9C, 0x8E, 0x8E, 0x87, 0x87, 0x83, 0xC3, 0xC0, 0xC0, // 41
+			0x2E, 0x87, 0x80, 0x83, 0xC0, 0x81, 0xE0, 0x90, 0xF0, 0xDE, 0xB9, 0xF7, 0xEB, 0xF0, 0xFF, 0xE0, 0x87, 0x07, 0x8D, 0xC0, 0x8E, 0xF0, 0x8E, 0x9C, 0x8F, 0x8F, 0x87, 0x83, 0xC0, 0xC1, 0x11, 0x3F, 0x3F, 0x3F, 0x3F, // 42
+			0x1B, 0x3F, 0x3F, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x80, 0x6E, 0xF8, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x1F, 0x3F, 0x3F, // 43
+			0x1A, 0x3F, 0x81, 0xEE, 0xF7, 0xBB, 0x9B, 0xD8, 0xC0, // 44
+			0x0F, 0x3F, 0x3F, 0x5A, 0x0F, 0x3F, 0x3F, // 45
+			0x30, 0x3F, 0x8E, 0x4B, 0xF7, 0x23, // 46
+			0x80, 0x83, 0x80, 0x87, 0x80, 0x87, 0x0A, 0xF0, 0x81, 0xE0, 0x81, 0xE0, 0x81, 0xE0, 0x83, 0xC0, 0x83, 0xC0, 0x87, 0x80, 0x87, 0x0A, 0xF0, 0x81, 0xE0, 0x81, 0xE0, 0x81, 0xE0, 0x83, 0xC0, 0x83, 0xC0, 0x87, 0xC0, 0x87, 0x0A, 0xF0, 0x81, 0xE0, 0x81, 0xE0, 0x81, 0xE0, 0x83, 0xC0, 0x83, 0xC0, 0x83, 0xC0, 0x87, 0x0A, 0xF0, 0x81, 0xE0, 0x81, 0xE0, 0x81, 0xE0, 0x83, 0xC0, 0x83, 0xC0, 0x83, 0xC0, 0x83, 0x0B, // 47
+			0x33, 0xBF, 0x80, 0x9F, 0xF0, 0x8F, 0xFE, 0x87, 0xC3, 0xE3, 0xE0, 0xBC, 0xF0, 0x87, 0x9C, 0x81, 0xEF, 0x07, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x09, 0xFF, 0x08, 0xF7, 0x80, 0xB9, 0xE0, 0x8E, 0xBC, 0x87, 0xC7, 0xC3, 0xE0, 0x49, 0x80, 0x47, 0x07, 0xBF, 0x34, 0x3F, // 48
+			0x23, 0xB8, 0x8F, 0x83, 0xF1, 0xFE, 0x4B, 0xF7, 0xBC, 0xF4, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0x3F, // 49
+			0x33, 0xFF, 0x80, 0x47, 0xF0, 0x4A, 0xE7, 0xE0, 0xF8, 0xE0, 0x8F, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x07, 0x87, 0x08, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x8F, 0x07, 0x87, 0x07, 0x87, 0x0C, 0x6F, 0x2F, 0x3F, // 50
+			0x2E, 0xBF, 0xC0, 0xFF, 0xF8, 0xFF, 0xFE, 0x98, 0x8F, 0x08, 0x8F, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0xFF, 0x07, 0xFF, 0x07, 0x48, 0x08, 0x9F, 0x07, 0x87, 0x08, 0x8F, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x08, 0x9D, 0xE0, 0xBE, 0x47, 0xFC, 0x49, 0xE0, 0x47, 0x2D, 0x3F, // 51
+			0x39, 0x87, 0x09, 0x8F, 0x09, 0x9F, 0x09, 0xBF, 0x09, 0xFF, 0x07, 0xBD, 0xE0, 0x87, 0x9C, 0x81, 0xF3, 0xC0, 0xBC, 0xB8, 0x87, 0x87, 0x81, 0xE0, 0xF0, 0x9C, 0x8E, 0x87, 0x81, 0xE1, 0xE0, 0x9C, 0x9C, 0x83, 0xC7, 0x80, 0xB8, 0x72, 0x80, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x39, 0x3F, // 52
+			0x2E, 0x47, 0xF8, 0x47, 0xF8, 0x4A, 0xC7, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x0A, 0xFF, 0x07, 0x47, 0xE0, 0x4B, 0x08, 0xFF, 0x07, 0x8F, 0x08, 0x8F, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x08, 0x9D, 0xE0, 0xBE, 0x47, 0xFC, 0x49, 0xE0, 0x47, 0x2D, 0x3F, // 53
+			0x36, 0x8F, 0x07, 0xBF, 0xC0, 0xBF, 0xF0, 0x9F, 0xC0, 0x8F, 0x07, 0x8F, 0x07, 0x87, 0x07, 0x87, 0x08, 0x87, 0x80, 0x81, 0xEF, 0xE0, 0x48, 0xF8, 0x4D, 0x9E, 0x81, 0xF7, 0x08, 0xF7, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0xC0, 0x8E, 0xF0, 0x87, 0xDE, 0x81, 0xE3, 0xE1, 0xF8, 0x49, 0xE0, 0x49, 0x80, 0xBF, 0x34, 0x3F, // 54
+			0x2F, 0x6F, 0x07, 0x83, 0x08, 0x87, 0x07, 0x87, 0x07, 0x87, 0x08, 0x87, 0x07, 0x87, 0x08, 0x87, 0x07, 0x87, 0x08, 0x87, 0x07, 0x87, 0x08, 0x87, 0x07, 0x83, 0x08, 0x87, 0x08, 0x87, 0x07, 0x83, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x07, 0x83, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x38, 0x3F, // 55
+			0x33, 0xBF, 0x07, 0x47, 0xE0, 0x4B, 0x87, 0xC3, 0xE3, 0xE0, 0xBC, 0xF0, 0x87, 0x9C, 0x81, 0xE7, 0x80, 0xB9, 0xF0, 0x8E, 0x9C, 0x87, 0x87, 0xE3, 0xE0, 0x49, 0x80, 0xFF, 0xC0, 0xBF, 0xFC, 0x9C, 0x9F, 0xCE, 0x81, 0xF7, 0x08, 0xFF, 0x08, 0xBF, 0x08, 0xBF, 0x09, 0xFF, 0x07, 0xFB, 0xE0, 0xBC, 0x4A, 0xF0, 0x49, 0xC0, 0xBF, 0x34, 0x3F, // 56
+			0x33, 0xBF, 0x07, 0xFF, 0xF0, 0xBF, 0xFE, 0x9E, 0x87, 0xC7, 0x07, 0xF7, 0x08, 0xF7, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x09, 0xFF, 0x08, 0xF7, 0xC0, 0xBC, 0x49, 0xF8, 0x47, 0xFC, 0x8F, 0xE7, 0x07, 0x87, 0x08, 0x87, 0x08, 0x8F, 0x07, 0x87, 0x08, 0x8F, 0x07, 0x8F, 0x80, 0x9F, 0xC0, 0x48, 0x80, 0xFF, 0x80, 0x9F, 0x38, 0x3F, // 57
+			0x2A, 0x8E, 0x4B, 0xF7, 0x2B, 0x8E, 0x4B, 0xF7, 0x23, // 58
+			0x2A, 0x8E, 0x4B, 0xF7, 0x30, 0x8E, 0xB9, 0xE7, 0x9C, 0xE3, 0x9C, 0xE1, 0x07, // 59
+			0x17, 0x3F, 0x3F, 0x81, 0x09, 0x8F, 0x08, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0x8F, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x08, 0x8F, 0x07, 0x81, 0x10, 0x3F, 0x3F, // 60
+			0x3F, 0x3F, 0x3F, 0x6F, 0x0F, 0x3F, 0x6F, 0x3F, 0x3F, 0x3F, // 61
+			0x13, 0x3F, 0x3F, 0x81, 0x0B, 0x8F, 0x0B, 0xBF, 0x0C, 0xFF, 0x0B, 0xFF, 0x0B, 0xFF, 0x0B, 0xBF, 0x0B, 0xBF, 0x09, 0x8F, 0x09, 0xBF, 0x07, 0xBF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0xBF, 0x07, 0x8F, 0x07, 0x81, 0x27, 0x3F, 0x3F, // 62
+			0x24, 0x87, 0xF8, 0xBF, 0xFC, 0x48, 0xF3, 0x83, 0xF0, 0x83, 0xE0, 0x83, 0xC0, 0x87, 0x08, 0xB8, 0x81, 0xE0, 0x87, 0x08, 0xF8, 0x83, 0xC0, 0x8F, 0x07, 0xB8, 0x81, 0xE0, 0x83, 0xC0, 0x87, 0x2B, 0x81, 0x80, 0x87, 0x09, 0xF0, 0x81, 0xE0, 0x81, 0x21, 0x3F, // 63
+			0x24, 0x3F, 0x48, 0x11, 0x4D, 0x0D, 0x51, 0x09, 0xBF, 0x80, 0xBF, 0xC0, 0x9F, 0x80, 0x81, 0xF8, 0x8F, 0x0E, 0xBC, 0x8F, 0x0E, 0x8F, 0x87, 0x80, 0xFF, 0xE1, 0xF3, 0xE0, 0x47, 0xF8, 0xB9, 0xE0, 0x47, 0xFC, 0x9C, 0xF0, 0xFC, 0x87, 0x83, 0xF8, 0x9C, 0x81, 0xE0, 0xFE, 0x8F, 0x07, 0xF0, 0xBF, 0x87, 0x08, 0xF0, 0xBF, 0x87, 0x08, 0xF0, 0xBF, 0x87, 0x08, 0xF0, 0xBF, 0x87, 0x80, 0x9C, 0x8F, 0xE1, 0xF0, 0x87, 0x87, 0xB8, 0x9C, 0x81, 0xE1, 0xE7, 0x87, 0xE0, 0xB8, 0xF9, 0xE0, 0x50, 0xE3, 0xE0, 0x4D, 0xF0, 0xB8, 0x87, 0xF9, 0xF8, 0x8F, 0x17, 0x8F, 0x18, 0x9F, 0x15, 0x87, 0xF8, 0x81, 0x0D, 0x4F, 0x0F, 0x4D, 0x12, 0x47, 0xE0, 0x3F, // 64
+			0x0D, 0x3F, 0x87, 0x11, 0x9F, 0x10, 0x9F, 0x10, 0xBF, 0x11, 0xF7, 0x10, 0xF7, 0x0A, 0x83, 0xE7, 0x09, 0x83, 0xC7, 0x0A, 0x87, 0x8F, 0x09, 0x8E, 0x87, 0x0A, 0x9C, 0x8F, 0x09, 0xBC, 0x87, 0x09, 0xB8, 0x87, 0x08, 0x9C, 0x81, 0xE0, 0x87, 0x08, 0xF0, 0x83, 0xC0, 0x87, 0x80, 0x50, 0x80, 0x50, 0xC0, 0x4B, 0xFE, 0x87, 0x09, 0x8F, 0x87, 0x09, 0x87, 0x8F, 0x08, 0x83, 0xC7, 0x09, 0x81, 0xE7, 0x0F, 0xF7, 0x0D, 0x87, 0x27, 0x3F, 0x3F, // 65
+			0x36, 0x49, 0xC0, 0x4A, 0xF0, 0x4D, 0xE7, 0x07, 0xFC, 0xF0, 0x81, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x07, 0x8E, 0xF0, 0x81, 0xF7, 0x07, 0xFC, 0x4A, 0xF8, 0x4A, 0xF0, 0x4A, 0xFC, 0xF0, 0x83, 0xF7, 0x0A, 0xF7, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x07, 0x8F, 0xF0, 0x81, 0xF7, 0x07, 0xFE, 0x4A, 0xFC, 0x4B, 0xF0, 0x47, 0xF0, 0x3F, 0x3F, // 66
+			0x80, 0x39, 0x47, 0x08, 0x49, 0xF0, 0x4C, 0xE3, 0xF8, 0x8E, 0x9F, 0x09, 0x87, 0x0B, 0x8F, 0x0A, 0x87, 0x0B, 0x87, 0x0A, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0C, 0x8F, 0x0B, 0x87, 0x0C, 0x8F, 0x0B, 0x87, 0x0C, 0x8F, 0x0D, 0x9F, 0x07, 0xE0, 0x4C, 0xE0, 0x4D, 0x07, 0x47, 0x07, 0x3F, 0x3F, // 67
+			0x3F, 0x4A, 0x08, 0x4D, 0xC0, 0x49, 0xFE, 0x87, 0x80, 0xBF, 0xC7, 0x80, 0x87, 0xC7, 0x80, 0x83, 0xE7, 0x80, 0x81, 0xF7, 0x0D, 0xF7, 0x0D, 0xF7, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xBF, 0x0D, 0xF7, 0x0D, 0xF7, 0x80, 0x81, 0xF7, 0x80, 0x83, 0xE7, 0x0A, 0xF8, 0xF0, 0x87, 0xF8, 0x4D, 0xE0, 0x4E, 0x80, 0x49, 0x1C, 0x3F, 0x3F, // 68
+			0x32, 0x49, 0xFE, 0x49, 0xFE, 0x4C, 0xF7, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x0D, 0x49, 0xFC, 0x49, 0xFC, 0x4C, 0xE7, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x0D, 0x72, 0x36, 0x3F, // 69
+			0x2C, 0x6F, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x0B, 0x47, 0xFE, 0x47, 0xFE, 0x4A, 0xF7, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x34, 0x3F, // 70
+			0x80, 0x39, 0x47, 0x08, 0x49, 0xF0, 0x4B, 0xF1, 0xF8, 0x87, 0x8F, 0x0A, 0x87, 0x0B, 0x8F, 0x0A, 0x87, 0x0B, 0x8F, 0x0A, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0xBF, 0x0B, 0xBF, 0x0C, 0xFF, 0x0A, 0xBB, 0xC0, 0x81, 0xEF, 0x0A, 0xF3, 0xC0, 0x83, 0xCF, 0x80, 0x8E, 0x9F, 0x07, 0xF0, 0x4C, 0xE0, 0x4D, 0x07, 0x47, 0x07, 0x3F, 0x3F, // 71
+			0x34, 0x87, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0C, 0x7E, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x80, 0x81, 0xE0, 0x3F, 0x3F, // 72
+			0x08, 0x4A, 0x7F, 0x14, // 73
+			0x34, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x09, 0xBD, 0x80, 0x9C, 0xF0, 0x9E, 0x48, 0xF8, 0x49, 0xC0, 0xFF, 0x2D, 0x3F, // 74
+			0x35, 0x81, 0xE0, 0x81, 0xF3, 0xC0, 0x87, 0xC7, 0x07, 0xBC, 0x9C, 0x81, 0xF0, 0xB8, 0x87, 0xC0, 0xF0, 0x9E, 0x81, 0xE0, 0xF8, 0x83, 0xC3, 0xE0, 0x87, 0x8F, 0x09, 0xF3, 0xE0, 0x81, 0xEF, 0x0A, 0xBF, 0x0D, 0x47, 0x80, 0x83, 0xDF, 0x0A, 0xF3, 0xF0, 0x81, 0xE1, 0xF0, 0x83, 0xC1, 0xF0, 0x87, 0x81, 0xF8, 0x8E, 0x81, 0xF8, 0x9C, 0x81, 0xF8, 0xB8, 0x81, 0xF8, 0xF0, 0x81, 0xF1, 0xE0, 0x81, 0xF3, 0xC0, 0x81, 0xF7, 0x09, 0x8F, 0x0B, 0x3F, 0x3F, // 75
+			0x28, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x0B, 0x6C, 0x28, 0x3F, // 76
+			0x0E, 0x3F, 0x87, 0x0D, 0x8E, 0x8F, 0x0C, 0x9E, 0x8F, 0x0D, 0xBC, 0x9F, 0x0C, 0xFC, 0xBF, 0x0B, 0xBE, 0x9F, 0xE0, 0x81, 0xFE, 0xBF, 0xC0, 0x83, 0xFC, 0xF7, 0xC0, 0x8F, 0xB9, 0xE7, 0x80, 0x9C, 0xF3, 0xCF, 0x80, 0xF9, 0xE7, 0x8E, 0x81, 0xE3, 0xCE, 0x9C, 0x83, 0xC7, 0x9C, 0x9C, 0x8E, 0x8E, 0xB8, 0xB8, 0x9C, 0x9C, 0xF0, 0xB8, 0xF0, 0xB9, 0xE0, 0xF1, 0xE0, 0xF7, 0xC0, 0xE3, 0x81, 0xEE, 0x81, 0xEE, 0x81, 0xFC, 0x81, 0xDC, 0x83, 0xF8, 0x83, 0xF0, 0x87, 0xF0, 0x87, 0xE0, 0x8F, 0xE0, 0x87, 0x07, 0xBF, 0x13, 0xBF, 0x13, 0xBF, 0x10, 0x87, 0x3C, 0x3F, 0x3F, // 77
+			0x37, 0x87, 0x0D, 0xFF, 0x0C, 0x47, 0x0B, 0x48, 0x0A, 0x48, 0x0A, 0xFF, 0xF0, 0x81, 0xFD, 0xF0, 0x83, 0xF9, 0xF0, 0x87, 0xF1, 0xF0, 0x8F, 0xE1, 0xF0, 0x9F, 0xC3, 0xE0, 0xBF, 0x83, 0xE0, 0xFE, 0x83, 0xE1, 0xFC, 0x83, 0xE3, 0xF8, 0x83, 0xC7, 0xF0, 0x83, 0xCF, 0xE0, 0x87, 0xDF, 0xC0, 0x87, 0xBF, 0x0A, 0x48, 0x0B, 0x47, 0x0B, 0x47, 0x0C, 0xFF, 0x0C, 0xBF, 0x0C, 0xBF, 0x09, 0x83, 0x0B, 0x3F, 0x3F, // 78
+			0x0F, 0x3F, 0x47, 0x0D, 0x4B, 0x09, 0x4F, 0x80, 0xFE, 0x83, 0xF8, 0x9F, 0x08, 0xBE, 0x8F, 0x08, 0x8F, 0x8F, 0x08, 0x83, 0xE7, 0x09, 0x81, 0xE7, 0x0F, 0xFF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x11, 0xF7, 0x09, 0x81, 0xF7, 0x0A, 0x83, 0xCF, 0x0A, 0x8F, 0x8F, 0x0A, 0xBC, 0x9F, 0x09, 0xFC, 0x8F, 0xE0, 0xBF, 0x80, 0x4F, 0x09, 0x4B, 0x0D, 0x47, 0x2F, 0x3F, 0x3F, // 79
+			0x36, 0x49, 0xC0, 0x4A, 0xF0, 0x4D, 0xE7, 0x07, 0xFE, 0xF0, 0x81, 0xF7, 0x0A, 0xFF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x0A, 0xBF, 0x07, 0x8F, 0xF0, 0x81, 0xF7, 0x07, 0xFE, 0x4A, 0xFC, 0x4A, 0xF0, 0xFF, 0xF8, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0C, 0x3F, 0x3F, // 80
+			0x0F, 0x3F, 0x47, 0x0D, 0x4B, 0x09, 0x4F, 0x80, 0xFE, 0x83, 0xF8, 0x9F, 0x08, 0xBE, 0x8F, 0x08, 0x8F, 0x8F, 0x08, 0x83, 0xE7, 0x09, 0x81, 0xE7, 0x0F, 0xFF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x10, 0xBF, 0x11, 0xFF, 0x09, 0x81, 0xE7, 0x0A, 0x83, 0xCF, 0x0A, 0x8F, 0x8F, 0x0A, 0xBC, 0x9F, 0x09, 0xF8, 0x8F, 0xE0, 0xBF, 0x80, 0x4E, 0x0A, 0x4B, 0x0D, 0xFF, 0x0F, 0x87, 0x11, 0x8F, 0x11, 0x8F, 0x13, 0xBF, 0x12, 0x47, 0x0F, 0x9F, 0x13, 0x98, // 81
+			0x39, 0x49, 0x07, 0x4B, 0xE0, 0x4C, 0xE1, 0xE0, 0x8F, 0xC7, 0x09, 0xF1, 0xE0, 0x81, 0xE7, 0x09, 0xB9, 0xE0, 0x81, 0xE7, 0x09, 0xB9, 0xE0, 0x81, 0xE7, 0x80, 0x8E, 0x9C, 0x81, 0xF8, 0x4B, 0xF0, 0x4B, 0xE0, 0x4A, 0xC0, 0xB8, 0x8F, 0x81, 0xE0, 0x9E, 0x87, 0x07, 0xF0, 0xB8, 0x83, 0xE1, 0xE0, 0x87, 0xC7, 0x09, 0xF1, 0xE0, 0x83, 0xE7, 0x09, 0xB9, 0xE0, 0x81, 0xF7, 0x80, 0x83, 0xE0, 0x3F, 0x3F, // 82
+			0x38, 0xFF, 0x07, 0x47, 0xF8, 0x48, 0xFC, 0xBC, 0x83, 0x8F, 0x08, 0x87, 0x09, 0x87, 0x09, 0x87, 0x0A, 0x8F, 0x0A, 0x8F, 0x0B, 0xBF, 0x0B, 0xFF, 0x0B, 0x47, 0x0A, 0xFF, 0x0B, 0xBF, 0x09, 0x8F, 0x0A, 0x8F, 0x09, 0x87, 0x09, 0x87, 0x09, 0x87, 0x0C, 0xFB, 0xC0, 0x9E, 0x4A, 0xFC, 0x4C, 0x80, 0x47, 0x3B, 0x3F, // 83
+			0x38, 0x75, 0xF0, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0B, 0x87, 0x0C, 0x3F, 0x3F, // 84
+			0x34, 0x87, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0B, 0xBF, 0x0C, 0xFF, 0x0A, 0xFB, 0xC0, 0x83, 0xCF, 0x07, 0xBC, 0xBE, 0x87, 0xE0, 0x4C, 0x80, 0x4A, 0x09, 0xFF, 0x0A, 0x3F, 0x3F, // 85
+			0x80, 0x39, 0x87, 0x10, 0xF7, 0x08, 0x81, 0xE7, 0x08, 0x81, 0xE7, 0x09, 0x83, 0xC7, 0x08, 0x87, 0x87, 0x09, 0x8E, 0x8F, 0x08, 0x9E, 0x87, 0x08, 0x9C, 0x87, 0x09, 0xB8, 0x8F, 0x08, 0xF8, 0x87, 0x80, 0x9C, 0x81, 0xF0, 0x8F, 0x07, 0xB8, 0x87, 0x08, 0xB8, 0x87, 0x08, 0xBC, 0x8F, 0x07, 0x8E, 0x87, 0x08, 0x8F, 0x8F, 0x07, 0x83, 0xC7, 0x08, 0x83, 0xC7, 0x0E, 0xF7, 0x0F, 0xF7, 0x0F, 0xFF, 0x0E, 0x9F, 0x0F, 0x9F, 0x0E, 0x87, 0x2A, 0x3F, 0x3F, // 86
+			0x1B, 0x3F, 0x87, 0x18, 0xBF, 0x19, 0xFF, 0x11, 0x81, 0xF7, 0x0A, 0xF0, 0x81, 0xE7, 0x07, 0x8F, 0x07, 0xB9, 0xE0, 0x81, 0xF0, 0x83, 0xCF, 0x80, 0x9F, 0x07, 0xB8, 0xF0, 0x83, 0xF0, 0x83, 0xC7, 0x80, 0xBB, 0xC0, 0xBC, 0xB8, 0x83, 0xDC, 0x83, 0xC3, 0xE0, 0x9D, 0xF0, 0x9C, 0x9E, 0x83, 0xC7, 0x81, 0xE0, 0xF0, 0x9C, 0xB8, 0x9E, 0x87, 0x83, 0xE3, 0xE1, 0xF0, 0xBC, 0x9C, 0x8E, 0x8E, 0x81, 0xE1, 0xE0, 0xF0, 0xF0, 0x8E, 0x9C, 0x87, 0xC7, 0x80, 0xF1, 0xE0, 0x9C, 0xF8, 0x87, 0xDE, 0x81, 0xF7, 0x08, 0xF7, 0x08, 0xF7, 0x08, 0xF7, 0x08, 0xF7, 0x07, 0xBF, 0x09, 0xFF, 0x07, 0x9F, 0x08, 0x9F, 0x08, 0x9F, 0x08, 0x9F, 0x07, 0x8F, 0x09, 0x8F, 0x24, 0x3F, 0x3F, 0x3F, // 87
+			0x3B, 0x8F, 0x80, 0x83, 0xE7, 0x07, 0x87, 0x87, 0x07, 0x9C, 0x8F, 0x07, 0xF8, 0x8F, 0x80, 0xF0, 0x87, 0x81, 0xE0, 0x87, 0xC3, 0xE0, 0x83, 0xE3, 0xC0, 0x81, 0xE7, 0x0D, 0xFF, 0x0C, 0xBF, 0x0C, 0x8F, 0x0D, 0x8F, 0x0E, 0x9F, 0x0E, 0xFF, 0x80, 0x81, 0xF7, 0x07, 0x87, 0xC7, 0x07, 0x8E, 0x8F, 0x08, 0xF8, 0x9E, 0x81, 0xF0, 0x8E, 0x81, 0xE0, 0x87, 0x83, 0xE0, 0x87, 0xC7, 0xC0, 0x83, 0xC7, 0x80, 0x81, 0xEF, 0x09, 0x8F, 0x12, 0x3F, 0x3F, // 88
+			0x3B, 0x8F, 0x80, 0x81, 0xF7, 0x07, 0x83, 0xCF, 0x80, 0x87, 0xC7, 0x07, 0x8E, 0x87, 0x80, 0x9C, 0x87, 0x08, 0xF0, 0x8E, 0x81, 0xE0, 0x8F, 0x83, 0xE0, 0x87, 0x83, 0xC0, 0x83, 0xC7, 0x80, 0x83, 0xEF, 0x0C, 0xF7, 0x0D, 0xFF, 0x0C, 0x9F, 0x0C, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x0D, 0x87, 0x1B, 0x3F, 0x3F, // 89
+			0x39, 0x4B, 0xFE, 0x4B, 0xFE, 0x51, 0x0B, 0x8F, 0x0A, 0x8F, 0x0A, 0x8F, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0B, 0x8F, 0x0A, 0x8F, 0x0A, 0x87, 0x0A, 0x87, 0x0A, 0x87, 0x0B, 0x8F, 0x0A, 0x87, 0x0A, 0x87, 0x0B, 0x8F, 0x0A, 0x87, 0x0A, 0x87, 0x0B, 0x8F, 0x0D, 0x76, 0xE0, 0x3F, 0x3F, // 90
+			0x5C, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0x5A, // 91
+			0xE0, 0x80, 0xF0, 0x80, 0xF0, 0x80, 0xF0, 0x80, 0xB8, 0x80, 0xB8, 0x80, 0xB8, 0x80, 0x9C, 0x80, 0x9C, 0x80, 0x8E, 0x80, 0x8E, 0x80, 0x8E, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x07, 0x8F, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0x83, // 92
+			0x59, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0xF0, 0x9C, 0x87, 0x81, 0xE0, 0xB8, 0x8E, 0x83, 0xC0, 0x5D, // 93
+			0x35, 0x87, 0x0A, 0x9F, 0x09, 0x9F, 0x07, 0x8E, 0xF0, 0x83, 0xEF, 0x07, 0xF1, 0xE0, 0x9E, 0x9E, 0x83, 0xC1, 0xE0, 0xF8, 0x9E, 0x8E, 0x81, 0xE3, 0xE0, 0x9E, 0xB8, 0x81, 0xEF, 0x80, 0x9E, 0xA0, 0x81, 0x33, 0x3F, 0x3F, 0x3F, 0x3F, // 94
+			0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x75, // 95
+			0xA1, 0xE3, 0xE3, 0xE3, 0xE3, 0xC2, 0x27, 0x3F, 0x3F, // 96
+			0x3F, 0x3F, 0xBF, 0xC0, 0xFF, 0xF0, 0x4A, 0x88, 0x8F, 0x07, 0x8F, 0x80, 0x87, 0x07, 0x8E, 0x8F, 0xFE, 0xBF, 0xFE, 0x4D, 0xF8, 0x8F, 0xE0, 0x8F, 0xE0, 0x8F, 0xE0, 0x8F, 0xE0, 0x8F, 0xF8, 0x8E, 0x47, 0xFC, 0x48, 0xF0, 0x48, 0x22, 0x3F, // 97
+			0xF0, 0x80, 0x9C, 0x80, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x07, 0x83, 0xCF, 0xE0, 0x48, 0xF8, 0x48, 0xFC, 0xFC, 0x8F, 0x9C, 0x81, 0xF7, 0x08, 0xF7, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xFF, 0x08, 0xF7, 0x07, 0xFB, 0xC0, 0xBC, 0x48, 0xF8, 0x4A, 0xC0, 0x47, 0x35, 0x3F, // 98
+			0x80, 0x39, 0x3F, 0x8F, 0xF0, 0xBF, 0xF8, 0xFF, 0xF9, 0xF0, 0x93, 0xE0, 0x83, 0xC0, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x80, 0x87, 0x07, 0x87, 0x07, 0x8F, 0x0A, 0xF8, 0x84, 0x48, 0xF0, 0x48, 0xC0, 0xFF, 0x22, 0x3F, // 99
+			0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x80, 0x81, 0xE0, 0xFE, 0xB8, 0x47, 0xFC, 0x4D, 0x9E, 0x87, 0xEF, 0x07, 0xF7, 0x07, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x09, 0xFF, 0x80, 0x9D, 0xE0, 0x87, 0xBC, 0x81, 0xE7, 0xC0, 0xB8, 0x49, 0xF0, 0x4A, 0xC0, 0x47, 0x31, 0x3F, // 100
+			0x13, 0x3F, 0x3F, 0x9F, 0x08, 0xFF, 0xE0, 0x47, 0xF8, 0xBC, 0x8F, 0x9C, 0x81, 0xE7, 0x07, 0xBF, 0x09, 0x75, 0x08, 0x87, 0x09, 0x8F, 0x08, 0x87, 0x09, 0x8F, 0x07, 0x83, 0xE0, 0x98, 0x4A, 0xE0, 0x4A, 0x80, 0xFF, 0x32, 0x3F, // 101
+			0x87, 0xF9, 0xFF, 0xDF, 0xFD, 0xF0, 0x9E, 0x81, 0xE0, 0x8E, 0x80, 0xF0, 0x87, 0x80, 0xBF, 0xFB, 0xFF, 0xDF, 0xFD, 0xE0, 0x8E, 0x80, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x14, 0x3F, // 102
+			0x15, 0x3F, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x4D, 0x9E, 0x81, 0xEF, 0x07, 0xF7, 0x07, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x07, 0x9F, 0xC0, 0x87, 0xF8, 0x81, 0xEF, 0x07, 0xF7, 0xE0, 0xFC, 0x49, 0xF8, 0x47, 0xFC, 0x8F, 0xE7, 0x08, 0x87, 0x08, 0x87, 0x08, 0x8F, 0x0B, 0xF1, 0x80, 0xFC, 0x48, 0xF8, 0x49, 0xE0, 0xBF, 0xE0, // 103
+			0xF0, 0x80, 0xB8, 0x80, 0x9C, 0x80, 0x8E, 0x80, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x80, 0x83, 0xC0, 0x81, 0xEF, 0xF0, 0x47, 0xF8, 0x4B, 0xCE, 0x81, 0xF7, 0x07, 0xF7, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x80, 0x9F, 0xC0, 0x8F, 0xE0, 0x87, 0x28, 0x3F, // 104
+			0x8F, 0x47, 0x0B, 0x78, 0x14, // 105
+			0x08, 0xF1, 0xE3, 0xC7, 0x19, 0xB8, 0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB8, 0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB8, 0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB9, 0xEF, 0xDE, 0xB8, // 106
+			0xF0, 0x80, 0xB8, 0x80, 0x9C, 0x80, 0x8E, 0x80, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x07, 0x87, 0x09, 0x9C, 0x83, 0xEE, 0x83, 0xE7, 0x83, 0xE3, 0xC3, 0xE1, 0xE3, 0xE0, 0xF3, 0xE0, 0xBB, 0xE0, 0x9F, 0xE0, 0x8F, 0xE0, 0x87, 0xF8, 0x83, 0xDE, 0x81, 0xE7, 0xC0, 0xF1, 0xF0, 0xB8, 0xBC, 0x9C, 0x8F, 0x8E, 0x83, 0xE7, 0x81, 0xF3, 0xC0, 0xBD, 0xE0, 0x8F, 0x28, 0x3F, // 107
+			0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB8, 0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB8, 0xF1, 0xE3, 0xC7, 0x8E, 0x9C, 0xB8, 0xF1, 0xE3, 0xC7, 0xCF, 0xEF, 0xC7, 0x29, // 108
+			0x1D, 0x3F, 0x3F, 0x3F, 0x83, 0xFE, 0x87, 0xF0, 0x4A, 0xDF, 0xFC, 0x52, 0xFD, 0xE0, 0xBF, 0x83, 0xEE, 0x81, 0xE0, 0x8F, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0xF0, 0x87, 0x80, 0xBF, 0x07, 0xF0, 0x87, 0x2E, 0x3F, 0x3F, // 109
+			0x07, 0x3F, 0x3F, 0xBF, 0xF0, 0x47, 0xFC, 0x4B, 0xCE, 0x81, 0xF7, 0x07, 0xF7, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x80, 0x9F, 0xC0, 0x8F, 0xE0, 0x87, 0x28, 0x3F, // 110
+			0x1C, 0x3F, 0x3F, 0x9F, 0x09, 0x47, 0xC0, 0x4A, 0xE1, 0xF0, 0xBC, 0xBC, 0x83, 0xE7, 0x08, 0xF7, 0x09, 0xBF, 0x09, 0xBF, 0x09, 0xBF, 0x09, 0xBF, 0x09, 0xBF, 0x09, 0xBF, 0x0A, 0xF7, 0x80, 0x9C, 0xF8, 0x87, 0xC7, 0xC1, 0xF0, 0x4B, 0xC0, 0x48, 0x07, 0x9F, 0x3C, 0x3F, // 111
+			0x11, 0x3F, 0x3F, 0xFF, 0xC0, 0x48, 0xF0, 0x48, 0xF8, 0xF0, 0x8F, 0x9C, 0x81, 0xF7, 0x08, 0xF7, 0x08, 0xFF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xF7, 0x07, 0xFB, 0xF0, 0xBC, 0x48, 0xFC, 0xFF, 0xFE, 0x9C, 0xFE, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x0C, // 112
+			0x15, 0x3F, 0x3F, 0xFF, 0xC0, 0x47, 0xF8, 0x4C, 0x9E, 0x81, 0xEF, 0x07, 0xF7, 0x08, 0xFF, 0x07, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x08, 0xBF, 0x07, 0x9F, 0xC0, 0x87, 0xB8, 0x81, 0xEF, 0x07, 0xF3, 0xE0, 0xFC, 0x49, 0xF8, 0x47, 0xFC, 0x8F, 0xE7, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, // 113
+			0x24, 0x3F, 0x5E, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x07, 0xF0, 0x87, 0x14, 0x3F, // 114
+			0x32, 0x3F, 0x81, 0xFE, 0x8F, 0xFE, 0xBF, 0xFD, 0xF0, 0x93, 0xC0, 0x87, 0x80, 0x8F, 0x80, 0x8F, 0x08, 0xFF, 0x80, 0xBF, 0xE0, 0x9F, 0xE0, 0x87, 0xE0, 0x87, 0xC0, 0x87, 0x07, 0x9D, 0x80, 0x49, 0xFE, 0x47, 0xF0, 0xFF, 0x1E, 0x3F, // 115
+			0x19, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xBF, 0xF7, 0xFE, 0x47, 0xDC, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8F, 0x80, 0xFF, 0xE7, 0xFC, 0xBF, 0x80, 0x3F, // 116
+			0x80, 0x3B, 0x3F, 0x87, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x07, 0xBF, 0x08, 0xFF, 0x07, 0xF7, 0x80, 0xBB, 0xE0, 0x9C, 0x48, 0xF8, 0x48, 0xF0, 0x48, 0x2A, 0x3F, // 117
+			0x14, 0x3F, 0x3F, 0x87, 0x09, 0xBF, 0xC0, 0x8F, 0xB8, 0x81, 0xE7, 0x07, 0xB9, 0xF0, 0x8F, 0x8E, 0x81, 0xE1, 0xE0, 0x9C, 0x9E, 0x87, 0xC1, 0xE0, 0xF0, 0x9C, 0x8E, 0x83, 0xE3, 0xE0, 0x9C, 0xB8, 0x83, 0xEF, 0x08, 0xF7, 0x09, 0xFF, 0x09, 0xFF, 0x08, 0x9F, 0x09, 0x9F, 0x08, 0x87, 0x3D, 0x3F, // 118
+			0x2C, 0x3F, 0x3F, 0x3F, 0x81, 0xE0, 0x87, 0x07, 0xBF, 0x08, 0xF0, 0x83, 0xDC, 0x83, 0xF0, 0x8E, 0xB8, 0x87, 0xE0, 0x9C, 0xF0, 0x8F, 0xC0, 0xB9, 0xE0, 0x9F, 0x81, 0xF1, 0xE0, 0xF7, 0x83, 0xC3, 0xC1, 0xEE, 0x87, 0x87, 0x83, 0xDC, 0x8E, 0x87, 0x8E, 0xBC, 0xB8, 0x8E, 0x9C, 0xB8, 0xF0, 0x9C, 0xB8, 0xF1, 0xE0, 0x9D, 0xF1, 0xF7, 0x07, 0xF7, 0x83, 0xDC, 0x81, 0xEE, 0x87, 0xB8, 0x81, 0xF8, 0x8F, 0xE0, 0x83, 0xF0, 0x8F, 0xC0, 0x87, 0xE0, 0x9F, 0x80, 0x87, 0x07, 0xF8, 0x3F, 0x3F, 0x3F, // 119
+			0x09, 0x3F, 0x3F, 0x81, 0xF0, 0x8F, 0x9C, 0x83, 0xC3, 0xC1, 0xE0, 0xF8, 0xF8, 0x8E, 0x9C, 0x81, 0xEF, 0x07, 0xFF, 0x07, 0x9F, 0x08, 0x9F, 0x08, 0x8F, 0x08, 0x9F, 0x07, 0x9F, 0xE0, 0x87, 0xBC, 0x83, 0xE7, 0xC1, 0xF0, 0xF0, 0xB8, 0x9E, 0x9E, 0x83, 0xE7, 0x80, 0xBB, 0xE0, 0x8F, 0x2F, 0x3F, // 120
+			0x15, 0x3F, 0x3F, 0x87, 0x08, 0xB9, 0xE0, 0x8F, 0x9C, 0x81, 0xE3, 0xC0, 0x9C, 0x9C, 0x83, 0xC3, 0xC0, 0xF0, 0xB8, 0x8E, 0x83, 0xC1, 0xE0, 0xB8, 0xB8, 0x87, 0x87, 0x07, 0xF1, 0xE0, 0x8E, 0xB8, 0x81, 0xE7, 0x09, 0xF7, 0x08, 0xBB, 0x09, 0xBF, 0x09, 0x9F, 0x08, 0x8F, 0x09, 0x8F, 0x09, 0x87, 0x09, 0x8F, 0x08, 0x87, 0x09, 0x8F, 0x80, 0x48, 0x07, 0x47, 0x07, 0xBF, 0x0A, // 121
+			0x07, 0x3F, 0x3F, 0x47, 0xFE, 0x47, 0xFE, 0x4D, 0x07, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x87, 0x80, 0x87, 0x07, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x87, 0x07, 0x8F, 0x09, 0x6C, 0x28, 0x3F, // 122
+			0x81, 0xF0, 0xBE, 0x8F, 0xE3, 0xE0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x83, 0xC1, 0xF8, 0x9E, 0x83, 0xF0, 0x8E, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xE0, 0x9F, 0xC1, 0xF8, 0x8F, // 123
+			0x68, 0x7F, // 124
+			0xF8, 0x8F, 0xC1, 0xFC, 0x83, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xB8, 0x87, 0xE0, 0xBC, 0x8F, 0xC1, 0xE0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x81, 0xE0, 0x9C, 0x83, 0xC0, 0xB8, 0x87, 0x80, 0xF0, 0x8E, 0x83, 0xE3, 0xF8, 0xBE, 0x87, 0xC0, // 125
+			0x2D, 0x3F, 0x3F, 0x3F, 0x8F, 0x80, 0xE3, 0xF8, 0x8E, 0x48, 0x8F, 0xB8, 0x47, 0xDC, 0x87, 0xF1, 0xC0, 0xBC, 0x3F, 0x3F, 0x3F, 0x3F, // 126
+			0x0D, 0x5D, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x8F, 0x09, 0x5D, 0x21, 0x3F, // 127
 		};
 	}
 }
@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 32
 		 * - last char       : 128
 		 * - number of chars : 96
-		 * - size in bytes   : 7389
+		 * - size in bytes   : 4776 (run-length encoded, 7389 raw)
 		 * 
 		 * \ingroup	font
 		 */
@@ -41,7 +41,9 @@ xpcc::GraphicDisplay::GraphicDisplay() :
 	draw(&xpcc::GraphicDisplay::setPixel),
 	foregroundColor(glcd::Color::white()),
 	backgroundColor(glcd::Color::black()),
-	font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8))
+	font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8)),
+	textCache(nullptr),
+	clipping(false)
 {
 }
 
@@ -60,7 +62,8 @@ xpcc::GraphicDisplay::setColor(const glcd::Color& newColor)
 	 * not the way it was implemented above. Maybe check if newColor equals
 	 * backgroundColor.
 	 * */
-	draw = &xpcc::GraphicDisplay::setPixel;
+	draw = this->clipping ? &xpcc::GraphicDisplay::setPixelClipped :
+			&xpcc::GraphicDisplay::setPixel;
 	this->foregroundColor = newColor;
 }
 
@@ -70,6 +73,57 @@ xpcc::GraphicDisplay::setBackgroundColor(const glcd::Color& newColor)
 	this->backgroundColor = newColor;
 }
 
+// ----------------------------------------------------------------------------
+void
+xpcc::GraphicDisplay::setClippingWindow(glcd::Point upperLeft,
+		uint16_t width, uint16_t height)
+{
+	int_fast16_t x0 = upperLeft.getX();
+	int_fast16_t y0 = upperLeft.getY();
+	int_fast16_t x1 = x0 + width;
+	int_fast16_t y1 = y0 + height;
+	if (x0 < 0) {
+		x0 = 0;
+	}
+	if (y0 < 0) {
+		y0 = 0;
+	}
+	if (x1 > static_cast<int16_t>(this->getWidth())) {
+		x1 = this->getWidth();
+	}
+	if (y1 > static_cast<int16_t>(this->getHeight())) {
+		y1 = this->getHeight();
+	}
+	// an empty window discards everything
+	if (x1 < x0) {
+		x1 = x0;
+	}
+	if (y1 < y0) {
+		y1 = y0;
+	}
+
+	this->clipStart = glcd::Point(x0, y0);
+	this->clipEnd = glcd::Point(x1, y1);
+	this->clipping = true;
+	this->draw = &xpcc::GraphicDisplay::setPixelClipped;
+}
+
+void
+xpcc::GraphicDisplay::resetClippingWindow()
+{
+	this->clipping = false;
+	this->draw = &xpcc::GraphicDisplay::setPixel;
+}
+
+void
+xpcc::GraphicDisplay::setPixelClipped(int16_t x, int16_t y)
+{
+	if (x >= this->clipStart.getX() && x < this->clipEnd.getX() &&
+		y >= this->clipStart.getY() && y < this->clipEnd.getY()) {
+		this->setPixel(x, y);
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::GraphicDisplay::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
@@ -137,8 +191,23 @@ xpcc::GraphicDisplay::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 void
 xpcc::GraphicDisplay::drawHorizontalLine(glcd::Point start, uint16_t length)
 {
-	for (int_fast16_t i = start.getX(); i < static_cast<int16_t>(start.getX() + length); ++i) {
-		(this->*draw)(i, start.getY());
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	const int16_t y = start.getY();
+	if (length == 0 || y < clipStart.getY() || y >= clipEnd.getY()) {
+		return;
+	}
+
+	int_fast16_t x0 = start.getX();
+	int_fast16_t x1 = x0 + length - 1;
+	if (x0 < clipStart.getX()) {
+		x0 = clipStart.getX();
+	}
+	if (x1 >= clipEnd.getX()) {
+		x1 = clipEnd.getX() - 1;
+	}
+	if (x0 <= x1) {
+		this->fillSpan(x0, x1, y);
 	}
 }
 
@@ -314,6 +383,14 @@ xpcc::GraphicDisplay::drawImage(glcd::Point upperLeft,
 	uint8_t width = image[0];
 	uint8_t height = image[1];
 
+	if (width == 0)
+	{
+		// run-length encoded
+		drawImageRunLength(upperLeft, image[1], image[2],
+				xpcc::accessor::Flash<uint8_t>(image.getPointer() + 3));
+		return;
+	}
+
 	drawImageRaw(upperLeft, width, height,
 			xpcc::accessor::Flash<uint8_t>(image.getPointer() + 2));
 }
@@ -323,26 +400,209 @@ xpcc::GraphicDisplay::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height,
 		xpcc::accessor::Flash<uint8_t> data)
 {
-	uint16_t rows = (height + 7) / 8;
-	for (uint16_t i = 0; i < width; i++)
+	// visible part of the image
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	const int_fast16_t x = upperLeft.getX();
+	const int_fast16_t y = upperLeft.getY();
+	const int_fast16_t left = clipStart.getX() - x;
+	const int_fast16_t top = clipStart.getY() - y;
+	const int_fast16_t iStart = (left > 0) ? left : 0;
+	const int_fast16_t kStart = (top > 0) ? top : 0;
+	int_fast16_t iEnd = width;
+	int_fast16_t kEnd = height;
+	if (x + iEnd > clipEnd.getX()) {
+		iEnd = clipEnd.getX() - x;
+	}
+	if (y + kEnd > clipEnd.getY()) {
+		kEnd = clipEnd.getY() - y;
+	}
+
+	for (int_fast16_t k = kStart; k < kEnd; ++k)
 	{
-		for (uint16_t k = 0; k < rows; k++)
+		// the image is stored in columns of eight pixels per byte
+		const uint8_t mask = 1 << (k & 0x07);
+		const uint16_t offset = (k / 8) * width;
+
+		// draw runs of pixels with the same value at once
+		int_fast16_t start = iStart;
+		bool set = (start < iEnd) && (data[offset + start] & mask);
+		for (int_fast16_t i = iStart + 1; i <= iEnd; ++i)
 		{
-			uint16_t byte = data[i + k * width];
-			uint16_t rowHeight = height - k * 8;
-			if (rowHeight > 8) {
-				rowHeight = 8;
-			}
-			for (uint16_t j = 0; j < rowHeight; j++)
+			const bool next = (i < iEnd) && (data[offset + i] & mask);
+			if (i == iEnd || next != set)
 			{
-				if (byte & 0x01) {
-					this->setPixel(upperLeft.getX() + i, upperLeft.getY() + k * 8 + j);
+				if (set) {
+					this->fillSpan(x + start, x + i - 1, y + k);
 				}
 				else {
-					this->clearPixel(upperLeft.getX() + i, upperLeft.getY() + k * 8 + j);
+					this->clearSpan(x + start, x + i - 1, y + k);
+				}
+				start = i;
+				set = next;
+			}
+		}
+	}
+}
+
+void
+xpcc::GraphicDisplay::drawImageRunLength(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data)
+{
+	// visible part of the image
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	const int_fast16_t x = upperLeft.getX();
+	const int_fast16_t y = upperLeft.getY();
+	const int_fast16_t left = clipStart.getX() - x;
+	const int_fast16_t iStart = (left > 0) ? left : 0;
+	const int_fast16_t yStart = clipStart.getY();
+	int_fast16_t iEnd = width;
+	int_fast16_t kEnd = height;
+	if (x + iEnd > clipEnd.getX()) {
+		iEnd = clipEnd.getX() - x;
+	}
+	if (y + kEnd > clipEnd.getY()) {
+		kEnd = clipEnd.getY() - y;
+	}
+	if (iStart >= iEnd || y + kEnd <= yStart) {
+		return;
+	}
+
+	// draws the visible part of the pixels [begin, end) of row k
+	auto draw = [this, x, y, yStart, iStart, iEnd](int_fast16_t begin,
+			int_fast16_t end, int_fast16_t k, bool set)
+	{
+		if (y + k < yStart) {
+			return;
+		}
+		if (begin < iStart) {
+			begin = iStart;
+		}
+		if (end > iEnd) {
+			end = iEnd;
+		}
+		if (begin < end)
+		{
+			if (set) {
+				this->fillSpan(x + begin, x + end - 1, y + k);
+			}
+			else {
+				this->clearSpan(x + begin, x + end - 1, y + k);
+			}
+		}
+	};
+
+	glcd::RunLengthDecoder decoder(data);
+
+	// pixels [start, i) of row k have the value of set and are not drawn yet
+	int_fast16_t i = 0;
+	int_fast16_t k = 0;
+	int_fast16_t start = 0;
+	bool set = false;
+	while (k < kEnd)
+	{
+		bool value;
+		int_fast16_t length = decoder.next(value);
+		while (length > 0)
+		{
+			if (value != set)
+			{
+				draw(start, i, k, set);
+				start = i;
+				set = value;
+			}
+
+			// a run may continue in the next row
+			const int_fast16_t pixels = (length < width - i) ? length : width - i;
+			i += pixels;
+			length -= pixels;
+			if (i == width)
+			{
+				draw(start, i, k, set);
+				i = 0;
+				start = 0;
+				if (++k == kEnd) {
+					return;
 				}
-				byte >>= 1;
 			}
 		}
 	}
 }
+
+namespace
+{
+	// number of leading ones of the word, 0..32
+	inline uint_fast8_t
+	countLeadingOnes(uint32_t word)
+	{
+		word = ~word;
+		if (word == 0) {
+			return 32;
+		}
+		return (sizeof(unsigned int) >= sizeof(uint32_t)) ?
+				__builtin_clz(word) - (sizeof(unsigned int) - sizeof(uint32_t)) * 8 :
+				__builtin_clzl(word) - (sizeof(unsigned long) - sizeof(uint32_t)) * 8;
+	}
+}
+
+void
+xpcc::GraphicDisplay::drawBitmap(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		const uint32_t* data)
+{
+	// visible part of the bitmap
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	const int_fast16_t x = upperLeft.getX();
+	const int_fast16_t y = upperLeft.getY();
+	const int_fast16_t left = clipStart.getX() - x;
+	const int_fast16_t top = clipStart.getY() - y;
+	const int_fast16_t iStart = (left > 0) ? left : 0;
+	const int_fast16_t kStart = (top > 0) ? top : 0;
+	int_fast16_t iEnd = width;
+	int_fast16_t kEnd = height;
+	if (x + iEnd > clipEnd.getX()) {
+		iEnd = clipEnd.getX() - x;
+	}
+	if (y + kEnd > clipEnd.getY()) {
+		kEnd = clipEnd.getY() - y;
+	}
+
+	const uint16_t stride = (width + 31) / 32;
+	for (int_fast16_t k = kStart; k < kEnd; ++k)
+	{
+		const uint32_t* row = data + uint32_t(k) * stride;
+
+		// find the end of every run of equal bits, 32 bits at once
+		int_fast16_t i = iStart;
+		while (i < iEnd)
+		{
+			const bool set = (row[i / 32] << (i % 32)) & 0x80000000;
+			int_fast16_t end = i;
+			while (end < iEnd)
+			{
+				const uint_fast8_t shift = end % 32;
+				const uint32_t word = set ? row[end / 32] : ~row[end / 32];
+				// the bits shifted in are zero, so the run stops there
+				const uint_fast8_t ones = countLeadingOnes(word << shift);
+				end += ones;
+				if (ones < 32 - shift) {
+					break;
+				}
+			}
+			if (end > iEnd) {
+				end = iEnd;
+			}
+
+			if (set) {
+				this->fillSpan(x + i, x + end - 1, y + k);
+			}
+			else {
+				this->clearSpan(x + i, x + end - 1, y + k);
+			}
+			i = end;
+		}
+	}
+}
@@ -38,6 +38,8 @@
 #include <xpcc/io/iostream.hpp>
 
 #include "font.hpp"
+#include "run_length_decoder.hpp"
+#include "text_cache.hpp"
 
 namespace xpcc
 {
@@ -229,10 +231,44 @@ namespace xpcc
 		//void
 		//setViewport();
 
-		// TODO Set a clipping area
-		// Everything drawn outside this area will be discarded.
-		//void
-		//setClippingWindow();
+		/**
+		 * Set a clipping window.
+		 *
+		 * Everything drawn outside this area will be discarded, the
+		 * coordinate system is not changed. The window is limited to the
+		 * display. Used by the GUI to redraw only the damaged part of a
+		 * widget.
+		 *
+		 * \see	resetClippingWindow()
+		 */
+		void
+		setClippingWindow(glcd::Point upperLeft, uint16_t width, uint16_t height);
+
+		/// Allow drawing on the complete display again (the default)
+		void
+		resetClippingWindow();
+
+		/// Upper left corner of the clipping window
+		xpcc_always_inline glcd::Point
+		getClippingWindowStart() const
+		{
+			return this->clipping ? this->clipStart : glcd::Point(0, 0);
+		}
+
+		/// First pixel right of and below the clipping window
+		xpcc_always_inline glcd::Point
+		getClippingWindowEnd() const
+		{
+			return this->clipping ? this->clipEnd :
+					glcd::Point(this->getWidth(), this->getHeight());
+		}
+
+		/// \c true if a clipping window is set
+		inline bool
+		isClipped() const
+		{
+			return this->clipping;
+		}
 
 		/**
 		 * Draw a pixel in currently active foreground color.
@@ -324,10 +360,15 @@ namespace xpcc
 		 * The first byte in the image data specifies the with, the second
 		 * byte the height. Afterwards the actual image data.
 		 *
+		 * Run-length encoded images start with a zero, followed by the
+		 * width, the height and the encoded data, see
+		 * glcd::RunLengthDecoder.
+		 *
 		 * \param upperLeft		Upper left corner
 		 * \param image			Image data
 		 *
-		 * \see	drawImage()
+		 * \see	drawImageRaw()
+		 * \see	drawImageRunLength()
 		 */
 		void
 		drawImage(glcd::Point upperLeft, xpcc::accessor::Flash<uint8_t> image);
@@ -336,12 +377,44 @@ namespace xpcc
 		 * Draw an image.
 		 *
 		 * \p data is the actual image data without any size information.
+		 *
+		 * Every row of the image is drawn as runs of set and cleared
+		 * pixels with fillSpan() and clearSpan(). Displays which can copy
+		 * the image directly into their memory override this method.
 		 */
 		virtual void
 		drawImageRaw(glcd::Point upperLeft,
 				uint16_t width, uint16_t height,
 				xpcc::accessor::Flash<uint8_t> data);
 
+		/**
+		 * Draw a run-length encoded image.
+		 *
+		 * \p data is the encoded image without any size information. The
+		 * runs are drawn with fillSpan() and clearSpan() while decoding,
+		 * so no memory is needed for the decompressed image.
+		 *
+		 * \see	glcd::RunLengthDecoder
+		 */
+		void
+		drawImageRunLength(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data);
+
+		/**
+		 * Draw a bitmap in the format of glcd::Bitmap.
+		 *
+		 * Set bits are drawn in the foreground color, cleared bits in the
+		 * background color. Every row is drawn as runs of pixels with
+		 * fillSpan() and clearSpan(), like drawImageRaw().
+		 *
+		 * \param	data	\p height rows of (\p width + 31) / 32 words
+		 */
+		virtual void
+		drawBitmap(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				const uint32_t* data);
+
 		/**
 		 * Fill a rectangle.
 		 */
@@ -391,8 +464,11 @@ namespace xpcc
 		getFontHeight(const xpcc::accessor::Flash<uint8_t> *font);
 
 		/**
-		* Get the width of (null terminated) string.
-		*/
+		 * Get the width of (null terminated) string.
+		 *
+		 * Characters which are not part of the font are skipped, for
+		 * several lines the width of the widest line is returned.
+		 */
 		uint16_t
 		getStringWidth(const char* s) const;
 
@@ -446,17 +522,84 @@ namespace xpcc
 		void
 		write(char c);
 
+		/**
+		 * Draw a text with its upper left corner at \p position.
+		 *
+		 * Like setCursor() followed by `operator <<`, except that the
+		 * spacing between the glyphs is cleared as well and that a new
+		 * line starts again at the x-position of \p position. The cursor
+		 * is left behind the text.
+		 *
+		 * With a text cache every line is cached as a whole, so this is
+		 * intended for static labels.
+		 */
+		void
+		drawText(glcd::Point position, const char* text);
+
+		/**
+		 * Use pre-rendered glyphs and lines from \p cache for all text
+		 * output.
+		 *
+		 * The cache can be shared by several displays. \c nullptr (the
+		 * default) draws the glyphs directly from the font.
+		 *
+		 * \see	glcd::TextCache
+		 */
+		inline void
+		setTextCache(glcd::TextCache* cache)
+		{
+			this->textCache = cache;
+		}
+
+		inline glcd::TextCache*
+		getTextCache() const
+		{
+			return this->textCache;
+		}
+
 	protected:
 		/// helper method for drawCircle() and drawEllipse()
 		void
 		drawCircle4(glcd::Point center, int16_t x, int16_t y);
 
+		/// helper method for drawText(), draws \p length characters
+		void
+		drawTextLine(const char* text, uint16_t length);
+
 		virtual void
 		drawHorizontalLine(glcd::Point start, uint16_t length);
 
 		virtual void
 		drawVerticalLine(glcd::Point start, uint16_t length);
 
+		/**
+		 * Set the pixels from \p x0 to \p x1 (both inclusive) in row \p y.
+		 *
+		 * The coordinates are already clipped to the display and the
+		 * clipping window: 0 <= x0 <= x1 < getWidth() and
+		 * 0 <= y < getHeight(). The default
+		 * implementation draws every pixel on its own, displays should
+		 * override it with a faster version (e.g. a block transfer or
+		 * word-wide writes to the frame buffer).
+		 *
+		 * Used by fillRectangle(), drawHorizontalLine() and drawImageRaw().
+		 */
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		/// Clear the pixels from \p x0 to \p x1 in row \p y, see fillSpan()
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
+		/**
+		 * Set all pixels from \p x0|\p y0 to \p x1|\p y1 (all inclusive).
+		 *
+		 * The coordinates are clipped like for fillSpan(). The default
+		 * implementation calls fillSpan() for every row.
+		 */
+		virtual void
+		fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
 		virtual void
 		setPixel(int16_t x, int16_t y) = 0;
 
@@ -466,6 +609,10 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y) = 0;
 
+		/// setPixel() for pixels inside the clipping window only
+		void
+		setPixelClipped(int16_t x, int16_t y);
+
 	protected:
 		// Interface class for the IOStream
 		class Writer : public IODevice
@@ -504,6 +651,11 @@ namespace xpcc
 		glcd::Color backgroundColor;
 		xpcc::accessor::Flash<uint8_t> font;
 		glcd::Point cursor;
+		glcd::TextCache* textCache;
+
+		bool clipping;
+		glcd::Point clipStart;
+		glcd::Point clipEnd;	// exclusive
 	};
 }
 
@@ -35,16 +35,32 @@ void
 xpcc::GraphicDisplay::fillRectangle(glcd::Point upperLeft,
 		uint16_t width, uint16_t height)
 {
-	for (uint16_t i = upperLeft.getX();
-			(i < upperLeft.getX() + width) && (i < getWidth());
-			++i)
-	{
-		for (uint16_t k = upperLeft.getY();
-				(k < upperLeft.getY() + height) && (k < getHeight());
-				++k)
-		{
-			(this->*draw)(i, k);
-		}
+	if (width == 0 || height == 0) {
+		return;
+	}
+
+	// clip to the display and the clipping window
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	int_fast16_t x0 = upperLeft.getX();
+	int_fast16_t y0 = upperLeft.getY();
+	int_fast16_t x1 = x0 + width - 1;
+	int_fast16_t y1 = y0 + height - 1;
+	if (x0 < clipStart.getX()) {
+		x0 = clipStart.getX();
+	}
+	if (y0 < clipStart.getY()) {
+		y0 = clipStart.getY();
+	}
+	if (x1 >= clipEnd.getX()) {
+		x1 = clipEnd.getX() - 1;
+	}
+	if (y1 >= clipEnd.getY()) {
+		y1 = clipEnd.getY() - 1;
+	}
+
+	if (x0 <= x1 && y0 <= y1) {
+		this->fillArea(x0, y0, x1, y1);
 	}
 }
 
@@ -77,3 +93,28 @@ xpcc::GraphicDisplay::fillCircle(glcd::Point center, uint16_t radius)
 		this->drawVerticalLine(glcd::Point(center.getX() - y, center.getY() - x), 2 * x);
 	}
 }
+
+// ----------------------------------------------------------------------------
+void
+xpcc::GraphicDisplay::fillSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	for (int_fast16_t x = x0; x <= x1; ++x) {
+		(this->*draw)(x, y);
+	}
+}
+
+void
+xpcc::GraphicDisplay::clearSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	for (int_fast16_t x = x0; x <= x1; ++x) {
+		this->clearPixel(x, y);
+	}
+}
+
+void
+xpcc::GraphicDisplay::fillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	for (int_fast16_t y = y0; y <= y1; ++y) {
+		this->fillSpan(x0, x1, y);
+	}
+}
@@ -63,13 +63,30 @@ xpcc::GraphicDisplay::getStringWidth(const char* s, const xpcc::accessor::Flash<
 	const uint8_t offsetWidthTable 	= 8;
 	const uint8_t vspace 			= (*font)[5];
 	const uint8_t first 			= (*font)[6];
+	const uint8_t count 			= (*font)[7];
 
 	uint16_t width = 0;
+	uint16_t lineWidth = 0;
 
-	while(*s) {
-		width += (*font)[offsetWidthTable + (static_cast<uint8_t>(*s) - first)];
-		width += vspace;
-		s++;
+	for (; *s; s++)
+	{
+		const uint8_t character = static_cast<uint8_t>(*s);
+		if (character == '\n') {
+			lineWidth = 0;
+			continue;
+		}
+		if (character >= (first + count) || character < first) {
+			// skipped by write()
+			continue;
+		}
+
+		lineWidth += (*font)[offsetWidthTable + (character - first)];
+		if (character < 128) {
+			lineWidth += vspace;
+		}
+		if (lineWidth > width) {
+			width = lineWidth;
+		}
 	}
 
 	return width;
@@ -100,19 +117,45 @@ xpcc::GraphicDisplay::write(char c)
 		return;
 	}
 	
+	if (this->textCache)
+	{
+		const glcd::Bitmap glyph = this->textCache->getGlyph(this->font, c);
+		if (glyph.isValid())
+		{
+			this->drawBitmap(cursor, glyph.width, glyph.height, glyph.data);
+			cursor.setX(cursor.getX() + glyph.width + ((character < 128) ? vspace : 0));
+			return;
+		}
+	}
+	
 	const uint8_t offsetWidthTable = 8;
 	
-	uint16_t offset = count + offsetWidthTable;
 	uint8_t position = character - first + offsetWidthTable;
-	const uint8_t usedRows = (height + 7) / 8;	// round up
-	for (uint8_t i = offsetWidthTable; i < position; i++)
-	{
-		offset += font[i] * usedRows;
-	}
 	uint8_t width = font[position];
 	
-	this->drawImageRaw(cursor, width, height,
-			accessor::asFlash(font.getPointer() + offset));
+	if (font[2] == 0)
+	{
+		// run-length encoded, the width table is followed by a table
+		// with the offset of every glyph
+		const uint16_t table = offsetWidthTable + count + (character - first) * 2;
+		const uint16_t offset = offsetWidthTable + count * 3 +
+				(font[table] | (font[table + 1] << 8));
+		
+		this->drawImageRunLength(cursor, width, height,
+				accessor::asFlash(font.getPointer() + offset));
+	}
+	else
+	{
+		uint16_t offset = count + offsetWidthTable;
+		const uint8_t usedRows = (height + 7) / 8;	// round up
+		for (uint8_t i = offsetWidthTable; i < position; i++)
+		{
+			offset += font[i] * usedRows;
+		}
+		
+		this->drawImageRaw(cursor, width, height,
+				accessor::asFlash(font.getPointer() + offset));
+	}
 	
 	cursor.setX(cursor.getX() + width);
 	
@@ -132,6 +175,80 @@ xpcc::GraphicDisplay::write(char c)
 	}
 }
 
+// ----------------------------------------------------------------------------
+void
+xpcc::GraphicDisplay::drawText(glcd::Point position, const char* text)
+{
+	if (!this->font.isValid())
+		return;
+
+	this->cursor = position;
+	while (true)
+	{
+		const char* end = text;
+		while (*end != '\0' && *end != '\n') {
+			end++;
+		}
+		this->drawTextLine(text, end - text);
+
+		if (*end == '\0') {
+			break;
+		}
+		this->cursor.set(position.getX(),
+				this->cursor.getY() + this->font[3] + this->font[4]);
+		text = end + 1;
+	}
+}
+
+void
+xpcc::GraphicDisplay::drawTextLine(const char* text, uint16_t length)
+{
+	if (this->textCache)
+	{
+		const glcd::Bitmap line = this->textCache->getText(this->font, text, length);
+		if (line.isValid())
+		{
+			this->drawBitmap(cursor, line.width, line.height, line.data);
+			cursor.setX(cursor.getX() + line.width);
+			return;
+		}
+	}
+
+	// character by character, clearing the space after every glyph
+	const glcd::Point clipStart = this->getClippingWindowStart();
+	const glcd::Point clipEnd = this->getClippingWindowEnd();
+	const int16_t y0 = (cursor.getY() < clipStart.getY()) ?
+			clipStart.getY() : cursor.getY();
+	int16_t y1 = cursor.getY() + this->font[3] - 1;
+	if (y1 >= clipEnd.getY()) {
+		y1 = clipEnd.getY() - 1;
+	}
+	for (uint_fast16_t i = 0; i < length; ++i)
+	{
+		const int16_t start = cursor.getX();
+		const uint8_t character = static_cast<uint8_t>(text[i]);
+		this->write(text[i]);
+
+		// the cursor only moved for glyphs of the font
+		if (start == cursor.getX() || character >= 128) {
+			continue;
+		}
+		int16_t x0 = cursor.getX() - this->font[5];
+		int16_t x1 = cursor.getX() - 1;
+		if (x0 < clipStart.getX()) {
+			x0 = clipStart.getX();
+		}
+		if (x1 >= clipEnd.getX()) {
+			x1 = clipEnd.getX() - 1;
+		}
+		if (x0 <= x1) {
+			for (int16_t y = y0; y <= y1; ++y) {
+				this->clearSpan(x0, x1, y);
+			}
+		}
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::GraphicDisplay::Writer::write(char c)
@@ -32,6 +32,9 @@
  * \defgroup	image	Images
  *
  * Images are generated out of PBM format, see \c tools/bitmap.
+ * Images with large areas of the same color are run-length encoded
+ * (`BITMAP_ENCODING='rle'` in \c image/SConscript.generate), see
+ * xpcc::GraphicDisplay::drawImage().
  */
 
 #include "image/logo_xpcc_90x64.hpp"
@@ -13,6 +13,7 @@ namespace bitmap
 	 *
 	 * - Width  : 16
 	 * - Height : 16
+	 * - Size   : 34 bytes
 	 *
 	 * \ingroup	image
 	 */
@@ -5,15 +5,34 @@ namespace bitmap
 {
 	FLASH_STORAGE(uint8_t logo_eurobot_90x64[]) =
 	{
-		90, 64,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xbc, 0x1c, 0xbc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xfa, 0xfa, 0xfa, 0x7a, 0x3a, 0x7a, 0xf4, 0xf4, 0xf4, 0xec, 0xec, 0xe8, 0xf8, 0xd8, 0xd0, 0xb0, 0xb0, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x38, 0xbc, 0xbe, 0x3e, 0x7f, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0x3d, 0x38, 0x7d, 0x3f, 0x3f, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0x07, 0x07, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0x3f, 0x0e, 0x0f, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xcf, 0xe7, 0xcf, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0xed, 0xed, 0xec, 0xec, 0xff, 0xf0, 0xe0, 0xef, 0xe7, 0xf0, 0xe0, 0xff, 0xe0, 0xe0, 0xfe, 0xff, 0xff, 0xf0, 0xe0, 0xef, 0xef, 0xef, 0xe0, 0xf0, 0xff, 0xe0, 0xe0, 0xef, 0xef, 0xe0, 0xf0, 0xff, 0xf0, 0xe0, 0xef, 0xef, 0xef, 0xe0, 0xf0, 0xff, 0xff, 0xe0, 0xe0, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xeb, 0xe3, 0xf1, 0xe3, 0xcb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x03, 0x39, 0xf1, 0xe1, 0x01, 0x01, 0x01, 0x03, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x7f, 0xff, 0xff, 0xfb, 0xdb, 0xe3, 0xf0, 0xf1, 0xf3, 0xe3, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf7, 0xf3, 0xe3, 0xe3, 0xe3, 0xc3, 0xc3, 0xc3, 0x81, 0x81, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0xfc, 0xfe, 0xf9, 0xf3, 0xf1, 0xf0, 0x78, 0x38, 0x38, 0x3e, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf2, 0xf8, 0xf8, 0xfc, 0xf8, 0xf8, 0xf2, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xbf, 0x5f, 0x2f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x1f, 0x1f, 0x0c, 0x0c, 0x0c, 0x1c, 0x3e, 0x3e, 0x7f, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x7f, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xc1, 0xc3, 0xc7, 0x80, 0x08, 0x1c, 0x9c, 0x9c, 0xf8, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0xbf, 0xbf, 0xdf, 0x5f, 0x6f, 0x2f, 0x17, 0x13, 0x0b, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xf8, 0xe0, 0x80, 0x70, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x18, 0x1e, 0x1f, 0x1f, 0x3e, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x3b, 0x3b, 0x3b, 0x3a, 0x3a, 0x38, 0x39, 0x39, 0x38, 0x18, 0x1a, 0x1d, 0x1d, 0x0d, 0x0d, 0x0d, 0x0e, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1e, 0x3d, 0x3b, 0x77, 0x67, 0x66, 0x60, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0, 90, 64,
+		0x0e, 0x3f, 0x3f, 0xbf, 0x80, 0x3f, 0x49, 0xe0, 0x9f, 0x3a, 0x53, 0xfe, 0x9f, 0x33, 0x5a, 0xfe,
+		0x9f, 0x2d, 0x49, 0xfe, 0x55, 0xcf, 0x28, 0x4d, 0xf8, 0xff, 0xfe, 0x48, 0xcf, 0x24, 0x4e, 0xfe,
+		0x48, 0xf8, 0x48, 0xe7, 0x1e, 0x8f, 0xfe, 0x54, 0xfe, 0x4b, 0xe7, 0x1d, 0xff, 0xf8, 0x67, 0xf7,
+		0x1b, 0xff, 0xfe, 0x69, 0xf7, 0x18, 0x55, 0xfc, 0x51, 0xfe, 0x4b, 0x16, 0x56, 0xfc, 0x4c, 0xcf,
+		0xe0, 0x4a, 0x14, 0x57, 0xfc, 0x4b, 0xe7, 0xfa, 0x4c, 0x0c, 0x81, 0xf0, 0xe6, 0xa4, 0xe1, 0xc1,
+		0xf0, 0xe0, 0x55, 0x0b, 0x83, 0xe6, 0xa6, 0xa0, 0xc0, 0xc0, 0xe0, 0xa0, 0x56, 0x08, 0x81, 0xf9,
+		0xc9, 0xc8, 0xe7, 0x93, 0x93, 0xcc, 0x58, 0x08, 0x83, 0xf8, 0x89, 0xc9, 0xe7, 0x93, 0x93, 0xcc,
+		0x48, 0xfe, 0x49, 0x07, 0x87, 0xf9, 0xf9, 0xc9, 0xe7, 0x93, 0x93, 0xcc, 0x4b, 0x80, 0xff, 0x07,
+		0x87, 0xf9, 0xf9, 0x89, 0xe7, 0x93, 0x93, 0xcc, 0x49, 0xf8, 0x49, 0x08, 0xbf, 0xf0, 0xb1, 0xa7,
+		0xc1, 0xc1, 0xe0, 0xf0, 0xff, 0xf9, 0x9f, 0xf8, 0x81, 0x7f, 0xde, 0x48, 0x08, 0x50, 0x7f, 0x08,
+		0x50, 0x7f, 0x07, 0x7d, 0xfe, 0x4c, 0x07, 0x4e, 0xfe, 0x4f, 0xc0, 0x51, 0xfc, 0x4b, 0x07, 0x4f,
+		0xfc, 0x4e, 0x07, 0x52, 0x08, 0x47, 0x07, 0x50, 0xf8, 0x47, 0xfe, 0xc0, 0x52, 0xe0, 0x49, 0x80,
+		0x52, 0xf0, 0xff, 0xfe, 0xe0, 0x4f, 0xfd, 0xef, 0xfe, 0x81, 0xf8, 0x4b, 0xe0, 0xff, 0xfd, 0xe0,
+		0x4e, 0xfb, 0xf7, 0xfe, 0x81, 0xc0, 0x4b, 0xe0, 0xbf, 0xfc, 0xe0, 0x47, 0xfe, 0x4d, 0xfe, 0x81,
+		0xc0, 0x4d, 0x12, 0xe0, 0x48, 0xf8, 0x4d, 0xf8, 0x87, 0x80, 0x4c, 0x0b, 0x81, 0xe0, 0x48, 0x0a,
+		0x49, 0xf8, 0x87, 0x80, 0x48, 0x0e, 0x81, 0xa0, 0x4a, 0xe0, 0x4e, 0xc0, 0x9e, 0x83, 0x15, 0x83,
+		0x80, 0x4b, 0x88, 0x4c, 0xe0, 0x8f, 0x21, 0xf8, 0x48, 0xfc, 0xfc, 0x4c, 0x07, 0xbc, 0x87, 0x17,
+		0x68, 0xd0, 0x83, 0xe0, 0x9f, 0x14, 0x63, 0xfd, 0x80, 0x87, 0x80, 0x47, 0x12, 0xff, 0xc0, 0x53,
+		0xfd, 0x07, 0x87, 0xc0, 0x4a, 0x0f, 0xbf, 0x07, 0x51, 0xfd, 0x08, 0x87, 0xc0, 0x4b, 0x0c, 0x87,
+		0x0a, 0x4f, 0xfd, 0x07, 0x81, 0xf0, 0x4d, 0x0c, 0x83, 0x0b, 0x4d, 0xfd, 0x0f, 0x54, 0x11, 0xa7,
+		0x80, 0x4c, 0xf9, 0x10, 0x51, 0xe0, 0x87, 0xc0, 0x8f, 0xe0, 0x4b, 0xf9, 0x10, 0xb8, 0x4b, 0xe0,
+		0x8f, 0xf8, 0x87, 0xe0, 0x4a, 0xf3, 0x19, 0x4c, 0x80, 0x4a, 0x07, 0xf0, 0x48, 0xf3, 0x19, 0x87,
+		0xe3, 0xc0, 0x4c, 0xe0, 0xf0, 0x47, 0xe7, 0x19, 0x81, 0xc0, 0xe0, 0x4c, 0xf9, 0xf8, 0xff, 0xc7,
+		0x25, 0x82, 0x8c, 0x4e, 0x8c, 0xbe, 0x8f, 0x2d, 0x8f, 0xc0, 0xff, 0xf8, 0x90, 0xbf, 0x32, 0x4a,
+		0x10, 0x48, 0x1f, 0x81, 0x0c, 0x62, 0x26, 0xb3, 0x08, 0x5e, 0x2b, 0xf7, 0x0b, 0x56, 0x30, 0xef,
+		0x11, 0xbf, 0x33, 0x81, 0xef, 0x12, 0x3f, 0xef, 0x0c, 0x3f, 0x81, 0xef, 0x12, 0x3f, 0xf7, 0x0f,
+		0x3f, 0x8f, 0x81, 0x0a, 0x3f, 0x83, 0xe1, 0x11, 0x3f, 0xff, 0x11, 0x3f, 0x8f, 0x1c, 0x3f, 0x3f,
 	};
 }
 
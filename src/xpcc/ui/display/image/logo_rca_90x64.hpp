@@ -13,6 +13,7 @@ namespace bitmap
 	 *
 	 * - Width  : 90
 	 * - Height : 64
+	 * - Size   : 722 bytes
 	 *
 	 * \ingroup	image
 	 */
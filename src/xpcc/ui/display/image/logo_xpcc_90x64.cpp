@@ -5,15 +5,28 @@ namespace bitmap
 {
 	FLASH_STORAGE(uint8_t logo_xpcc_90x64[]) =
 	{
-		90, 64,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x60, 0x20, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x20, 0x60, 0xc0, 0x00, 0x80, 0x80, 0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1a, 0x22, 0xc2, 0x02, 0x02, 0x0c, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0c, 0x02, 0x82, 0xc2, 0xf2, 0xfa, 0xfe, 0x1e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0xe0, 0xf8, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0x3e, 0x07, 0x03, 0x01, 0x80, 0xe0, 0x30, 0x18, 0x08, 0x08, 0x18, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x12, 0x0c, 0x00, 0x80, 0xc0, 0x80, 0x00, 0x04, 0x0e, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x80, 0x00, 0x00, 0x07, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0x3c, 0x78, 0xe0, 0xc0, 0x80, 0x80, 0xc0, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x26, 0x21, 0x20, 0x20, 0x38, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xe0, 0xe0, 0xe1, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x83, 0x80, 0xc0, 0xe0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0x10, 0x10, 0x10, 0x18, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xe7, 0xd3, 0xf7, 0xff, 0xc7, 0xfb, 0xc7, 0xff, 0xcb, 0xc3, 0xff, 0xc1, 0xdb, 0xe7, 0xff, 0xe1, 0xdf, 0xff, 0xc5, 0xff, 0xc7, 0xfb, 0xc7, 0xff, 0x67, 0x5b, 0x83, 0xff, 0xff, 0xff, 0xc3, 0xfb, 0x3f, 0x18, 0x24, 0x18, 0x00, 0x3e, 0x24, 0x18, 0x00, 0x18, 0x24, 0x18, 0x00, 0x1e, 0x24, 0x00, 0x28, 0x24, 0x14,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0, 90, 64,
+		0x1b, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0xbf, 0xe0, 0x3f, 0x48, 0x9c, 0x87, 0x3e, 0x4f, 0x07,
+		0x98, 0x47, 0x2f, 0x51, 0x0a, 0xae, 0x81, 0x2c, 0x52, 0x0c, 0xf0, 0x81, 0x16, 0xbf, 0x80, 0x58,
+		0x81, 0xf1, 0xe0, 0x81, 0x14, 0x88, 0x90, 0xa0, 0x51, 0xe0, 0x48, 0xc0, 0x81, 0x13, 0x82, 0x88,
+		0x90, 0x51, 0xe0, 0x49, 0x81, 0xf1, 0x16, 0x90, 0xa2, 0x8f, 0x07, 0x87, 0xe0, 0x48, 0xc1, 0xcf,
+		0x16, 0x84, 0x8a, 0x87, 0x0e, 0xf0, 0x49, 0xc3, 0x1d, 0x82, 0x84, 0x8f, 0x0e, 0xb0, 0x48, 0xc1,
+		0x1d, 0x81, 0x07, 0x9f, 0x0e, 0xb0, 0x48, 0xc3, 0x1e, 0x81, 0x07, 0xbe, 0x87, 0xf0, 0x90, 0x47,
+		0xe1, 0x20, 0x81, 0x80, 0xfe, 0x8f, 0xf8, 0x90, 0x47, 0xe1, 0x27, 0xc1, 0xfe, 0x8f, 0xfc, 0x90,
+		0x48, 0xc3, 0x20, 0x81, 0x81, 0xfc, 0x9f, 0xf8, 0xa0, 0x48, 0x87, 0x1e, 0x81, 0x07, 0xfc, 0x9f,
+		0xf8, 0xa0, 0x48, 0x87, 0x21, 0x90, 0x83, 0xf0, 0x47, 0xc3, 0x83, 0xfe, 0x87, 0x20, 0xa0, 0xc1,
+		0xf0, 0x47, 0xc3, 0x80, 0xf9, 0x83, 0xcf, 0x19, 0xa1, 0xe0, 0xf0, 0x48, 0x87, 0x80, 0x82, 0x83,
+		0xf1, 0x18, 0xc3, 0xf0, 0xf0, 0x48, 0x87, 0xc0, 0x81, 0x80, 0x81, 0x11, 0x81, 0x83, 0xf0, 0xb0,
+		0x48, 0x87, 0xf0, 0x83, 0xc0, 0x81, 0x13, 0x84, 0x9f, 0xe1, 0xc3, 0xfe, 0x87, 0xfc, 0x8f, 0xe0,
+		0x81, 0x16, 0xc3, 0xfe, 0x84, 0x8f, 0xe0, 0x50, 0xfc, 0x83, 0x15, 0x90, 0xff, 0xe1, 0x0f, 0x5d,
+		0x18, 0x52, 0x0e, 0x5a, 0x22, 0x4c, 0x0d, 0x5b, 0x22, 0x4c, 0x0b, 0x5d, 0x22, 0x49, 0xf0, 0x65,
+		0x22, 0x49, 0xf0, 0x49, 0xfe, 0xf6, 0x4c, 0xc2, 0x81, 0x15, 0x49, 0xf0, 0xfe, 0xf6, 0xa6, 0xfd,
+		0xe7, 0x94, 0xe2, 0xb3, 0x10, 0x47, 0xfc, 0x9f, 0x8a, 0xea, 0xda, 0xd5, 0xee, 0xd5, 0xa9, 0x12,
+		0x49, 0xf0, 0xfd, 0xea, 0xaa, 0xea, 0xd7, 0xba, 0xd5, 0xa1, 0x11, 0x47, 0xf8, 0xab, 0xb5, 0x93,
+		0xd5, 0xb3, 0xda, 0xb1, 0x8b, 0x12, 0x48, 0xf0, 0x5d, 0xdf, 0x24, 0x66, 0xfe, 0xbf, 0x24, 0x74,
+		0x25, 0x72, 0x26, 0x72, 0x26, 0x72, 0x27, 0x70, 0x28, 0x70, 0x29, 0x6e, 0x2b, 0x6c, 0x2c, 0x6c,
+		0x2d, 0x6a, 0x2f, 0x68, 0x31, 0x66, 0x33, 0x64, 0x35, 0x62, 0x37, 0x60, 0x3a, 0x5c, 0x3d, 0x54,
+		0xfe, 0x3f, 0x55, 0xc0, 0x3f, 0x50, 0x0c, 0x3f, 0x48, 0x10, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
 	};
 }
 
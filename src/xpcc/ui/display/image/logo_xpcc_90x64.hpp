@@ -13,6 +13,7 @@ namespace bitmap
 	 *
 	 * - Width  : 90
 	 * - Height : 64
+	 * - Size   : 339 bytes, run-length encoded (722 bytes raw)
 	 *
 	 * \ingroup	image
 	 */
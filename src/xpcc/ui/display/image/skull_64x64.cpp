@@ -5,15 +5,30 @@ namespace bitmap
 {
 	FLASH_STORAGE(uint8_t skull_64x64[]) =
 	{
-		64, 64,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x60, 0x30, 0x18, 0x08, 0x0c, 0x0c, 0x04, 0x06, 0x06, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x06, 0x06, 0x04, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3e, 0x07, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x0f, 0x7c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x80, 0x03, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x80, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0xc0, 0xc0, 0x40, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0e, 0xfc, 0x7f, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3c, 0x00, 0x00, 0x7f, 0xfc, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00,
-		0xf0, 0xb8, 0x9e, 0x8f, 0x80, 0x80, 0x80, 0x83, 0x07, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x60, 0x6f, 0xfc, 0xf0, 0xe0, 0xc0, 0xc0, 0xc1, 0xc1, 0x83, 0x03, 0x01, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x03, 0x83, 0x81, 0xc1, 0xc0, 0xe0, 0xe0, 0xf0, 0xfc, 0xcf, 0x40, 0x60, 0x30, 0x10, 0x1c, 0x0e, 0x03, 0x01, 0x00, 0x01, 0x1f, 0x30, 0x60, 0xc0,
-		0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x63, 0xff, 0x31, 0x0d, 0xe3, 0x0f, 0x5c, 0xf0, 0x90, 0xf0, 0x11, 0xe1, 0x20, 0xe0, 0x10, 0xf1, 0x11, 0xf0, 0x90, 0x90, 0xdc, 0x0f, 0xf1, 0x0f, 0xf9, 0xff, 0xc7, 0x61, 0x61, 0x30, 0x30, 0x18, 0x18, 0x0c, 0x04, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
-		0x00, 0x00, 0x00, 0x00, 0xe0, 0xb0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x10, 0x18, 0x08, 0x0c, 0x0c, 0x86, 0xc2, 0xc3, 0x6f, 0x7e, 0x70, 0xc1, 0x83, 0x82, 0x07, 0x04, 0x07, 0x08, 0x0f, 0x09, 0x0f, 0x09, 0x0f, 0x09, 0x05, 0x04, 0x05, 0x82, 0xc3, 0xe0, 0x70, 0x7f, 0x6f, 0xc6, 0xcc, 0x8c, 0x08, 0x18, 0x10, 0x30, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x7e, 0x60, 0x40, 0x60, 0x30, 0x1c, 0x06, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x02, 0x06, 0x1c, 0x30, 0x60, 0x40, 0x60, 0x3c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00,
+		0, 64, 64,
+		0x1a, 0x4a, 0x30, 0x52, 0x27, 0x9f, 0x0c, 0x9f, 0x21, 0x8f, 0x11, 0x8f, 0x1c, 0x83, 0x15, 0x87,
+		0x1a, 0x87, 0x17, 0x83, 0x18, 0x83, 0x19, 0x83, 0x16, 0x83, 0x1b, 0x83, 0x14, 0x83, 0x1d, 0x83,
+		0x12, 0x83, 0x1e, 0x83, 0x12, 0x83, 0x1f, 0x83, 0x10, 0x81, 0x20, 0x83, 0x10, 0x83, 0x21, 0x83,
+		0x0f, 0x83, 0x21, 0x83, 0x12, 0x91, 0x1e, 0x93, 0x12, 0x91, 0x1e, 0x91, 0x12, 0x93, 0x1e, 0x99,
+		0x12, 0x93, 0x1e, 0x99, 0x12, 0x91, 0x1e, 0x91, 0x12, 0x91, 0x1e, 0x91, 0x13, 0xb3, 0x1d, 0xb3,
+		0x13, 0xb3, 0x1d, 0xb3, 0x13, 0xb1, 0x1d, 0xa3, 0x13, 0x99, 0x1c, 0x93, 0x15, 0xb2, 0x8f, 0xf8,
+		0x87, 0xfc, 0x93, 0x16, 0xb4, 0x49, 0x80, 0x48, 0x8b, 0x17, 0xbc, 0x49, 0x80, 0x48, 0xcf, 0x17,
+		0x9c, 0x49, 0x80, 0x47, 0xe7, 0x18, 0x8c, 0x49, 0x80, 0xff, 0xf3, 0x19, 0x8c, 0x48, 0x07, 0xff,
+		0xf3, 0x0c, 0x87, 0xc0, 0x98, 0x47, 0x80, 0x9f, 0xf1, 0xc0, 0x90, 0x86, 0xe0, 0x90, 0xff, 0x80,
+		0x87, 0xf8, 0xa0, 0xbe, 0x82, 0x98, 0x88, 0x9f, 0x82, 0xc1, 0xf8, 0x90, 0x9b, 0x83, 0x8c, 0x84,
+		0x83, 0x83, 0xb0, 0xb0, 0x88, 0x98, 0xc1, 0xc3, 0x83, 0x0a, 0xbb, 0x0a, 0x98, 0xb0, 0xc3, 0xc1,
+		0xe3, 0x0b, 0xf7, 0x0a, 0xb0, 0xe1, 0x8e, 0x81, 0xf3, 0x0a, 0xf7, 0x08, 0x98, 0xf0, 0xb3, 0x09,
+		0xff, 0x09, 0xf7, 0x07, 0xbc, 0xe0, 0x8d, 0x0c, 0x47, 0xc0, 0xf7, 0x80, 0x48, 0x09, 0x47, 0xe0,
+		0x8f, 0xf8, 0x9d, 0xe0, 0x48, 0x07, 0x82, 0x48, 0x08, 0xfe, 0x8c, 0xb0, 0xff, 0xc0, 0x9f, 0xf0,
+		0x83, 0xc0, 0xb3, 0x0d, 0xab, 0x07, 0x47, 0xc0, 0x81, 0xf0, 0xab, 0x07, 0x83, 0xac, 0x87, 0x14,
+		0xbc, 0xab, 0x0c, 0xee, 0x87, 0x14, 0x83, 0xec, 0xbe, 0x9f, 0xeb, 0x8f, 0x1a, 0x9f, 0xa5, 0xba,
+		0xc2, 0xef, 0x1a, 0x81, 0xcb, 0xaa, 0xd2, 0xdf, 0x21, 0x92, 0xba, 0xd7, 0xd7, 0x22, 0x99, 0xd5,
+		0xfe, 0xd3, 0x1d, 0x81, 0xf9, 0xea, 0xd0, 0xe7, 0x1e, 0x9c, 0xe1, 0xea, 0xdc, 0x9f, 0x17, 0x83,
+		0xe3, 0x80, 0xff, 0x80, 0xef, 0x0f, 0x8f, 0xfc, 0x83, 0x0e, 0x86, 0x87, 0x0d, 0x9f, 0xf0, 0x87,
+		0x11, 0xf8, 0x8f, 0xfc, 0x81, 0x0b, 0xbf, 0x09, 0x81, 0xfe, 0x83, 0xfe, 0x81, 0xc0, 0x83, 0xc7,
+		0x07, 0x83, 0xc7, 0x08, 0x88, 0x83, 0x80, 0xb8, 0x8f, 0x07, 0xbc, 0x87, 0x08, 0xe0, 0x86, 0x87,
+		0x09, 0x49, 0xf0, 0x81, 0xe0, 0xb0, 0x81, 0xc3, 0x0c, 0x87, 0x0a, 0x81, 0xc3, 0x0a, 0xa1, 0x25,
+		0xa1, 0x0b, 0xa3, 0x25, 0xb1, 0x0a, 0x9b, 0x26, 0x9b, 0x09, 0x8f, 0x26, 0x87, 0x80, 0x3f,
 	};
 }
 
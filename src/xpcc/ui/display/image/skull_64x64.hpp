@@ -13,6 +13,7 @@ namespace bitmap
 	 *
 	 * - Width  : 64
 	 * - Height : 64
+	 * - Size   : 370 bytes, run-length encoded (514 bytes raw)
 	 *
 	 * \ingroup	image
 	 */
@@ -0,0 +1,91 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_GLCD_RUN_LENGTH_DECODER_HPP
+#define XPCC_GLCD_RUN_LENGTH_DECODER_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Streaming decoder for run-length encoded images and fonts
+		 *
+		 * The pixels are stored row by row, a row continues with the next
+		 * one. Every byte is either
+		 *
+		 * - `0vnnnnnn`: a run of n+1 pixels (1..64) with the value v, or
+		 * - `1ddddddd`: the next seven pixels, the first one in bit 6.
+		 *
+		 * The decoder returns the pixels as runs of equal value, so that
+		 * they can be drawn as spans without decompressing the image into
+		 * memory. It knows nothing about the size of the image, the caller
+		 * has to stop after the last pixel.
+		 *
+		 * The images and fonts are encoded by `scons/site_tools/bitmap.py`
+		 * with `BITMAP_ENCODING='rle'` and by
+		 * `tools/font_creator/font_export.py` with `--rle`. Both mark the
+		 * encoding with a width of zero in the header, see
+		 * GraphicDisplay::drawImage().
+		 *
+		 * \ingroup	graphics
+		 */
+		class RunLengthDecoder
+		{
+		public:
+			RunLengthDecoder(xpcc::accessor::Flash<uint8_t> data) :
+				data(data), literal(0), literalBits(0)
+			{
+			}
+
+			/**
+			 * \brief	Next run of pixels
+			 *
+			 * \param[out]	set		\c true if the pixels are set
+			 * \return	number of pixels, at least one
+			 */
+			inline uint_fast8_t
+			next(bool& set)
+			{
+				if (this->literalBits == 0)
+				{
+					const uint8_t code = *this->data;
+					++this->data;
+					if ((code & 0x80) == 0) {
+						set = (code & 0x40);
+						return (code & 0x3f) + 1;
+					}
+					// the first pixel is moved into bit 7
+					this->literal = code << 1;
+					this->literalBits = 7;
+				}
+
+				set = (this->literal & 0x80);
+				uint_fast8_t length = 0;
+				do {
+					this->literal <<= 1;
+					this->literalBits--;
+					length++;
+				}
+				while (this->literalBits > 0 && bool(this->literal & 0x80) == set);
+				return length;
+			}
+
+		private:
+			xpcc::accessor::Flash<uint8_t> data;
+			uint8_t literal;
+			uint8_t literalBits;
+		};
+	}
+}
+
+#endif // XPCC_GLCD_RUN_LENGTH_DECODER_HPP
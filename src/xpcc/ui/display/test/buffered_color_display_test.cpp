@@ -0,0 +1,316 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/buffered_color_display.hpp>
+
+#include "buffered_color_display_test.hpp"
+
+using xpcc::glcd::Rgb565;
+using xpcc::glcd::Argb8888;
+using xpcc::glcd::Color;
+using xpcc::glcd::Point;
+
+namespace
+{
+	template< typename Format, typename Accelerator = xpcc::glcd::NoAccelerator >
+	class Display : public xpcc::BufferedColorDisplay<Format, 16, 8, Accelerator>
+	{
+	public:
+		Display() :
+			xpcc::BufferedColorDisplay<Format, 16, 8, Accelerator>(frame)
+		{
+			this->clear();
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		typename Format::Pixel
+		at(int16_t x, int16_t y) const
+		{
+			return frame[y * 16 + x];
+		}
+
+		typename Format::Pixel frame[16 * 8];
+	};
+
+	// reference: the channels of source over destination, as floats
+	uint8_t
+	over(uint8_t source, uint8_t destination, float alpha)
+	{
+		return uint8_t(source * alpha + destination * (1.f - alpha) + 0.5f);
+	}
+
+	uint8_t
+	channel(uint32_t argb, uint8_t shift)
+	{
+		return (argb >> shift) & 0xff;
+	}
+
+	// accelerator which fills and counts its calls
+	struct CountingAccelerator
+	{
+		static uint16_t fills;
+		static uint16_t waits;
+
+		template< typename Pixel >
+		static bool
+		fill(Pixel* destination, uint16_t stride, uint16_t width, uint16_t height, Pixel pixel)
+		{
+			for (uint16_t row = 0; row < height; ++row) {
+				for (uint16_t column = 0; column < width; ++column) {
+					destination[row * stride + column] = pixel;
+				}
+			}
+			fills++;
+			return true;
+		}
+
+		template< typename Pixel >
+		static bool
+		copy(Pixel*, uint16_t, const Pixel*, uint16_t, uint16_t, uint16_t)
+		{
+			return false;
+		}
+
+		template< typename Pixel >
+		static bool
+		blend(Pixel*, uint16_t, const uint32_t*, uint16_t, uint16_t, uint16_t, uint8_t)
+		{
+			return false;
+		}
+
+		static void
+		wait()
+		{
+			waits++;
+		}
+	};
+
+	uint16_t CountingAccelerator::fills = 0;
+	uint16_t CountingAccelerator::waits = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedColorDisplayTest::testConversion()
+{
+	TEST_ASSERT_EQUALS(Rgb565::fromArgb(0xffffffff), 0xffff);
+	TEST_ASSERT_EQUALS(Rgb565::fromArgb(0xffff0000), 0xf800);
+	TEST_ASSERT_EQUALS(Rgb565::fromArgb(0x0000ff00), 0x07e0);
+	TEST_ASSERT_EQUALS(Rgb565::fromArgb(0x000000ff), 0x001f);
+
+	TEST_ASSERT_EQUALS(Rgb565::toArgb(0xffff), 0xffffffffUL);
+	TEST_ASSERT_EQUALS(Rgb565::toArgb(0x0000), 0xff000000UL);
+	TEST_ASSERT_EQUALS(Rgb565::toArgb(0xf800), 0xffff0000UL);
+
+	TEST_ASSERT_EQUALS(Argb8888::fromColor(Color::blue()), 0xff0000ffUL);
+	TEST_ASSERT_EQUALS(Rgb565::fromArgb(Argb8888::fromColor(Color::orange())),
+			Color::orange().getValue());
+}
+
+void
+BufferedColorDisplayTest::testBlendRgb565()
+{
+	// long enough for the vectorized and the scalar part
+	uint16_t pixels[11];
+	uint32_t source[11];
+	for (uint8_t ii = 0; ii < 11; ++ii)
+	{
+		pixels[ii] = 0x1234 * (ii + 1);
+		source[ii] = (uint32_t(ii * 25) << 24) | (0x00a0b0c0 + ii * 0x050505);
+	}
+
+	uint16_t expected[11];
+	for (uint8_t ii = 0; ii < 11; ++ii)
+	{
+		const uint32_t destination = Rgb565::toArgb(pixels[ii]);
+		const float alpha = (ii * 25) / 255.f * (200 / 255.f);
+		expected[ii] = Rgb565::fromArgb(
+				(uint32_t(over(channel(source[ii], 16), channel(destination, 16), alpha)) << 16) |
+				(uint32_t(over(channel(source[ii], 8), channel(destination, 8), alpha)) << 8) |
+				over(channel(source[ii], 0), channel(destination, 0), alpha));
+	}
+
+	Rgb565::blend(pixels, source, 11, 200);
+
+	for (uint8_t ii = 0; ii < 11; ++ii)
+	{
+		// rounding of the channels may differ in the last bit
+		TEST_ASSERT_EQUALS_DELTA(pixels[ii] >> 11, expected[ii] >> 11, 1);
+		TEST_ASSERT_EQUALS_DELTA((pixels[ii] >> 5) & 0x3f, (expected[ii] >> 5) & 0x3f, 1);
+		TEST_ASSERT_EQUALS_DELTA(pixels[ii] & 0x1f, expected[ii] & 0x1f, 1);
+	}
+
+	// fully opaque and transparent colors
+	Rgb565::blend(pixels, 11, 0xff00ff00);
+	for (uint8_t ii = 0; ii < 11; ++ii) {
+		TEST_ASSERT_EQUALS(pixels[ii], 0x07e0);
+	}
+	Rgb565::blend(pixels, 11, 0x00ff0000);
+	for (uint8_t ii = 0; ii < 11; ++ii) {
+		TEST_ASSERT_EQUALS(pixels[ii], 0x07e0);
+	}
+}
+
+void
+BufferedColorDisplayTest::testBlendArgb8888()
+{
+	uint32_t pixels[7];
+	for (uint8_t ii = 0; ii < 7; ++ii) {
+		pixels[ii] = 0xff204060;
+	}
+	pixels[6] = 0x00000000;
+
+	Argb8888::blend(pixels, 7, 0x80ffffff);
+
+	for (uint8_t ii = 0; ii < 6; ++ii)
+	{
+		TEST_ASSERT_EQUALS(channel(pixels[ii], 24), 0xff);
+		TEST_ASSERT_EQUALS_DELTA(channel(pixels[ii], 16), over(0xff, 0x20, 128 / 255.f), 1);
+		TEST_ASSERT_EQUALS_DELTA(channel(pixels[ii], 8), over(0xff, 0x40, 128 / 255.f), 1);
+		TEST_ASSERT_EQUALS_DELTA(channel(pixels[ii], 0), over(0xff, 0x60, 128 / 255.f), 1);
+	}
+	// over a transparent pixel the opacity is the one of the color
+	TEST_ASSERT_EQUALS(channel(pixels[6], 24), 0x80);
+
+	const uint32_t source[2] = { 0xffabcdef, 0x00abcdef };
+	Argb8888::blend(pixels, source, 2);
+	TEST_ASSERT_EQUALS(pixels[0], 0xffabcdefUL);
+	TEST_ASSERT_EQUALS(pixels[1], pixels[2]);
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedColorDisplayTest::testFillRectangle()
+{
+	Display<Rgb565> display;
+	for (uint8_t ii = 0; ii < 16 * 8; ++ii) {
+		TEST_ASSERT_EQUALS(display.frame[ii], 0x0000);
+	}
+
+	display.setColor(Color::red());
+	display.fillRectangle(Point(-2, 6), 5, 10);
+
+	for (int16_t y = 0; y < 8; ++y) {
+		for (int16_t x = 0; x < 16; ++x) {
+			const bool inside = (x < 3 && y >= 6);
+			TEST_ASSERT_EQUALS(display.at(x, y), inside ? 0xf800 : 0x0000);
+		}
+	}
+
+	display.setBackgroundColor(Color::blue());
+	display.clear();
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0x001f);
+	TEST_ASSERT_EQUALS(display.at(15, 7), 0x001f);
+}
+
+void
+BufferedColorDisplayTest::testTranslucentFill()
+{
+	Display<Argb8888> display;
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0xff000000UL);
+
+	display.setColor(Color::white());
+	display.setAlpha(0x80);
+	display.fillRectangle(Point(1, 1), 2, 2);
+	display.drawPixel(5, 5);
+
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0xff000000UL);
+	TEST_ASSERT_EQUALS(display.at(1, 1), 0xff808080UL);
+	TEST_ASSERT_EQUALS(display.at(2, 2), 0xff808080UL);
+	TEST_ASSERT_EQUALS(display.at(5, 5), 0xff808080UL);
+
+	// drawing twice adds up
+	display.fillRectangle(Point(1, 1), 1, 1);
+	TEST_ASSERT_EQUALS(display.at(1, 1), 0xffc0c0c0UL);
+
+	display.setAlpha(0);
+	display.fillRectangle(Point(0, 0), 16, 8);
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0xff000000UL);
+}
+
+void
+BufferedColorDisplayTest::testBlit()
+{
+	Display<Rgb565> display;
+
+	uint16_t image[4 * 3];
+	for (uint8_t ii = 0; ii < 4 * 3; ++ii) {
+		image[ii] = ii + 1;
+	}
+
+	// only the lower right 2x2 pixels of the left 3x3 of the image are visible
+	display.blit(Point(-1, -1), 3, 3, image, 4);
+
+	TEST_ASSERT_EQUALS(display.at(0, 0), 6);
+	TEST_ASSERT_EQUALS(display.at(1, 0), 7);
+	TEST_ASSERT_EQUALS(display.at(2, 0), 0);
+	TEST_ASSERT_EQUALS(display.at(0, 1), 10);
+	TEST_ASSERT_EQUALS(display.at(1, 1), 11);
+	TEST_ASSERT_EQUALS(display.at(0, 2), 0);
+
+	display.blit(Point(14, 7), 4, 3, image);
+	TEST_ASSERT_EQUALS(display.at(14, 7), 1);
+	TEST_ASSERT_EQUALS(display.at(15, 7), 2);
+
+	// completely outside
+	display.blit(Point(16, 0), 4, 3, image);
+	display.blit(Point(-4, 0), 4, 3, image);
+	TEST_ASSERT_EQUALS(display.at(0, 3), 0);
+}
+
+void
+BufferedColorDisplayTest::testBlend()
+{
+	Display<Rgb565> display;
+	display.setBackgroundColor(Color::white());
+	display.clear();
+
+	const uint32_t image[3] = { 0xff000000, 0x00000000, 0xff0000ff };
+	display.blend(Point(0, 0), 3, 1, image);
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0x0000);
+	TEST_ASSERT_EQUALS(display.at(1, 0), 0xffff);
+	TEST_ASSERT_EQUALS(display.at(2, 0), 0x001f);
+
+	// with half the opacity
+	display.setAlpha(0x80);
+	display.blend(Point(0, 1), 3, 1, image);
+	TEST_ASSERT_EQUALS(display.at(0, 1), Rgb565::fromArgb(0xff7f7f7f));
+	TEST_ASSERT_EQUALS(display.at(1, 1), 0xffff);
+}
+
+void
+BufferedColorDisplayTest::testAccelerator()
+{
+	CountingAccelerator::fills = 0;
+	CountingAccelerator::waits = 0;
+
+	Display<Rgb565, CountingAccelerator> display;
+	TEST_ASSERT_EQUALS(CountingAccelerator::fills, 1);
+	TEST_ASSERT_EQUALS(CountingAccelerator::waits, 0);
+
+	display.setColor(Color::green());
+	display.fillRectangle(Point(2, 2), 3, 3);
+	TEST_ASSERT_EQUALS(CountingAccelerator::fills, 2);
+	TEST_ASSERT_EQUALS(display.at(4, 4), 0x0400);
+
+	// translucent fills and copies are done by the CPU, after waiting
+	display.setAlpha(0x80);
+	display.fillRectangle(Point(2, 2), 3, 3);
+	TEST_ASSERT_EQUALS(CountingAccelerator::fills, 2);
+	TEST_ASSERT_EQUALS(CountingAccelerator::waits, 1);
+
+	const uint16_t image[1] = { 0x1234 };
+	display.blit(Point(0, 0), 1, 1, image);
+	TEST_ASSERT_EQUALS(CountingAccelerator::waits, 2);
+	TEST_ASSERT_EQUALS(display.at(0, 0), 0x1234);
+}
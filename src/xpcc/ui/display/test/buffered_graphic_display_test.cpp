@@ -0,0 +1,287 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/ui/display/font/fixed_width_5x8.hpp>
+#include <xpcc/ui/display/image/home_16x16.hpp>
+#include <string.h>
+
+#include "buffered_graphic_display_test.hpp"
+
+using xpcc::glcd::Point;
+
+namespace
+{
+	static constexpr uint16_t Width = 40;
+	static constexpr uint16_t Height = 32;
+	static constexpr uint16_t Pages = Height / 8;
+
+	class Display : public xpcc::BufferedGraphicDisplay<Width, Height>
+	{
+	public:
+		Display()
+		{
+			// content which can be cleared by images and text
+			this->fillRectangle(Point(0, 0), Width / 2, Height);
+			this->clean();
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		using xpcc::BufferedGraphicDisplay<Width, Height>::isDirty;
+		using xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyBegin;
+		using xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyEnd;
+		using xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyWindow;
+		using xpcc::BufferedGraphicDisplay<Width, Height>::markClean;
+
+		/// Marks the buffer as transferred and remembers its content
+		void
+		clean()
+		{
+			this->markClean(0);
+			memcpy(transferred, this->display_buffer, sizeof(transferred));
+		}
+
+		bool
+		isChanged() const
+		{
+			return (memcmp(transferred, this->display_buffer, sizeof(transferred)) != 0);
+		}
+
+		/// \c true if every byte changed since clean() is within the changed
+		/// columns of its page and within the dirty window
+		bool
+		isTracked() const
+		{
+			uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+			const bool dirty = this->getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd);
+
+			for (uint16_t page = 0; page < Pages; ++page)
+			{
+				for (uint16_t x = 0; x < Width; ++x)
+				{
+					if (this->display_buffer[x][page] == transferred[x][page]) {
+						continue;
+					}
+					if (not dirty or not this->isDirty(page) or
+						x < this->getDirtyBegin(page) or x >= this->getDirtyEnd(page)) {
+						return false;
+					}
+					if (x < columnBegin or x >= columnEnd or
+						page < pageBegin or page >= pageEnd) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		uint8_t transferred[Width][Pages];
+	};
+
+	class NewDisplay : public xpcc::BufferedGraphicDisplay<Width, Height>
+	{
+	public:
+		virtual void
+		update()
+		{
+		}
+	};
+
+	typedef void (*Drawing)(Display& display);
+
+	// inside, across the borders of the display and across the pages.
+	// Images and text which are not aligned to the pages clear pixels.
+	const Drawing drawings[] = {
+		[](Display& display) { display.drawPixel(30, 9); },
+		[](Display& display) { display.drawImage(Point(2, 5), xpcc::accessor::asFlash(bitmap::home_16x16)); },
+		[](Display& display) { display.drawLine(-5, 12, 34, 12); },
+		[](Display& display) { display.drawLine(30, -3, 30, 40); },
+		[](Display& display) { display.drawLine(0, 0, 39, 31); },
+		[](Display& display) { display.fillRectangle(Point(15, 5), 30, 20); },
+		[](Display& display) { display.fillRectangle(Point(-3, 3), 30, 2); },
+		[](Display& display) {
+			display.setFont(xpcc::font::FixedWidth5x8);
+			display.drawText(Point(-2, 13), "xpcc");
+		},
+		[](Display& display) { display.drawRectangle(Point(30, 20), 20, 20); },
+		[](Display& display) { display.drawRoundedRectangle(Point(21, 2), 15, 25, 4); },
+		[](Display& display) { display.drawCircle(Point(28, 16), 9); },
+		[](Display& display) { display.fillCircle(Point(38, 2), 6); },
+		[](Display& display) { display.drawImage(Point(-6, 19), xpcc::accessor::asFlash(bitmap::home_16x16)); },
+		[](Display& display) { display.drawEllipse(Point(20, 16), 18, 6); },
+		[](Display& display) { display.drawImage(Point(24, 8), xpcc::accessor::asFlash(bitmap::home_16x16)); },
+		[](Display& display) { display.drawImage(Point(30, -5), xpcc::accessor::asFlash(bitmap::home_16x16)); },
+		[](Display& display) { display.drawImage(Point(-4, 20), xpcc::accessor::asFlash(bitmap::home_16x16)); },
+		[](Display& display) {
+			display.setFont(xpcc::font::FixedWidth5x8);
+			display.setCursor(22, 27);
+			display << "xpcc";
+		},
+		[](Display& display) {
+			display.setClippingWindow(Point(25, 6), 8, 11);
+			display.fillRectangle(Point(0, 0), Width, Height);
+		},
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedGraphicDisplayTest::testClean()
+{
+	Display display;
+	TEST_ASSERT_FALSE(display.isDirty());
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 0U);
+
+	uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+	TEST_ASSERT_FALSE(display.getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd));
+
+	display.markClean(12);
+	display.markClean(5);
+	TEST_ASSERT_EQUALS(display.getUpdateBytes(), 5U);
+	TEST_ASSERT_EQUALS(display.getTotalUpdateBytes(), 17U);
+
+	// only the column of the pixel
+	display.drawPixel(25, 20);
+	TEST_ASSERT_TRUE(display.isDirty());
+	TEST_ASSERT_FALSE(display.isDirty(0));
+	TEST_ASSERT_TRUE(display.isDirty(2));
+	TEST_ASSERT_EQUALS(display.getDirtyBegin(2), 25);
+	TEST_ASSERT_EQUALS(display.getDirtyEnd(2), 26);
+
+	TEST_ASSERT_TRUE(display.getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd));
+	TEST_ASSERT_EQUALS(columnBegin, 25);
+	TEST_ASSERT_EQUALS(columnEnd, 26);
+	TEST_ASSERT_EQUALS(pageBegin, 2);
+	TEST_ASSERT_EQUALS(pageEnd, 3);
+
+	// the window contains both pixels
+	display.drawPixel(29, 3);
+	TEST_ASSERT_FALSE(display.isDirty(1));
+	TEST_ASSERT_TRUE(display.getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd));
+	TEST_ASSERT_EQUALS(columnBegin, 25);
+	TEST_ASSERT_EQUALS(columnEnd, 30);
+	TEST_ASSERT_EQUALS(pageBegin, 0);
+	TEST_ASSERT_EQUALS(pageEnd, 3);
+	TEST_ASSERT_TRUE(display.isTracked());
+
+	// pixels outside of the display change nothing
+	display.clean();
+	display.drawPixel(-1, 5);
+	display.drawPixel(Width, 5);
+	display.drawPixel(5, Height);
+	TEST_ASSERT_FALSE(display.isDirty());
+}
+
+void
+BufferedGraphicDisplayTest::testClearAndInvalidate()
+{
+	Display display;
+
+	// the whole screen without changing the buffer
+	display.invalidate();
+	TEST_ASSERT_FALSE(display.isChanged());
+	for (uint16_t page = 0; page < Pages; ++page)
+	{
+		TEST_ASSERT_EQUALS(display.getDirtyBegin(page), 0);
+		TEST_ASSERT_EQUALS(display.getDirtyEnd(page), Width);
+	}
+
+	display.clean();
+	display.clear();
+	TEST_ASSERT_TRUE(display.isChanged());
+	TEST_ASSERT_TRUE(display.isTracked());
+
+	uint16_t columnBegin, columnEnd, pageBegin, pageEnd;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(columnBegin, columnEnd, pageBegin, pageEnd));
+	TEST_ASSERT_EQUALS(columnBegin, 0);
+	TEST_ASSERT_EQUALS(columnEnd, Width);
+	TEST_ASSERT_EQUALS(pageBegin, 0);
+	TEST_ASSERT_EQUALS(pageEnd, Pages);
+
+	// the content of a new display is unknown
+	NewDisplay created;
+	TEST_ASSERT_TRUE(created.isDirty());
+	TEST_ASSERT_EQUALS(created.getTotalUpdateBytes(), 0U);
+}
+
+void
+BufferedGraphicDisplayTest::testDrawing()
+{
+	for (const Drawing& drawing : drawings)
+	{
+		Display display;
+		drawing(display);
+		TEST_ASSERT_TRUE(display.isChanged());
+		TEST_ASSERT_TRUE(display.isTracked());
+
+		// clean until the next drawing
+		display.clean();
+		TEST_ASSERT_FALSE(display.isDirty());
+		TEST_ASSERT_TRUE(display.isTracked());
+	}
+
+	// changes accumulate until the buffer is clean
+	Display display;
+	for (const Drawing& drawing : drawings)
+	{
+		display.resetClippingWindow();
+		drawing(display);
+		TEST_ASSERT_TRUE(display.isTracked());
+	}
+}
+
+void
+BufferedGraphicDisplayTest::testRandomDrawing()
+{
+	Display display;
+	display.setFont(xpcc::font::FixedWidth5x8);
+	uint32_t state = 42;
+	auto random = [&state](int16_t min, int16_t max) -> int16_t
+	{
+		state = state * 1103515245 + 12345;
+		return min + int16_t((state >> 16) % uint16_t(max - min));
+	};
+
+	for (uint16_t round = 0; round < 500; ++round)
+	{
+		const Point point(random(-10, Width + 10), random(-10, Height + 10));
+		switch (random(0, 8))
+		{
+			case 0:
+				display.drawPixel(point);
+				break;
+			case 1:
+				display.drawLine(point, Point(random(-10, Width + 10), random(-10, Height + 10)));
+				break;
+			case 2:
+				display.fillRectangle(point, random(0, 20), random(0, 20));
+				break;
+			case 3:
+				display.drawRectangle(point, random(0, 20), random(0, 20));
+				break;
+			case 4:
+				display.fillCircle(point, random(0, 10));
+				break;
+			case 5:
+				display.drawImage(point, xpcc::accessor::asFlash(bitmap::home_16x16));
+				break;
+			case 6:
+				display.drawText(point, "42");
+				break;
+			default:
+				display.clean();
+				break;
+		}
+		TEST_ASSERT_TRUE(display.isTracked());
+	}
+}
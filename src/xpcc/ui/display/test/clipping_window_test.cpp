@@ -0,0 +1,216 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/buffered_color_display.hpp>
+#include <xpcc/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/ui/display/font/fixed_width_5x8.hpp>
+#include <xpcc/ui/display/image/home_16x16.hpp>
+#include <xpcc/ui/display/image/skull_64x64.hpp>
+
+#include "clipping_window_test.hpp"
+
+using xpcc::glcd::Color;
+using xpcc::glcd::Point;
+
+namespace
+{
+	static constexpr uint16_t Width = 48;
+	static constexpr uint16_t Height = 24;
+
+	class ColorDisplay : public xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>
+	{
+	public:
+		ColorDisplay() :
+			xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>(frame)
+		{
+			this->setBackgroundColor(Color::blue());
+			this->clear();
+			// content which must be kept outside of the window
+			this->setColor(Color::yellow());
+			this->fillRectangle(Point(0, 0), Width / 2, Height);
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		uint16_t
+		get(int16_t x, int16_t y) const
+		{
+			return frame[y * Width + x];
+		}
+
+		uint16_t frame[Width * Height];
+	};
+
+	class MonochromeDisplay : public xpcc::BufferedGraphicDisplay<Width, Height>
+	{
+	public:
+		MonochromeDisplay()
+		{
+			this->clear();
+			this->fillRectangle(Point(0, 0), Width / 2, Height);
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		bool
+		get(int16_t x, int16_t y)
+		{
+			return this->getPixel(x, y);
+		}
+	};
+
+	struct Window
+	{
+		Point upperLeft;
+		uint16_t width;
+		uint16_t height;
+	};
+
+	// inside, across the borders of the display and empty
+	const Window windows[] = {
+		{ Point(5, 3), 20, 10 },
+		{ Point(-4, -4), 12, 9 },
+		{ Point(30, 10), 40, 40 },
+		{ Point(17, 0), 1, Height },
+		{ Point(10, 10), 0, 5 },
+	};
+
+	void
+	drawScene(xpcc::GraphicDisplay& display, const Color& first, const Color& second)
+	{
+		xpcc::glcd::StaticTextCache<1024> cache;
+
+		display.setColor(first);
+		display.fillRectangle(Point(2, 2), 40, 15);
+		display.drawLine(0, 0, 47, 23);
+		display.drawLine(0, 12, 47, 12);
+		display.drawLine(20, 0, 20, 23);
+		display.drawPixel(7, 3);
+
+		display.setColor(second);
+		display.drawCircle(Point(24, 12), 10);
+		display.fillCircle(Point(10, 10), 5);
+		display.drawRoundedRectangle(Point(3, 3), 30, 15, 4);
+		display.drawImage(Point(7, 8), xpcc::accessor::asFlash(bitmap::home_16x16));
+		display.drawImage(Point(20, -9), xpcc::accessor::asFlash(bitmap::skull_64x64));
+
+		display.setFont(xpcc::font::FixedWidth5x8);
+		display.setCursor(1, 14);
+		display << "Clip 42";
+		display.setTextCache(&cache);
+		display.drawText(Point(13, 1), "cached");
+		display.setTextCache(nullptr);
+	}
+
+	template< typename Display >
+	bool
+	isClipped(Display& reference, Display& original, Display& clipped,
+			const Window& window)
+	{
+		for (int16_t y = 0; y < Height; ++y)
+		{
+			for (int16_t x = 0; x < Width; ++x)
+			{
+				const bool inside =
+						x >= window.upperLeft.x && x < window.upperLeft.x + window.width &&
+						y >= window.upperLeft.y && y < window.upperLeft.y + window.height;
+				if (clipped.get(x, y) != (inside ? reference.get(x, y) : original.get(x, y))) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+ClippingWindowTest::testWindow()
+{
+	ColorDisplay display;
+	TEST_ASSERT_FALSE(display.isClipped());
+	TEST_ASSERT_EQUALS(display.getClippingWindowStart(), Point(0, 0));
+	TEST_ASSERT_EQUALS(display.getClippingWindowEnd(), Point(Width, Height));
+
+	// limited to the display
+	display.setClippingWindow(Point(-4, 10), 20, 40);
+	TEST_ASSERT_TRUE(display.isClipped());
+	TEST_ASSERT_EQUALS(display.getClippingWindowStart(), Point(0, 10));
+	TEST_ASSERT_EQUALS(display.getClippingWindowEnd(), Point(16, Height));
+
+	// completely outside
+	display.setClippingWindow(Point(50, 30), 10, 10);
+	TEST_ASSERT_EQUALS(display.getClippingWindowStart(), display.getClippingWindowEnd());
+
+	display.resetClippingWindow();
+	TEST_ASSERT_FALSE(display.isClipped());
+	TEST_ASSERT_EQUALS(display.getClippingWindowEnd(), Point(Width, Height));
+
+	// the pixels drawn after a change of the color are clipped as well
+	display.setClippingWindow(Point(30, 0), 10, 10);
+	display.setColor(Color::red());
+	display.drawPixel(2, 2);
+	display.drawPixel(32, 2);
+	TEST_ASSERT_EQUALS(display.get(2, 2), Color::yellow().getValue());
+	TEST_ASSERT_EQUALS(display.get(32, 2), Color::red().getValue());
+}
+
+void
+ClippingWindowTest::testColorDisplay()
+{
+	ColorDisplay reference;
+	ColorDisplay original;
+	drawScene(reference, Color::red(), Color::white());
+
+	for (const Window& window : windows)
+	{
+		ColorDisplay clipped;
+		clipped.setClippingWindow(window.upperLeft, window.width, window.height);
+		drawScene(clipped, Color::red(), Color::white());
+		TEST_ASSERT_TRUE(isClipped(reference, original, clipped, window));
+
+		// images in the format of the frame buffer
+		ColorDisplay copied;
+		copied.setClippingWindow(window.upperLeft, window.width, window.height);
+		copied.blit(Point(0, 0), Width, Height, reference.frame);
+		TEST_ASSERT_TRUE(isClipped(reference, original, copied, window));
+	}
+}
+
+void
+ClippingWindowTest::testMonochromeDisplay()
+{
+	// black draws with the optimized drawHorizontalLine()
+	MonochromeDisplay reference;
+	MonochromeDisplay original;
+	drawScene(reference, Color::black(), Color::white());
+
+	for (const Window& window : windows)
+	{
+		MonochromeDisplay clipped;
+		clipped.setClippingWindow(window.upperLeft, window.width, window.height);
+		drawScene(clipped, Color::black(), Color::white());
+		TEST_ASSERT_TRUE(isClipped(reference, original, clipped, window));
+
+		// copied page by page without a clipping window
+		MonochromeDisplay image;
+		image.setClippingWindow(window.upperLeft, window.width, window.height);
+		image.drawImage(Point(8, 8), xpcc::accessor::asFlash(bitmap::home_16x16));
+
+		MonochromeDisplay unclipped;
+		unclipped.drawImage(Point(8, 8), xpcc::accessor::asFlash(bitmap::home_16x16));
+		TEST_ASSERT_TRUE(isClipped(unclipped, original, image, window));
+	}
+}
@@ -0,0 +1,189 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/detect.hpp>
+
+#include "headless_display_test.hpp"
+
+// The display writes files and is only available on hosted targets
+#ifdef XPCC__OS_HOSTED
+
+#include <xpcc/architecture/platform/driver/graphics/hosted/headless_display.hpp>
+#include <stdio.h>
+#include <string.h>
+
+using xpcc::glcd::Color;
+using xpcc::glcd::Point;
+
+namespace
+{
+	// FNV-1a of a single color repeated over the whole image
+	uint64_t
+	hashOf(uint32_t pixels, uint8_t red, uint8_t green, uint8_t blue)
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
+		for (uint32_t ii = 0; ii < pixels; ++ii)
+		{
+			for (uint8_t byte : { red, green, blue })
+			{
+				hash ^= byte;
+				hash *= 0x100000001b3ull;
+			}
+		}
+		return hash;
+	}
+
+	// reads the complete file, returns the number of bytes read
+	size_t
+	readFile(const char* filename, uint8_t* data, size_t size)
+	{
+		FILE* file = fopen(filename, "rb");
+		if (file == NULL) {
+			return 0;
+		}
+		const size_t length = fread(data, 1, size, file);
+		fclose(file);
+		remove(filename);
+		return length;
+	}
+
+	template< typename Display >
+	void
+	drawScene(Display& display)
+	{
+		display.clear();
+		display.setColor(Color::red());
+		display.fillRectangle(Point(2, 1), 5, 3);
+		display.setColor(Color::blue());
+		display.drawLine(Point(0, 7), Point(15, 0));
+		display.setCursor(8, 0);
+		display << "x";
+	}
+}
+
+void
+HeadlessDisplayTest::testHash()
+{
+	xpcc::HeadlessDisplay<16, 8> display;
+
+	// black background after the construction
+	TEST_ASSERT_EQUALS(display.getHash(), hashOf(16 * 8, 0, 0, 0));
+
+	display.setBackgroundColor(Color::white());
+	display.clear();
+	TEST_ASSERT_EQUALS(display.getHash(), hashOf(16 * 8, 0xff, 0xff, 0xff));
+
+	drawScene(display);
+	const uint64_t scene = display.getHash();
+	TEST_ASSERT_TRUE(scene != hashOf(16 * 8, 0xff, 0xff, 0xff));
+
+	// a single pixel changes the hash
+	display.setColor(Color::green());
+	display.drawPixel(15, 7);
+	TEST_ASSERT_TRUE(display.getHash() != scene);
+
+	// drawing the same again gives the same hash
+	drawScene(display);
+	TEST_ASSERT_EQUALS(display.getHash(), scene);
+}
+
+void
+HeadlessDisplayTest::testHashFormats()
+{
+	xpcc::HeadlessDisplay<16, 8, xpcc::glcd::Rgb565> rgb565;
+	xpcc::HeadlessDisplay<16, 8, xpcc::glcd::Argb8888> argb8888;
+
+	drawScene(rgb565);
+	drawScene(argb8888);
+	TEST_ASSERT_EQUALS(rgb565.getHash(), argb8888.getHash());
+}
+
+void
+HeadlessDisplayTest::testUpdate()
+{
+	xpcc::HeadlessDisplay<16, 8> display;
+	TEST_ASSERT_EQUALS(display.getUpdateCount(), 0U);
+
+	display.update();
+	display.update();
+	TEST_ASSERT_EQUALS(display.getUpdateCount(), 2U);
+}
+
+void
+HeadlessDisplayTest::testWritePbm()
+{
+	xpcc::HeadlessDisplay<10, 3> display;
+	display.setColor(Color::red());
+	display.drawPixel(0, 0);
+	display.drawPixel(9, 0);
+	display.drawLine(Point(1, 2), Point(8, 2));
+
+	const char filename[] = "headless_display_test.pbm";
+	TEST_ASSERT_TRUE(display.writePbm(filename));
+
+	uint8_t data[64];
+	const char header[] = "P4\n10 3\n";
+	const size_t length = readFile(filename, data, sizeof(data));
+	TEST_ASSERT_EQUALS(length, strlen(header) + 3 * 2);
+	TEST_ASSERT_EQUALS(memcmp(data, header, strlen(header)), 0);
+
+	// two bytes per row, padded with zeros
+	const uint8_t pixels[] = {
+		0x80, 0x40,
+		0x00, 0x00,
+		0x7f, 0x80,
+	};
+	TEST_ASSERT_EQUALS_ARRAY(data + strlen(header), pixels, sizeof(pixels));
+
+	TEST_ASSERT_FALSE(display.writePbm("/nonexistent/directory/image.pbm"));
+}
+
+void
+HeadlessDisplayTest::testWritePpm()
+{
+	xpcc::HeadlessDisplay<2, 2> display;
+	display.setColor(Color::white());
+	display.drawPixel(1, 0);
+	display.setColor(Color::blue());
+	display.drawPixel(0, 1);
+
+	const char filename[] = "headless_display_test.ppm";
+	TEST_ASSERT_TRUE(display.writePpm(filename));
+
+	uint8_t data[64];
+	const char header[] = "P6\n2 2\n255\n";
+	const size_t length = readFile(filename, data, sizeof(data));
+	TEST_ASSERT_EQUALS(length, strlen(header) + 4 * 3);
+	TEST_ASSERT_EQUALS(memcmp(data, header, strlen(header)), 0);
+
+	const uint8_t pixels[] = {
+		0x00, 0x00, 0x00,	0xff, 0xff, 0xff,
+		0x00, 0x00, 0xff,	0x00, 0x00, 0x00,
+	};
+	TEST_ASSERT_EQUALS_ARRAY(data + strlen(header), pixels, sizeof(pixels));
+
+	// the hash covers the same bytes as the image file
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (uint8_t byte : pixels)
+	{
+		hash ^= byte;
+		hash *= 0x100000001b3ull;
+	}
+	TEST_ASSERT_EQUALS(display.getHash(), hash);
+}
+
+#else
+
+void HeadlessDisplayTest::testHash() {}
+void HeadlessDisplayTest::testHashFormats() {}
+void HeadlessDisplayTest::testUpdate() {}
+void HeadlessDisplayTest::testWritePbm() {}
+void HeadlessDisplayTest::testWritePpm() {}
+
+#endif
@@ -0,0 +1,156 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/buffered_color_display.hpp>
+#include <xpcc/ui/display/image/home_16x16.hpp>
+#include <xpcc/ui/display/run_length_decoder.hpp>
+
+#include "run_length_test.hpp"
+
+using xpcc::glcd::Color;
+using xpcc::glcd::Point;
+
+namespace
+{
+	static constexpr uint16_t Width = 48;
+	static constexpr uint16_t Height = 24;
+
+	class Display : public xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>
+	{
+	public:
+		Display() :
+			xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>(frame)
+		{
+			this->setBackgroundColor(Color::blue());
+			this->clear();
+			this->setColor(Color::yellow());
+			// the cleared pixels of the image are drawn as well
+			this->fillRectangle(Point(0, 0), Width, Height / 2);
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		bool
+		operator == (const Display& other) const
+		{
+			for (uint16_t ii = 0; ii < Width * Height; ++ii) {
+				if (frame[ii] != other.frame[ii]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		uint16_t frame[Width * Height];
+	};
+
+	FLASH_STORAGE(uint8_t runs[]) =
+	{
+		0x45,	// 6 pixels set
+		0x02,	// 3 pixels cleared
+		0xd5,	// 1010101
+		0xf8,	// 1111000
+		0x3f,	// 64 pixels cleared
+		0x7f,	// 64 pixels set
+	};
+
+	// bitmap::home_16x16, encoded by scons/site_tools/bitmap.py
+	FLASH_STORAGE(uint8_t home_16x16_rle[]) =
+	{
+		0, 16, 16,
+		0x12, 0x48, 0xc1, 0x80, 0x88, 0xc1, 0xc1, 0x90, 0xf8, 0xa4, 0xbf, 0x89, 0x9f, 0xf2, 0xac, 0x86,
+		0xc9, 0x81, 0x92, 0xa7, 0xa4, 0xc9, 0xe9, 0x92, 0xba, 0xa4, 0x47, 0x91, 0x08, 0xa0, 0x49, 0x12,
+	};
+
+	// xpcc::font::Matrix8x8, encoded by tools/font_creator/font_export.py
+	FLASH_STORAGE(uint8_t Matrix8x8_rle[]) =
+	{
+		0x80, 0x00, 0, 8, 0, 0, 48, 10,
+		8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+		0x00, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1B, 0x00, 0x24, 0x00,
+		0x2D, 0x00, 0x36, 0x00, 0x3F, 0x00, 0x48, 0x00, 0x51, 0x00,
+		0xBE, 0xB1, 0xD9, 0xED, 0xF7, 0xDB, 0xCC, 0xFC, 0x07, // 48
+		0x98, 0x9C, 0x86, 0x83, 0x81, 0xC0, 0xE1, 0xFC, 0x07, // 49
+		0xBC, 0xB3, 0x81, 0xC3, 0xC3, 0x83, 0x99, 0xFC, 0x07, // 50
+		0xBC, 0xB3, 0x81, 0xC3, 0xC0, 0xB3, 0x98, 0xF8, 0x07, // 51
+		0x8E, 0x8F, 0x8D, 0xCC, 0xE7, 0xF8, 0x98, 0x9E, 0x07, // 52
+		0xFE, 0xB0, 0x9F, 0x80, 0xE0, 0xB3, 0x98, 0xF8, 0x07, // 53
+		0x9C, 0x98, 0x98, 0x8F, 0xC6, 0xB3, 0x98, 0xF8, 0x07, // 54
+		0xFE, 0xB3, 0x81, 0xC1, 0xC1, 0xC0, 0xE0, 0xB0, 0x07, // 55
+		0xBC, 0xB3, 0x99, 0xC7, 0xC6, 0xB3, 0x98, 0xF8, 0x07, // 56
+		0xBC, 0xB3, 0x99, 0xC7, 0xE0, 0xB0, 0xB0, 0xF0, 0x07, // 57
+	};
+
+	// positions at the borders of the display and in between
+	const Point positions[] = {
+		Point(0, 0), Point(3, 5), Point(-7, -3), Point(40, 18), Point(-2, 12),
+		Point(-20, 0), Point(0, 30),
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+RunLengthTest::testDecoder()
+{
+	const uint8_t lengths[] = { 6, 3, 1, 1, 1, 1, 1, 1, 1, 4, 3, 64, 64 };
+	const bool values[] = { true, false, true, false, true, false, true,
+			false, true, true, false, false, true };
+
+	xpcc::glcd::RunLengthDecoder decoder(xpcc::accessor::asFlash(runs));
+	for (uint8_t ii = 0; ii < sizeof(lengths); ++ii)
+	{
+		bool set;
+		TEST_ASSERT_EQUALS(decoder.next(set), lengths[ii]);
+		TEST_ASSERT_EQUALS(set, values[ii]);
+	}
+}
+
+void
+RunLengthTest::testImage()
+{
+	for (const Point& position : positions)
+	{
+		Display raw;
+		Display encoded;
+		raw.drawImage(position, xpcc::accessor::asFlash(bitmap::home_16x16));
+		encoded.drawImage(position, xpcc::accessor::asFlash(home_16x16_rle));
+		TEST_ASSERT_TRUE(raw == encoded);
+	}
+}
+
+void
+RunLengthTest::testFont()
+{
+	xpcc::glcd::StaticTextCache<512> cache;
+
+	for (const Point& position : positions)
+	{
+		Display raw;
+		Display encoded;
+		Display cached;
+		raw.setFont(xpcc::font::Matrix8x8);
+		encoded.setFont(Matrix8x8_rle);
+		cached.setFont(Matrix8x8_rle);
+		cached.setTextCache(&cache);
+
+		for (Display* display : { &raw, &encoded, &cached })
+		{
+			display->setCursor(position);
+			*display << "0123456789" << "\n" << "9876543210";
+			display->drawText(position + Point(3, 4), "42");
+		}
+		TEST_ASSERT_TRUE(raw == encoded);
+		TEST_ASSERT_TRUE(raw == cached);
+		TEST_ASSERT_EQUALS(raw.getCursor(), encoded.getCursor());
+	}
+	TEST_ASSERT_TRUE(cache.getHits() > 0);
+}
@@ -0,0 +1,265 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/buffered_color_display.hpp>
+#include <xpcc/ui/display/text_cache.hpp>
+
+#include "text_cache_test.hpp"
+
+using xpcc::glcd::Color;
+using xpcc::glcd::Point;
+
+namespace
+{
+	static constexpr uint16_t Width = 48;
+	static constexpr uint16_t Height = 24;
+
+	class Display : public xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>
+	{
+	public:
+		Display() :
+			xpcc::BufferedColorDisplay<xpcc::glcd::Rgb565, Width, Height>(frame)
+		{
+			this->setBackgroundColor(Color::blue());
+			this->clear();
+		}
+
+		virtual void
+		update()
+		{
+		}
+
+		bool
+		operator == (const Display& other) const
+		{
+			for (uint16_t ii = 0; ii < Width * Height; ++ii) {
+				if (frame[ii] != other.frame[ii]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		uint16_t
+		at(int16_t x, int16_t y) const
+		{
+			return frame[y * Width + x];
+		}
+
+		uint16_t frame[Width * Height];
+	};
+
+	const uint8_t* const fonts[] = {
+		xpcc::font::FixedWidth5x8,	// one page
+		xpcc::font::AllCaps3x5,		// less than a page
+		xpcc::font::Numbers14x32,	// several pages
+	};
+
+	const char* const texts[] = {
+		"Hello World!",
+		"HELLO 123",
+		"0123456789",
+	};
+
+	// positions at the borders of the display and in between
+	const Point positions[] = {
+		Point(0, 0), Point(3, 5), Point(-7, -3), Point(40, 18), Point(-2, 12),
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+TextCacheTest::testDrawBitmap()
+{
+	// 70 pixels wide, the runs cross the word boundaries
+	const uint32_t bitmap[] = {
+		0xffffffff, 0xf0000000, 0x80000000,
+		0x00000001, 0x8000ffff, 0x40000000,
+		0xaaaaaaaa, 0x55555555, 0xc0000000,
+	};
+
+	for (const Point& position : positions)
+	{
+		Display display;
+		display.setColor(Color::red());
+		display.drawBitmap(position, 70, 3, bitmap);
+
+		for (int16_t y = 0; y < Height; ++y)
+		{
+			for (int16_t x = 0; x < Width; ++x)
+			{
+				const int16_t i = x - position.getX();
+				const int16_t k = y - position.getY();
+				uint16_t expected = Color::blue().getValue();
+				if (i >= 0 && i < 70 && k >= 0 && k < 3 &&
+						((bitmap[k * 3 + i / 32] << (i % 32)) & 0x80000000)) {
+					expected = Color::red().getValue();
+				}
+				TEST_ASSERT_EQUALS(display.at(x, y), expected);
+			}
+		}
+	}
+}
+
+void
+TextCacheTest::testGlyphs()
+{
+	xpcc::glcd::StaticTextCache<2048> cache;
+
+	for (uint8_t ii = 0; ii < 3; ++ii)
+	{
+		for (const Point& position : positions)
+		{
+			Display direct;
+			Display cached;
+			cached.setTextCache(&cache);
+			TEST_ASSERT_TRUE(cached.getTextCache() == &cache);
+
+			for (Display* display : { &direct, &cached })
+			{
+				display->setColor(Color::yellow());
+				display->setFont(fonts[ii]);
+				display->setCursor(position);
+				*display << texts[ii] << "\n" << texts[ii];
+			}
+			TEST_ASSERT_TRUE(direct == cached);
+			TEST_ASSERT_EQUALS(direct.getCursor(), cached.getCursor());
+		}
+	}
+
+	// every glyph is only rendered once
+	TEST_ASSERT_EQUALS(cache.getMisses(), 9U + 8U + 10U);
+	TEST_ASSERT_TRUE(cache.getHits() > 0);
+
+	// not part of the font
+	const xpcc::glcd::Bitmap missing =
+			cache.getGlyph(xpcc::accessor::asFlash(xpcc::font::Numbers14x32), 'a');
+	TEST_ASSERT_FALSE(missing.isValid());
+
+	const xpcc::glcd::Bitmap glyph =
+			cache.getGlyph(xpcc::accessor::asFlash(xpcc::font::Numbers14x32), '1');
+	TEST_ASSERT_TRUE(glyph.isValid());
+	TEST_ASSERT_EQUALS(glyph.width, 14);
+	TEST_ASSERT_EQUALS(glyph.height, 32);
+	TEST_ASSERT_EQUALS(glyph.getStride(), 1);
+}
+
+void
+TextCacheTest::testText()
+{
+	xpcc::glcd::StaticTextCache<2048> cache;
+
+	for (uint8_t ii = 0; ii < 3; ++ii)
+	{
+		for (const Point& position : positions)
+		{
+			Display direct;
+			Display cached;
+			cached.setTextCache(&cache);
+
+			for (Display* display : { &direct, &cached })
+			{
+				display->setColor(Color::yellow());
+				display->setFont(fonts[ii]);
+				// the spacing is cleared
+				display->fillRectangle(Point(0, 0), Width, Height);
+				display->drawText(position, texts[ii]);
+				display->drawText(position + Point(2, 8), "a\nb\xfc" "c");
+			}
+			TEST_ASSERT_TRUE(direct == cached);
+			TEST_ASSERT_EQUALS(direct.getCursor(), cached.getCursor());
+		}
+	}
+	const uint32_t misses = cache.getMisses();
+
+	// unchanged labels are taken from the cache
+	Display display;
+	display.setTextCache(&cache);
+	display.setFont(fonts[0]);
+	display.drawText(positions[1], texts[0]);
+	TEST_ASSERT_EQUALS(cache.getMisses(), misses);
+
+	// same string, changed content
+	char label[] = "12";
+	display.drawText(positions[1], label);
+	label[1] = '3';
+	display.drawText(positions[1], label);
+	TEST_ASSERT_EQUALS(cache.getMisses(), misses + 2);
+
+	TEST_ASSERT_EQUALS(display.getCursor(),
+			positions[1] + Point(display.getStringWidth(label), 0));
+}
+
+void
+TextCacheTest::testEviction()
+{
+	// two glyphs of FixedWidth5x8 with 8 rows of one word each
+	xpcc::glcd::StaticTextCache<64, 4> cache;
+	TEST_ASSERT_EQUALS(cache.getCapacity(), 64U);
+
+	Display direct;
+	Display cached;
+	cached.setTextCache(&cache);
+
+	for (Display* display : { &direct, &cached }) {
+		*display << "ab";
+	}
+	TEST_ASSERT_EQUALS(cache.getMisses(), 2U);
+	TEST_ASSERT_EQUALS(cache.getHits(), 0U);
+
+	for (Display* display : { &direct, &cached }) {
+		*display << "ba";
+	}
+	TEST_ASSERT_EQUALS(cache.getMisses(), 2U);
+	TEST_ASSERT_EQUALS(cache.getHits(), 2U);
+
+	// replaces the oldest glyph 'a'
+	for (Display* display : { &direct, &cached }) {
+		*display << "cba";
+	}
+	TEST_ASSERT_EQUALS(cache.getMisses(), 4U);
+	TEST_ASSERT_EQUALS(cache.getHits(), 3U);
+
+	// the line does not fit, drawn glyph by glyph
+	for (Display* display : { &direct, &cached }) {
+		display->drawText(Point(0, 12), "much too long");
+	}
+	TEST_ASSERT_TRUE(direct == cached);
+	TEST_ASSERT_EQUALS(direct.getCursor(), cached.getCursor());
+
+	cached << "g";
+	const uint32_t misses = cache.getMisses();
+	cached << "g";
+	TEST_ASSERT_EQUALS(cache.getMisses(), misses);
+
+	cache.clear();
+	cached << "g";
+	TEST_ASSERT_EQUALS(cache.getMisses(), misses + 1);
+}
+
+void
+TextCacheTest::testStringWidth()
+{
+	Display display;
+
+	// 5 pixels and one space per glyph
+	TEST_ASSERT_EQUALS(display.getStringWidth("abc"), 18);
+	TEST_ASSERT_EQUALS(display.getStringWidth(""), 0);
+	TEST_ASSERT_EQUALS(display.getStringWidth("ab\nabcd\nc"), 24);
+
+	// not part of the font
+	display.setFont(xpcc::font::Numbers14x32);
+	TEST_ASSERT_EQUALS(display.getStringWidth("1a2"),
+			display.getStringWidth("12"));
+
+	// the same as the cursor moves
+	display.setCursor(0, 0);
+	display << "1a2";
+	TEST_ASSERT_EQUALS(display.getCursor().getX(), display.getStringWidth("12"));
+}
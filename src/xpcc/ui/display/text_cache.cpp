@@ -0,0 +1,303 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "text_cache.hpp"
+#include "run_length_decoder.hpp"
+
+namespace
+{
+	// Layout of the font table, see xpcc::font
+	static constexpr uint8_t Width = 2;
+	static constexpr uint8_t Height = 3;
+	static constexpr uint8_t VerticalSpace = 5;
+	static constexpr uint8_t First = 6;
+	static constexpr uint8_t Count = 7;
+	static constexpr uint8_t WidthTable = 8;
+
+	inline bool
+	contains(const xpcc::accessor::Flash<uint8_t>& font, uint8_t character)
+	{
+		const uint8_t first = font[First];
+		return (character >= first && character < first + font[Count]);
+	}
+
+	/// Width of the character, 0 if it is not part of the font
+	uint8_t
+	getGlyphWidth(const xpcc::accessor::Flash<uint8_t>& font, uint8_t character)
+	{
+		if (!contains(font, character)) {
+			return 0;
+		}
+		return font[WidthTable + character - font[First]];
+	}
+
+	/// Horizontal advance of the cursor, like GraphicDisplay::write()
+	uint16_t
+	getAdvance(const xpcc::accessor::Flash<uint8_t>& font, uint8_t character)
+	{
+		if (!contains(font, character)) {
+			return 0;
+		}
+		// only characters below 128 are followed by a space
+		return getGlyphWidth(font, character) +
+				((character < 128) ? font[VerticalSpace] : 0);
+	}
+
+	/// Sets the bits of the glyph at column \p x of the bitmap
+	void
+	renderGlyph(const xpcc::accessor::Flash<uint8_t>& font, uint8_t character,
+			uint32_t* bitmap, uint16_t stride, uint16_t x)
+	{
+		const uint8_t height = font[Height];
+		const uint8_t first = font[First];
+		const uint8_t count = font[Count];
+		const uint8_t pages = (height + 7) / 8;
+
+		const uint8_t position = WidthTable + character - first;
+		const uint8_t width = font[position];
+		if (width == 0) {
+			return;
+		}
+
+		if (font[Width] == 0)
+		{
+			// run-length encoded, the glyph is stored row by row
+			const uint16_t table = WidthTable + count + (character - first) * 2;
+			const uint16_t offset = WidthTable + count * 3 +
+					(font[table] | (font[table + 1] << 8));
+			xpcc::glcd::RunLengthDecoder decoder(
+					xpcc::accessor::asFlash(font.getPointer() + offset));
+
+			uint32_t* row = bitmap;
+			uint_fast16_t column = 0;
+			for (uint_fast8_t k = 0; k < height; )
+			{
+				bool set;
+				uint_fast16_t length = decoder.next(set);
+				while (length > 0 && k < height)
+				{
+					const uint_fast16_t pixels =
+							(length < width - column) ? length : width - column;
+					if (set)
+					{
+						for (uint_fast16_t i = x + column; i < x + column + pixels; ++i) {
+							row[i / 32] |= uint32_t(1) << (31 - (i % 32));
+						}
+					}
+					column += pixels;
+					length -= pixels;
+					if (column == width) {
+						column = 0;
+						row += stride;
+						k++;
+					}
+				}
+			}
+			return;
+		}
+
+		uint16_t offset = WidthTable + count;
+		for (uint8_t i = WidthTable; i < position; ++i) {
+			offset += font[i] * pages;
+		}
+
+		// the glyph is stored in columns of eight pixels per byte, page
+		// by page
+		for (uint_fast8_t page = 0; page < pages; ++page)
+		{
+			for (uint_fast8_t column = 0; column < width; ++column)
+			{
+				uint8_t byte = font[offset + page * width + column];
+				const uint16_t xx = x + column;
+				const uint32_t bit = uint32_t(1) << (31 - (xx % 32));
+				uint32_t* word = &bitmap[uint32_t(page * 8) * stride + xx / 32];
+				for (uint_fast8_t row = page * 8; byte && row < height; ++row)
+				{
+					if (byte & 0x01) {
+						*word |= bit;
+					}
+					byte >>= 1;
+					word += stride;
+				}
+			}
+		}
+	}
+
+	// FNV-1a
+	uint32_t
+	hash(const char* text, uint16_t length)
+	{
+		uint32_t value = 2166136261u;
+		for (; length > 0; --length, ++text) {
+			value ^= uint8_t(*text);
+			value *= 16777619u;
+		}
+		return value;
+	}
+}
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::TextCache::TextCache(uint32_t* memory, uint32_t words,
+		Entry* entries, uint8_t* index, uint8_t count) :
+	memory(memory), words(words), entries(entries), index(index), count(count),
+	head(0), nextEntry(0), hits(0), misses(0)
+{
+	this->clear();
+}
+
+void
+xpcc::glcd::TextCache::clear()
+{
+	for (uint_fast8_t i = 0; i < this->count; ++i) {
+		this->entries[i] = Entry { nullptr, nullptr, 0, 0, 0, 0, 0 };
+		this->index[i] = 0;
+	}
+	this->head = 0;
+	this->nextEntry = 0;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::Bitmap
+xpcc::glcd::TextCache::getGlyph(const accessor::Flash<uint8_t>& font, char c)
+{
+	const uint8_t character = static_cast<uint8_t>(c);
+	Entry* entry = this->find(font.getPointer(), nullptr, character);
+	if (entry == nullptr)
+	{
+		const uint8_t width = getGlyphWidth(font, character);
+		if (width == 0) {
+			return Bitmap { nullptr, 0, 0 };
+		}
+
+		const uint8_t height = font[Height];
+		const uint16_t stride = (width + 31) / 32;
+		entry = this->allocate(uint32_t(stride) * height);
+		if (entry == nullptr) {
+			return Bitmap { nullptr, 0, 0 };
+		}
+		this->misses++;
+
+		*entry = Entry { font.getPointer(), nullptr, character, entry->offset,
+				entry->size, width, height };
+		renderGlyph(font, character, &this->memory[entry->offset], stride, 0);
+	}
+	else {
+		this->hits++;
+	}
+
+	return Bitmap { &this->memory[entry->offset], entry->width, entry->height };
+}
+
+xpcc::glcd::Bitmap
+xpcc::glcd::TextCache::getText(const accessor::Flash<uint8_t>& font,
+		const char* text, uint16_t length)
+{
+	const uint32_t key = hash(text, length);
+	Entry* entry = this->find(font.getPointer(), text, key);
+	if (entry == nullptr)
+	{
+		uint16_t width = 0;
+		for (uint_fast16_t i = 0; i < length; ++i) {
+			width += getAdvance(font, text[i]);
+		}
+		if (width == 0) {
+			return Bitmap { nullptr, 0, 0 };
+		}
+
+		const uint8_t height = font[Height];
+		const uint16_t stride = (width + 31) / 32;
+		entry = this->allocate(uint32_t(stride) * height);
+		if (entry == nullptr) {
+			return Bitmap { nullptr, 0, 0 };
+		}
+		this->misses++;
+
+		*entry = Entry { font.getPointer(), text, key, entry->offset,
+				entry->size, width, height };
+
+		uint16_t x = 0;
+		for (uint_fast16_t i = 0; i < length; ++i)
+		{
+			const uint16_t advance = getAdvance(font, text[i]);
+			if (advance) {
+				renderGlyph(font, text[i], &this->memory[entry->offset], stride, x);
+				x += advance;
+			}
+		}
+	}
+	else {
+		this->hits++;
+	}
+
+	return Bitmap { &this->memory[entry->offset], entry->width, entry->height };
+}
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::TextCache::Entry*
+xpcc::glcd::TextCache::find(const uint8_t* font, const char* text, uint32_t key)
+{
+	if (this->count == 0) {
+		return nullptr;
+	}
+
+	// try the entry found last time for this hash first
+	const uint8_t hash = (key ^ (uintptr_t(font) >> 2) ^ (uintptr_t(text) >> 2)) % this->count;
+	Entry* entry = &this->entries[this->index[hash]];
+	if (entry->key == key && entry->font == font && entry->text == text) {
+		return entry;
+	}
+
+	for (uint_fast8_t i = 0; i < this->count; ++i)
+	{
+		entry = &this->entries[i];
+		if (entry->key == key && entry->font == font && entry->text == text) {
+			this->index[hash] = i;
+			return entry;
+		}
+	}
+	return nullptr;
+}
+
+xpcc::glcd::TextCache::Entry*
+xpcc::glcd::TextCache::allocate(uint32_t size)
+{
+	if (size > this->words || this->count == 0) {
+		return nullptr;
+	}
+	if (this->head + size > this->words) {
+		this->head = 0;
+	}
+
+	// remove the bitmaps which are overwritten
+	const uint32_t end = this->head + size;
+	for (uint_fast8_t i = 0; i < this->count; ++i)
+	{
+		Entry& entry = this->entries[i];
+		if (entry.font != nullptr &&
+				entry.offset < end && this->head < entry.offset + entry.size) {
+			entry.font = nullptr;
+		}
+	}
+
+	// the entries are reused in the same order as the memory, so this is
+	// the oldest one
+	Entry* entry = &this->entries[this->nextEntry];
+	this->nextEntry = (this->nextEntry + 1) % this->count;
+
+	entry->font = nullptr;
+	entry->offset = this->head;
+	entry->size = size;
+	this->head = end;
+
+	// the glyphs are drawn into the bitmap by setting bits
+	for (uint32_t i = entry->offset; i < end; ++i) {
+		this->memory[i] = 0;
+	}
+	return entry;
+}
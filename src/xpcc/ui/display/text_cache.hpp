@@ -0,0 +1,196 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_GLCD_TEXT_CACHE_HPP
+#define XPCC_GLCD_TEXT_CACHE_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Image with one bit per pixel, stored row by row
+		 *
+		 * Every row starts with a new 32 bit word, bit 31 of the first
+		 * word is the leftmost pixel.
+		 *
+		 * \ingroup	graphics
+		 */
+		struct Bitmap
+		{
+			const uint32_t* data;
+			uint16_t width;
+			uint16_t height;
+
+			/// Number of words per row
+			inline uint16_t
+			getStride() const
+			{
+				return (this->width + 31) / 32;
+			}
+
+			inline bool
+			isValid() const
+			{
+				return (this->data != nullptr);
+			}
+		};
+
+		/**
+		 * \brief	Pre-rendered glyphs and lines of text
+		 *
+		 * Decoding a glyph from the font table is expensive: the glyph
+		 * has to be searched by summing up the widths of all preceding
+		 * glyphs, and the bytes are stored in columns, so they are read
+		 * once per row. The cache renders every glyph into a Bitmap on its
+		 * first use, which GraphicDisplay then draws in runs of pixels.
+		 * Lines drawn with GraphicDisplay::drawText() are cached as a whole.
+		 *
+		 * The bitmaps are stored in a ring buffer, when it is full the
+		 * oldest bitmaps are replaced. A line is identified by its font,
+		 * the address of the string and a hash of its content, so lines
+		 * with changing content (e.g. a number) only replace other bitmaps.
+		 * Write those with `operator <<` instead, which only caches the
+		 * glyphs.
+		 *
+		 * Use StaticTextCache to provide the memory.
+		 *
+		 * \code
+		 * xpcc::glcd::StaticTextCache<4096> cache;
+		 *
+		 * display.setTextCache(&cache);
+		 * display.drawText(xpcc::glcd::Point(10, 10), "Temperature");
+		 * display.setCursor(100, 10);
+		 * display << temperature;
+		 * \endcode
+		 *
+		 * \ingroup	graphics
+		 */
+		class TextCache
+		{
+		public:
+			/**
+			 * \brief	Bitmap of the character \p c
+			 *
+			 * The bitmap is as wide as the glyph, without the spacing.
+			 *
+			 * \return	an invalid bitmap if the font does not contain the
+			 * 			character or the bitmap does not fit into the cache
+			 */
+			Bitmap
+			getGlyph(const accessor::Flash<uint8_t>& font, char c);
+
+			/**
+			 * \brief	Bitmap of the first \p length characters of \p text
+			 *
+			 * The bitmap contains the spacing after every glyph, characters
+			 * which are not part of the font are skipped.
+			 *
+			 * \return	an invalid bitmap if it does not fit into the cache
+			 */
+			Bitmap
+			getText(const accessor::Flash<uint8_t>& font, const char* text,
+					uint16_t length);
+
+			/// Remove all bitmaps
+			void
+			clear();
+
+			/// Size of the memory for the bitmaps in bytes
+			inline uint32_t
+			getCapacity() const
+			{
+				return this->words * sizeof(uint32_t);
+			}
+
+			/// Number of bitmaps which were found in the cache
+			inline uint32_t
+			getHits() const
+			{
+				return this->hits;
+			}
+
+			/// Number of bitmaps which had to be rendered
+			inline uint32_t
+			getMisses() const
+			{
+				return this->misses;
+			}
+
+		protected:
+			/// @cond
+			struct Entry
+			{
+				const uint8_t* font;	// nullptr if unused
+				const char* text;		// nullptr for glyphs
+				uint32_t key;			// character or hash of the text
+				uint32_t offset;		// in words
+				uint16_t size;			// in words
+				uint16_t width;
+				uint16_t height;
+			};
+			/// @endcond
+
+			TextCache(uint32_t* memory, uint32_t words,
+					Entry* entries, uint8_t* index, uint8_t count);
+
+		private:
+			Entry*
+			find(const uint8_t* font, const char* text, uint32_t key);
+
+			/// Reserves the memory for a bitmap, replacing the oldest ones
+			Entry*
+			allocate(uint32_t size);
+
+			uint32_t* const memory;
+			const uint32_t words;
+			Entry* const entries;
+			uint8_t* const index;	// last entry found per hash
+			const uint8_t count;
+
+			uint32_t head;
+			uint8_t nextEntry;
+
+			uint32_t hits;
+			uint32_t misses;
+		};
+
+		/**
+		 * \brief	TextCache with its own memory
+		 *
+		 * \tparam	Bytes	Memory for the bitmaps. A bitmap needs four bytes
+		 * 					per row for every started 32 pixels of width,
+		 * 					e.g. 140 bytes for a glyph of
+		 * 					xpcc::font::Ubuntu_36 and 512 bytes for one of
+		 * 					xpcc::font::Numbers46x64.
+		 * \tparam	Entries	Maximum number of bitmaps
+		 *
+		 * \ingroup	graphics
+		 */
+		template <uint32_t Bytes, uint8_t Entries = 64>
+		class StaticTextCache : public TextCache
+		{
+		public:
+			StaticTextCache() :
+				TextCache(storage, Bytes / sizeof(uint32_t), table, index, Entries)
+			{
+			}
+
+		private:
+			uint32_t storage[Bytes / sizeof(uint32_t)];
+			Entry table[Entries];
+			uint8_t index[Entries];
+		};
+	}
+}
+
+#endif // XPCC_GLCD_TEXT_CACHE_HPP
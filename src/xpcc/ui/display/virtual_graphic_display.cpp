@@ -48,3 +48,38 @@ xpcc::VirtualGraphicDisplay::getPixel(int16_t x, int16_t y)
 {
 	return this->display->getPixel(x + this->leftUpper[0], y + this->leftUpper[1] );
 }
+
+void
+xpcc::VirtualGraphicDisplay::fillSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	if (this->translateSpan(x0, x1, y)) {
+		this->display->fillSpan(x0, x1, y);
+	}
+}
+
+void
+xpcc::VirtualGraphicDisplay::clearSpan(int16_t x0, int16_t x1, int16_t y)
+{
+	if (this->translateSpan(x0, x1, y)) {
+		this->display->clearSpan(x0, x1, y);
+	}
+}
+
+bool
+xpcc::VirtualGraphicDisplay::translateSpan(int16_t& x0, int16_t& x1, int16_t& y) const
+{
+	x0 += this->leftUpper[0];
+	x1 += this->leftUpper[0];
+	y += this->leftUpper[1];
+
+	if (y < 0 || y >= static_cast<int16_t>(this->display->getHeight())) {
+		return false;
+	}
+	if (x0 < 0) {
+		x0 = 0;
+	}
+	if (x1 >= static_cast<int16_t>(this->display->getWidth())) {
+		x1 = this->display->getWidth() - 1;
+	}
+	return (x0 <= x1);
+}
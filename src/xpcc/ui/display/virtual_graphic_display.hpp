@@ -75,7 +75,17 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 
+		virtual void
+		fillSpan(int16_t x0, int16_t x1, int16_t y);
+
+		virtual void
+		clearSpan(int16_t x0, int16_t x1, int16_t y);
+
  	private:
+		/// Moves the span onto the display and clips it, \c false if not visible
+		bool
+		translateSpan(int16_t& x0, int16_t& x1, int16_t& y) const;
+
 		xpcc::GraphicDisplay* display;
 		xpcc::glcd::Point leftUpper;
 		xpcc::glcd::Point rightLower;
@@ -146,6 +146,105 @@ typedef struct Dimension
 
 typedef xpcc::glcd::Point Point;
 
+/**
+ * Rectangular area of the screen, e.g. the part of a widget that has to be
+ * redrawn. The lower right corner x1|y1 is the first pixel outside of the
+ * region.
+ *
+ * @ingroup	gui
+ */
+struct Region
+{
+	Region() :
+		x0(0), y0(0), x1(0), y1(0)
+	{
+	}
+
+	Region(Point upperLeft, Dimension dimension) :
+		x0(upperLeft.x), y0(upperLeft.y),
+		x1(upperLeft.x + dimension.width), y1(upperLeft.y + dimension.height)
+	{
+	}
+
+	bool
+	isEmpty() const
+	{
+		return (x0 >= x1) || (y0 >= y1);
+	}
+
+	/// Number of pixels
+	uint32_t
+	getSize() const
+	{
+		return isEmpty() ? 0 : uint32_t(x1 - x0) * uint32_t(y1 - y0);
+	}
+
+	Point
+	getUpperLeft() const
+	{
+		return Point(x0, y0);
+	}
+
+	Dimension
+	getDimension() const
+	{
+		return isEmpty() ? Dimension(0, 0) : Dimension(x1 - x0, y1 - y0);
+	}
+
+	/// Region moved by \p offset
+	Region
+	translated(Point offset) const
+	{
+		return Region(x0 + offset.x, y0 + offset.y, x1 + offset.x, y1 + offset.y);
+	}
+
+	/// Area covered by both regions, may be empty
+	Region
+	intersection(const Region& other) const
+	{
+		return Region((x0 > other.x0) ? x0 : other.x0,
+					  (y0 > other.y0) ? y0 : other.y0,
+					  (x1 < other.x1) ? x1 : other.x1,
+					  (y1 < other.y1) ? y1 : other.y1);
+	}
+
+	/// Smallest region containing both regions, empty regions are ignored
+	Region
+	merge(const Region& other) const
+	{
+		if(other.isEmpty())
+			return *this;
+		if(isEmpty())
+			return other;
+
+		return Region((x0 < other.x0) ? x0 : other.x0,
+					  (y0 < other.y0) ? y0 : other.y0,
+					  (x1 > other.x1) ? x1 : other.x1,
+					  (y1 > other.y1) ? y1 : other.y1);
+	}
+
+	bool
+	intersects(const Region& other) const
+	{
+		return !intersection(other).isEmpty();
+	}
+
+	bool
+	operator == (const Region& other) const
+	{
+		return (x0 == other.x0) && (y0 == other.y0) &&
+			   (x1 == other.x1) && (y1 == other.y1);
+	}
+
+	int16_t x0, y0, x1, y1;
+
+private:
+	Region(int16_t x0, int16_t y0, int16_t x1, int16_t y1) :
+		x0(x0), y0(y0), x1(x1), y1(y1)
+	{
+	}
+};
+
 }	// namespace gui
 
 }	// namespace xpcc
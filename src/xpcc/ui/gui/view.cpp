@@ -15,7 +15,9 @@
 xpcc::gui::View::View(xpcc::gui::GuiViewStack* stack, uint8_t identifier, xpcc::gui::Dimension dimension) :
 	AbstractView(stack, identifier),
 	stack(stack),
-	dimension(dimension)
+	dimension(dimension),
+	redrawnPixels(0),
+	renderCount(0)
 {
 	this->display().clear();
 }
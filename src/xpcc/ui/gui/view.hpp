@@ -36,6 +36,7 @@ class GuiViewStack;
 class View : public xpcc::AbstractView
 {
 	friend class GuiViewStack;
+	friend class Widget;
 
 public:
 	/**
@@ -97,12 +98,49 @@ public:
 		return stack;
 	}
 
+	/**
+	 * Number of pixels the widgets were rendered to since the last call of
+	 * resetRedrawCounters(). Only the damaged parts of the widgets are
+	 * rendered, so this shows how much work the partial redraws save.
+	 */
+	inline uint32_t
+	getRedrawnPixels() const
+	{
+		return this->redrawnPixels;
+	}
+
+	/// Number of calls to Widget::render() since the last reset
+	inline uint32_t
+	getRenderCount() const
+	{
+		return this->renderCount;
+	}
+
+	void
+	resetRedrawCounters()
+	{
+		this->redrawnPixels = 0;
+		this->renderCount = 0;
+	}
+
 protected:
 	xpcc::gui::GuiViewStack* stack;
 	Dimension dimension;
 	WidgetContainer widgets;
 
 	xpcc::gui::ColorPalette colorpalette;
+
+private:
+	/// Called by Widget for every render()
+	inline void
+	countRedraw(uint32_t pixels)
+	{
+		this->redrawnPixels += pixels;
+		this->renderCount++;
+	}
+
+	uint32_t redrawnPixels;
+	uint32_t renderCount;
 };
 
 }	// namespace gui
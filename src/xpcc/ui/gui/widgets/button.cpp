@@ -59,8 +59,8 @@ xpcc::gui::ButtonWidget::render(View* view)
 		out->setFont(&(this->font));
 
 	out->setColor(cp[Color::TEXT]);
-	out->setCursor(x + (width - stringWidth) / 2, y + (height - stringHeight) / 2);
-	*out << this->label;
+	out->drawText(xpcc::glcd::Point(x + (width - stringWidth) / 2, y + (height - stringHeight) / 2),
+			this->label);
 }
 
 void
@@ -26,6 +26,5 @@ xpcc::gui::Label::render(View* view)
 		out->setFont(&(this->font));
 	}
 
-	out->setCursor(this->getPosition().x, this->getPosition().y);
-	*out << this->label;
+	out->drawText(this->getPosition(), this->label);
 }
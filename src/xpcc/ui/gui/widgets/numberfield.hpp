@@ -41,7 +41,11 @@ public:
 		if(this->value == value)
 			return;
 		this->value = value;
-		this->markDirty();
+
+		// only the text inside the box changes, starting 10 pixels right
+		// of its left border
+		this->markDirty(xpcc::glcd::Point(12, 1),
+				Dimension(this->dimension.width - 15, this->dimension.height - 2));
 	}
 
 	T
@@ -17,7 +17,6 @@ xpcc::gui::NumberRocker<T>::increase()
 {
 	this->value += this->step;
 	this->num_field.setValue(this->value);
-	this->num_field.markDirty();
 
 	if(cb_activate != NULL)
 	{
@@ -31,7 +30,6 @@ xpcc::gui::NumberRocker<T>::decrease()
 {
 	this->value -= this->step;
 	this->num_field.setValue(this->value);
-	this->num_field.markDirty();
 
 	if(cb_activate != NULL)
 	{
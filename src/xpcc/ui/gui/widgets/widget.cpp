@@ -66,6 +66,126 @@ xpcc::gui::WidgetGroup::setPosition(const xpcc::glcd::Point& pos)
 	}
 }
 
+void
+xpcc::gui::WidgetGroup::draw(View* view)
+{
+	const Region damage = this->getDamage();
+
+	/* the child widgets are drawn on their own, so only their damaged
+	 * regions are redrawn */
+	this->render(view);
+	this->markDrawn();
+
+	this->redrawIntersections(view, damage);
+}
+
+void
+xpcc::gui::WidgetGroup::redraw(View* view, const Region& region)
+{
+	for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
+	{
+		(*iter)->redraw(view, region);
+	}
+
+	this->redrawIntersections(view, region.intersection(this->getRegion()));
+}
+
+void
+xpcc::gui::Widget::draw(View* view)
+{
+	const Region damage = this->getDamage();
+
+	if(damage == this->getRegion())
+	{
+		/* whole widget, drawn without a clipping window of its own */
+		this->render(view);
+
+		xpcc::GraphicDisplay& out = view->display();
+		const xpcc::glcd::Point start = out.getClippingWindowStart();
+		const xpcc::glcd::Point end = out.getClippingWindowEnd();
+		view->countRedraw(damage.intersection(Region(start,
+				Dimension(end.x - start.x, end.y - start.y))).getSize());
+	}
+	else
+	{
+		this->renderClipped(view, damage);
+	}
+	this->markDrawn();
+
+	/* widgets on top were overdrawn inside the damaged region */
+	this->redrawIntersections(view, damage);
+}
+
+void
+xpcc::gui::Widget::redraw(View* view, const Region& region)
+{
+	const Region visible = region.intersection(this->getRegion());
+	if(visible.isEmpty())
+		return;
+
+	this->renderClipped(view, visible);
+	this->redrawIntersections(view, visible);
+}
+
+void
+xpcc::gui::Widget::renderClipped(View* view, const Region& region)
+{
+	xpcc::GraphicDisplay& out = view->display();
+
+	/* keep the clipping window of the caller, e.g. when a widget below is
+	 * redrawn only partially */
+	const bool clipped = out.isClipped();
+	const xpcc::glcd::Point start = out.getClippingWindowStart();
+	const xpcc::glcd::Point end = out.getClippingWindowEnd();
+	const Dimension window(end.x - start.x, end.y - start.y);
+
+	const Region visible = region.intersection(Region(start, window));
+	if(visible.isEmpty())
+		return;
+
+	const Dimension dimension = visible.getDimension();
+	out.setClippingWindow(visible.getUpperLeft(), dimension.width, dimension.height);
+	this->render(view);
+	view->countRedraw(visible.getSize());
+
+	if(clipped)
+		out.setClippingWindow(start, window.width, window.height);
+	else
+		out.resetClippingWindow();
+}
+
+void
+xpcc::gui::Widget::redrawIntersections(View* view, const Region& region)
+{
+	if(region.isEmpty())
+		return;
+
+	for(auto iter = this->intersecting_widgets.begin(); iter != this->intersecting_widgets.end(); ++iter)
+	{
+		(*iter)->redraw(view, region);
+	}
+}
+
+void
+xpcc::gui::Widget::markDirty(const xpcc::glcd::Point& upperLeft, const Dimension& dimension)
+{
+	const Region region = Region(upperLeft, dimension).intersection(
+			Region(xpcc::glcd::Point(0, 0), this->dimension));
+	if(region.isEmpty())
+		return;
+
+	if(!this->dirty)
+	{
+		this->dirty = true;
+		this->damage = region;
+	}
+	else if(!this->damage.isEmpty())
+	{
+		/* an empty damage of a dirty widget already covers everything */
+		this->damage = this->damage.merge(region);
+	}
+}
+
 void
 xpcc::gui::Widget::updateIntersections(WidgetContainer *widgets)
 {
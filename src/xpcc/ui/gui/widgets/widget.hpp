@@ -46,6 +46,7 @@ public:
 		position(xpcc::glcd::Point(-10,-10)),
 		relative_position(xpcc::glcd::Point(-10,-10)),
 		dirty(true),
+		damage(),
 		is_interactive(is_interactive),
 		font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8))
 	{
@@ -64,24 +65,22 @@ public:
 
 	/**
 	 * Interface for drawing widgets. Basically calls render(), but has some
-	 * logic that needs to be executed before and after rendering a widget
+	 * logic that needs to be executed before and after rendering a widget.
+	 *
+	 * Only the damaged region is redrawn, see markDirty(). The widgets on
+	 * top are redrawn where they intersect with it.
 	 */
-	void
-	draw(View *view)
-	{
-		// render widget on screen
-		this->render(view);
-		this->markDrawn();
+	virtual void
+	draw(View *view);
 
-		// if there are widgets on top, redraw them
-		if(this->hasIntersections())
-		{
-			for(auto iter = this->intersecting_widgets.begin(); iter != this->intersecting_widgets.end(); ++iter)
-			{
-				(*iter)->draw(view);
-			}
-		}
-	}
+	/**
+	 * Render the part of the widget inside \p region (absolute
+	 * coordinates) again, e.g. because a widget below was drawn over it.
+	 * The display is clipped to the region, so render() can draw the
+	 * whole widget.
+	 */
+	virtual void
+	redraw(View *view, const Region& region);
 
 	/**
 	 * Handles InputEvents and calls activate/deactivate if event coordinates
@@ -114,7 +113,7 @@ public:
 	activate(const InputEvent& ev, void* data)
 	{
 		this->activated = true;
-		this->dirty = true;
+		this->markDirty();
 
 		// call callback when set
 		if(cb_activate != NULL)
@@ -126,7 +125,7 @@ public:
 	deactivate(const InputEvent& ev, void* data)
 	{
 		this->activated = false;
-		this->dirty = true;
+		this->markDirty();
 
 		// call callback when set
 		if(cb_deactivate != NULL)
@@ -235,6 +234,29 @@ public:
 		return this->dimension.height;
 	}
 
+	/// Area of the widget on screen
+	inline Region
+	getRegion()
+	{
+		return Region(this->position, this->dimension);
+	}
+
+	/**
+	 * Area on screen that needs to be redrawn, empty if the widget is not
+	 * dirty.
+	 */
+	virtual Region
+	getDamage()
+	{
+		if(!this->dirty)
+			return Region();
+
+		if(this->damage.isEmpty())
+			return this->getRegion();
+
+		return this->damage.translated(this->position);
+	}
+
 	/// Whether widget needs to be redrawn or not.
 	virtual bool
 	isDirty()
@@ -254,6 +276,7 @@ public:
 	markDrawn()
 	{
 		this->dirty = false;
+		this->damage = Region();
 	}
 
 	/// Mark widget, that it needs to be redrawn.
@@ -261,8 +284,18 @@ public:
 	markDirty()
 	{
 		this->dirty = true;
+		this->damage = Region();
 	}
 
+	/**
+	 * Mark only a part of the widget, that it needs to be redrawn. Several
+	 * parts are merged into the smallest region containing all of them.
+	 *
+	 * @param	upperLeft	relative to the position of the widget
+	 */
+	void
+	markDirty(const xpcc::glcd::Point& upperLeft, const Dimension& dimension);
+
 	/// Set widget-specific font. Use xpcc::font::FontName as argument.
 	virtual void
 	setFont(const uint8_t *newFont)
@@ -316,6 +349,10 @@ public:
 	/// has changes to be drawed
 	bool dirty;
 
+	/// part that has to be drawn relative to the position, empty for the
+	/// whole widget
+	Region damage;
+
 	/// whether widget will receive events
 	bool is_interactive;
 
@@ -324,6 +361,15 @@ public:
 
 	/// list of widgets that intersect with this widget
 	WidgetContainer intersecting_widgets;
+
+protected:
+	/// render() clipped to \p region and the current clipping window
+	void
+	renderClipped(View* view, const Region& region);
+
+	/// redraw() all widgets on top inside \p region
+	void
+	redrawIntersections(View* view, const Region& region);
 };
 
 /**
@@ -355,6 +401,13 @@ public:
 	void
 	setPosition(const xpcc::glcd::Point& pos);
 
+	/// Draws the dirty child widgets
+	void
+	draw(View* view);
+
+	void
+	redraw(View* view, const Region& region);
+
 	bool
 	isDirty()
 	{
@@ -366,6 +419,18 @@ public:
 		return false;
 	}
 
+	/// Smallest region containing the damage of all child widgets
+	Region
+	getDamage()
+	{
+		Region region;
+		for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
+		{
+			region = region.merge((*iter)->getDamage());
+		}
+		return region;
+	}
+
 	void
 	markDirty()
 	{
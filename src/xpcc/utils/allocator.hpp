@@ -34,6 +34,7 @@
 #include "allocator/dynamic.hpp"
 #include "allocator/static.hpp"
 #include "allocator/block.hpp"
+#include "allocator/traits.hpp"
 
 namespace xpcc
 {
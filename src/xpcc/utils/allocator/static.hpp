@@ -31,6 +31,11 @@
 #ifndef XPCC_ALLOCATOR__STATIC_HPP
 #define XPCC_ALLOCATOR__STATIC_HPP
 
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+
 #include "allocator_base.hpp"
 
 namespace xpcc
@@ -41,20 +46,59 @@ namespace xpcc
 		 * \brief	Static memory allocator
 		 * 
 		 * Allocates a big static block and distributes pieces of it during
-		 * run-time. No reallocation is done when no more pieces are available.
+		 * run-time. No reallocation is done when no more pieces are available,
+		 * allocate() returns a null pointer instead.
+		 * 
+		 * The block contains \p N slots of the size of \p T. Which slots
+		 * are in use is stored in a two-level bitmap (one bit per slot and
+		 * one bit per 32 slots), so a single slot is found in constant time
+		 * with two count-trailing-zeros operations. This is the case for all
+		 * node based containers like LinkedList and DoublyLinkedList.
+		 * Contiguous blocks of multiple slots (as used by DynamicArray) are
+		 * searched first-fit. Memory overhead is two bits per slot.
+		 * 
+		 * The pool is a static variable: all allocators with the same
+		 * template arguments share it, copying an allocator is free and
+		 * no memory is needed on the stack. As a rebind creates a different
+		 * type, a list of \c T uses a separate pool for its nodes.
+		 * The pool lives in the \c .bss section and is valid before any
+		 * constructor is called.
+		 * 
+		 * \code
+		 * // at most 16 pending entries, no heap
+		 * xpcc::LinkedList<Entry, xpcc::allocator::Static<Entry, 16> > list;
+		 * 
+		 * if (!list.append(entry)) {
+		 *     // pool exhausted
+		 * }
+		 * 
+		 * // maximum number of entries used so far
+		 * std::size_t peak = list.getAllocator().getPeak();
+		 * \endcode
+		 * 
+		 * A DynamicArray needs the old and the new buffer at the same time
+		 * while growing. Reserve the capacity once after construction
+		 * to use the full pool.
+		 * 
+		 * \tparam	T			Type of the allocated objects
+		 * \tparam	N			Number of objects in the pool
+		 * \tparam	IsrSafe		Disable interrupts with xpcc::atomic::Lock
+		 * 						while modifying the pool, needed if the
+		 * 						same pool is used from interrupt context.
 		 * 
 		 * \ingroup	allocator
 		 * \author	Fabian Greif
 		 */
 		template <typename T,
-				  std::size_t N>
+				  std::size_t N,
+				  bool IsrSafe = false>
 		class Static : public AllocatorBase<T>
 		{
 		public:
 			template <typename U>
 			struct rebind
 			{
-				typedef Static<U, N> other;
+				typedef Static<U, N, IsrSafe> other;
 			};
 			
 		public:
@@ -69,22 +113,116 @@ namespace xpcc
 			}
 			
 			template <typename U>
-			Static(const Static<U, N>&) :
+			Static(const Static<U, N, IsrSafe>&) :
 				AllocatorBase<T>()
 			{
 			}
 			
-			// TODO
+			/**
+			 * \brief	Allocate \p n contiguous objects
+			 * 
+			 * \return	Pointer to uninitialized memory, or a null pointer if
+			 * 			\p n is zero or the pool has no \p n contiguous
+			 * 			free slots.
+			 */
 			T*
-			allocate(std::size_t other);
+			allocate(std::size_t n);
 			
+			/// Return memory obtained by allocate(), ignores null pointers
 			void
-			deallocate(T*);
+			deallocate(T* p);
+			
+			/// Number of objects in the pool
+			static constexpr std::size_t
+			getCapacity()
+			{
+				return N;
+			}
+			
+			/// Number of objects currently allocated
+			std::size_t
+			getUsed() const
+			{
+				return pool.used;
+			}
+			
+			/// Maximum number of objects allocated at the same time
+			std::size_t
+			getPeak() const
+			{
+				return pool.peak;
+			}
+			
+			/// Number of calls of allocate() which returned a null pointer
+			std::size_t
+			getFailed() const
+			{
+				return pool.failed;
+			}
+			
+			/// Sets the peak to the current usage and clears the failures
+			void
+			resetStatistics();
 			
 		private:
-			T memory[N];
+			static constexpr std::size_t Words = (N + 31) / 32;
+			static constexpr std::size_t SummaryWords = (Words + 31) / 32;
+			
+			// uninitialized memory for one object
+			struct Slot
+			{
+				alignas(T) uint8_t data[sizeof(T)];
+			};
+			
+			struct NoLock
+			{
+			};
+			
+			typedef typename ::xpcc::tmp::Select<IsrSafe,
+					::xpcc::atomic::Lock, NoLock>::Result Lock;
+			
+			// Plain aggregate without constructor, zero initialized means
+			// that all slots are free.
+			struct Pool
+			{
+				Slot memory[N];
+				
+				/// Bit set if the slot is in use
+				uint32_t allocated[Words];
+				
+				/// Bit set for the last slot of every allocated block
+				uint32_t last[Words];
+				
+				/// Bit set if all slots of the corresponding word are in use
+				uint32_t full[SummaryWords];
+				
+				std::size_t used;
+				std::size_t peak;
+				std::size_t failed;
+			};
+			
+			/// Bits of a word which belong to existing slots
+			static constexpr uint32_t
+			getValidMask(std::size_t word)
+			{
+				return ((word == (Words - 1)) && (N % 32)) ?
+						((uint32_t(1) << (N % 32)) - 1) : 0xffffffff;
+			}
+			
+			static std::size_t
+			findSlot();
+			
+			static std::size_t
+			findBlock(std::size_t n);
+			
+			static void
+			updateSummary(std::size_t word);
+			
+			static Pool pool;
 		};
 	}
 }
 
+#include "static_impl.hpp"
+
 #endif // XPCC_ALLOCATOR__STATIC_HPP
@@ -0,0 +1,159 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_ALLOCATOR__STATIC_HPP
+	#error	"Don't include this file directly, use 'static.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N, bool IsrSafe>
+typename xpcc::allocator::Static<T, N, IsrSafe>::Pool
+xpcc::allocator::Static<T, N, IsrSafe>::pool;
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N, bool IsrSafe>
+T*
+xpcc::allocator::Static<T, N, IsrSafe>::allocate(std::size_t n)
+{
+	if (n == 0) {
+		return nullptr;
+	}
+
+	Lock lock;
+	(void) lock;
+
+	const std::size_t index = (n == 1) ? findSlot() : findBlock(n);
+	if (index >= N) {
+		pool.failed++;
+		return nullptr;
+	}
+
+	const std::size_t end = index + n - 1;
+	for (std::size_t i = index; i <= end; ++i) {
+		pool.allocated[i / 32] |= uint32_t(1) << (i % 32);
+	}
+	pool.last[end / 32] |= uint32_t(1) << (end % 32);
+
+	for (std::size_t word = index / 32; word <= end / 32; ++word) {
+		updateSummary(word);
+	}
+
+	pool.used += n;
+	if (pool.used > pool.peak) {
+		pool.peak = pool.used;
+	}
+
+	return reinterpret_cast<T*>(&pool.memory[index]);
+}
+
+template <typename T, std::size_t N, bool IsrSafe>
+void
+xpcc::allocator::Static<T, N, IsrSafe>::deallocate(T* p)
+{
+	if (p == nullptr) {
+		return;
+	}
+
+	Lock lock;
+	(void) lock;
+
+	const std::size_t first = reinterpret_cast<Slot*>(p) - pool.memory;
+
+	// free slots until the end of the block is found
+	std::size_t index = first;
+	bool isLast;
+	do {
+		const uint32_t mask = uint32_t(1) << (index % 32);
+		isLast = (pool.last[index / 32] & mask);
+		pool.last[index / 32] &= ~mask;
+		pool.allocated[index / 32] &= ~mask;
+		index++;
+	} while (!isLast);
+
+	for (std::size_t word = first / 32; word <= (index - 1) / 32; ++word) {
+		updateSummary(word);
+	}
+
+	pool.used -= index - first;
+}
+
+template <typename T, std::size_t N, bool IsrSafe>
+void
+xpcc::allocator::Static<T, N, IsrSafe>::resetStatistics()
+{
+	Lock lock;
+	(void) lock;
+
+	pool.peak = pool.used;
+	pool.failed = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N, bool IsrSafe>
+std::size_t
+xpcc::allocator::Static<T, N, IsrSafe>::findSlot()
+{
+	for (std::size_t s = 0; s < SummaryWords; ++s)
+	{
+		uint32_t available = ~pool.full[s];
+		if ((s == (SummaryWords - 1)) && (Words % 32)) {
+			available &= (uint32_t(1) << (Words % 32)) - 1;
+		}
+
+		if (available != 0)
+		{
+			// the summary guarantees a free slot inside of this word
+			const std::size_t word = s * 32 + __builtin_ctzl(available);
+			const uint32_t slots = ~pool.allocated[word] & getValidMask(word);
+			return word * 32 + __builtin_ctzl(slots);
+		}
+	}
+	return N;
+}
+
+template <typename T, std::size_t N, bool IsrSafe>
+std::size_t
+xpcc::allocator::Static<T, N, IsrSafe>::findBlock(std::size_t n)
+{
+	std::size_t length = 0;
+	std::size_t i = 0;
+	while (i < N)
+	{
+		const std::size_t word = i / 32;
+		if (((i % 32) == 0) && (pool.full[word / 32] & (uint32_t(1) << (word % 32))))
+		{
+			// skip words without free slots
+			length = 0;
+			i += 32;
+			continue;
+		}
+
+		if (pool.allocated[word] & (uint32_t(1) << (i % 32))) {
+			length = 0;
+		}
+		else if (++length == n) {
+			return i + 1 - n;
+		}
+		i++;
+	}
+	return N;
+}
+
+template <typename T, std::size_t N, bool IsrSafe>
+void
+xpcc::allocator::Static<T, N, IsrSafe>::updateSummary(std::size_t word)
+{
+	const uint32_t mask = uint32_t(1) << (word % 32);
+	if ((pool.allocated[word] | ~getValidMask(word)) == 0xffffffff) {
+		pool.full[word / 32] |= mask;
+	}
+	else {
+		pool.full[word / 32] &= ~mask;
+	}
+}
@@ -0,0 +1,263 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/utils/allocator.hpp>
+#include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/doubly_linked_list.hpp>
+#include <xpcc/container/dynamic_array.hpp>
+
+#include "static_allocator_test.hpp"
+
+// Every test uses different template arguments, all allocators with the same
+// arguments share one pool.
+
+void
+StaticAllocatorTest::testAllocateSingle()
+{
+	xpcc::allocator::Static<uint32_t, 40> allocator;
+	TEST_ASSERT_EQUALS(allocator.getCapacity(), 40U);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 0U);
+
+	uint32_t* p[40];
+	for (uint_fast8_t i = 0; i < 40; ++i)
+	{
+		p[i] = allocator.allocate(1);
+		TEST_ASSERT_TRUE(p[i] != nullptr);
+
+		// lowest free slot first
+		TEST_ASSERT_TRUE(p[i] == p[0] + i);
+	}
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 40U);
+	TEST_ASSERT_EQUALS(allocator.getFailed(), 0U);
+
+	TEST_ASSERT_TRUE(allocator.allocate(1) == nullptr);
+	TEST_ASSERT_EQUALS(allocator.getFailed(), 1U);
+
+	// freed slots are reused
+	allocator.deallocate(p[35]);
+	allocator.deallocate(p[5]);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 38U);
+	TEST_ASSERT_TRUE(allocator.allocate(1) == p[5]);
+	TEST_ASSERT_TRUE(allocator.allocate(1) == p[35]);
+
+	// all copies share the pool
+	xpcc::allocator::Static<uint32_t, 40> copy(allocator);
+	TEST_ASSERT_EQUALS(copy.getUsed(), 40U);
+
+	for (uint_fast8_t i = 0; i < 40; ++i) {
+		copy.deallocate(p[i]);
+	}
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 0U);
+	TEST_ASSERT_EQUALS(allocator.getPeak(), 40U);
+
+	allocator.resetStatistics();
+	TEST_ASSERT_EQUALS(allocator.getPeak(), 0U);
+	TEST_ASSERT_EQUALS(allocator.getFailed(), 0U);
+}
+
+void
+StaticAllocatorTest::testAllocateBlock()
+{
+	xpcc::allocator::Static<uint16_t, 70> allocator;
+
+	uint16_t* a = allocator.allocate(3);
+	uint16_t* b = allocator.allocate(1);
+	uint16_t* c = allocator.allocate(40);
+	TEST_ASSERT_TRUE(a != nullptr);
+	TEST_ASSERT_TRUE(b == a + 3);
+	TEST_ASSERT_TRUE(c == a + 4);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 44U);
+
+	// does not fit into the remaining 26 slots
+	TEST_ASSERT_TRUE(allocator.allocate(27) == nullptr);
+	TEST_ASSERT_EQUALS(allocator.getFailed(), 1U);
+
+	// first fit
+	allocator.deallocate(a);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 41U);
+	uint16_t* d = allocator.allocate(2);
+	uint16_t* e = allocator.allocate(2);
+	TEST_ASSERT_TRUE(d == a);
+	TEST_ASSERT_TRUE(e == a + 44);
+
+	// block is freed completely
+	allocator.deallocate(c);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 5U);
+	uint16_t* f = allocator.allocate(60);
+	TEST_ASSERT_TRUE(f == nullptr);
+	f = allocator.allocate(40);
+	TEST_ASSERT_TRUE(f == a + 4);
+
+	allocator.deallocate(b);
+	allocator.deallocate(d);
+	allocator.deallocate(e);
+	allocator.deallocate(f);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 0U);
+	TEST_ASSERT_TRUE(allocator.allocate(70) == a);
+	allocator.deallocate(a);
+
+	// zero sized requests are no failures
+	TEST_ASSERT_TRUE(allocator.allocate(0) == nullptr);
+	TEST_ASSERT_EQUALS(allocator.getFailed(), 2U);
+	TEST_ASSERT_EQUALS(allocator.getPeak(), 70U);
+}
+
+void
+StaticAllocatorTest::testDeallocateNull()
+{
+	xpcc::allocator::Static<uint8_t, 3> allocator;
+
+	allocator.deallocate(nullptr);
+	TEST_ASSERT_EQUALS(allocator.getUsed(), 0U);
+	TEST_ASSERT_TRUE(allocator.allocate(3) != nullptr);
+}
+
+void
+StaticAllocatorTest::testLinkedList()
+{
+	typedef xpcc::LinkedList<int16_t, xpcc::allocator::Static<int16_t, 4> > List;
+	{
+		List list;
+		TEST_ASSERT_TRUE(list.append(1));
+		TEST_ASSERT_TRUE(list.append(2));
+		TEST_ASSERT_TRUE(list.prepend(0));
+		TEST_ASSERT_TRUE(list.append(3));
+
+		TEST_ASSERT_FALSE(list.append(4));
+		TEST_ASSERT_FALSE(list.prepend(-1));
+		TEST_ASSERT_EQUALS(list.getSize(), 4U);
+		TEST_ASSERT_EQUALS(list.getFront(), 0);
+		TEST_ASSERT_EQUALS(list.getBack(), 3);
+		TEST_ASSERT_EQUALS(list.getAllocator().getUsed(), 4U);
+		TEST_ASSERT_EQUALS(list.getAllocator().getFailed(), 2U);
+
+		list.removeFront();
+		TEST_ASSERT_TRUE(list.append(4));
+		TEST_ASSERT_EQUALS(list.getFront(), 1);
+		TEST_ASSERT_EQUALS(list.getBack(), 4);
+	}
+
+	// the destructor returned all nodes
+	List list;
+	TEST_ASSERT_EQUALS(list.getAllocator().getUsed(), 0U);
+	TEST_ASSERT_EQUALS(list.getAllocator().getPeak(), 4U);
+}
+
+void
+StaticAllocatorTest::testDoublyLinkedList()
+{
+	xpcc::DoublyLinkedList<int16_t, xpcc::allocator::Static<int16_t, 3> > list;
+
+	TEST_ASSERT_TRUE(list.append(1));
+	TEST_ASSERT_TRUE(list.prepend(0));
+	TEST_ASSERT_TRUE(list.append(2));
+	TEST_ASSERT_FALSE(list.append(3));
+	TEST_ASSERT_FALSE(list.prepend(-1));
+	TEST_ASSERT_EQUALS(list.getFront(), 0);
+	TEST_ASSERT_EQUALS(list.getBack(), 2);
+
+	list.removeBack();
+	TEST_ASSERT_TRUE(list.prepend(-1));
+	TEST_ASSERT_EQUALS(list.getFront(), -1);
+	TEST_ASSERT_EQUALS(list.getBack(), 1);
+	TEST_ASSERT_EQUALS(list.getAllocator().getUsed(), 3U);
+}
+
+void
+StaticAllocatorTest::testDynamicArray()
+{
+	xpcc::DynamicArray<int32_t, xpcc::allocator::Static<int32_t, 10> > array(10);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 10U);
+
+	for (int32_t i = 0; i < 10; ++i) {
+		TEST_ASSERT_TRUE(array.append(i));
+	}
+	TEST_ASSERT_FALSE(array.append(10));
+	TEST_ASSERT_EQUALS(array.getSize(), 10U);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 10U);
+	TEST_ASSERT_EQUALS(array[9], 9);
+
+	array.clear();
+	TEST_ASSERT_EQUALS(array.getAllocator().getUsed(), 0U);
+
+	// growing needs the old and the new buffer at the same time, the
+	// capacities 1, 2, 3 and 5 do not fit into 10 slots
+	for (int32_t i = 0; i < 3; ++i) {
+		TEST_ASSERT_TRUE(array.append(i));
+	}
+	TEST_ASSERT_FALSE(array.append(3));
+	TEST_ASSERT_EQUALS(array.getSize(), 3U);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 3U);
+	TEST_ASSERT_EQUALS(array[2], 2);
+}
+
+void
+StaticAllocatorTest::testDynamicArrayExhausted()
+{
+	typedef xpcc::DynamicArray<int16_t, xpcc::allocator::Static<int16_t, 4> > Array;
+
+	// the constructors leave the array empty when the pool is too small
+	Array sized(8);
+	TEST_ASSERT_EQUALS(sized.getCapacity(), 0U);
+	TEST_ASSERT_TRUE(sized.append(1));
+	TEST_ASSERT_EQUALS(sized.getSize(), 1U);
+	TEST_ASSERT_EQUALS(sized[0], 1);
+	sized.clear();
+
+	Array filled(8, 3);
+	TEST_ASSERT_EQUALS(filled.getSize(), 0U);
+	TEST_ASSERT_EQUALS(filled.getCapacity(), 0U);
+
+	Array list { 1, 2, 3, 4, 5 };
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+	TEST_ASSERT_EQUALS(list.getCapacity(), 0U);
+
+	// reserve() fails without changing the array
+	Array array { 1, 2 };
+	TEST_ASSERT_FALSE(array.reserve(3));
+	TEST_ASSERT_EQUALS(array.getSize(), 2U);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 2U);
+	TEST_ASSERT_TRUE(array.reserve(0));
+
+	// copies need a second buffer
+	Array copy(array);
+	TEST_ASSERT_EQUALS(copy.getSize(), 2U);
+	TEST_ASSERT_EQUALS(copy[1], 2);
+
+	Array failed(array);
+	TEST_ASSERT_EQUALS(failed.getSize(), 0U);
+	TEST_ASSERT_EQUALS(failed.getCapacity(), 0U);
+
+	failed = copy;
+	TEST_ASSERT_EQUALS(failed.getSize(), 0U);
+	TEST_ASSERT_EQUALS(failed.getCapacity(), 0U);
+
+	copy.clear();
+	failed = array;
+	TEST_ASSERT_EQUALS(failed.getSize(), 2U);
+	TEST_ASSERT_EQUALS(failed[0], 1);
+	TEST_ASSERT_EQUALS(failed.getAllocator().getUsed(), 4U);
+
+	// self assignment keeps the values
+	array = array;
+	TEST_ASSERT_EQUALS(array.getSize(), 2U);
+	TEST_ASSERT_EQUALS(array[1], 2);
+}
+
+void
+StaticAllocatorTest::testIsrSafe()
+{
+	xpcc::LinkedList<uint8_t, xpcc::allocator::Static<uint8_t, 2, true> > list;
+
+	TEST_ASSERT_TRUE(list.append(1));
+	TEST_ASSERT_TRUE(list.append(2));
+	TEST_ASSERT_FALSE(list.append(3));
+	list.removeAll();
+	TEST_ASSERT_EQUALS(list.getAllocator().getUsed(), 0U);
+}
@@ -0,0 +1,38 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class StaticAllocatorTest : public unittest::TestSuite
+{
+public:
+	void
+	testAllocateSingle();
+
+	void
+	testAllocateBlock();
+
+	void
+	testDeallocateNull();
+
+	void
+	testLinkedList();
+
+	void
+	testDoublyLinkedList();
+
+	void
+	testDynamicArray();
+
+	void
+	testDynamicArrayExhausted();
+
+	void
+	testIsrSafe();
+};
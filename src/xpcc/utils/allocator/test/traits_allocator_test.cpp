@@ -0,0 +1,180 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/utils/allocator.hpp>
+#include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/dynamic_array.hpp>
+#include <xpcc/container/smart_pointer.hpp>
+#include <xpcc/architecture/platform/driver/core/generic/heap.hpp>
+
+#include "traits_allocator_test.hpp"
+
+using xpcc::hosted::Heap;
+
+void
+TraitsAllocatorTest::setUp()
+{
+	Heap::addRegion(xpcc::MemoryDMA | xpcc::MemoryTrait::AccessDBus, 4096);
+	Heap::addRegion(xpcc::MemoryFastData, 1024);
+	Heap::addRegion(xpcc::MemoryExternal | xpcc::MemoryTrait::AccessDMA, 16384);
+}
+
+void
+TraitsAllocatorTest::tearDown()
+{
+	Heap::removeRegions();
+}
+
+void
+TraitsAllocatorTest::testRegionSelection()
+{
+	TEST_ASSERT_EQUALS(Heap::getRegionCount(), 3U);
+
+	void *fast = Heap::allocate(100, xpcc::MemoryFastData);
+	TEST_ASSERT_TRUE(fast != nullptr);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(0).used, 0U);
+	TEST_ASSERT_TRUE(Heap::getStatistics(1).used >= 100U);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(2).used, 0U);
+
+	void *external = Heap::allocate(100, xpcc::MemoryExternal);
+	TEST_ASSERT_TRUE(Heap::getStatistics(2).used >= 100U);
+
+	// the first matching region is used
+	void *dma = Heap::allocate(100, xpcc::MemoryDMA);
+	TEST_ASSERT_TRUE(Heap::getStatistics(0).used >= 100U);
+
+	// memory of the system heap is not touched
+	int *system = new int;
+	TEST_ASSERT_FALSE(Heap::free(system));
+	delete system;
+
+	TEST_ASSERT_TRUE(Heap::free(fast));
+	TEST_ASSERT_TRUE(Heap::free(external));
+	TEST_ASSERT_TRUE(Heap::free(dma));
+	for (uint8_t i = 0; i < 3; ++i) {
+		TEST_ASSERT_EQUALS(Heap::getStatistics(i).used, 0U);
+	}
+}
+
+void
+TraitsAllocatorTest::testFallback()
+{
+	// the core-coupled RAM is exhausted, falls back to the internal RAM
+	void *a = Heap::allocate(900, xpcc::MemoryFastData);
+	void *b = Heap::allocate(900, xpcc::MemoryFastData);
+	TEST_ASSERT_TRUE(a != nullptr);
+	TEST_ASSERT_TRUE(b != nullptr);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(1).failed, 1U);
+	TEST_ASSERT_TRUE(Heap::getStatistics(0).used >= 900U);
+
+	// nothing fits anywhere
+	TEST_ASSERT_TRUE(Heap::allocate(20000, xpcc::MemoryExternal) == nullptr);
+
+	// memory of the regions is released with delete
+	::operator delete(a);
+	::operator delete(b);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(0).used, 0U);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(1).used, 0U);
+}
+
+void
+TraitsAllocatorTest::testStatistics()
+{
+	Heap::Statistics statistics = Heap::getStatistics(1);
+	TEST_ASSERT_EQUALS(statistics.size, 1024U);
+	TEST_ASSERT_TRUE(statistics.traits == xpcc::MemoryFastData);
+	TEST_ASSERT_EQUALS(statistics.largestFree, 1024U);
+
+	void *a = Heap::allocate(200, xpcc::MemoryFastData);
+	void *b = Heap::allocate(200, xpcc::MemoryFastData);
+	const std::size_t used = Heap::getStatistics(1).used;
+	Heap::free(a);
+	Heap::free(b);
+
+	statistics = Heap::getStatistics(1);
+	TEST_ASSERT_EQUALS(statistics.used, 0U);
+	TEST_ASSERT_EQUALS(statistics.peak, used);
+	TEST_ASSERT_EQUALS(statistics.failed, 0U);
+	TEST_ASSERT_EQUALS(statistics.largestFree, 1024U);
+	TEST_ASSERT_EQUALS(statistics.getFragmentation(), 0U);
+
+	// invalid region
+	TEST_ASSERT_EQUALS(Heap::getStatistics(5).size, 0U);
+}
+
+void
+TraitsAllocatorTest::testFragmentation()
+{
+	void *blocks[8];
+	for (uint8_t i = 0; i < 8; ++i) {
+		blocks[i] = Heap::allocate(100, xpcc::MemoryFastData);
+	}
+	// free every second block
+	for (uint8_t i = 0; i < 8; i += 2) {
+		Heap::free(blocks[i]);
+	}
+
+	Heap::Statistics statistics = Heap::getStatistics(1);
+	TEST_ASSERT_TRUE(statistics.largestFree < (statistics.size - statistics.used));
+	TEST_ASSERT_TRUE(statistics.getFragmentation() > 50);
+
+	for (uint8_t i = 1; i < 8; i += 2) {
+		Heap::free(blocks[i]);
+	}
+	statistics = Heap::getStatistics(1);
+	TEST_ASSERT_EQUALS(statistics.largestFree, 1024U);
+	TEST_ASSERT_EQUALS(statistics.getFragmentation(), 0U);
+}
+
+void
+TraitsAllocatorTest::testContainers()
+{
+	{
+		xpcc::LinkedList<int32_t,
+				xpcc::allocator::Traits<int32_t, xpcc::MemoryFastData.value> > list;
+		for (int32_t i = 0; i < 10; ++i) {
+			TEST_ASSERT_TRUE(list.append(i));
+		}
+		TEST_ASSERT_EQUALS(list.getBack(), 9);
+		TEST_ASSERT_TRUE(Heap::getStatistics(1).used > 0U);
+		TEST_ASSERT_EQUALS(Heap::getStatistics(2).used, 0U);
+
+		xpcc::DynamicArray<uint16_t,
+				xpcc::allocator::Traits<uint16_t, xpcc::MemoryExternal.value> > array(1000);
+		for (uint16_t i = 0; i < 1000; ++i) {
+			array.append(i);
+		}
+		TEST_ASSERT_EQUALS(array[999], 999);
+		TEST_ASSERT_TRUE(Heap::getStatistics(2).used >= 2000U);
+	}
+
+	// the destructors released everything
+	TEST_ASSERT_EQUALS(Heap::getStatistics(1).used, 0U);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(2).used, 0U);
+}
+
+void
+TraitsAllocatorTest::testSmartPointer()
+{
+	{
+		uint32_t value = 0x12345678;
+		xpcc::SmartPointer pointer(&value, xpcc::MemoryFastData);
+		TEST_ASSERT_TRUE(Heap::getStatistics(1).used > 0U);
+
+		xpcc::SmartPointer copy(pointer);
+		TEST_ASSERT_EQUALS(copy.get<uint32_t>(), 0x12345678U);
+
+		xpcc::SmartPointer buffer(100, xpcc::MemoryExternal);
+		TEST_ASSERT_EQUALS(buffer.getSize(), 100U);
+		TEST_ASSERT_TRUE(Heap::getStatistics(2).used >= 100U);
+	}
+
+	TEST_ASSERT_EQUALS(Heap::getStatistics(1).used, 0U);
+	TEST_ASSERT_EQUALS(Heap::getStatistics(2).used, 0U);
+}
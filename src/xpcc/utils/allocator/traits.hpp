@@ -0,0 +1,105 @@
+// coding: utf-8
+/* Copyright (c) 2018, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_ALLOCATOR__TRAITS_HPP
+#define XPCC_ALLOCATOR__TRAITS_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/interface/memory.hpp>
+
+#include "allocator_base.hpp"
+
+namespace xpcc
+{
+	namespace allocator
+	{
+		/**
+		 * \brief	Dynamic memory allocator for memory with given traits
+		 *
+		 * Like Dynamic, but requests the memory with `new (traits)` from
+		 * the heap of a memory region with the given traits, e.g. the
+		 * core-coupled RAM for often used data or the external SDRAM for
+		 * large buffers. If the region is exhausted the heap falls back
+		 * to other regions, see xpcc::MemoryTraits.
+		 *
+		 * The traits need to be passed as integer, as classes are not
+		 * allowed as template arguments:
+		 * \code
+		 * // list nodes in the core-coupled memory
+		 * xpcc::LinkedList<Entry,
+		 *         xpcc::allocator::Traits<Entry, xpcc::MemoryFastData.value> > list;
+		 *
+		 * // pixel buffer in the external SDRAM
+		 * xpcc::DynamicArray<uint16_t,
+		 *         xpcc::allocator::Traits<uint16_t, xpcc::MemoryExternal.value> > buffer(480 * 272);
+		 * \endcode
+		 *
+		 * The traits are ignored on AVRs. On hosted targets the regions can
+		 * be emulated with xpcc::hosted::Heap.
+		 *
+		 * \tparam	T		Type of the allocated objects
+		 * \tparam	traits	Value of a xpcc::MemoryTraits object
+		 *
+		 * \see		xpcc::MemoryTraits
+		 * \ingroup	allocator
+		 */
+		template <typename T,
+				  uint16_t traits = ::xpcc::MemoryDefault.value>
+		class Traits : public AllocatorBase<T>
+		{
+		public:
+			template <typename U>
+			struct rebind
+			{
+				typedef Traits<U, traits> other;
+			};
+
+		public:
+			Traits() :
+				AllocatorBase<T>()
+			{
+			}
+
+			Traits(const Traits& other) :
+				AllocatorBase<T>(other)
+			{
+			}
+
+			template <typename U>
+			Traits(const Traits<U, traits>&) :
+				AllocatorBase<T>()
+			{
+			}
+
+			T*
+			allocate(std::size_t n)
+			{
+				// allocate the memory without calling the constructor
+				// of the associated data-type.
+				return static_cast<T*>(::operator new(n * sizeof(T),
+						::xpcc::MemoryTraits(traits)));
+			}
+
+			void
+			deallocate(T* p)
+			{
+				// memory of all regions is released with the normal delete
+				::operator delete(p);
+			}
+
+			static constexpr ::xpcc::MemoryTraits
+			getTraits()
+			{
+				return ::xpcc::MemoryTraits(traits);
+			}
+		};
+	}
+}
+
+#endif // XPCC_ALLOCATOR__TRAITS_HPP
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2018, Roboterclub Aachen e.V.
+# All Rights Reserved.
+#
+# The file is part of the xpcc library and is released under the 3-clause BSD
+# license. See the file `LICENSE` for the full license governing this code.
+# -----------------------------------------------------------------------------
+"""
+Run-length encoding of monochrome images and glyphs.
+
+The pixels are encoded row by row, a row continues with the next one. Every
+byte is one of:
+
+- `0vnnnnnn`: run of n+1 pixels (1..64) with the value v
+- `1ddddddd`: the next seven pixels, the first one in bit 6
+
+Pixels after the last one of the image are ignored. This is the format read
+by xpcc::glcd::RunLengthDecoder.
+"""
+
+def encode(pixels):
+	"""
+	Encode a list of pixels (0 or 1) with the fewest possible bytes.
+	"""
+	count = len(pixels)
+
+	# length of the run of equal pixels starting at every pixel
+	run = [1] * (count + 1)
+	for i in range(count - 2, -1, -1):
+		if pixels[i] == pixels[i + 1]:
+			run[i] = run[i + 1] + 1
+
+	# fewest bytes needed from pixel i to the end, and the code starting at
+	# pixel i (0 for seven literal pixels, otherwise the length of the run)
+	cost = [0] * (count + 1)
+	code = [0] * count
+	for i in range(count - 1, -1, -1):
+		cost[i] = cost[min(i + 7, count)] + 1
+		for length in range(1, min(run[i], 64) + 1):
+			if cost[i + length] + 1 < cost[i]:
+				cost[i] = cost[i + length] + 1
+				code[i] = length
+
+	data = []
+	i = 0
+	while i < count:
+		length = code[i]
+		if length:
+			data.append((pixels[i] << 6) | (length - 1))
+			i += length
+		else:
+			byte = 0x80
+			for bit, pixel in enumerate(pixels[i:i + 7]):
+				byte |= pixel << (6 - bit)
+			data.append(byte)
+			i += 7
+	return data
+
+def decode(data, count):
+	"""
+	Reverse of encode(), returns `count` pixels.
+	"""
+	pixels = []
+	for byte in data:
+		if byte & 0x80:
+			pixels += [(byte >> (6 - bit)) & 1 for bit in range(7)]
+		else:
+			pixels += [(byte >> 6) & 1] * ((byte & 0x3f) + 1)
+	return pixels[:count]
+
+def from_pages(data, width, height):
+	"""
+	Pixels row by row from the page layout of the raw images and fonts:
+	columns of eight pixels per byte, the LSB is the topmost pixel.
+	"""
+	return [(data[(y // 8) * width + x] >> (y % 8)) & 1
+			for y in range(height) for x in range(width)]
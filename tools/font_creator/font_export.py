@@ -1,11 +1,15 @@
 #!/usr/bin/env python3
 
 import os
+import sys
 import string
 import re
 import math
 import datetime
 
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), "../bitmap"))
+import run_length
+
 # -----------------------------------------------------------------------------
 template_copyright = """\
 // coding: utf-8
@@ -53,7 +57,7 @@ namespace xpcc
 		FLASH_STORAGE(uint8_t ${array_name}[]) =
 		{
 			${size_low}, ${size_high}, // total size of this array
-			${width},	// width (may vary)
+			${width_byte},	// ${width_comment}
 			${height},	// height
 			${hspace},	// hspace
 			${vspace}, 	// vspace
@@ -63,7 +67,7 @@ namespace xpcc
 			// char widths
 			// for each character the separate width in pixels
 			${char_width}
-			
+			${glyph_offsets}
 			// font data
 			// bit field of all characters
 			${font_data}
@@ -96,7 +100,7 @@ namespace xpcc
 		 * - first char      : ${first}
 		 * - last char       : ${last}
 		 * - number of chars : ${count}
-		 * - size in bytes   : ${size}
+		 * - size in bytes   : ${size}${encoding}
 		 * 
 		 * \\ingroup	font
 		 */
@@ -162,7 +166,7 @@ def read_font_file(filename):
 				if c == " ":
 					pass
 				elif c == "#":
-					y = char_line_index / 8
+					y = char_line_index // 8
 					offset = y * char.width
 					char.data[offset + index] |= 1 << (char_line_index % 8)
 				else:
@@ -227,12 +231,14 @@ def read_font_file(filename):
 # -----------------------------------------------------------------------------
 if __name__ == '__main__':
 	try:
-		filename = os.sys.argv[1]
+		arguments = [a for a in os.sys.argv[1:] if a != "--rle"]
+		encoded = "--rle" in os.sys.argv
+		filename = arguments[0]
 		if not filename.endswith('.font'):
 			raise
-		outfile = os.sys.argv[2]
+		outfile = arguments[1]
 	except:
-		print("usage: %s *.font outfile" % os.sys.argv[0])
+		print("usage: %s [--rle] *.font outfile" % os.sys.argv[0])
 		exit(1)
 	
 	try:
@@ -246,10 +252,21 @@ if __name__ == '__main__':
 	char_width_line = ""
 	char_line_count = 0
 	font_data = []
+	glyph_offsets = []
+	raw_size = 8 + len(font.chars) + sum([len(char.data) for char in font.chars])
 	
 	# 8 byte header, width table
 	size = 8 + len(font.chars)
+	if encoded:
+		# table with the offset of every glyph
+		size += 2 * len(font.chars)
+	offset = 0
 	for char in font.chars:
+		if encoded:
+			char.data = run_length.encode(
+					run_length.from_pages(char.data, char.width, char.height))
+			glyph_offsets.append("0x%02X, 0x%02X, // %i" % (offset & 0xff, offset >> 8, char.index))
+			offset += len(char.data)
 		size += len(char.data)
 		
 		char_width_line += "%2i, " % char.width
@@ -279,6 +296,10 @@ if __name__ == '__main__':
 			preferred_width = key
 			max = value
 	
+	if size > 0xffff:
+		print("Error: font is too large (%i bytes)" % size)
+		exit(1)
+	
 	substitutions = {
 		'copyright': template_copyright,
 		'font_name': font.name,
@@ -287,6 +308,10 @@ if __name__ == '__main__':
 		'size_low': "0x%02X" % (size & 0xff),
 		'size_high': "0x%02X" % (size >> 8),
 		'width': preferred_width,
+		# a width of zero marks the run-length encoded fonts
+		'width_byte': 0 if encoded else max(preferred_width, 1),
+		'width_comment': "run-length encoded" if encoded else "width (may vary)",
+		'encoding': (" (run-length encoded, %i raw)" % raw_size) if encoded else "",
 		'width_string': "fixed width    " if (len(width_histogram) == 1) else "preferred width",
 		'height': font.height,
 		'hspace': font.hspace,
@@ -295,6 +320,8 @@ if __name__ == '__main__':
 		'last': font.first_char + len(font.chars),
 		'count': len(font.chars),
 		'char_width': "\n\t\t\t".join(char_width),
+		'glyph_offsets': ("\n\t\t\t// offset of every glyph in the font data (little endian)\n\t\t\t" +
+				"\n\t\t\t".join(glyph_offsets) + "\n\t\t\t") if encoded else "",
 		'font_data': "\n\t\t\t".join(font_data),
 		'include_guard': "XPCC_FONT__" + os.path.basename(outfile).upper().replace(" ", "_") + "_HPP"
 	}